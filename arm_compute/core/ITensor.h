@@ -90,6 +90,8 @@ public:
     bool is_used() const;
     /** Marks a tensor as unused */
     void mark_as_unused() const;
+    /** Marks a tensor as used again, e.g. when new functions have to be prepared from it */
+    void mark_as_used() const;
 
 private:
     mutable bool _is_used = { true }; /**< Flag that marks if the tensor is used or not */
@@ -32,15 +32,33 @@ namespace arm_compute
 /** Descriptor for FFT scale kernels */
 struct FFTScaleKernelInfo
 {
-    float scale{ 0.f };      /**< Axis to perform the kernel on. */
-    bool  conjugate{ true }; /**< Flag to conjugate the output/ */
+    float scale{ 0.f };                /**< Axis to perform the kernel on. */
+    bool  conjugate{ true };           /**< Flag to conjugate the output/ */
+    bool  packed_real_output{ false }; /**< Flag to write the real and imaginary parts of each element as two consecutive elements of a real output */
 };
 
 /** Descriptor for FFT digit reverse kernels */
 struct FFTDigitReverseKernelInfo
+{
+    unsigned int axis{ 0 };                  /**< Axis to perform the kernel on. */
+    bool         conjugate{ false };         /**< Flag to conjugate the output/ */
+    bool         packed_real_input{ false }; /**< Flag to read pairs of consecutive elements of a real input as complex elements. Only supported on axis 0 */
+};
+
+/** Descriptor for FFT real transform kernels */
+struct FFTRealTransformKernelInfo
+{
+    bool inverse{ false }; /**< Flag to rebuild the packed spectrum of an inverse transform rather than to split the one of a forward transform */
+    bool is_odd{ false };  /**< Flag to convert between the non-redundant bins and the full spectrum of a real signal of odd length, which cannot be packed */
+};
+
+/** Descriptor for FFT chirp kernels */
+struct FFTChirpKernelInfo
 {
     unsigned int axis{ 0 };          /**< Axis to perform the kernel on. */
-    bool         conjugate{ false }; /**< Flag to conjugate the output/ */
+    unsigned int length{ 0 };        /**< Length N of the FFT the chirp e^(-i * pi * n^2 / N) belongs to. */
+    bool         conjugate{ false }; /**< Flag to multiply by the conjugate chirp e^(i * pi * n^2 / N). */
+    float        scale{ 1.f };       /**< Value the chirp is divided by. */
 };
 
 /** Descriptor used by the FFT core kernels */
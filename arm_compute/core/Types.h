@@ -1608,6 +1608,8 @@ struct FullyConnectedLayerInfo
     bool                are_weights_reshaped{ false };              /**<  Reshape the weights tensor if false. */
     bool                retain_internal_weights{ false };           /**<  Retain internal reshaped weights. */
     bool                fp_mixed_precision{ false };                /**<  Use wider accumulators (32 bit instead of 16 for FP16) to improve accuracy. */
+    bool                enable_dynamic_quantization{ false };       /**<  Quantize F32 input and weights to 8 bit at run time and use an integer matrix multiplication. */
+    bool                sparse_weights{ false };                    /**<  Compress the weights and use a block-sparse matrix multiplication. */
     ActivationLayerInfo activation_info{};                          /**<  Fused activation to apply after the matrix multiplication. */
 
     /** Sets the weights trained data layout
@@ -1632,6 +1634,28 @@ struct FullyConnectedLayerInfo
         transpose_weights = should_transpose_weights;
         return *this;
     }
+    /** Sets the dynamic quantization flag
+     *
+     * @param[in] enable Boolean flag indicating if F32 input and weights should be quantized at run time
+     *
+     * @return Updated object
+     */
+    FullyConnectedLayerInfo &set_enable_dynamic_quantization(bool enable)
+    {
+        enable_dynamic_quantization = enable;
+        return *this;
+    }
+    /** Sets the sparse weights flag
+     *
+     * @param[in] sparse Boolean flag indicating if the weights contain many zeros
+     *
+     * @return Updated object
+     */
+    FullyConnectedLayerInfo &set_sparse_weights(bool sparse)
+    {
+        sparse_weights = sparse;
+        return *this;
+    }
 };
 
 /** Normalization Layer Information class */
@@ -1758,7 +1782,7 @@ class WeightsInfo
 public:
     /** Default constructor */
     WeightsInfo()
-        : _are_reshaped(false), _kernel_width(0), _kernel_height(0), _num_kernels(0), _retain_internal_weights(false)
+        : _are_reshaped(false), _kernel_width(0), _kernel_height(0), _num_kernels(0), _retain_internal_weights(false), _sparse_weights(false)
     {
     }
     /** Constructor
@@ -1768,9 +1792,11 @@ public:
      * @param[in] kernel_height           Kernel height.
      * @param[in] num_kernels             Number of convolution kernels.
      * @param[in] retain_internal_weights (Optional) True if internal reshaped weights must be retained. Used for reconfiguration purposes. Default is false.
+     * @param[in] sparse_weights          (Optional) True if the weights contain many zeros and a block-sparse matrix multiplication should be used. Default is false.
      */
-    WeightsInfo(bool are_reshaped, unsigned int kernel_width, unsigned int kernel_height, unsigned int num_kernels, bool retain_internal_weights = false)
-        : _are_reshaped(are_reshaped), _kernel_width(kernel_width), _kernel_height(kernel_height), _num_kernels(num_kernels), _retain_internal_weights(retain_internal_weights)
+    WeightsInfo(bool are_reshaped, unsigned int kernel_width, unsigned int kernel_height, unsigned int num_kernels, bool retain_internal_weights = false, bool sparse_weights = false)
+        : _are_reshaped(are_reshaped), _kernel_width(kernel_width), _kernel_height(kernel_height), _num_kernels(num_kernels), _retain_internal_weights(retain_internal_weights),
+          _sparse_weights(sparse_weights)
     {
     }
     /** Flag which specifies if the weights tensor has been reshaped.
@@ -1801,6 +1827,14 @@ public:
     {
         return _retain_internal_weights;
     }
+    /** Flag which specifies if the weights are sparse
+     *
+     * @return True if the weights should be compressed and multiplied with a block-sparse matrix multiplication
+     */
+    bool sparse_weights() const
+    {
+        return _sparse_weights;
+    }
 
 private:
     bool         _are_reshaped;
@@ -1808,6 +1842,7 @@ private:
     unsigned int _kernel_height;
     unsigned int _num_kernels;
     bool         _retain_internal_weights;
+    bool         _sparse_weights;
 };
 
 /** GEMM reshape information class. This class stores the necessary information about matrix A and matrix B reshape.
@@ -2006,7 +2041,9 @@ public:
           _fp_mixed_precision(false),
           _broadcast_bias(false),
           _pretranpose_B(true),
-          _activation_info()
+          _activation_info(),
+          _sparse_weights(false),
+          _fast_math(false)
     {
     }
     /** Constructor
@@ -2037,7 +2074,9 @@ public:
           _fp_mixed_precision(fp_mixed_precision),
           _broadcast_bias(broadcast_bias),
           _pretranpose_B(reshape_b_only_on_first_run),
-          _activation_info(activation_info)
+          _activation_info(activation_info),
+          _sparse_weights(false),
+          _fast_math(false)
     {
     }
     /** Flag which specifies if the matrix A has been reshaped
@@ -2154,6 +2193,38 @@ public:
     {
         _activation_info = activation_info;
     }
+    /** Flag which specifies if matrix B is sparse and should be compressed before the multiplication
+     *
+     * @return True if matrix B is sparse
+     */
+    bool sparse_weights() const
+    {
+        return _sparse_weights;
+    }
+    /** Set sparse weights flag
+     *
+     * @param[in] flag Flag to set
+     */
+    void set_sparse_weights(bool flag)
+    {
+        _sparse_weights = flag;
+    }
+    /** Flag which specifies if a reduced precision (e.g. bfloat16) matrix multiplication can be used for F32 inputs
+     *
+     * @return True if fast math is enabled
+     */
+    bool fast_math() const
+    {
+        return _fast_math;
+    }
+    /** Set fast math flag
+     *
+     * @param[in] fast_math Flag to set
+     */
+    void set_fast_math(bool fast_math)
+    {
+        _fast_math = fast_math;
+    }
 
 private:
     bool                    _is_a_reshaped;
@@ -2167,6 +2238,8 @@ private:
     bool                    _broadcast_bias;
     bool                    _pretranpose_B;
     ActivationLayerInfo     _activation_info;
+    bool                    _sparse_weights;
+    bool                    _fast_math;
 };
 
 /** Winograd information */
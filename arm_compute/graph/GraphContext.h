@@ -24,6 +24,7 @@
 #ifndef ARM_COMPUTE_GRAPH_GRAPH_CONTEXT_H
 #define ARM_COMPUTE_GRAPH_GRAPH_CONTEXT_H
 
+#include "arm_compute/graph/GraphPlan.h"
 #include "arm_compute/graph/Types.h"
 
 #include "arm_compute/runtime/IMemoryManager.h"
@@ -121,6 +122,11 @@ public:
      * @return Weights manager contexts
      */
     std::map<Target, WeightsManagerContext> &weights_managers();
+    /** Execution plan accessor
+     *
+     * @return Execution plan of the graph, loaded or recorded at finalization
+     */
+    GraphPlan &plan();
     /** Finalizes memory managers in graph context */
     void finalize();
 
@@ -128,6 +134,7 @@ private:
     GraphConfig _config;                                       /**< Graph configuration */
     std::map<Target, MemoryManagerContext>  _memory_managers;  /**< Memory managers for each target */
     std::map<Target, WeightsManagerContext> _weights_managers; /**< Weights managers for each target */
+    GraphPlan                               _plan;             /**< Execution plan of the graph */
 };
 } // namespace graph
 } // namespace arm_compute
@@ -24,10 +24,15 @@
 #ifndef ARM_COMPUTE_GRAPH_GRAPH_MANAGER_H
 #define ARM_COMPUTE_GRAPH_GRAPH_MANAGER_H
 
+#include "arm_compute/graph/GraphContext.h"
+#include "arm_compute/graph/ITensorHandle.h"
 #include "arm_compute/graph/Types.h"
 #include "arm_compute/graph/Workload.h"
 
+#include <list>
 #include <map>
+#include <memory>
+#include <vector>
 
 namespace arm_compute
 {
@@ -35,7 +40,6 @@ namespace graph
 {
 // Forward declaration
 class Graph;
-class GraphContext;
 class PassManager;
 
 /** Graph manager class
@@ -61,6 +65,9 @@ public:
      *          plan is to avoid by copying the graph structure,
      *          or provide another entry-point for this functionality as it will increase the memory requirements
      *
+     * @note If @ref GraphConfig::input_shape_cache_size is greater than 0, @p ctx and @p pm have to outlive the graph:
+     *       the backend passes of @p pm are run again when the inputs are reshaped
+     *
      * @param[in] graph  Graph to finalize
      * @param[in] ctx    Graph context
      * @param[in] pm     Pass manager to use for any optimization passes
@@ -72,6 +79,54 @@ public:
      * @param[in] graph Graph to execute
      */
     void execute_graph(Graph &graph);
+    /** Changes the shapes of the inputs of a finalized graph
+     *
+     * The shapes of the other tensors are inferred again and the nodes are configured for them, with the context given at finalization.
+     * The weights transformed by the functions of the first workload are reused through the weights manager.
+     * The workloads configured for the last shapes are cached, so that going back to them doesn't configure the nodes again.
+     *
+     * @note The graph has to be finalized with @ref GraphConfig::input_shape_cache_size greater than 0
+     * @note Reshape, detection post process and dummy nodes have a fixed output shape, so the shapes of their inputs can't change.
+     *       Such a change is rejected before the current workload is touched.
+     *
+     * @param[in] graph  Graph to reshape
+     * @param[in] shapes New shape of each input, in the order the inputs were added to the graph
+     *
+     * @return a status
+     */
+    Status reshape_graph_inputs(Graph &graph, const std::vector<TensorShape> &shapes);
+    /** Changes the number of batches exchanged through the accessors of a finalized graph
+     *
+     * The nodes stay configured for the batch size they were finalized with, so nothing is configured again.
+     * The valid region of the input and output tensors is limited to their first @p batch_size batches instead:
+     * the batch accessors (e.g. BatchBufferInputAccessor) only fill and read these batches.
+     *
+     * @note The functions still compute every batch the graph was configured with: many of them fold the batches into other dimensions,
+     *       so their execution windows can't be limited to some batches. The latency of an execution is therefore the one of the largest batch.
+     * @note Reshaping the inputs with @ref reshape_graph_inputs resets the number of batches to the one of the new shapes.
+     *
+     * @param[in] graph      Graph to change the batch size of
+     * @param[in] batch_size Number of batches, not greater than the one of the inputs and outputs of the graph
+     *
+     * @return a status
+     */
+    Status set_graph_batch_size(Graph &graph, unsigned int batch_size);
+    /** Prints the execution profile of each node of a graph in CSV format
+     *
+     * @note The graph has to be finalized with @ref GraphConfig::enable_node_profiling set
+     *
+     * @param[in]  graph Graph to print the profile of
+     * @param[out] os    Output stream
+     */
+    void print_profile_csv(Graph &graph, std::ostream &os);
+    /** Prints a graph in dot format, with the execution profile of each node
+     *
+     * @note The graph has to be finalized with @ref GraphConfig::enable_node_profiling set
+     *
+     * @param[in]  graph Graph to print
+     * @param[out] os    Output stream
+     */
+    void print_profile_dot(Graph &graph, std::ostream &os);
     /** Invalidates the graph execution workload
      *
      * @param[in] graph Graph to invalidate
@@ -79,7 +134,54 @@ public:
     void invalidate_graph(Graph &graph);
 
 private:
-    std::map<GraphID, ExecutionWorkload> _workloads = {}; /**< Graph workloads */
+    /** Weights transforms acquired by the functions of a workload through the weights managers */
+    struct TransformUsage
+    {
+        std::vector<ITransformWeights *> owned = {}; /**< Transforms owned by the functions of the workload */
+        std::vector<ITransformWeights *> used  = {}; /**< Transforms owned by the functions of other workloads */
+    };
+    /** Workload configured for other input shapes than the current ones, along with the tensors it uses */
+    struct ShapeWorkload
+    {
+        std::vector<TensorShape>                           input_shapes = {}; /**< Shapes of the inputs */
+        std::unique_ptr<GraphContext>                      ctx          = {}; /**< Context owned by the workload, nullptr for the workload created at finalization */
+        ExecutionWorkload                                  workload     = {}; /**< Configured workload */
+        TransformUsage                                     transforms   = {}; /**< Weights transforms acquired by the workload */
+        std::map<TensorID, TensorDescriptor>               descs        = {}; /**< Descriptors of the non-constant tensors */
+        std::map<TensorID, std::unique_ptr<ITensorHandle>> handles      = {}; /**< Backend handles of the non-constant tensors */
+    };
+    /** Functions of an evicted workload, kept while the other workloads use the weights they transformed */
+    struct RetiredWorkload
+    {
+        std::vector<ITransformWeights *> owned_transforms = {}; /**< Transforms owned by the functions */
+        std::vector<ExecutionTask>       tasks            = {}; /**< Tasks holding the functions */
+    };
+    /** Input reshaping state of a graph */
+    struct ReshapeState
+    {
+        Target                        target            = { Target::UNSPECIFIED }; /**< Target the graph has been finalized for */
+        GraphContext                 *ctx               = { nullptr };             /**< Context given at finalization */
+        PassManager                  *pm                = { nullptr };             /**< Pass manager given at finalization */
+        std::vector<TensorShape>      input_shapes      = {};                      /**< Current shapes of the inputs */
+        std::unique_ptr<GraphContext> active_ctx        = {};                      /**< Context owned by the current workload, nullptr for the workload created at finalization */
+        TransformUsage                active_transforms = {};                      /**< Weights transforms acquired by the current workload, empty for the workload created at finalization */
+        std::list<ShapeWorkload>      cache             = {};                      /**< Cached workloads, most recently used first */
+        std::list<RetiredWorkload>    retired           = {};                      /**< Evicted workloads owning weights transforms still used by other workloads */
+    };
+
+    /** Configures the nodes of a graph whose tensors have been configured, and sets up their memory
+     *
+     * @param[in] graph            Graph to configure
+     * @param[in] ctx              Graph context
+     * @param[in] target           Execution target
+     * @param[in] setup_constants  Allocate the constant tensors and call their accessors
+     *
+     * @return The configured workload
+     */
+    ExecutionWorkload configure_workload(Graph &graph, GraphContext &ctx, Target target, bool setup_constants);
+
+    std::map<GraphID, ReshapeState>      _reshape_states = {}; /**< Input reshaping state of the graphs */
+    std::map<GraphID, ExecutionWorkload> _workloads      = {}; /**< Graph workloads */
 };
 } // namespace graph
 } // namespace arm_compute
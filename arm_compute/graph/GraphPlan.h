@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_GRAPH_GRAPH_PLAN_H
+#define ARM_COMPUTE_GRAPH_GRAPH_PLAN_H
+
+#include "arm_compute/graph/Types.h"
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace arm_compute
+{
+namespace graph
+{
+// Forward declarations
+class Graph;
+
+/** Execution plan of a graph
+ *
+ * Records the results of the finalization of a graph which are costly to compute again,
+ * so that the next finalizations of the same graph reuse them instead of running the heuristics and the folded nodes.
+ * The plan holds:
+ *  - The fingerprint of the graph built by the frontend, along with the target and configuration it was finalized for.
+ *  - The graph IR as mutated by the passes, with the parameters of the nodes, to check that they still give the same graph.
+ *  - The output of each folded constant node, along with the hash of the content of the constants it was computed from.
+ *  - The method the backend selected for each convolution node left to its heuristics.
+ *
+ * @note The constants are still loaded and hashed to check the folded outputs, so folding only saves running the folded nodes.
+ *       The memory offsets of the tensors aren't recorded: the memory managers compute them in a single pass over the lifetimes of the tensors.
+ */
+class GraphPlan final
+{
+public:
+    /** Output of a folded node */
+    struct FoldedConstant
+    {
+        uint64_t             inputs_hash{ 0 }; /**< Hash of the content of the constant inputs of the node */
+        std::vector<uint8_t> data{};           /**< Output of the node */
+    };
+
+    /** Hashes a sequence of bytes
+     *
+     * @param[in] bytes Bytes to hash
+     * @param[in] size  Number of bytes
+     * @param[in] seed  (Optional) Hash to continue from
+     *
+     * @return Hash of the bytes
+     */
+    static uint64_t hash_bytes(const uint8_t *bytes, size_t size, uint64_t seed = 14695981039346656037ULL);
+    /** Computes the fingerprint of a graph
+     *
+     * @param[in] g      Graph, before any mutation
+     * @param[in] target Target the graph is finalized for
+     * @param[in] config Configuration the graph is finalized with
+     *
+     * @return Fingerprint of the graph
+     */
+    static uint64_t fingerprint(const Graph &g, Target target, const GraphConfig &config);
+    /** Describes the nodes of a graph, along with their inputs and output tensors
+     *
+     * @param[in] g Graph to describe
+     *
+     * @return Description of the graph, one node per line
+     */
+    static std::string describe(const Graph &g);
+
+    /** Loads a plan from a file
+     *
+     * @param[in] filename    File to load the plan from
+     * @param[in] fingerprint Fingerprint of the graph the plan has to match
+     *
+     * @return True if the file holds a valid plan for the graph, else false and the plan is reset
+     */
+    bool load(const std::string &filename, uint64_t fingerprint);
+    /** Saves the plan to a file
+     *
+     * @param[in] filename File to save the plan to
+     */
+    void save(const std::string &filename) const;
+    /** Clears the plan and sets the fingerprint of the graph it is recorded for
+     *
+     * @param[in] fingerprint Fingerprint of the graph
+     */
+    void reset(uint64_t fingerprint);
+    /** Checks if the plan has been loaded from a file
+     *
+     * @return True if the plan has been loaded, false if it is being recorded
+     */
+    bool is_loaded() const;
+    /** Checks if outputs of folded nodes have been recorded since the plan was loaded or reset
+     *
+     * @return True if the plan has to be saved again
+     */
+    bool is_modified() const;
+    /** Returns the description of the mutated graph
+     *
+     * @return Description of the graph as returned by @ref describe
+     */
+    const std::string &ir() const;
+    /** Sets the description of the mutated graph, and clears the convolution methods recorded for the previous one
+     *
+     * @param[in] ir Description of the graph as returned by @ref describe
+     */
+    void set_ir(std::string ir);
+    /** Returns the convolution methods selected by the backend
+     *
+     * @return The method of each convolution node, by ID in the mutated graph
+     */
+    const std::map<NodeID, ConvolutionMethod> &convolution_methods() const;
+    /** Records the convolution method selected by the backend for a node
+     *
+     * @param[in] id     ID of the convolution node in the mutated graph
+     * @param[in] method Method selected for the node
+     */
+    void add_convolution_method(NodeID id, ConvolutionMethod method);
+    /** Looks for the output of a folded node
+     *
+     * @param[in] id ID of the node before it was folded
+     *
+     * @return Output of the node, nullptr if it is not in the plan
+     */
+    const FoldedConstant *folded_constant(NodeID id) const;
+    /** Records the output of a folded node
+     *
+     * @param[in] id          ID of the node before it was folded
+     * @param[in] inputs_hash Hash of the content of the constant inputs of the node
+     * @param[in] data        Output of the node
+     */
+    void add_folded_constant(NodeID id, uint64_t inputs_hash, std::vector<uint8_t> data);
+    /** Releases the outputs of the folded nodes, once the constants holding them have been created */
+    void release_folded_constants();
+
+private:
+    uint64_t                            _fingerprint{ 0 };
+    bool                                _is_loaded{ false };
+    bool                                _is_modified{ false };
+    std::string                         _ir{};
+    std::map<NodeID, FoldedConstant>    _folded_constants{};
+    std::map<NodeID, ConvolutionMethod> _convolution_methods{};
+};
+} // namespace graph
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_GRAPH_GRAPH_PLAN_H */
@@ -118,6 +118,8 @@ public:
      * @return Weights manager
      */
     virtual std::shared_ptr<arm_compute::IWeightsManager> create_weights_manager() = 0;
+    /** Blocks until all the work enqueued on the backend has completed */
+    virtual void sync() = 0;
 };
 } // namespace backends
 } // namespace graph
@@ -72,6 +72,11 @@ public:
      * @return Backend tensor handle
      */
     ITensorHandle *handle();
+    /** Extracts the backend tensor handle
+     *
+     * @return The backend tensor handle of the tensor
+     */
+    std::unique_ptr<ITensorHandle> extract_handle();
     /** Sets the backend tensor accessor
      *
      * @param[in] accessor Accessor to set
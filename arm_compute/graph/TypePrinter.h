@@ -101,6 +101,9 @@ inline ::std::ostream &operator<<(::std::ostream &os, const NodeType &node_type)
         case NodeType::DepthwiseConvolutionLayer:
             os << "DepthwiseConvolutionLayer";
             break;
+        case NodeType::DepthwiseSeparableConvolutionLayer:
+            os << "DepthwiseSeparableConvolutionLayer";
+            break;
         case NodeType::EltwiseLayer:
             os << "EltwiseLayer";
             break;
@@ -79,14 +79,23 @@ struct TensorDescriptor;
 /** Graph configuration structure */
 struct GraphConfig
 {
-    bool        use_function_memory_manager{ true };   /**< Use a memory manager to manage per-function auxilary memory */
-    bool        use_function_weights_manager{ true };  /**< Use a weights manager to manage transformed weights */
-    bool        use_transition_memory_manager{ true }; /**< Use a memory manager to manager transition buffer memory */
-    bool        use_tuner{ false };                    /**< Use a tuner in tunable backends */
-    bool        convert_to_uint8{ false };             /**< Convert graph to a synthetic uint8 graph */
-    CLTunerMode tuner_mode{ CLTunerMode::EXHAUSTIVE }; /**< Tuner mode to be used by the CL tuner */
-    int         num_threads{ -1 };                     /**< Number of threads to use (thread capable backends), if 0 the backend will auto-initialize, if -1 the backend will stay as it is. */
-    std::string tuner_file{ "acl_tuner.csv" };         /**< File to load/store tuning values from */
+    bool         use_function_memory_manager{ true };              /**< Use a memory manager to manage per-function auxilary memory */
+    bool         use_function_weights_manager{ true };             /**< Use a weights manager to manage transformed weights */
+    bool         use_transition_memory_manager{ true };            /**< Use a memory manager to manager transition buffer memory */
+    bool         use_tuner{ false };                               /**< Use a tuner in tunable backends */
+    bool         use_conv_method_tuner{ false };                   /**< Measure the convolution methods and keep the fastest ones in conv_method_tuner_file (NEON backend only) */
+    bool         convert_to_uint8{ false };                        /**< Convert graph to a synthetic uint8 graph */
+    bool         use_pipelined_execution{ false };                 /**< Overlap the input and output accessors of the neighbouring frames with the execution of each frame */
+    CLTunerMode  tuner_mode{ CLTunerMode::EXHAUSTIVE };            /**< Tuner mode to be used by the CL tuner */
+    int          num_threads{ -1 };                                /**< Number of threads to use (thread capable backends), if 0 the backend will auto-initialize, if -1 the backend will stay as it is. */
+    unsigned int num_parallel_branches{ 1 };                       /**< Maximum number of independent tasks run concurrently on partitions of the threads (NEON backend only), 1 runs the tasks one after the other. */
+    unsigned int num_pipeline_stages{ 1 };                         /**< Number of stages of balanced cost the graph is cut into, each processing a different frame on its own subset of the cores (NEON backend only). */
+    unsigned int input_shape_cache_size{ 0 };                      /**< Number of workloads configured for other input shapes kept when the inputs are reshaped, 0 disables the reshaping of the inputs */
+    bool         enable_node_profiling{ false };                   /**< Measure the execution time of each node and compare its throughput to its analytical cost */
+    bool         fuse_depthwise_separable{ false };                /**< Fuse depthwise convolutions with the pointwise convolutions that consume them (NEON backend only) */
+    std::string  tuner_file{ "acl_tuner.csv" };                    /**< File to load/store tuning values from */
+    std::string  conv_method_tuner_file{ "acl_conv_methods.csv" }; /**< File to load/store the convolution methods measured by the NEON backend */
+    std::string  plan_file{};                                      /**< File to load/store the execution plan of the graph, empty disables the plan. See @ref GraphPlan */
 };
 
 /**< Device target types */
@@ -150,6 +159,7 @@ enum class NodeType
     DeconvolutionLayer,
     DepthToSpaceLayer,
     DepthwiseConvolutionLayer,
+    DepthwiseSeparableConvolutionLayer,
     DequantizationLayer,
     DetectionOutputLayer,
     DetectionPostProcessLayer,
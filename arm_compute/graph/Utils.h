@@ -33,6 +33,7 @@ namespace graph
 {
 // Forward Declaration
 class GraphContext;
+class GraphPlan;
 
 inline bool is_utility_node(INode *node)
 {
@@ -92,10 +93,11 @@ void force_target_to_graph(Graph &g, Target target);
  *
  * @param[in] target Target to create the pass manager for
  * @param[in] cfg    Graph configuration meta-data
+ * @param[in] plan   (Optional) Execution plan the passes read their results from or record them to
  *
  * @return A PassManager with default mutating passes
  */
-PassManager create_default_pass_manager(Target target, const GraphConfig &cfg);
+PassManager create_default_pass_manager(Target target, const GraphConfig &cfg, GraphPlan *plan = nullptr);
 /** Setups requested backend context if it exists, is supported and hasn't been initialized already.
  *
  * @param[in,out] ctx    Graph Context.
@@ -28,9 +28,14 @@
 #include "arm_compute/graph/Tensor.h"
 #include "arm_compute/runtime/IFunction.h"
 #include "arm_compute/runtime/IMemoryGroup.h"
+#include "arm_compute/runtime/IScheduler.h"
 
+#include <cstdint>
 #include <functional>
+#include <map>
 #include <memory>
+#include <ostream>
+#include <string>
 #include <vector>
 
 namespace arm_compute
@@ -43,9 +48,43 @@ class INode;
 class Graph;
 
 struct ExecutionTask;
+struct ExecutionWorkload;
 
 void execute_task(ExecutionTask &task);
 
+/** Analytical cost and measured execution time of a task */
+struct TaskProfile
+{
+    uint64_t     flops{ 0 };         /**< Arithmetic operations of one execution, a multiply-accumulate counting as two */
+    uint64_t     bytes{ 0 };         /**< Bytes of the inputs and outputs accessed by one execution */
+    unsigned int num_runs{ 0 };      /**< Number of measured executions */
+    double       total_time_us{ 0 }; /**< Sum of the execution times in microseconds */
+    double       min_time_us{ 0 };   /**< Shortest execution time in microseconds */
+};
+
+/** Computes the analytical cost of a node from its tensor descriptors
+ *
+ * @param[in] node Node to compute the cost of
+ *
+ * @return Profile holding the cost of the node and no measurement
+ */
+TaskProfile compute_node_cost(const INode &node);
+/** Prints the profile of each measured task of a workload in CSV format
+ *
+ * The compute and memory roofs of the roofline classification are the best throughputs achieved by the tasks of the workload.
+ *
+ * @param[in]  workload Workload to print the profile of
+ * @param[out] os       Output stream
+ */
+void print_profile_csv(const ExecutionWorkload &workload, std::ostream &os);
+/** Summarizes the profile of each measured task of a workload
+ *
+ * @param[in] workload Workload to summarize the profile of
+ *
+ * @return Time, throughputs and roofline classification of each measured node, to annotate the graph with
+ */
+std::map<NodeID, std::string> get_profile_annotations(const ExecutionWorkload &workload);
+
 /** Task executor */
 class TaskExecutor final
 {
@@ -84,8 +123,9 @@ struct ExecutionTask
     /** Default destructor */
     ~ExecutionTask() = default;
     // TODO (geopin01) : Support vector of functions?
-    std::unique_ptr<arm_compute::IFunction> task = {}; /**< Task to execute */
-    INode                                  *node = {}; /**< Node bound to this workload */
+    std::unique_ptr<arm_compute::IFunction> task    = {}; /**< Task to execute */
+    INode                                  *node    = {}; /**< Node bound to this workload */
+    std::unique_ptr<TaskProfile>            profile = {}; /**< Profile of the task, null if the task isn't profiled */
 
     /** Function operator */
     void operator()();
@@ -97,11 +137,19 @@ struct ExecutionTask
 /** Execution workload */
 struct ExecutionWorkload
 {
-    std::vector<Tensor *>      inputs  = {};          /**< Input handles */
-    std::vector<Tensor *>      outputs = {};          /**< Output handles */
-    std::vector<ExecutionTask> tasks   = {};          /**< Execution workload */
-    Graph                     *graph   = { nullptr }; /**< Graph bound to the workload */
-    GraphContext              *ctx     = { nullptr }; /**< Graph execution context */
+    std::vector<Tensor *>            inputs  = {};          /**< Input handles */
+    std::vector<Tensor *>            outputs = {};          /**< Output handles */
+    std::vector<ExecutionTask>       tasks   = {};          /**< Execution workload */
+    std::vector<std::vector<size_t>> stages  = {};          /**< Indices of the tasks of each stage, which don't depend on each other. Empty if the tasks run one after the other */
+    Graph                           *graph   = { nullptr }; /**< Graph bound to the workload */
+    GraphContext                    *ctx     = { nullptr }; /**< Graph execution context */
+
+    /** Schedulers sharing the threads between the tasks run concurrently, for each number of concurrent tasks */
+    std::map<size_t, std::vector<std::unique_ptr<IScheduler>>> branch_schedulers = {};
+    /** Indices of the contiguous tasks of each pipeline stage. Empty if the graph is not pipelined */
+    std::vector<std::vector<size_t>> pipeline_stages = {};
+    /** Scheduler of each pipeline stage, running on its own subset of the threads */
+    std::vector<std::unique_ptr<IScheduler>> pipeline_schedulers = {};
 };
 } // namespace graph
 } // namespace arm_compute
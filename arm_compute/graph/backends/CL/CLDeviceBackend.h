@@ -68,6 +68,7 @@ public:
     Status validate_node(INode &node) override;
     std::shared_ptr<arm_compute::IMemoryManager> create_memory_manager(MemoryManagerAffinity affinity) override;
     std::shared_ptr<arm_compute::IWeightsManager> create_weights_manager() override;
+    void sync() override;
 
 private:
     int                                _context_count; /**< Counts how many contexts are currently using the backend */
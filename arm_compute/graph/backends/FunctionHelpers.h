@@ -651,6 +651,84 @@ std::unique_ptr<IFunction> create_depthwise_convolution_layer(DepthwiseConvoluti
     return RETURN_UNIQUE_PTR(func);
 }
 
+/** Create a backend depthwise separable convolution layer function
+ *
+ * @tparam DepthwiseSeparableConvolutionLayer Backend depthwise separable convolution function
+ * @tparam TargetInfo                         Target-specific information
+ *
+ * @param[in] node Node to create the backend function for
+ * @param[in] ctx  Graph context
+ *
+ * @return Backend depthwise separable convolution layer function
+ */
+template <typename DepthwiseSeparableConvolutionLayer, typename TargetInfo>
+std::unique_ptr<IFunction> create_depthwise_separable_convolution_layer(DepthwiseSeparableConvolutionLayerNode &node, GraphContext &ctx)
+{
+    validate_node<TargetInfo>(node, 5 /* expected inputs */, 1 /* expected outputs */);
+
+    // Extract IO and info
+    typename TargetInfo::TensorType *input             = get_backing_tensor<TargetInfo>(node.input(0));
+    typename TargetInfo::TensorType *depthwise_weights = get_backing_tensor<TargetInfo>(node.input(1));
+    typename TargetInfo::TensorType *depthwise_biases  = get_backing_tensor<TargetInfo>(node.input(2));
+    typename TargetInfo::TensorType *pointwise_weights = get_backing_tensor<TargetInfo>(node.input(3));
+    typename TargetInfo::TensorType *pointwise_biases  = get_backing_tensor<TargetInfo>(node.input(4));
+    typename TargetInfo::TensorType *output            = get_backing_tensor<TargetInfo>(node.output(0));
+
+    const bool is_quantized = is_data_type_quantized_asymmetric(input->info()->data_type());
+
+    if(is_quantized)
+    {
+        if(depthwise_biases != nullptr)
+        {
+            depthwise_biases->info()->set_data_type(DataType::S32);
+        }
+        if(pointwise_biases != nullptr)
+        {
+            pointwise_biases->info()->set_data_type(DataType::S32);
+        }
+    }
+
+    const PadStrideInfo       depthwise_info   = node.depthwise_convolution_info();
+    const unsigned int        depth_multiplier = node.depth_multiplier();
+    const QuantizationInfo    depthwise_qinfo  = node.depthwise_output_quant_info();
+    const ActivationLayerInfo depthwise_act    = node.depthwise_fused_activation();
+    const ActivationLayerInfo fused_act        = node.fused_activation();
+
+    // Create and configure function (we assume that functions have been validated before creation)
+    std::shared_ptr<IMemoryManager> mm = get_memory_manager(ctx, TargetInfo::TargetType);
+    std::unique_ptr<IFunction>      func;
+    std::string                     func_name;
+
+    std::tie(func, func_name) = create_named_memory_managed_function<DepthwiseSeparableConvolutionLayer>(
+                                    std::string("DepthwiseSeparableConvolutionLayer"), mm,
+                                    input, depthwise_weights, depthwise_biases, pointwise_weights, pointwise_biases, output,
+                                    depthwise_info, depthwise_qinfo, depth_multiplier, depthwise_act, fused_act);
+
+    // Log info
+    std::ostringstream qss;
+    if(is_quantized)
+    {
+        qss << " Input QuantInfo: " << input->info()->quantization_info()
+            << " Depthwise output QuantInfo: " << depthwise_qinfo
+            << " Output QuantInfo: " << output->info()->quantization_info();
+    }
+    ARM_COMPUTE_LOG_GRAPH_INFO("Instantiated "
+                               << node.name()
+                               << " Type: " << func_name
+                               << " Target: " << TargetInfo::TargetType
+                               << " Data Type: " << input->info()->data_type()
+                               << " Input shape: " << input->info()->tensor_shape()
+                               << " Depthwise weights shape: " << depthwise_weights->info()->tensor_shape()
+                               << " Pointwise weights shape: " << pointwise_weights->info()->tensor_shape()
+                               << " Output shape: " << output->info()->tensor_shape()
+                               << " Depth multiplier: " << depth_multiplier
+                               << qss.str()
+                               << (depthwise_act.enabled() ? " " + to_string(depthwise_act.activation()) : "")
+                               << (fused_act.enabled() ? " " + to_string(fused_act.activation()) : "")
+                               << std::endl);
+    return RETURN_UNIQUE_PTR(func);
+}
+
 /** Create a backend depth to space layer function
  *
  * @tparam DepthToSpaceLayerNode Function Backend depth to space function
@@ -53,6 +53,7 @@ public:
     Status validate_node(INode &node) override;
     std::shared_ptr<arm_compute::IMemoryManager> create_memory_manager(MemoryManagerAffinity affinity) override;
     std::shared_ptr<arm_compute::IWeightsManager> create_weights_manager() override;
+    void sync() override;
 
 private:
     bool              _initialized; /**< Flag that specifies if the backend has been default initialized */
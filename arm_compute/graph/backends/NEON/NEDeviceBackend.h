@@ -27,6 +27,9 @@
 #include "arm_compute/graph/IDeviceBackend.h"
 
 #include "arm_compute/runtime/Allocator.h"
+#include "arm_compute/runtime/NEON/NEConvolutionMethodTuner.h"
+
+#include <string>
 
 namespace arm_compute
 {
@@ -39,6 +42,8 @@ class NEDeviceBackend final : public IDeviceBackend
 {
 public:
     NEDeviceBackend();
+    /** Destructor */
+    ~NEDeviceBackend();
 
     // Inherited overridden methods
     void initialize_backend() override;
@@ -52,9 +57,12 @@ public:
     Status validate_node(INode &node) override;
     std::shared_ptr<arm_compute::IMemoryManager> create_memory_manager(MemoryManagerAffinity affinity) override;
     std::shared_ptr<arm_compute::IWeightsManager> create_weights_manager() override;
+    void sync() override;
 
 private:
-    Allocator _allocator; /**< NEON backend allocator */
+    Allocator                _allocator;              /**< NEON backend allocator */
+    NEConvolutionMethodTuner _conv_method_tuner;      /**< Tuner of the convolution methods */
+    std::string              _conv_method_tuner_file; /**< Filename to load/store the tuner's methods from */
 };
 } // namespace backends
 } // namespace graph
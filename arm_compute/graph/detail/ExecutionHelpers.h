@@ -78,6 +78,16 @@ void allocate_all_tensors(Graph &g);
  * @return The execution workload
  */
 ExecutionWorkload configure_all_nodes(Graph &g, GraphContext &ctx, const std::vector<NodeID> &node_order);
+/** Groups the tasks of a workload in stages of independent tasks, which are then run concurrently by @ref call_all_tasks
+ *
+ * The tasks of a stage only depend on tasks of the previous stages. Each task of a stage runs on its own partition of the threads of the scheduler.
+ *
+ * @note Does nothing if fewer than 2 branches can run concurrently, or if the library is built without the C++ scheduler.
+ *
+ * @param[in, out] workload     Workload to configure
+ * @param[in]      num_branches Maximum number of tasks to run concurrently
+ */
+void configure_parallel_execution(ExecutionWorkload &workload, unsigned int num_branches);
 /** Release the memory of all unused const nodes
  *
  * @param[in] g Graph to release the memory from
@@ -117,6 +127,35 @@ void prepare_all_tasks(ExecutionWorkload &workload);
  * @param[in] workload Workload to execute
  */
 void call_all_tasks(ExecutionWorkload &workload);
+/** Executes a workload until its accessors stop, streaming the frames through it
+ *
+ * The input accessors fill a staging copy of the inputs for the next frame and the output accessors consume a staging copy
+ * of the outputs of the previous frame on helper threads, while the current frame is executed.
+ *
+ * @note The accessors of one more frame than in sequential execution may be called before the execution stops.
+ *
+ * @param[in] workload Workload to execute
+ */
+void execute_pipelined(ExecutionWorkload &workload);
+/** Cuts the tasks of a workload into contiguous pipeline stages of balanced estimated cost
+ *
+ * Each stage is given its own subset of the threads, the stages process different frames at the same time.
+ * The worker threads of the stages are bound to separate cores if the device has a core for every thread.
+ *
+ * @note The stages are not configured if the CPP scheduler is not available or if there aren't enough threads.
+ *
+ * @param[in, out] workload   Workload to configure
+ * @param[in]      num_stages Requested number of stages
+ */
+void configure_pipeline_stages(ExecutionWorkload &workload, unsigned int num_stages);
+/** Executes the pipeline stages of a workload until its accessors stop, streaming the frames through them
+ *
+ * The accesses of the stages to the tensors they share are ordered frame by frame: a stage waits for the previous stages
+ * to be done with a tensor for the current frame, and for the next stages to be done with it for the previous frame.
+ *
+ * @param[in] workload Workload to execute
+ */
+void execute_pipeline_stages(ExecutionWorkload &workload);
 } // namespace detail
 } // namespace graph
 } // namespace arm_compute
@@ -31,6 +31,7 @@
 #include "arm_compute/graph/Graph.h"
 #include "arm_compute/graph/GraphContext.h"
 #include "arm_compute/graph/GraphManager.h"
+#include "arm_compute/graph/PassManager.h"
 
 namespace arm_compute
 {
@@ -63,6 +64,38 @@ public:
     void finalize(Target target, const GraphConfig &config);
     /** Executes the stream **/
     void run();
+    /** Changes the shapes of the inputs of the finalized stream
+     *
+     * @note The stream has to be finalized with @ref GraphConfig::input_shape_cache_size greater than 0
+     *
+     * @param[in] shapes New shape of each input, in the order the inputs were added
+     *
+     * @return a status
+     */
+    Status reshape_inputs(const std::vector<TensorShape> &shapes);
+    /** Changes the number of batches exchanged through the accessors of the finalized stream
+     *
+     * The stream isn't configured again: see @ref GraphManager::set_graph_batch_size
+     *
+     * @param[in] batch_size Number of batches, not greater than the one the stream was finalized with
+     *
+     * @return a status
+     */
+    Status set_batch_size(unsigned int batch_size);
+    /** Prints the execution profile of each node of the stream in CSV format
+     *
+     * @note The stream has to be finalized with @ref GraphConfig::enable_node_profiling set
+     *
+     * @param[out] os Output stream
+     */
+    void print_profile_csv(std::ostream &os);
+    /** Prints the graph of the stream in dot format, with the execution profile of each node
+     *
+     * @note The stream has to be finalized with @ref GraphConfig::enable_node_profiling set
+     *
+     * @param[out] os Output stream
+     */
+    void print_profile_dot(std::ostream &os);
 
     // Inherited overridden methods
     void add_layer(ILayer &layer) override;
@@ -73,6 +106,7 @@ private:
     //Important: GraphContext must be declared *before* the GraphManager because the GraphManager
     //allocates resources from the context and therefore needs to be destroyed before the context during clean up.
     GraphContext _ctx;     /**< Graph context to use */
+    PassManager  _pm;      /**< Pass manager used at finalization and when the inputs are reshaped */
     GraphManager _manager; /**< Graph manager */
     Graph        _g;       /**< Internal graph representation of the stream */
 };
@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_GRAPH_CONSTANT_FOLDING_MUTATOR_H
+#define ARM_COMPUTE_GRAPH_CONSTANT_FOLDING_MUTATOR_H
+
+#include "arm_compute/graph/GraphPlan.h"
+#include "arm_compute/graph/IGraphMutator.h"
+
+namespace arm_compute
+{
+namespace graph
+{
+/** Mutation pass to evaluate the subgraphs that only depend on constants once
+ *
+ * The nodes whose inputs are all constant, and the prior box nodes that only depend on the shapes of their inputs,
+ * are run with the NEON backend and replaced by a constant node holding their output.
+ *
+ * When given an execution plan, the outputs it holds are used instead of running the nodes, as long as the content of their constant inputs
+ * hasn't changed, and the outputs computed are recorded to it.
+ *
+ * @note Constants shared with other nodes are not folded, as their accessors can't be called more than once.
+ **/
+class ConstantFoldingMutator final : public IGraphMutator
+{
+public:
+    /** Constructor
+     *
+     * @param[in] fold_prior_boxes (Optional) Fold the prior box nodes, which is only valid if the shapes of the inputs of the graph don't change
+     * @param[in] plan             (Optional) Execution plan holding the outputs of the folded nodes
+     */
+    ConstantFoldingMutator(bool fold_prior_boxes = true, GraphPlan *plan = nullptr);
+
+    // Inherited methods overridden
+    virtual void mutate(Graph &g) override;
+    MutationType type() const override;
+    const char *name() override;
+
+private:
+    bool       _fold_prior_boxes;
+    GraphPlan *_plan;
+};
+} // namespace graph
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_GRAPH_CONSTANT_FOLDING_MUTATOR_H */
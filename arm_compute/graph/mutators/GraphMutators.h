@@ -24,11 +24,14 @@
 #ifndef ARM_COMPUTE_GRAPH_GRAPH_MUTATORS_H
 #define ARM_COMPUTE_GRAPH_GRAPH_MUTATORS_H
 
+#include "arm_compute/graph/mutators/ConstantFoldingMutator.h"
+#include "arm_compute/graph/mutators/DeadCodeEliminationMutator.h"
 #include "arm_compute/graph/mutators/DepthConcatSubTensorMutator.h"
 #include "arm_compute/graph/mutators/GroupedConvolutionMutator.h"
 #include "arm_compute/graph/mutators/InPlaceOperationMutator.h"
 #include "arm_compute/graph/mutators/NodeExecutionMethodMutator.h"
 #include "arm_compute/graph/mutators/NodeFusionMutator.h"
+#include "arm_compute/graph/mutators/PermuteEliminationMutator.h"
 #include "arm_compute/graph/mutators/SplitLayerSubTensorMutator.h"
 #include "arm_compute/graph/mutators/SyntheticDataTypeMutator.h"
 
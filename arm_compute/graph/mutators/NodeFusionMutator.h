@@ -35,10 +35,19 @@ namespace graph
 class NodeFusionMutator final : public IGraphMutator
 {
 public:
+    /** Constructor
+     *
+     * @param[in] fuse_depthwise_separable (Optional) Fuse depthwise convolutions with the pointwise convolutions that consume them (NEON only)
+     */
+    NodeFusionMutator(bool fuse_depthwise_separable = false);
+
     // Inherited methods overridden
     virtual void mutate(Graph &g) override;
     MutationType type() const override;
     const char *name() override;
+
+private:
+    bool _fuse_depthwise_separable;
 };
 } // namespace graph
 } // namespace arm_compute
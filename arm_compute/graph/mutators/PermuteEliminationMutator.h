@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_GRAPH_PERMUTE_ELIMINATION_MUTATOR_H
+#define ARM_COMPUTE_GRAPH_PERMUTE_ELIMINATION_MUTATOR_H
+
+#include "arm_compute/graph/IGraphMutator.h"
+#include "arm_compute/graph/Types.h"
+
+namespace arm_compute
+{
+namespace graph
+{
+/** Mutation pass to choose the data layout of the nodes and remove the redundant permute nodes
+ *
+ * On NEON, the depthwise convolutions permute their NCHW input, weights and output to NHWC at each execution.
+ * The pass groups each of them with the connected NCHW nodes that can run in NHWC as well (activation, batch normalization,
+ * convolution, depthwise convolution, eltwise with inputs of the same shape, unary eltwise, concatenation, pooling without
+ * a forced layout), and runs the group in NHWC if the permute nodes needed at its boundary are fewer than the permutes
+ * done by its depthwise convolutions. The weights are permuted by a node of their own, which the constant folding pass evaluates once.
+ *
+ * Then, a permute node is propagated through the layout agnostic nodes that follow it (activation, unary eltwise) up to the next
+ * permute node: the pair is removed if the permutations cancel each other, and is merged into a single permute node if
+ * the two nodes are adjacent.
+ *
+ * @note The pass has to run before @ref ConstantFoldingMutator, so that the permutes of the weights are folded.
+ **/
+class PermuteEliminationMutator final : public IGraphMutator
+{
+public:
+    /** Constructor
+     *
+     * @param[in] target (Optional) Target the graph is finalized for. The layouts are only assigned for @ref Target::NEON
+     */
+    PermuteEliminationMutator(Target target = Target::UNSPECIFIED);
+
+    // Inherited methods overridden
+    virtual void mutate(Graph &g) override;
+    MutationType type() const override;
+    const char *name() override;
+
+private:
+    Target _target;
+};
+} // namespace graph
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_GRAPH_PERMUTE_ELIMINATION_MUTATOR_H */
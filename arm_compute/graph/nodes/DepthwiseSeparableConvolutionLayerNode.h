@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_GRAPH_DEPTHWISE_SEPARABLE_CONVOLUTION_LAYER_NODE_H
+#define ARM_COMPUTE_GRAPH_DEPTHWISE_SEPARABLE_CONVOLUTION_LAYER_NODE_H
+
+#include "arm_compute/graph/INode.h"
+
+namespace arm_compute
+{
+namespace graph
+{
+/** Depthwise Separable Convolution Layer node
+ *
+ * A depthwise convolution immediately followed by a pointwise (1x1) convolution, which only consumes its output.
+ * Inputs are, in order: input, depthwise weights, depthwise biases, pointwise weights and pointwise biases.
+ */
+class DepthwiseSeparableConvolutionLayerNode final : public INode
+{
+public:
+    /** Constructor
+     *
+     * @param[in] depthwise_info           Depthwise convolution layer attributes
+     * @param[in] depth_multiplier         (Optional) Depth multiplier of the depthwise convolution.
+     * @param[in] depthwise_out_quant_info (Optional) Quantization info of the depthwise convolution output
+     * @param[in] out_quant_info           (Optional) Output quantization info
+     */
+    DepthwiseSeparableConvolutionLayerNode(PadStrideInfo    depthwise_info,
+                                           int              depth_multiplier         = 1,
+                                           QuantizationInfo depthwise_out_quant_info = QuantizationInfo(),
+                                           QuantizationInfo out_quant_info           = QuantizationInfo());
+    /** Depth multiplier accessor
+     *
+     * @return Depth multiplier
+     */
+    int depth_multiplier() const;
+    /** Depthwise convolution metadata accessor
+     *
+     * @return Depthwise convolution information
+     */
+    PadStrideInfo depthwise_convolution_info() const;
+    /** Quantization info of the depthwise convolution output accessor
+     *
+     * @return Quantization info of the intermediate tensor
+     */
+    QuantizationInfo depthwise_output_quant_info() const;
+    /** Returns the activation fused to the depthwise convolution
+     *
+     * @return Fused depthwise activation
+     */
+    ActivationLayerInfo depthwise_fused_activation() const;
+    /** Sets the activation fused to the depthwise convolution
+     *
+     * @param[in] fused_activation Fused activation to set
+     */
+    void set_depthwise_fused_activation(ActivationLayerInfo fused_activation);
+    /** Returns the activation fused to the pointwise convolution
+     *
+     * @return Fused activation
+     */
+    ActivationLayerInfo fused_activation() const;
+    /** Sets the activation fused to the pointwise convolution
+     *
+     * @param[in] fused_activation Fused activation to set
+     */
+    void set_fused_activation(ActivationLayerInfo fused_activation);
+    /** Computes depthwise separable convolution output descriptor
+     *
+     * @param[in] input_descriptor             Input descriptor
+     * @param[in] depthwise_weights_descriptor Depthwise weights descriptor
+     * @param[in] pointwise_weights_descriptor Pointwise weights descriptor
+     * @param[in] depthwise_info               Depthwise convolution operation attributes
+     *
+     * @return Output descriptor
+     */
+    static TensorDescriptor compute_output_descriptor(const TensorDescriptor &input_descriptor,
+                                                      const TensorDescriptor &depthwise_weights_descriptor,
+                                                      const TensorDescriptor &pointwise_weights_descriptor,
+                                                      const PadStrideInfo    &depthwise_info);
+
+    // Inherited overridden methods:
+    NodeType         type() const override;
+    bool             forward_descriptors() override;
+    TensorDescriptor configure_output(size_t idx) const override;
+    void accept(INodeVisitor &v) override;
+
+public:
+    static constexpr NodeType node_type = NodeType::DepthwiseSeparableConvolutionLayer;
+
+private:
+    PadStrideInfo       _depthwise_info;
+    int                 _depth_multiplier;
+    QuantizationInfo    _depthwise_out_quant_info;
+    QuantizationInfo    _out_quant_info;
+    ActivationLayerInfo _depthwise_fused_activation;
+    ActivationLayerInfo _fused_activation;
+};
+} // namespace graph
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_GRAPH_DEPTHWISE_SEPARABLE_CONVOLUTION_LAYER_NODE_H */
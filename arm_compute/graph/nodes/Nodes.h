@@ -35,6 +35,7 @@
 #include "arm_compute/graph/nodes/DeconvolutionLayerNode.h"
 #include "arm_compute/graph/nodes/DepthToSpaceLayerNode.h"
 #include "arm_compute/graph/nodes/DepthwiseConvolutionLayerNode.h"
+#include "arm_compute/graph/nodes/DepthwiseSeparableConvolutionLayerNode.h"
 #include "arm_compute/graph/nodes/DequantizationLayerNode.h"
 #include "arm_compute/graph/nodes/DetectionOutputLayerNode.h"
 #include "arm_compute/graph/nodes/DetectionPostProcessLayerNode.h"
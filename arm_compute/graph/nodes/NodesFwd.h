@@ -41,6 +41,7 @@ class ConvolutionLayerNode;
 class DeconvolutionLayerNode;
 class DepthToSpaceLayerNode;
 class DepthwiseConvolutionLayerNode;
+class DepthwiseSeparableConvolutionLayerNode;
 class DequantizationLayerNode;
 class DetectionOutputLayerNode;
 class DetectionPostProcessLayerNode;
@@ -27,7 +27,9 @@
 #include "arm_compute/graph/IGraphPrinter.h"
 
 #include "arm_compute/graph/INodeVisitor.h"
+#include "arm_compute/graph/Types.h"
 
+#include <map>
 #include <string>
 
 namespace arm_compute
@@ -70,6 +72,13 @@ private:
 class DotGraphPrinter final : public IGraphPrinter
 {
 public:
+    /** Default Constructor **/
+    DotGraphPrinter() = default;
+    /** Constructor
+     *
+     * @param[in] annotations Text added to the label of the nodes, indexed by node ID
+     */
+    DotGraphPrinter(std::map<NodeID, std::string> annotations);
     // Inherited methods overridden
     void print(const Graph &g, std::ostream &os) override;
 
@@ -100,7 +109,8 @@ private:
     void print_edges(const Graph &g, std::ostream &os);
 
 private:
-    DotGraphVisitor _dot_node_visitor = {};
+    DotGraphVisitor               _dot_node_visitor = {};
+    std::map<NodeID, std::string> _annotations      = {};
 };
 } // namespace graph
 } // namespace arm_compute
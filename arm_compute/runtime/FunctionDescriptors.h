@@ -42,6 +42,7 @@ struct FFT1DInfo
 {
     unsigned int axis{ 0 };                          /**< Axis to run the FFT on. */
     FFTDirection direction{ FFTDirection::Forward }; /**< Direction of the FFT. */
+    bool         is_real{ false };                   /**< Real FFT: a forward FFT of a real input only computes the N / 2 + 1 non-redundant bins, an inverse FFT computes a real output from them. Only supported on axis 0. */
 };
 
 /** Descriptor used by the FFT2D function */
@@ -50,6 +51,7 @@ struct FFT2DInfo
     unsigned int axis0{ 0 };                         /**< Axis to run first pass on. If same, multiple transforms are performed on single axis*/
     unsigned int axis1{ 1 };                         /**< Axis to run second pass on. If same, multiple transforms are performed on single axis*/
     FFTDirection direction{ FFTDirection::Forward }; /**< Direction of the FFT. */
+    bool         is_real{ false };                   /**< Real FFT: the pass along axis 0 is a real FFT, see @ref FFT1DInfo. Only supported when @p axis0 is 0. */
 };
 
 /** Descriptor used by the Convolution function */
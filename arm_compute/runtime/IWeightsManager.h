@@ -29,6 +29,7 @@
 #include "arm_compute/runtime/ITransformWeights.h"
 
 #include <map>
+#include <vector>
 
 namespace arm_compute
 {
@@ -36,6 +37,13 @@ namespace arm_compute
 class IWeightsManager
 {
 public:
+    /** Transform returned by a call to @ref acquire */
+    struct AcquiredTransform
+    {
+        ITransformWeights *transform; /**< Transform holding the transformed weights */
+        bool               is_owner;  /**< True if the transform is the one given to @ref acquire, false if an equivalent transform was reused */
+    };
+
     /** Constructor */
     IWeightsManager();
     /** Default Destructor */
@@ -76,10 +84,23 @@ public:
      * @return True if the weights tensor is managed else false
      */
     bool are_weights_managed(const ITensor *weights);
+    /** Get the transforms acquired since the last call, and clear them
+     *
+     * @return The transforms returned by each call to @ref acquire, in order
+     */
+    std::vector<AcquiredTransform> take_acquired_transforms();
+    /** Stop managing the weights transformed by a transform
+     *
+     * @note Must be called before destroying the object owning the transform, once no other object uses its transformed weights
+     *
+     * @param[in] weights_transform Transform to release
+     */
+    void release_transform(ITransformWeights *weights_transform);
 
 private:
     std::map<const ITensor *, std::vector<ITransformWeights *>> _managed_weights;
     std::map<const ITensor *, ITransformWeights *>              _managed_weights_parents;
+    std::vector<AcquiredTransform>                              _acquired_transforms;
 };
 } // arm_compute
 #endif /*ARM_COMPUTE_IWEIGHTSMANAGER_H */
\ No newline at end of file
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_NECONVOLUTIONMETHODTUNER_H
+#define ARM_COMPUTE_NECONVOLUTIONMETHODTUNER_H
+
+#include "arm_compute/core/Types.h"
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace arm_compute
+{
+/** Cache of the fastest convolution method measured for each convolution configuration
+ *
+ * When a tuner is registered with @ref NEConvolutionLayer::set_tuner, @ref NEConvolutionLayer benchmarks every
+ * method that is valid for a configuration missing from the table on its first configuration, and reuses the
+ * fastest one afterwards. The table can be stored to and loaded from a file so that tuning is only done once.
+ *
+ * @note Accesses to the table are serialized so that layers can be configured from several threads.
+ */
+class NEConvolutionMethodTuner
+{
+public:
+    /** Constructor
+     *
+     * @param[in] tune_new_configs (Optional) Benchmark the configurations which are not present in the table ?
+     */
+    NEConvolutionMethodTuner(bool tune_new_configs = true);
+    /** Destructor */
+    ~NEConvolutionMethodTuner() = default;
+    /** Setter for tune_new_configs option
+     *
+     * @param[in] tune_new_configs Benchmark the configurations which are not present in the table ?
+     */
+    void set_tune_new_configs(bool tune_new_configs);
+    /** Tune configurations that are not in the table
+     *
+     * @return True if tuning of new configurations is enabled.
+     */
+    bool tune_new_configs() const;
+    /** Look for the method of a configuration in the table
+     *
+     * @param[in]  config_id Identifier of the convolution configuration.
+     * @param[out] method    Method stored for the configuration, untouched if it is not in the table.
+     *
+     * @return True if the configuration is in the table.
+     */
+    bool find_method(const std::string &config_id, ConvolutionMethod &method) const;
+    /** Manually add a method to the table
+     *
+     * @param[in] config_id Identifier of the convolution configuration.
+     * @param[in] method    Fastest method for the configuration.
+     */
+    void add_method_to_table(const std::string &config_id, ConvolutionMethod method);
+    /** Get a copy of the table
+     *
+     * @return The methods table as unordered_map container
+     */
+    std::unordered_map<std::string, ConvolutionMethod> methods_table() const;
+    /** Load the methods table from file
+     *
+     * @param[in] filename Load the methods table from this file. Each row should be of the form 'config_id;method'
+     */
+    void load_from_file(const std::string &filename);
+    /** Save the methods table to file
+     *
+     * @param[in] filename Save the methods table to this file. (Content will be overwritten)
+     */
+    void save_to_file(const std::string &filename) const;
+
+private:
+    std::unordered_map<std::string, ConvolutionMethod> _methods_table;
+    bool                                               _tune_new_configs;
+    mutable std::mutex                                 _mtx;
+};
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_NECONVOLUTIONMETHODTUNER_H */
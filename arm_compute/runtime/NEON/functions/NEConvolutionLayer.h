@@ -36,6 +36,7 @@ namespace arm_compute
 {
 // Forward declarations
 class ITensor;
+class NEConvolutionMethodTuner;
 
 /** Basic function to simulate a convolution layer. This function calls one of the following NEON functions:
  * -# @ref NEGEMMConvolutionLayer     (executed only in case GEMM is required for the operation)
@@ -67,6 +68,9 @@ class ITensor;
  * DirectConv    | 9x9              |
  * GEMM          | Any size         |
  *
+ * When a tuner is set with @ref NEConvolutionLayer::set_tuner, the table above is replaced by measurements: the first time a
+ * configuration is seen all the valid methods are run and the fastest one is stored in the tuner, then reused for later configurations
+ * with the same shapes, data type, data layout and number of threads.
  *
  */
 class NEConvolutionLayer : public IFunction
@@ -101,7 +105,8 @@ public:
      * @param[in]  act_info         (Optional) Activation layer information in case of a fused activation. Only RELU, BOUNDED_RELU and LU_BOUNDED_RELU supported.
      * @param[in]  enable_fast_math (Optional) Enable fast math computation. In case this flag were set, the function could dispatch the fastest implementation
      *                              available which may introduce a drop of accuracy as well. Default is false
-     * @param[in]  num_groups       (Optional) Number of groups when performing a grouped convolution. num_groups != 1 is not supported
+     * @param[in]  num_groups       (Optional) Number of groups when performing a grouped convolution. num_groups != 1 is only supported
+     *                              for F16/F32 and always uses @ref NEGEMMConvolutionLayer
      */
     void configure(ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const PadStrideInfo &conv_info, const WeightsInfo &weights_info = WeightsInfo(),
                    const Size2D &dilation = Size2D(1U, 1U), const ActivationLayerInfo &act_info = ActivationLayerInfo(), bool enable_fast_math = false, unsigned int num_groups = 1);
@@ -122,7 +127,8 @@ public:
      * @param[in] act_info         (Optional) Activation layer information in case of a fused activation.
      * @param[in] enable_fast_math (Optional) Enable fast math computation. In case this flag were set, the function could dispatch the fastest implementation
      *                             available which may introduce a drop of accuracy as well. Default is false
-     * @param[in] num_groups       (Optional) Number of groups when performing a grouped convolution. num_groups != 1 is not supported
+     * @param[in] num_groups       (Optional) Number of groups when performing a grouped convolution. num_groups != 1 is only supported
+     *                             for F16/F32 and always uses @ref NEGEMMConvolutionLayer
      *
      * @return a status
      */
@@ -149,6 +155,15 @@ public:
      */
     static ConvolutionMethod get_convolution_method(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *output, const PadStrideInfo &conv_info,
                                                     const WeightsInfo &weights_info = WeightsInfo(), const Size2D &dilation = Size2D(1U, 1U), const ActivationLayerInfo &act_info = ActivationLayerInfo(), bool enable_fast_math = false);
+    /** Set the tuner used to select the convolution method of all the convolution layers configured afterwards
+     *
+     * @param[in] tuner Tuner holding the fastest method of each configuration. Pass nullptr to go back to the heuristic selection.
+     *                  The tuner must outlive the configuration of the layers.
+     *
+     * @note The tuner can be set and used while layers are configured from other threads.
+     *       Saving the tuned methods to a file is left to the caller, see @ref NEConvolutionMethodTuner::save_to_file.
+     */
+    static void set_tuner(NEConvolutionMethodTuner *tuner);
     // Inherited methods overridden:
     void run() override;
     void prepare() override;
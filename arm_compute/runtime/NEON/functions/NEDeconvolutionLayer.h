@@ -27,6 +27,8 @@
 #include "arm_compute/runtime/CPP/functions/CPPUpsample.h"
 #include "arm_compute/runtime/NEON/functions/NEConvolutionLayer.h"
 #include "arm_compute/runtime/NEON/functions/NEDirectConvolutionLayer.h"
+#include "arm_compute/runtime/NEON/functions/NEGEMM.h"
+#include "arm_compute/runtime/NEON/functions/NEPermute.h"
 #include "arm_compute/runtime/NEON/functions/NEReverse.h"
 
 #include "arm_compute/core/Types.h"
@@ -39,6 +41,9 @@
 
 namespace arm_compute
 {
+// Forward declarations
+class NEDeconvolutionCol2ImKernel;
+
 /** Function to run the deconvolution layer.
  *
  * Deconvolution Layer is the backward pass of Convolution Layer. First we transform the input depending on the stride and pad info and then perfrom a 1x1
@@ -64,12 +69,18 @@ namespace arm_compute
  * The weights used by Deconvolution are supposed to be the same as the ones used for Convolution. Therefore, it will be necessary to use the weights in the
  * reverse order to perform an actual convolution. This is achieved by using @ref NEReverse.
  *
+ * For strided deconvolutions of floating point NHWC tensors, upsampling the input would make most of the convolution's MACs multiply zeroes.
+ * The deconvolution is then computed directly on the input instead: a GEMM multiplies every input element by the whole kernel and the results
+ * are accumulated into the output by @ref NEDeconvolutionCol2ImKernel.
+ *
  * This function calls the following NEON kernels/functions:
  *
  * -# @ref CPPUpsample
  * -# @ref NEConvolutionLayer
  * -# @ref NEPermute
  * -# @ref NEReverse
+ * -# @ref NEGEMM
+ * -# @ref NEDeconvolutionCol2ImKernel
  *
  */
 class NEDeconvolutionLayer : public IFunction
@@ -87,7 +98,7 @@ public:
     /** Prevent instances of this class from being moved (As this class contains pointers) */
     NEDeconvolutionLayer &operator=(NEDeconvolutionLayer &&) = delete;
     /** Default destructor */
-    virtual ~NEDeconvolutionLayer() = default;
+    ~NEDeconvolutionLayer();
 
     /** Set the input, weights, biases and output tensors.
      *
@@ -116,17 +127,24 @@ public:
     void prepare() override;
 
 private:
-    MemoryGroup        _memory_group;
-    NEConvolutionLayer _conv_f;
-    CPPUpsample        _upsample_f;
-    NEReverse          _flip_weights;
-    Tensor             _scaled_output;
-    Tensor             _weights_flipped;
-    Tensor             _flip_axis;
-    const ITensor     *_original_weights;
-    ITensor           *_input;
-    PadStrideInfo      _info;
-    bool               _is_prepared;
+    MemoryGroup                                  _memory_group;
+    NEConvolutionLayer                           _conv_f;
+    CPPUpsample                                  _upsample_f;
+    NEReverse                                    _flip_weights;
+    NEPermute                                    _permute_weights;
+    NEGEMM                                       _gemm;
+    std::unique_ptr<NEDeconvolutionCol2ImKernel> _col2im_kernel;
+    Tensor                                       _scaled_output;
+    Tensor                                       _weights_flipped;
+    Tensor                                       _flip_axis;
+    Tensor                                       _weights_permuted;
+    Tensor                                       _weights_gemm;
+    Tensor                                       _gemm_output;
+    const ITensor                               *_original_weights;
+    ITensor                                     *_input;
+    PadStrideInfo                                _info;
+    bool                                         _is_gemm_deconv;
+    bool                                         _is_prepared;
 };
 } // arm_compute
 #endif /* ARM_COMPUTE_NEDECONVOLUTIONLAYER_H */
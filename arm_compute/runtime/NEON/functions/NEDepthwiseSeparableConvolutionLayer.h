@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_NEDEPTHWISESEPARABLECONVOLUTIONLAYER_H
+#define ARM_COMPUTE_NEDEPTHWISESEPARABLECONVOLUTIONLAYER_H
+
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/IFunction.h"
+#include "arm_compute/runtime/IMemoryManager.h"
+#include "arm_compute/runtime/MemoryGroup.h"
+#include "arm_compute/runtime/NEON/functions/NEActivationLayer.h"
+#include "arm_compute/runtime/NEON/functions/NEGEMMConvolutionLayer.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include <memory>
+
+namespace arm_compute
+{
+// Forward declarations
+class ITensor;
+class NEDepthwiseConvolutionLayerNativeKernel;
+
+/** Basic function to execute a depthwise convolution followed by a pointwise (1x1) convolution.
+ *
+ * The output of the depthwise convolution is never written out as a whole: it is computed one block of output rows
+ * at a time into a buffer sized to fit in the cache, which is consumed by the pointwise convolution straight away.
+ *
+ * This function calls the following NEON kernels/functions for every block:
+ *
+ * -# @ref NEDepthwiseConvolutionLayerNativeKernel
+ * -# @ref NEActivationLayer (if the depthwise convolution has a fused activation)
+ * -# @ref NEGEMMConvolutionLayer
+ */
+class NEDepthwiseSeparableConvolutionLayer : public IFunction
+{
+public:
+    /** Default constructor */
+    NEDepthwiseSeparableConvolutionLayer(std::shared_ptr<IMemoryManager> memory_manager = nullptr);
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEDepthwiseSeparableConvolutionLayer(const NEDepthwiseSeparableConvolutionLayer &) = delete;
+    /** Prevent instances of this class from being moved (As this class contains non movable objects) */
+    NEDepthwiseSeparableConvolutionLayer(NEDepthwiseSeparableConvolutionLayer &&) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEDepthwiseSeparableConvolutionLayer &operator=(const NEDepthwiseSeparableConvolutionLayer &) = delete;
+    /** Prevent instances of this class from being moved (As this class contains non movable objects) */
+    NEDepthwiseSeparableConvolutionLayer &operator=(NEDepthwiseSeparableConvolutionLayer &&) = delete;
+    /** Default destructor */
+    ~NEDepthwiseSeparableConvolutionLayer();
+    /** Set the input and output tensors.
+     *
+     * @note Supported data layouts: NHWC
+     *
+     * @param[in]  input                  Source tensor. 3 lower dimensions represent a single input [IFM, width, height],
+     *                                    while every optional dimension from 4 and above represent a batch of inputs.
+     *                                    Data type supported: QASYMM8/QASYMM8_SIGNED/F16/F32.
+     * @param[in]  depthwise_weights      Depthwise weights tensor. A 3D tensor with shape [IFM * depth_multiplier, kernel_x, kernel_y].
+     *                                    Data type supported: Same as @p input or QSYMM8_PER_CHANNEL when @p input is QASYMM8/QASYMM8_SIGNED.
+     * @param[in]  depthwise_biases       Depthwise biases tensor. A 1D tensor with shape [IFM * depth_multiplier]. Can be nullptr.
+     *                                    Data type supported: Same as @p input, S32 when @p input is QASYMM8/QASYMM8_SIGNED.
+     * @param[in]  pointwise_weights      Pointwise weights tensor. A 4D tensor with shape [IFM * depth_multiplier, 1, 1, OFM].
+     *                                    Data type supported: Same as @p input or QSYMM8_PER_CHANNEL when @p input is QASYMM8/QASYMM8_SIGNED.
+     * @param[in]  pointwise_biases       Pointwise biases tensor. A 1D tensor with shape [OFM]. Can be nullptr.
+     *                                    Data type supported: Same as @p input, S32 when @p input is QASYMM8/QASYMM8_SIGNED.
+     * @param[out] output                 Destination tensor. 3 lower dimensions represent a single output [OFM, width, height], while the rest represent batch of outputs.
+     *                                    Data types supported: Same as @p input.
+     * @param[in]  depthwise_conv_info    Padding and stride information of the depthwise convolution.
+     * @param[in]  depthwise_output_qinfo (Optional) Quantization information of the depthwise convolution output. Only used when @p input is quantized.
+     * @param[in]  depth_multiplier       (Optional) Multiplier to apply to the input's depth in order to retrieve the depthwise output's depth. Defaults to 1.
+     * @param[in]  depthwise_act_info     (Optional) Activation fused to the depthwise convolution.
+     * @param[in]  pointwise_act_info     (Optional) Activation fused to the pointwise convolution.
+     * @param[in]  dilation               (Optional) Dilation of the depthwise convolution, in elements, across x and y. Defaults to (1, 1).
+     */
+    void configure(const ITensor *input, const ITensor *depthwise_weights, const ITensor *depthwise_biases, const ITensor *pointwise_weights, const ITensor *pointwise_biases, ITensor *output,
+                   const PadStrideInfo &depthwise_conv_info, const QuantizationInfo &depthwise_output_qinfo = QuantizationInfo(), unsigned int depth_multiplier = 1,
+                   const ActivationLayerInfo &depthwise_act_info = ActivationLayerInfo(), const ActivationLayerInfo &pointwise_act_info = ActivationLayerInfo(),
+                   const Size2D &dilation = Size2D(1U, 1U));
+    /** Static function to check if given info will lead to a valid configuration of @ref NEDepthwiseSeparableConvolutionLayer
+     *
+     * @note Supported data layouts: NHWC
+     *
+     * @param[in] input                  Source tensor info. 3 lower dimensions represent a single input [IFM, width, height],
+     *                                   while every optional dimension from 4 and above represent a batch of inputs.
+     *                                   Data type supported: QASYMM8/QASYMM8_SIGNED/F16/F32.
+     * @param[in] depthwise_weights      Depthwise weights tensor info. A 3D tensor with shape [IFM * depth_multiplier, kernel_x, kernel_y].
+     *                                   Data type supported: Same as @p input or QSYMM8_PER_CHANNEL when @p input is QASYMM8/QASYMM8_SIGNED.
+     * @param[in] depthwise_biases       Depthwise biases tensor info. A 1D tensor with shape [IFM * depth_multiplier]. Can be nullptr.
+     *                                   Data type supported: Same as @p input, S32 when @p input is QASYMM8/QASYMM8_SIGNED.
+     * @param[in] pointwise_weights      Pointwise weights tensor info. A 4D tensor with shape [IFM * depth_multiplier, 1, 1, OFM].
+     *                                   Data type supported: Same as @p input or QSYMM8_PER_CHANNEL when @p input is QASYMM8/QASYMM8_SIGNED.
+     * @param[in] pointwise_biases       Pointwise biases tensor info. A 1D tensor with shape [OFM]. Can be nullptr.
+     *                                   Data type supported: Same as @p input, S32 when @p input is QASYMM8/QASYMM8_SIGNED.
+     * @param[in] output                 Destination tensor info. 3 lower dimensions represent a single output [OFM, width, height], while the rest represent batch of outputs.
+     *                                   Data types supported: Same as @p input.
+     * @param[in] depthwise_conv_info    Padding and stride information of the depthwise convolution.
+     * @param[in] depthwise_output_qinfo (Optional) Quantization information of the depthwise convolution output. Only used when @p input is quantized.
+     * @param[in] depth_multiplier       (Optional) Multiplier to apply to the input's depth in order to retrieve the depthwise output's depth. Defaults to 1.
+     * @param[in] depthwise_act_info     (Optional) Activation fused to the depthwise convolution.
+     * @param[in] pointwise_act_info     (Optional) Activation fused to the pointwise convolution.
+     * @param[in] dilation               (Optional) Dilation of the depthwise convolution, in elements, across x and y. Defaults to (1, 1).
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *input, const ITensorInfo *depthwise_weights, const ITensorInfo *depthwise_biases, const ITensorInfo *pointwise_weights,
+                           const ITensorInfo *pointwise_biases, const ITensorInfo *output, const PadStrideInfo &depthwise_conv_info, const QuantizationInfo &depthwise_output_qinfo = QuantizationInfo(),
+                           unsigned int depth_multiplier = 1, const ActivationLayerInfo &depthwise_act_info = ActivationLayerInfo(),
+                           const ActivationLayerInfo &pointwise_act_info = ActivationLayerInfo(), const Size2D &dilation = Size2D(1U, 1U));
+
+    // Inherited methods overridden:
+    void run() override;
+    void prepare() override;
+
+private:
+    MemoryGroup                                              _memory_group;
+    std::unique_ptr<NEDepthwiseConvolutionLayerNativeKernel> _depthwise_kernel;
+    NEActivationLayer                                        _depthwise_activation;
+    NEGEMMConvolutionLayer                                   _pointwise_conv;
+    Tensor                                                   _depthwise_block;
+    Tensor                                                   _depthwise_output;
+    Tensor                                                   _pointwise_output;
+    ITensor                                                 *_output;
+    unsigned int                                             _block_rows;
+    unsigned int                                             _num_rows;
+    unsigned int                                             _num_batches;
+    bool                                                     _is_activationlayer_enabled;
+    bool                                                     _is_prepared;
+};
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_NEDEPTHWISESEPARABLECONVOLUTIONLAYER_H */
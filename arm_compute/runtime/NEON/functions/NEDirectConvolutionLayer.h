@@ -29,6 +29,7 @@
 #include "arm_compute/runtime/IMemoryManager.h"
 #include "arm_compute/runtime/MemoryGroup.h"
 #include "arm_compute/runtime/NEON/functions/NEActivationLayer.h"
+#include "arm_compute/runtime/NEON/functions/NEPermute.h"
 #include "arm_compute/runtime/Tensor.h"
 
 #include <memory>
@@ -37,6 +38,7 @@ namespace arm_compute
 {
 class NEDirectConvolutionLayerOutputStageKernel;
 class NEDirectConvolutionLayerKernel;
+class NEDirectConvolutionLayerNHWCKernel;
 class NEFillBorderKernel;
 
 /** Function to run the direct convolution.
@@ -45,7 +47,8 @@ class NEFillBorderKernel;
  *
  * -# @ref NEFillBorderKernel for the input
  * -# @ref NEDirectConvolutionLayerOutputStageKernel
- * -# @ref NEDirectConvolutionLayerKernel
+ * -# @ref NEDirectConvolutionLayerKernel (NCHW)
+ * -# @ref NEPermute for the weights and @ref NEDirectConvolutionLayerNHWCKernel (NHWC)
  */
 class NEDirectConvolutionLayer : public IFunction
 {
@@ -68,10 +71,11 @@ public:
      *    1x1 convolution with stride_x = 1/2/3, stride_y = 1/2/3 data type = F16/F32
      *    3x3 convolution with stride_x = 1/2/3, stride_y = 1/2/3 data type = F16/F32
      *    5x5 convolution with stride_x = 1/2/3, stride_y = 1/2/3 data type = F32
+     *        In NHWC, any kernel size, stride and dilation is supported for F16/F32.
      *
      * @param[in, out] input     Input tensor. Data types supported: F16/F32.
      * @param[in]      weights   Set of kernels to convolve the input volume.
-     *                           Supported sizes: 1x1, 3x3 and 5x5.
+     *                           Supported sizes: 1x1, 3x3 and 5x5 in NCHW, any in NHWC.
      *                           The 3rd dimension must be the same as the input's volume 3rd dimension.
      *                           Data type supported: Same as @p input.
      * @param[in]      bias      Set of biases. Can be nullptr. Data type supported: Same as @p input.
@@ -79,18 +83,21 @@ public:
      *                           The 3rd dimensions must be equal to the 4th dimension of the @p kernels tensor. Data types supported: Same as @p input.
      * @param[in]      conv_info Contains padding and stride information described in @ref PadStrideInfo.
      * @param[in]      act_info  (Optional) Activation layer information in case of a fused activation.
+     * @param[in]      dilation  (Optional) Dilation, in elements, across x and y. Defaults to (1, 1). Only supported in NHWC.
      */
-    void configure(ITensor *input, const ITensor *weights, const ITensor *bias, ITensor *output, const PadStrideInfo &conv_info, const ActivationLayerInfo &act_info = ActivationLayerInfo());
+    void configure(ITensor *input, const ITensor *weights, const ITensor *bias, ITensor *output, const PadStrideInfo &conv_info, const ActivationLayerInfo &act_info = ActivationLayerInfo(),
+                   const Size2D &dilation = Size2D(1U, 1U));
     /** Static function to check if given info will lead to a valid configuration of @ref NEDirectConvolutionLayer
      *
      * @note: DirectConvolution only works in the following configurations:
      *    1x1 convolution with stride_x = 1/2/3, stride_y = 1/2/3 data type = F16/F32
      *    3x3 convolution with stride_x = 1/2/3, stride_y = 1/2/3 data type = F16/F32
      *    5x5 convolution with stride_x = 1/2/3, stride_y = 1/2/3 data type = F32
+     *        In NHWC, any kernel size, stride and dilation is supported for F16/F32.
      *
      * @param[in] input     Input tensor. Data types supported: F16/F32.
      * @param[in] weights   Set of kernels to convolve the input volume.
-     *                      Supported sizes: 1x1, 3x3 and 5x5.
+     *                      Supported sizes: 1x1, 3x3 and 5x5 in NCHW, any in NHWC.
      *                      The 3rd dimension must be the same as the input's volume 3rd dimension.
      *                      Data type supported: Same as @p input.
      * @param[in] bias      Set of biases. Can be nullptr. Data type supported: Same as @p input.
@@ -98,19 +105,25 @@ public:
      *                      The 3rd dimensions must be equal to the 4th dimension of the @p kernels tensor. Data types supported: Same as @p input.
      * @param[in] conv_info Contains padding and stride information described in @ref PadStrideInfo.
      * @param[in] act_info  (Optional) Activation layer information in case of a fused activation.
+     * @param[in] dilation  (Optional) Dilation, in elements, across x and y. Defaults to (1, 1). Only supported in NHWC.
      *
      * @return a status
      */
     static Status validate(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *bias, const ITensorInfo *output, const PadStrideInfo &conv_info,
-                           const ActivationLayerInfo &act_info = ActivationLayerInfo());
+                           const ActivationLayerInfo &act_info = ActivationLayerInfo(), const Size2D &dilation = Size2D(1U, 1U));
 
     // Inherited methods overridden:
     void run() override;
+    void prepare() override;
 
 private:
     MemoryGroup                                                _memory_group;
     std::unique_ptr<NEDirectConvolutionLayerOutputStageKernel> _output_stage_kernel;
     std::unique_ptr<NEDirectConvolutionLayerKernel>            _conv_kernel;
+    std::unique_ptr<NEDirectConvolutionLayerNHWCKernel>        _conv_kernel_nhwc;
+    NEPermute                                                  _permute_weights;
+    Tensor                                                     _permuted_weights;
+    const ITensor                                             *_original_weights;
     std::unique_ptr<NEFillBorderKernel>                        _input_border_handler;
     NEActivationLayer                                          _activationlayer_function;
     Tensor                                                     _accumulator;
@@ -118,6 +131,8 @@ private:
     bool                                                       _is_activationlayer_enabled;
     unsigned int                                               _dim_split;
     bool                                                       _is_padding_required;
+    bool                                                       _is_nhwc;
+    bool                                                       _is_prepared;
 };
 }
 #endif /* ARM_COMPUTE_NEDIRECTCONVOLUTIONLAYER_H */
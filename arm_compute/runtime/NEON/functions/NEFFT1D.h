@@ -36,15 +36,31 @@ namespace arm_compute
 {
 // Forward declaration
 class ITensor;
+class NEComplexPixelWiseMultiplication;
+class NEFFTChirpKernel;
 class NEFFTDigitReverseKernel;
 class NEFFTRadixStageKernel;
+class NEFFTRealTransformKernel;
 class NEFFTScaleKernel;
 
 /** Basic function to execute one dimensional FFT. This function calls the following NEON kernels:
  *
- * -# @ref NEFFTDigitReverseKernel Performs digit reverse
- * -# @ref NEFFTRadixStageKernel   A list of FFT kernels depending on the radix decomposition
- * -# @ref NEFFTScaleKernel        Performs output scaling in case of in inverse FFT
+ * -# @ref NEFFTDigitReverseKernel  Performs digit reverse
+ * -# @ref NEFFTRadixStageKernel    A list of FFT kernels depending on the radix decomposition
+ * -# @ref NEFFTRealTransformKernel Converts between the spectra of a real signal and of the same signal packed as complex (in case of a real FFT)
+ * -# @ref NEFFTScaleKernel         Performs output scaling in case of in inverse FFT
+ *
+ * A real FFT of even length N runs a complex FFT of length N / 2 on the real signal, whose pairs of consecutive elements are read as complex elements.
+ * A real FFT of odd length N runs a complex FFT of length N, of which only the non-redundant bins are kept.
+ *
+ * Complex FFTs of a length that cannot be decomposed in the supported radixes are computed with Bluestein's algorithm, as a
+ * convolution with a chirp computed by FFTs of a length that can be decomposed:
+ *
+ * -# @ref NEFFTChirpKernel                 Multiplies the input by the chirp and zero pads it
+ * -# @ref NEFFT1D                          Forward transform of the chirped input
+ * -# @ref NEComplexPixelWiseMultiplication Product with the spectrum of the chirp filter, computed once
+ * -# @ref NEFFT1D                          Inverse transform of the product
+ * -# @ref NEFFTChirpKernel                 Multiplies the output by the chirp
  */
 class NEFFT1D : public IFunction
 {
@@ -66,7 +82,11 @@ public:
      * @param[in]  input  Source tensor. Data types supported: F32. Number of channels supported: 1 (real tensor) or 2 (complex tensor).
      * @param[out] output Destination tensor.  Data types and data layouts supported: Same as @p input.
      *                    Number of channels supported: 1 (real tensor) or 2 (complex tensor).If @p input is real, @p output must be complex.
+     *                    For a real FFT of length N, the complex side of the transform only holds N / 2 + 1 elements along the x axis.
      * @param[in]  config FFT related configuration
+     *
+     * @note Lengths that cannot be decomposed in the supported radixes are only supported when @p input and @p output are complex.
+     * @note The length of an inverse real FFT is taken from @p output, which has to be initialized for the length to be odd.
      */
     void configure(const ITensor *input, ITensor *output, const FFT1DInfo &config);
     /** Static function to check if given info will lead to a valid configuration of @ref NEFFT1D.
@@ -81,17 +101,45 @@ public:
 
     // Inherited methods overridden:
     void run() override;
+    void prepare() override;
 
 protected:
+    std::shared_ptr<IMemoryManager>                     _memory_manager;
     MemoryGroup                                         _memory_group;
     std::unique_ptr<NEFFTDigitReverseKernel>            _digit_reverse_kernel;
     std::vector<std::unique_ptr<NEFFTRadixStageKernel>> _fft_kernels;
     std::unique_ptr<NEFFTScaleKernel>                   _scale_kernel;
+    std::unique_ptr<NEFFTRealTransformKernel>           _real_transform_kernel;
     Tensor                                              _digit_reversed_input;
     Tensor                                              _digit_reverse_indices;
+    Tensor                                              _packed_spectrum;
+    std::unique_ptr<NEFFTChirpKernel>                   _chirp_kernel;
+    std::unique_ptr<NEFFTChirpKernel>                   _dechirp_kernel;
+    std::unique_ptr<NEFFT1D>                            _chirped_fft;
+    std::unique_ptr<NEFFT1D>                            _chirped_ifft;
+    std::unique_ptr<NEFFT1D>                            _chirp_filter_fft;
+    std::unique_ptr<NEComplexPixelWiseMultiplication>   _spectrum_product;
+    Tensor                                              _chirped_input;
+    Tensor                                              _chirped_spectrum;
+    Tensor                                              _chirp_filter;
+    Tensor                                              _chirp_filter_spectrum;
+    Tensor                                              _convolved;
     unsigned int                                        _num_ffts;
     unsigned int                                        _axis;
     bool                                                _run_scale;
+    bool                                                _is_real_forward;
+    bool                                                _is_real_inverse;
+    bool                                                _is_bluestein;
+    bool                                                _is_prepared;
+
+private:
+    /** Configure the function to compute the FFT with Bluestein's algorithm
+     *
+     * @param[in]  input  Source tensor. Data types supported: F32. Number of channels supported: 2 (complex tensor).
+     * @param[out] output Destination tensor. Data types and data layouts supported: Same as @p input.
+     * @param[in]  config FFT related configuration
+     */
+    void configure_bluestein(const ITensor *input, ITensor *output, const FFT1DInfo &config);
 };
 } // namespace arm_compute
 #endif /*ARM_COMPUTE_NEFFT1D_H */
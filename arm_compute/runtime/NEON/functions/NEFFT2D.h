@@ -40,6 +40,9 @@ class ITensor;
  *
  * -# @ref NEFFT1D 1D FFT is performed on the first given axis
  * -# @ref NEFFT1D 1D FFT is performed on the second given axis
+ *
+ * When @ref FFT2DInfo::is_real is set, the pass along axis 0 is a real FFT: the forward FFT only computes the
+ * N / 2 + 1 non-redundant bins along axis 0, and the inverse FFT computes a real output from them.
  */
 class NEFFT2D : public IFunction
 {
@@ -58,15 +61,17 @@ public:
     ~NEFFT2D();
     /** Initialise the function's source and destinations
      *
-     * @param[in]  input  Source tensor. Data types supported: F32.
+     * @param[in]  input  Source tensor. Data types supported: F32. Number of channels supported: 1 (real tensor, forward real FFT only) or 2 (complex tensor).
      * @param[out] output Destination tensor. Data types and data layouts supported: Same as @p input.
+     *                    Number of channels supported: 2 (complex tensor) or 1 (real tensor, inverse real FFT only).
      * @param[in]  config FFT related configuration
      */
     void configure(const ITensor *input, ITensor *output, const FFT2DInfo &config);
     /** Static function to check if given info will lead to a valid configuration of @ref NEFFT2D.
      *
-     * @param[in] input  Source tensor info. Data types supported: F32.
+     * @param[in] input  Source tensor info. Data types supported: F32. Number of channels supported: 1 (real tensor, forward real FFT only) or 2 (complex tensor).
      * @param[in] output Destination tensor info. Data types and data layouts supported: Same as @p input.
+     *                   Number of channels supported: 2 (complex tensor) or 1 (real tensor, inverse real FFT only).
      * @param[in] config FFT related configuration
      *
      * @return a status
@@ -55,6 +55,9 @@ class ITensor;
  *  -# @ref NEArithmeticAddition             Add bias.
  *  -# @ref NEActivationLayer                Perform activation.
  *  -# @ref NEPermute                        Permute output if NHWC(only NCHW is supported).
+ *
+ * As input and weights are real, the transforms along the width are real FFTs and only the non-redundant half of
+ * the spectrum is multiplied and reduced.
  */
 class NEFFTConvolutionLayer : public IFunction
 {
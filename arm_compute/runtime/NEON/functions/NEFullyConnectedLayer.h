@@ -27,6 +27,7 @@
 #include "arm_compute/runtime/IFunction.h"
 
 #include "arm_compute/runtime/MemoryGroup.h"
+#include "arm_compute/runtime/NEON/functions/NEActivationLayer.h"
 #include "arm_compute/runtime/NEON/functions/NEConvertFullyConnectedWeights.h"
 #include "arm_compute/runtime/NEON/functions/NEFlattenLayer.h"
 #include "arm_compute/runtime/NEON/functions/NEGEMM.h"
@@ -36,6 +37,9 @@
 namespace arm_compute
 {
 class NEFlattenLayerKernel;
+class NEGEMMLowpDequantizeInt32ToFloatKernel;
+class NEMinMaxRangeKernel;
+class NEQuantizationLayerKernel;
 
 /** Basic function to reshape the weights of Fully Connected layer with NEON. This function calls the following kernels:
  *
@@ -118,6 +122,15 @@ private:
  *  -# @ref NEGEMMMatrixMultiplyKernel or @ref NEGEMMLowpMatrixMultiplyCore (if quantized asymmetric)
  *  -# @ref NEGEMMMatrixAdditionKernel or @ref NEGEMMLowpQuantizeDownInt32ToUint8ScaleByFixedPoint (if quantized asymmetric) (if @p biases is not equal to nullptr)
  *
+ * If dynamic quantization is enabled in @ref FullyConnectedLayerInfo, the F32 matrix multiplication is replaced by:
+ *  -# @ref NEMinMaxRangeKernel and @ref NEQuantizationLayerKernel to quantize the input to QASYMM8_SIGNED on every run
+ *  -# @ref NEGEMMLowpMatrixMultiplyCore against the weights quantized per output channel (quantized only once)
+ *  -# @ref NEGEMMLowpDequantizeInt32ToFloatKernel
+ *  -# @ref NEActivationLayer (if the activation is enabled)
+ *
+ * If the weights are flagged as sparse in @ref FullyConnectedLayerInfo, the F32 (or dynamically quantized) matrix multiplication
+ * compresses the weights once and skips their all-zero blocks.
+ *
  * @note  The fully connected layer accepts "weights" tensors only with 2 dimensions.
  */
 class NEFullyConnectedLayer : public IFunction
@@ -147,7 +160,8 @@ public:
      *                     - The output of im2col on the input and the (transposed) 2D weights, if the function is called after a Convolution Layer
      *                     - The input tensor and the (transposed) 2D weights, if the function is called after another FullyConnected Layer.
      *                     Data type supported: Same as @p input.
-     * @param[in]  fc_info (Optional) Fully connected layer additional info
+     * @param[in]  fc_info (Optional) Fully connected layer additional info.
+     *                     Dynamic quantization can only be enabled for F32 tensors.
      */
     void configure(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output,
                    FullyConnectedLayerInfo fc_info = FullyConnectedLayerInfo());
@@ -178,6 +192,7 @@ private:
     void configure_fc_fc(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const ActivationLayerInfo &act);
     void configure_conv_fc(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const ActivationLayerInfo &act);
     void configure_mm(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const ActivationLayerInfo &act);
+    void configure_dynamic_quantization_mm(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const ActivationLayerInfo &act);
 
     MemoryGroup                                                         _memory_group;
     IWeightsManager                                                    *_weights_manager;
@@ -188,14 +203,26 @@ private:
     weights_transformations::NEFullyConnectedLayerReshapeWeightsManaged _reshape_weights_managed_function;
     NEGEMM                                                              _mm_gemm;
     NEGEMMLowpMatrixMultiplyCore                                        _mm_gemmlowp;
+    std::unique_ptr<NEMinMaxRangeKernel>                                _min_max_range_kernel;
+    std::unique_ptr<NEQuantizationLayerKernel>                          _quantize_input_kernel;
+    std::unique_ptr<NEGEMMLowpDequantizeInt32ToFloatKernel>             _dequantize_output_kernel;
+    NEActivationLayer                                                   _activation_func;
     Tensor                                                              _flatten_output;
     Tensor                                                              _converted_weights_output;
     Tensor                                                              _reshape_weights_output;
+    Tensor                                                              _quantized_input;
+    Tensor                                                              _quantized_weights;
+    Tensor                                                              _quantized_weights_sums;
+    Tensor                                                              _mm_result_s32;
     const ITensor                                                      *_original_weights;
+    const ITensor                                                      *_weights_to_quantize;
     bool                                                                _are_weights_converted;
     bool                                                                _are_weights_reshaped;
     bool                                                                _is_fc_after_conv;
     bool                                                                _is_quantized_asymmetric;
+    bool                                                                _is_dynamically_quantized;
+    bool                                                                _sparse_weights;
+    bool                                                                _run_activation;
     bool                                                                _is_prepared;
 };
 } // namespace arm_compute
@@ -44,6 +44,7 @@ struct AsmGemmInfo
 {
     AsmConvMethod           method{ AsmConvMethod::Im2Col };
     PadStrideInfo           ps_info{};
+    Size2D                  dilation{ 1U, 1U };
     ActivationLayerInfo     activation_info{};
     GEMMLowpOutputStageInfo output_stage{};
     bool                    negated_offsets{ true };
@@ -52,6 +53,8 @@ struct AsmGemmInfo
     int64_t                 padding_top{ 0 };
     int64_t                 padding_left{ 0 };
     float                   padding_value{ 0.f };
+    bool                    sparse_weights{ false };
+    bool                    fast_mode{ false };
 };
 
 /** Assembly kernel glue */
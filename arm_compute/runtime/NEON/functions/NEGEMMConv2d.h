@@ -27,6 +27,8 @@
 #include "arm_compute/runtime/FunctionDescriptors.h"
 #include "arm_compute/runtime/IFunction.h"
 #include "arm_compute/runtime/IMemoryManager.h"
+#include "arm_compute/runtime/ITransformWeights.h"
+#include "arm_compute/runtime/IWeightsManager.h"
 #include "arm_compute/runtime/NEON/functions/NEActivationLayer.h"
 #include "arm_compute/runtime/NEON/functions/NEGEMMAssemblyDispatch.h"
 #include "arm_compute/runtime/NEON/functions/NEPermute.h"
@@ -37,6 +39,54 @@ namespace arm_compute
 {
 // Forward declarations
 class ITensor;
+
+namespace weights_transformations
+{
+/** Basic function to manage the permuted weights generated from @ref NEPermute */
+class NEPermuteWeightsTransform : public ITransformWeights
+{
+public:
+    void run() override
+    {
+        _output.allocator()->allocate();
+        _func.run();
+        _reshape_run = true;
+    }
+
+    void release() override
+    {
+        _output.allocator()->free();
+    }
+
+    ITensor *get_weights() override
+    {
+        return &_output;
+    }
+
+    uint32_t uid() override
+    {
+        // Different permutations of the same weights must not be shared
+        uint32_t id = 0x10;
+        for(unsigned int i = 0; i < _perm.num_dimensions(); ++i)
+        {
+            id |= (_perm[i] & 0x3) << (8 + 2 * i);
+        }
+        return id;
+    }
+
+    void configure(const ITensor *input, const PermutationVector &perm)
+    {
+        _perm = perm;
+        _func.configure(input, &_output, perm);
+    }
+
+private:
+    Tensor            _output{};
+    NEPermute         _func{};
+    PermutationVector _perm{};
+};
+} // namespace weights_transformations
+
 /** Basic function to compute the convolution layer. This function calls the following NEON kernels/functions:
  *
  * Supports only NHWC data layout
@@ -46,12 +96,14 @@ class ITensor;
  *
  * Weights are transformed from OHWI to HWIO format using the following kernels:
  * -# @ref NEPermute
+ *
+ * If the weights are handled by a weights manager, the permutation and the assembly pretranspose are run through it.
  */
 class NEGEMMConv2d : public IFunction
 {
 public:
     /** Constructor */
-    NEGEMMConv2d(const std::shared_ptr<IMemoryManager> &memory_manager = nullptr);
+    NEGEMMConv2d(const std::shared_ptr<IMemoryManager> &memory_manager = nullptr, IWeightsManager *weights_manager = nullptr);
     /** Prevent instances of this class from being copied (As this class contains pointers) */
     NEGEMMConv2d(const NEGEMMConv2d &) = delete;
     /** Default move constructor */
@@ -73,7 +125,7 @@ public:
      *                     Data types supported: Same as @p input.
      * @param[in]  info    Convolution layer descriptor
      */
-    void configure(ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const Conv2dInfo &info);
+    void configure(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const Conv2dInfo &info);
     /** Static function to check if given info will lead to a valid configuration of @ref NEGEMMConv2d
      *
      * @param[in] input   Source tensor info. 3 lower dimensions represent a single input [width, height, IFM],
@@ -96,13 +148,15 @@ public:
     void prepare() override;
 
 private:
-    NEGEMMAssemblyDispatch _gemm_asm_func;
-    NEActivationLayer      _activation_func;
-    NEPermute              _weights_permute_func;
-    const ITensor         *_original_weights;
-    Tensor                 _permuted_weights;
-    bool                   _is_prepared;
-    bool                   _run_activation;
+    IWeightsManager                                   *_weights_manager;
+    NEGEMMAssemblyDispatch                             _gemm_asm_func;
+    NEActivationLayer                                  _activation_func;
+    NEPermute                                          _weights_permute_func;
+    weights_transformations::NEPermuteWeightsTransform _weights_permute_managed;
+    const ITensor                                     *_original_weights;
+    Tensor                                             _permuted_weights;
+    bool                                               _is_prepared;
+    bool                                               _run_activation;
 };
 } // namespace arm_compute
 #endif /* ARM_COMPUTE_NEGEMMCONV2D_H */
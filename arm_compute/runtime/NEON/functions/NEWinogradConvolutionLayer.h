@@ -31,6 +31,7 @@
 #include "arm_compute/runtime/MemoryGroup.h"
 #include "arm_compute/runtime/NEON/functions/NEActivationLayer.h"
 #include "arm_compute/runtime/NEON/functions/NEGEMM.h"
+#include "arm_compute/runtime/NEON/functions/NEGEMMAssemblyDispatch.h"
 
 #include "arm_compute/runtime/Tensor.h"
 
@@ -49,7 +50,12 @@ class ICPPKernel;
  * -# @ref NEGEMMAssemblyDispatch
  * -# @ref CPPPermute (three times: weights, input and output)
  *
+ * For quantized data types the following NEON kernels are also called:
+ * -# @ref NEWinogradLayerRemoveOffsetKernel (on the input, and once on the weights in the first call to the run() method)
+ * -# @ref NEGEMMLowpOffsetContributionOutputStageKernel
+ *
  * @note  Some Winograd configurations (i.e. F(2x2, 5x5), F(4x4, 5x5)) are supported only with enable_fast_math = true
+ * @note  Quantized data types are only supported with 3x3 kernels, which always use F(2x2, 3x3) with exact 16-bit transforms
  */
 class NEWinogradConvolutionLayer : public IFunction
 {
@@ -67,10 +73,12 @@ public:
      *
      * @param[in]  input            Source tensor. 3 lower dimensions represent a single input [width, height, IFM],
      *                              while every optional dimension from 4 and above represent a batch of inputs.
-     *                              Data types supported: F16/F32.
-     * @param[in]  weights          Weights tensor. Weights are 4D tensor with dimensions [kernel_x, kernel_y, IFM, OFM]. Data type supported: Same as @p input.
+     *                              Data types supported: QASYMM8/QASYMM8_SIGNED/F16/F32.
+     * @param[in]  weights          Weights tensor. Weights are 4D tensor with dimensions [kernel_x, kernel_y, IFM, OFM].
+     *                              Data type supported: Same as @p input, also QSYMM8_PER_CHANNEL if input is QASYMM8_SIGNED.
      *                              Currently only 3x3 and 5x5 kernels are supported.
-     * @param[in]  biases           Biases tensor. Shared biases supported. Biases are 1D tensor with dimensions [OFM]. Data type supported: Same as @p weights.
+     * @param[in]  biases           Biases tensor. Shared biases supported. Biases are 1D tensor with dimensions [OFM].
+     *                              Data type supported: Should match @p input data type, except for input of quantized type where biases should be of S32 type.
      * @param[out] output           Destination tensor. 3 lower dimensions represent a single output [width, height, OFM], while the rest represent batch of outputs.
      *                              Data types supported: Same as @p input.
      * @param[in]  conv_info        Contains padding and stride information described in @ref PadStrideInfo. Currently only unit strides are supported.
@@ -89,10 +97,12 @@ public:
      *
      * @param[in] input            Source tensor. 3 lower dimensions represent a single input [width, height, IFM],
      *                             while every optional dimension from 4 and above represent a batch of inputs.
-     *                             Data types supported: F16/F32.
-     * @param[in] weights          Weights tensor. Weights are 4D tensor with dimensions [kernel_x, kernel_y, IFM, OFM]. Data type supported:Same as @p input.
+     *                             Data types supported: QASYMM8/QASYMM8_SIGNED/F16/F32.
+     * @param[in] weights          Weights tensor. Weights are 4D tensor with dimensions [kernel_x, kernel_y, IFM, OFM].
+     *                             Data type supported: Same as @p input, also QSYMM8_PER_CHANNEL if input is QASYMM8_SIGNED.
      *                             Currently only 3x3 and 5x5 kernels are supported.
-     * @param[in] biases           Biases tensor. Shared biases supported. Biases are 1D tensor with dimensions [OFM]. Data type supported: Same as @p weights.
+     * @param[in] biases           Biases tensor. Shared biases supported. Biases are 1D tensor with dimensions [OFM].
+     *                             Data type supported: Should match @p input data type, except for input of quantized type where biases should be of S32 type.
      * @param[in] output           Destination tensor. 3 lower dimensions represent a single output [width, height, OFM], while the rest represent batch of outputs.
      *                             Data types supported: Same as @p input.
      * @param[in] conv_info        Contains padding and stride information described in @ref PadStrideInfo. Currently only unit strides are supported.
@@ -110,12 +120,26 @@ public:
     /** Prevent instances of this class from being copied (As this class contains pointers) */
     NEWinogradConvolutionLayer &operator=(const NEWinogradConvolutionLayer &) = delete;
 
+protected:
+    /** Force the number of rows of output tiles transformed and multiplied at once
+     *
+     * @note Must be called before @ref configure
+     *
+     * @param[in] tile_rows_per_block Number of rows of output tiles in each block.
+     *                                0 picks the largest block whose Winograd domain tensors fit in the L2 caches.
+     */
+    void set_tile_rows_per_block(unsigned int tile_rows_per_block);
+
 private:
     MemoryGroup                 _memory_group;
     NEGEMM                      _gemm_function;
+    NEGEMMAssemblyDispatch      _asm_glue;
     std::unique_ptr<ICPPKernel> _transform_input_kernel;
     std::unique_ptr<ICPPKernel> _transform_output_kernel;
     std::unique_ptr<ICPPKernel> _transform_weights_kernel;
+    std::unique_ptr<ICPPKernel> _remove_input_offset_kernel;
+    std::unique_ptr<ICPPKernel> _remove_weights_offset_kernel;
+    std::unique_ptr<ICPPKernel> _output_stage_kernel;
     NEActivationLayer           _activationlayer_function;
 
     CPPPermute     _permute_input;
@@ -129,11 +153,18 @@ private:
     Tensor         _input_nhwc;
     Tensor         _output_nhwc;
     Tensor         _weights_hwio;
+    Tensor         _input_s16;
+    Tensor         _weights_hwio_s16;
+    Tensor         _output_s32;
     const ITensor *_input;
     const ITensor *_weights;
     ITensor       *_output;
     bool           _is_prepared;
     bool           _is_activationlayer_enabled;
+    bool           _is_quantized;
+    unsigned int   _num_tile_rows;
+    unsigned int   _tile_rows_per_block;
+    unsigned int   _forced_tile_rows_per_block;
 };
 } // namespace arm_compute
 #endif /* ARM_COMPUTE_NEWINOGRADCONVOLUTIONLAYER_H */
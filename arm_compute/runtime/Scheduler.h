@@ -50,9 +50,18 @@ public:
     static void set(std::shared_ptr<IScheduler> scheduler);
     /** Access the scheduler singleton.
      *
-     * @return A reference to the scheduler object.
+     * @return A reference to the scheduler object, or to the scheduler of the calling thread if one has been set with @ref set_thread_scheduler.
      */
     static IScheduler &get();
+    /** Sets a scheduler to be used by the calling thread only, instead of the active scheduler.
+     *
+     * Lets several threads run functions concurrently, each of them on its own scheduler (e.g. on a partition of the cores).
+     *
+     * @note Ignored when the library is built without multi-threading support.
+     *
+     * @param[in] scheduler Scheduler to use in the calling thread. Pass nullptr to use the active scheduler again.
+     */
+    static void set_thread_scheduler(IScheduler *scheduler);
     /** Set the active scheduler.
      *
      * Only one scheduler can be enabled at any time.
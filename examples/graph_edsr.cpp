@@ -71,14 +71,18 @@ public:
         model.setup(common_params, *expected_output_filename);
 
         GraphConfig config;
-        config.num_threads = common_params.threads;
-        config.use_tuner   = common_params.enable_tuner;
-        config.tuner_mode  = common_params.tuner_mode;
-        config.tuner_file  = common_params.tuner_file;
+        config.num_threads             = common_params.threads;
+        config.use_tuner               = common_params.enable_tuner;
+        config.use_conv_method_tuner   = common_params.enable_conv_method_tuner;
+        config.use_pipelined_execution = common_params.pipelined;
+        config.num_pipeline_stages     = common_params.pipeline_stages;
+        config.tuner_mode              = common_params.tuner_mode;
+        config.tuner_file              = common_params.tuner_file;
+        config.plan_file               = common_params.plan_file;
 
         context.set_config(config);
 
-        auto pass_manager = create_default_pass_manager(common_params.target, config);
+        auto pass_manager = create_default_pass_manager(common_params.target, config, config.plan_file.empty() ? nullptr : &context.plan());
         manager.finalize_graph(model.graph(), context, pass_manager, common_params.target);
 
         return true;
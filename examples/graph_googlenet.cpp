@@ -126,10 +126,14 @@ public:
 
         // Finalize graph
         GraphConfig config;
-        config.num_threads = common_params.threads;
-        config.use_tuner   = common_params.enable_tuner;
-        config.tuner_mode  = common_params.tuner_mode;
-        config.tuner_file  = common_params.tuner_file;
+        config.num_threads             = common_params.threads;
+        config.use_tuner               = common_params.enable_tuner;
+        config.use_conv_method_tuner   = common_params.enable_conv_method_tuner;
+        config.use_pipelined_execution = common_params.pipelined;
+        config.num_pipeline_stages     = common_params.pipeline_stages;
+        config.tuner_mode              = common_params.tuner_mode;
+        config.tuner_file              = common_params.tuner_file;
+        config.plan_file               = common_params.plan_file;
 
         graph.finalize(common_params.target, config);
 
@@ -169,4 +169,9 @@ void ITensor::mark_as_unused() const
 {
     _is_used = false;
 }
+
+void ITensor::mark_as_used() const
+{
+    _is_used = true;
+}
 } // namespace arm_compute
\ No newline at end of file
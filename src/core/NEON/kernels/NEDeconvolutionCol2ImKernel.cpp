@@ -0,0 +1,233 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/core/NEON/kernels/NEDeconvolutionCol2ImKernel.h"
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/core/Validate.h"
+#include "src/core/CPP/Validate.h"
+#include "src/core/NEON/wrapper/wrapper.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/WindowHelpers.h"
+
+namespace arm_compute
+{
+namespace
+{
+constexpr auto   dim_manual_loop = Window::Dimension(0, 0, 0);
+constexpr size_t vector_size     = 16;
+
+/** Range of kernel taps, along one dimension, which map onto output coordinate @p out_coord
+ *
+ * The valid taps are [start, end) with a step equal to the stride.
+ */
+inline void compute_valid_taps(int32_t out_coord, int32_t pad, int32_t stride, int32_t input_size, int32_t kernel_size, int32_t &start, int32_t &end)
+{
+    // Tap k reads input element (out_coord + pad - k) / stride, if the division is exact
+    const int32_t base        = out_coord + pad;
+    const int32_t lowest_kern = base - stride * (input_size - 1);
+
+    start = base % stride;
+    if(lowest_kern > start)
+    {
+        start += ((lowest_kern - start + stride - 1) / stride) * stride;
+    }
+    end = std::min(kernel_size, base + 1);
+}
+
+TensorShape compute_output_shape(const ITensorInfo &input, const Size2D &kernel_dims, const PadStrideInfo &info)
+{
+    const auto out_dims = deconvolution_output_dimensions(input.dimension(1), input.dimension(2), kernel_dims.width, kernel_dims.height, info);
+
+    TensorShape output_shape = input.tensor_shape();
+    output_shape.set(0, input.dimension(0) / kernel_dims.area());
+    output_shape.set(1, out_dims.first);
+    output_shape.set(2, out_dims.second);
+    return output_shape;
+}
+
+Status validate_arguments(const ITensorInfo *input, const ITensorInfo *bias, const ITensorInfo *output, const Size2D &kernel_dims, const PadStrideInfo &info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, output);
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(input);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F16, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON(kernel_dims.area() == 0);
+    ARM_COMPUTE_RETURN_ERROR_ON(input->dimension(0) % kernel_dims.area() != 0);
+    ARM_COMPUTE_RETURN_ERROR_ON(input->num_dimensions() > 4);
+    ARM_COMPUTE_RETURN_ERROR_ON((info.stride().first < 1) || (info.stride().second < 1));
+    ARM_COMPUTE_RETURN_ERROR_ON(((input->dimension(1) - 1) * info.stride().first + kernel_dims.width) <= (info.pad_left() + info.pad_right()));
+    ARM_COMPUTE_RETURN_ERROR_ON(((input->dimension(2) - 1) * info.stride().second + kernel_dims.height) <= (info.pad_top() + info.pad_bottom()));
+
+    if(bias != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, bias);
+        ARM_COMPUTE_RETURN_ERROR_ON(bias->num_dimensions() > 1);
+        ARM_COMPUTE_RETURN_ERROR_ON(bias->dimension(0) != input->dimension(0) / kernel_dims.area());
+    }
+
+    if(output->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_LAYOUT_NOT_IN(output, DataLayout::NHWC);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(output->tensor_shape(), compute_output_shape(*input, kernel_dims, info));
+    }
+
+    return Status{};
+}
+} // namespace
+
+NEDeconvolutionCol2ImKernel::NEDeconvolutionCol2ImKernel()
+    : _func(nullptr), _input(nullptr), _bias(nullptr), _output(nullptr), _kernel_dims(), _info()
+{
+}
+
+void NEDeconvolutionCol2ImKernel::configure(const ITensor *input, const ITensor *bias, ITensor *output, const Size2D &kernel_dims, const PadStrideInfo &info)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, output);
+
+    // Output auto initialization if not yet initialized
+    auto_init_if_empty(*output->info(), input->info()->clone()->set_is_resizable(true).reset_padding().set_tensor_shape(compute_output_shape(*input->info(), kernel_dims, info)));
+
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(input->info(), (bias != nullptr) ? bias->info() : nullptr, output->info(), kernel_dims, info));
+
+    _input       = input;
+    _bias        = bias;
+    _output      = output;
+    _kernel_dims = kernel_dims;
+    _info        = info;
+
+    switch(input->info()->data_type())
+    {
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+        case DataType::F16:
+            _func = &NEDeconvolutionCol2ImKernel::run_col2im<float16_t>;
+            break;
+#endif // __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+        case DataType::F32:
+            _func = &NEDeconvolutionCol2ImKernel::run_col2im<float>;
+            break;
+        default:
+            ARM_COMPUTE_ERROR("Data type not supported");
+            break;
+    }
+
+    // Configure kernel window
+    Window      win = calculate_max_window(*output->info(), Steps());
+    Coordinates coord;
+    coord.set_num_dimensions(output->info()->num_dimensions());
+    output->info()->set_valid_region(ValidRegion(coord, output->info()->tensor_shape()));
+    INEKernel::configure(win);
+}
+
+Status NEDeconvolutionCol2ImKernel::validate(const ITensorInfo *input, const ITensorInfo *bias, const ITensorInfo *output, const Size2D &kernel_dims, const PadStrideInfo &info)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(input, bias, output, kernel_dims, info));
+    return Status{};
+}
+
+template <typename T>
+void NEDeconvolutionCol2ImKernel::run_col2im(const Window &window)
+{
+    using VectorType = typename wrapper::traits::neon_vector<T, vector_size / sizeof(T)>::type;
+    using TagType    = typename wrapper::traits::neon_vector<T, vector_size / sizeof(T)>::tag_type;
+
+    constexpr int32_t elements_per_vector = vector_size / sizeof(T);
+
+    const int32_t num_ofm        = static_cast<int32_t>(_output->info()->dimension(0));
+    const int32_t kernel_width   = static_cast<int32_t>(_kernel_dims.width);
+    const int32_t kernel_height  = static_cast<int32_t>(_kernel_dims.height);
+    const int32_t stride_x       = static_cast<int32_t>(_info.stride().first);
+    const int32_t stride_y       = static_cast<int32_t>(_info.stride().second);
+    const int32_t pad_left       = static_cast<int32_t>(_info.pad_left());
+    const int32_t pad_top        = static_cast<int32_t>(_info.pad_top());
+    const int32_t input_width    = static_cast<int32_t>(_input->info()->dimension(1));
+    const int32_t input_height   = static_cast<int32_t>(_input->info()->dimension(2));
+    const size_t  input_stride_y = _input->info()->strides_in_bytes()[1];
+    const size_t  input_stride_z = _input->info()->strides_in_bytes()[2];
+    const size_t  input_stride_w = _input->info()->strides_in_bytes()[3];
+
+    const uint8_t *input_base = _input->buffer() + _input->info()->offset_first_element_in_bytes();
+    const T       *bias_ptr   = (_bias != nullptr) ? reinterpret_cast<const T *>(_bias->buffer() + _bias->info()->offset_first_element_in_bytes()) : nullptr;
+
+    Window win = window;
+    win.set(Window::DimX, dim_manual_loop);
+
+    Iterator output_it(_output, win);
+
+    execute_window_loop(win, [&](const Coordinates & id)
+    {
+        int32_t kx_start = 0;
+        int32_t kx_end   = 0;
+        int32_t ky_start = 0;
+        int32_t ky_end   = 0;
+        compute_valid_taps(id.y(), pad_left, stride_x, input_width, kernel_width, kx_start, kx_end);
+        compute_valid_taps(id.z(), pad_top, stride_y, input_height, kernel_height, ky_start, ky_end);
+
+        const uint8_t *input_batch = input_base + id[3] * input_stride_w;
+        const auto     output_ptr  = reinterpret_cast<T *>(output_it.ptr());
+
+        int32_t c = 0;
+        for(; c <= num_ofm - elements_per_vector; c += elements_per_vector)
+        {
+            VectorType acc = (bias_ptr != nullptr) ? wrapper::vloadq(bias_ptr + c) : wrapper::vdup_n(static_cast<T>(0), TagType{});
+            for(int32_t ky = ky_start; ky < ky_end; ky += stride_y)
+            {
+                const uint8_t *input_row = input_batch + ((id.z() + pad_top - ky) / stride_y) * input_stride_z;
+                for(int32_t kx = kx_start; kx < kx_end; kx += stride_x)
+                {
+                    const auto input_ptr = reinterpret_cast<const T *>(input_row + ((id.y() + pad_left - kx) / stride_x) * input_stride_y) + (kx + ky * kernel_width) * num_ofm + c;
+                    acc                  = wrapper::vadd(acc, wrapper::vloadq(input_ptr));
+                }
+            }
+            wrapper::vstore(output_ptr + c, acc);
+        }
+
+        // Compute left-over elements
+        for(; c < num_ofm; ++c)
+        {
+            T acc = (bias_ptr != nullptr) ? bias_ptr[c] : static_cast<T>(0);
+            for(int32_t ky = ky_start; ky < ky_end; ky += stride_y)
+            {
+                const uint8_t *input_row = input_batch + ((id.z() + pad_top - ky) / stride_y) * input_stride_z;
+                for(int32_t kx = kx_start; kx < kx_end; kx += stride_x)
+                {
+                    acc += *(reinterpret_cast<const T *>(input_row + ((id.y() + pad_left - kx) / stride_x) * input_stride_y) + (kx + ky * kernel_width) * num_ofm + c);
+                }
+            }
+            output_ptr[c] = acc;
+        }
+    },
+    output_it);
+}
+
+void NEDeconvolutionCol2ImKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+
+    (this->*_func)(window);
+}
+} // namespace arm_compute
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_NEDECONVOLUTIONCOL2IMKERNEL_H
+#define ARM_COMPUTE_NEDECONVOLUTIONCOL2IMKERNEL_H
+
+#include "src/core/NEON/INEKernel.h"
+
+namespace arm_compute
+{
+// Forward declarations
+class ITensor;
+
+/** Interface for the kernel to accumulate the columns produced by the GEMM of a deconvolution into its output.
+ *
+ * The input holds, for every input element, the contribution of each kernel tap to each output feature map:
+ * [OFM * kernel_x * kernel_y, width_in, height_in, batches], with the feature maps varying fastest, then kernel_x, then kernel_y.
+ *
+ * Every output element gathers the taps that map onto it, which are the ones of the same phase modulo the stride:
+ *  \f[
+ *       out(ofm, x, y) = bias(ofm) + \sum_{kx, ky} in(ofm, kx, ky, (x + pad\_left - kx) / stride\_x, (y + pad\_top - ky) / stride\_y)
+ *  \f]
+ *
+ * where only the taps for which the divisions are exact and land inside the input are summed.
+ */
+class NEDeconvolutionCol2ImKernel : public INEKernel
+{
+public:
+    const char *name() const override
+    {
+        return "NEDeconvolutionCol2ImKernel";
+    }
+    /** Default constructor */
+    NEDeconvolutionCol2ImKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEDeconvolutionCol2ImKernel(const NEDeconvolutionCol2ImKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEDeconvolutionCol2ImKernel &operator=(const NEDeconvolutionCol2ImKernel &) = delete;
+    /** Default Move Constructor. */
+    NEDeconvolutionCol2ImKernel(NEDeconvolutionCol2ImKernel &&) = default;
+    /** Default move assignment operator */
+    NEDeconvolutionCol2ImKernel &operator=(NEDeconvolutionCol2ImKernel &&) = default;
+    /** Default destructor */
+    ~NEDeconvolutionCol2ImKernel() = default;
+    /** Initialise the kernel's input, bias and output.
+     *
+     * @note Supported data layouts: NHWC
+     *
+     * @param[in]  input       Input tensor with dimensions [OFM * kernel_x * kernel_y, width_in, height_in, batches]. Data types supported: F16/F32.
+     * @param[in]  bias        Bias tensor. A 1D tensor with dimensions [OFM]. Can be nullptr. Data type supported: Same as @p input.
+     * @param[out] output      Output tensor with dimensions [OFM, width_out, height_out, batches]. Data type supported: Same as @p input.
+     * @param[in]  kernel_dims Width and height of the deconvolution kernel.
+     * @param[in]  info        Padding and stride information of the deconvolution.
+     */
+    void configure(const ITensor *input, const ITensor *bias, ITensor *output, const Size2D &kernel_dims, const PadStrideInfo &info);
+    /** Static function to check if given info will lead to a valid configuration of @ref NEDeconvolutionCol2ImKernel
+     *
+     * @note Supported data layouts: NHWC
+     *
+     * @param[in] input       Input tensor info with dimensions [OFM * kernel_x * kernel_y, width_in, height_in, batches]. Data types supported: F16/F32.
+     * @param[in] bias        Bias tensor info. A 1D tensor with dimensions [OFM]. Can be nullptr. Data type supported: Same as @p input.
+     * @param[in] output      Output tensor info with dimensions [OFM, width_out, height_out, batches]. Data type supported: Same as @p input.
+     * @param[in] kernel_dims Width and height of the deconvolution kernel.
+     * @param[in] info        Padding and stride information of the deconvolution.
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *input, const ITensorInfo *bias, const ITensorInfo *output, const Size2D &kernel_dims, const PadStrideInfo &info);
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+
+private:
+    template <typename T>
+    void run_col2im(const Window &window);
+
+    /** Common signature for all the specialised deconvolution col2im functions
+     *
+     * @param[in] window Region on which to execute the kernel.
+     */
+    using Col2ImFunctionPtr = void (NEDeconvolutionCol2ImKernel::*)(const Window &window);
+
+    Col2ImFunctionPtr _func;
+    const ITensor    *_input;
+    const ITensor    *_bias;
+    ITensor          *_output;
+    Size2D            _kernel_dims;
+    PadStrideInfo     _info;
+};
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_NEDECONVOLUTIONCOL2IMKERNEL_H */
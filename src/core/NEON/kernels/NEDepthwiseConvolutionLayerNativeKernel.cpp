@@ -45,7 +45,8 @@ const size_t   channel_idx = get_data_layout_dimension_index(data_layout, DataLa
 
 constexpr auto   dim_manual_loop      = Window::Dimension(0, 0, 0);
 constexpr auto   dim_single_unit_step = Window::Dimension(0, 1, 1);
-constexpr size_t vector_size          = 8;
+constexpr size_t vector_size          = 16;
+constexpr size_t num_tiled_vectors    = 4;
 
 struct DepthwiseConvolutionRunInfo
 {
@@ -54,9 +55,10 @@ struct DepthwiseConvolutionRunInfo
     const uint32_t x_end;
     const uint32_t x_step;
     const uint32_t x_leftover_start;
+    const uint32_t x_tile_step;
+    const uint32_t x_tile_leftover_start;
     const size_t   input_stride_y;
     const size_t   input_stride_z;
-    const size_t   input_max_offset;
     const size_t   weights_width;
     const size_t   weights_height;
     const size_t   weights_stride_y;
@@ -75,9 +77,10 @@ struct DepthwiseConvolutionRunInfo
           x_end(w.x().end()),
           x_step(static_cast<uint32_t>(num_read_elements_per_iteration * depth_multiplier)),
           x_leftover_start(std::max(static_cast<int32_t>(w.x().end()) - static_cast<int32_t>(x_step) + 1, int32_t(0))),
+          x_tile_step(static_cast<uint32_t>(x_step * num_tiled_vectors)),
+          x_tile_leftover_start(std::max(static_cast<int32_t>(w.x().end()) - static_cast<int32_t>(x_tile_step) + 1, int32_t(0))),
           input_stride_y(input.strides_in_bytes().y()),
           input_stride_z(input.strides_in_bytes().z()),
-          input_max_offset(input.strides_in_bytes().z() * input.dimension(height_idx) - (input.padding().bottom + input.padding().top) * input.strides_in_bytes().y()),
           weights_width(weights.dimension(width_idx)),
           weights_height(weights.dimension(height_idx)),
           weights_stride_y(weights.strides_in_bytes().y()),
@@ -93,28 +96,93 @@ struct DepthwiseConvolutionRunInfo
     }
 };
 
-inline bool is_valid_input_region(int32_t base_w, uint32_t base_h, uint32_t w, uint32_t h, const DepthwiseConvolutionRunInfo &run_info, const Size2D &dilation)
+/** Range of kernel taps, along width and height, which read from inside the input tensor */
+struct DepthwiseConvolutionTapRange
 {
-    const int32_t current_h  = base_h + h * dilation.y();
-    const bool    is_valid_h = current_h >= 0 && current_h < static_cast<int32_t>(run_info.input_height);
+    uint32_t w_start;
+    uint32_t w_end;
+    uint32_t h_start;
+    uint32_t h_end;
+};
 
-    const int32_t current_w  = base_w + w * dilation.x();
-    const bool    is_valid_w = current_w >= 0 && current_w < static_cast<int32_t>(run_info.input_width);
+inline void compute_valid_taps(int32_t base, size_t input_size, size_t kernel_size, uint32_t dilation, uint32_t &start, uint32_t &end)
+{
+    const int64_t first = base < 0 ? (static_cast<int64_t>(-base) + dilation - 1) / dilation : 0;
+    const int64_t last  = (static_cast<int64_t>(input_size) - base + dilation - 1) / dilation;
 
-    return is_valid_h && is_valid_w;
+    start = static_cast<uint32_t>(std::min(first, static_cast<int64_t>(kernel_size)));
+    end   = static_cast<uint32_t>(std::max(std::min(last, static_cast<int64_t>(kernel_size)), static_cast<int64_t>(start)));
 }
 
-template <typename T>
-void depthwise_loop_multiplier1_fp(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const PadStrideInfo &conv_info,
-                                   const Size2D &dilation, const Window &window, bool has_biases)
+inline DepthwiseConvolutionTapRange compute_valid_tap_range(int32_t base_w, int32_t base_h, const DepthwiseConvolutionRunInfo &run_info, const Size2D &dilation)
+{
+    DepthwiseConvolutionTapRange taps{};
+    compute_valid_taps(base_w, run_info.input_width, run_info.weights_width, dilation.x(), taps.w_start, taps.w_end);
+    compute_valid_taps(base_h, run_info.input_height, run_info.weights_height, dilation.y(), taps.h_start, taps.h_end);
+    return taps;
+}
+
+/** Window of the output tensor written while executing @p window
+ *
+ * Rows and batches are made relative to @p block_origin, the first output row and batch of the block being computed.
+ */
+inline Window output_block_window(Window win, const Coordinates &block_origin)
+{
+    win.set(Window::DimZ, Window::Dimension(win.z().start() - block_origin.z(), win.z().end() - block_origin.z(), win.z().step()));
+    win.set(Window::DimW, Window::Dimension(win[Window::DimW].start() - block_origin[Window::DimW], win[Window::DimW].end() - block_origin[Window::DimW], win[Window::DimW].step()));
+    return win;
+}
+
+/** Accumulate @p num_vectors consecutive vectors of channels starting at @p x for a single output element
+ *
+ * Padded taps contribute zero, so only the taps in @p taps are visited and every accumulator stays in a register.
+ */
+template <typename T, size_t num_vectors>
+inline void depthwise_multiplier1_fp_vectors(const uint8_t *input_ptr, int64_t base_input_offset, const uint8_t *weights_ptr, const uint8_t *biases_ptr, uint8_t *output_ptr,
+                                             uint32_t x, const DepthwiseConvolutionRunInfo &run_info, const DepthwiseConvolutionTapRange &taps, const Size2D &dilation)
 {
     constexpr auto element_per_vector = vector_size / sizeof(T);
     using VectorType                  = typename wrapper::traits::neon_vector<T, element_per_vector>::type;
     using TagType                     = typename wrapper::traits::neon_vector<T, element_per_vector>::tag_type;
 
-    const auto run_info = DepthwiseConvolutionRunInfo(*input->info(), *weights->info(), conv_info, window);
+    VectorType acc[num_vectors];
+    for(size_t i = 0; i < num_vectors; ++i)
+    {
+        acc[i] = wrapper::vdup_n(static_cast<T>(0), TagType{});
+    }
+
+    for(uint32_t h = taps.h_start; h < taps.h_end; ++h)
+    {
+        const int64_t row_offset  = base_input_offset + h * dilation.y() * run_info.input_stride_z + x * sizeof(T);
+        const auto    weights_row = weights_ptr + h * run_info.weights_stride_z;
+
+        for(uint32_t w = taps.w_start; w < taps.w_end; ++w)
+        {
+            const auto in_ptr = reinterpret_cast<const T *>(input_ptr + row_offset + w * dilation.x() * run_info.input_stride_y);
+            const auto we_ptr = reinterpret_cast<const T *>(weights_row + w * run_info.weights_stride_y) + x;
+
+            for(size_t i = 0; i < num_vectors; ++i)
+            {
+                acc[i] = wrapper::vmla(acc[i], wrapper::vloadq(we_ptr + i * element_per_vector), wrapper::vloadq(in_ptr + i * element_per_vector));
+            }
+        }
+    }
+
+    for(size_t i = 0; i < num_vectors; ++i)
+    {
+        if(biases_ptr != nullptr)
+        {
+            acc[i] = wrapper::vadd(acc[i], wrapper::vloadq(reinterpret_cast<const T *>(biases_ptr) + x + i * element_per_vector));
+        }
+        wrapper::vstore(reinterpret_cast<T *>(output_ptr) + x + i * element_per_vector, acc[i]);
+    }
+}
 
-    const VectorType zero_vector = wrapper::vdup_n(static_cast<T>(0), TagType{});
+template <typename T>
+void depthwise_loop_multiplier1_fp(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const PadStrideInfo &conv_info,
+                                   const Size2D &dilation, const Window &window, const Coordinates &block_origin, bool has_biases)
+{
+    const auto run_info = DepthwiseConvolutionRunInfo(*input->info(), *weights->info(), conv_info, window);
 
     Window execution_window = window;
     execution_window.set(Window::DimX, dim_single_unit_step);
@@ -127,7 +195,7 @@ void depthwise_loop_multiplier1_fp(const ITensor *input, const ITensor *weights,
     Window win_weights = win_input;
     win_weights.set(Window::DimW, dim_manual_loop);
 
-    Window win_output = window;
+    Window win_output = output_block_window(window, block_origin);
     win_output.set(Window::DimX, dim_manual_loop);
 
     Iterator input_it(input, win_input);
@@ -145,72 +213,44 @@ void depthwise_loop_multiplier1_fp(const ITensor *input, const ITensor *weights,
         const int32_t input_y           = id.y() * run_info.conv_stride_x - run_info.conv_pad_left;
         const int32_t input_z           = id.z() * run_info.conv_stride_y - run_info.conv_pad_top;
         const int64_t base_input_offset = input_y * run_info.input_stride_y + input_z * run_info.input_stride_z;
+        const auto    taps              = compute_valid_tap_range(input_y, input_z, run_info, dilation);
 
         auto const base_weights_ptr = weights_it.ptr();
+        auto const biases_ptr       = has_biases ? biases_it.ptr() : nullptr;
         uint32_t   x                = run_info.x_start;
 
-        for(; x < run_info.x_leftover_start; x += run_info.x_step)
+        // Register-tiled main loop: several vectors of channels share each input/weights address computation
+        for(; x < run_info.x_tile_leftover_start; x += run_info.x_tile_step)
         {
-            VectorType acc          = zero_vector;
-            auto       weights_ptr  = base_weights_ptr;
-            int64_t    input_offset = base_input_offset;
-
-            for(uint32_t h = 0; h < run_info.weights_height; ++h)
-            {
-                int64_t offs = input_offset + x * sizeof(T);
-                for(uint32_t w = 0; w < run_info.weights_width; ++w)
-                {
-                    const bool is_valid_region = is_valid_input_region(input_y, input_z, w, h, run_info, dilation);
-                    const auto input_vals      = is_valid_region ?
-                                                 wrapper::vload(reinterpret_cast<T *>(input_it.ptr() + std::min(static_cast<size_t>(offs), run_info.input_max_offset))) :
-                                                 zero_vector;
-                    const auto weights_vals = wrapper::vload(reinterpret_cast<T *>(weights_ptr + w * run_info.weights_stride_y) + x);
-                    acc                     = wrapper::vmla(acc, weights_vals, input_vals);
-
-                    offs += dilation.x() * run_info.input_stride_y;
-                }
-
-                weights_ptr += run_info.weights_stride_z;
-                input_offset += dilation.y() * run_info.input_stride_z;
-            }
-
-            if(has_biases)
-            {
-                const auto biases_vals = wrapper::vload(reinterpret_cast<T *>(biases_it.ptr()) + x);
-                acc                    = wrapper::vadd(acc, biases_vals);
-            }
+            depthwise_multiplier1_fp_vectors<T, num_tiled_vectors>(input_it.ptr(), base_input_offset, base_weights_ptr, biases_ptr, output_it.ptr(), x, run_info, taps, dilation);
+        }
 
-            wrapper::vstore(reinterpret_cast<T *>(output_it.ptr()) + x, acc);
+        for(; x < run_info.x_leftover_start; x += run_info.x_step)
+        {
+            depthwise_multiplier1_fp_vectors<T, 1>(input_it.ptr(), base_input_offset, base_weights_ptr, biases_ptr, output_it.ptr(), x, run_info, taps, dilation);
         }
 
         for(; x < run_info.x_end; ++x)
         {
-            auto    acc_scalar   = T{ 0 };
-            auto    weights_ptr  = base_weights_ptr;
-            int64_t input_offset = base_input_offset;
+            auto acc_scalar = T{ 0 };
 
-            for(size_t h = 0; h < run_info.weights_height; ++h)
+            for(uint32_t h = taps.h_start; h < taps.h_end; ++h)
             {
-                int64_t offs = input_offset + x * sizeof(T);
-                for(size_t w = 0; w < run_info.weights_width; ++w)
-                {
-                    const bool is_valid_region = is_valid_input_region(input_y, input_z, w, h, run_info, dilation);
-                    const auto input_vals      = is_valid_region ? *reinterpret_cast<T *>(input_it.ptr() + std::min(static_cast<size_t>(offs), run_info.input_max_offset)) : 0;
-                    const auto weights_vals    = *(reinterpret_cast<T *>(weights_ptr + w * run_info.weights_stride_y) + x);
+                const int64_t row_offset  = base_input_offset + h * dilation.y() * run_info.input_stride_z + x * sizeof(T);
+                const auto    weights_row = base_weights_ptr + h * run_info.weights_stride_z;
 
-                    acc_scalar += (input_vals * weights_vals);
+                for(uint32_t w = taps.w_start; w < taps.w_end; ++w)
+                {
+                    const auto input_val   = *reinterpret_cast<T *>(input_it.ptr() + row_offset + w * dilation.x() * run_info.input_stride_y);
+                    const auto weights_val = *(reinterpret_cast<T *>(weights_row + w * run_info.weights_stride_y) + x);
 
-                    offs += dilation.x() * run_info.input_stride_y;
+                    acc_scalar += (input_val * weights_val);
                 }
-
-                weights_ptr += run_info.weights_stride_z;
-                input_offset += dilation.y() * run_info.input_stride_z;
             }
 
             if(has_biases)
             {
-                const auto biases_vals = *(reinterpret_cast<T *>(biases_it.ptr()) + x);
-                acc_scalar += biases_vals;
+                acc_scalar += *(reinterpret_cast<T *>(biases_ptr) + x);
             }
             *(reinterpret_cast<T *>(output_it.ptr()) + x) = acc_scalar;
         }
@@ -220,8 +260,12 @@ void depthwise_loop_multiplier1_fp(const ITensor *input, const ITensor *weights,
 
 template <typename T>
 void depthwise_loop_generic_fp(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const PadStrideInfo &conv_info,
-                               const Size2D &dilation, unsigned int depth_multiplier, const Window &window, bool has_biases)
+                               const Size2D &dilation, unsigned int depth_multiplier, const Window &window, const Coordinates &block_origin, bool has_biases)
 {
+    constexpr auto element_per_vector = vector_size / sizeof(T);
+    using VectorType                  = typename wrapper::traits::neon_vector<T, element_per_vector>::type;
+    using TagType                     = typename wrapper::traits::neon_vector<T, element_per_vector>::tag_type;
+
     const auto run_info = DepthwiseConvolutionRunInfo(*input->info(), *weights->info(), conv_info, window, depth_multiplier);
 
     Window execution_window = window;
@@ -238,7 +282,7 @@ void depthwise_loop_generic_fp(const ITensor *input, const ITensor *weights, con
     win_weights.set(Window::DimZ, dim_manual_loop);
     win_weights.set(Window::DimW, dim_manual_loop);
 
-    Window win_output = window;
+    Window win_output = output_block_window(window, block_origin);
     win_output.set_dimension_step(Window::DimX, run_info.x_step);
 
     Iterator input_it(input, win_input);
@@ -253,72 +297,123 @@ void depthwise_loop_generic_fp(const ITensor *input, const ITensor *weights, con
 
     execute_window_loop(execution_window, [&](const Coordinates & id)
     {
-        std::vector<T> acc(depth_multiplier, static_cast<T>(0));
+        const int32_t input_y           = id.y() * run_info.conv_stride_x - run_info.conv_pad_left;
+        const int32_t input_z           = id.z() * run_info.conv_stride_y - run_info.conv_pad_top;
+        const int64_t base_input_offset = input_y * run_info.input_stride_y + input_z * run_info.input_stride_z;
+        const auto    taps              = compute_valid_tap_range(input_y, input_z, run_info, dilation);
 
-        const int input_y      = id.y() * run_info.conv_stride_x - run_info.conv_pad_left;
-        const int input_z      = id.z() * run_info.conv_stride_y - run_info.conv_pad_top;
-        int       input_offset = input_y * run_info.input_stride_y + input_z * run_info.input_stride_z;
+        auto const weights_ptr = weights_it.ptr();
+        auto const output_ptr  = reinterpret_cast<T *>(output_it.ptr());
 
-        auto weights_ptr = weights_it.ptr();
-        for(size_t h = 0; h < run_info.weights_height; ++h)
+        // The output channels generated by one input channel are contiguous: broadcast the input and vectorise over the multiplier
+        uint32_t m = 0;
+        for(; m + element_per_vector <= depth_multiplier; m += element_per_vector)
         {
-            int offs = input_offset;
-            for(size_t w = 0; w < run_info.weights_width; ++w)
+            VectorType acc = wrapper::vdup_n(static_cast<T>(0), TagType{});
+
+            for(uint32_t h = taps.h_start; h < taps.h_end; ++h)
             {
-                const bool is_valid_region = is_valid_input_region(input_y, input_z, w, h, run_info, dilation);
-                const auto input_val       = is_valid_region ? *(reinterpret_cast<T *>(input_it.ptr() + std::min(static_cast<size_t>(offs), run_info.input_max_offset))) : T(0);
+                const int64_t row_offset  = base_input_offset + h * dilation.y() * run_info.input_stride_z;
+                const auto    weights_row = weights_ptr + h * run_info.weights_stride_z;
 
-                for(size_t m = 0; m < depth_multiplier; ++m)
+                for(uint32_t w = taps.w_start; w < taps.w_end; ++w)
                 {
-                    const auto weights_val = *(reinterpret_cast<T *>(weights_ptr + m * sizeof(T) + w * run_info.weights_stride_y));
-                    acc.at(m)              = support::cpp11::fma(weights_val, input_val, acc.at(m));
+                    const auto input_val    = *reinterpret_cast<T *>(input_it.ptr() + row_offset + w * dilation.x() * run_info.input_stride_y);
+                    const auto weights_vals = wrapper::vloadq(reinterpret_cast<T *>(weights_row + w * run_info.weights_stride_y) + m);
+                    acc                     = wrapper::vmla(acc, weights_vals, wrapper::vdup_n(input_val, TagType{}));
                 }
-
-                offs += dilation.x() * run_info.input_stride_y;
             }
 
-            weights_ptr += run_info.weights_stride_z;
-            input_offset += dilation.y() * run_info.input_stride_z;
+            if(has_biases)
+            {
+                acc = wrapper::vadd(acc, wrapper::vloadq(reinterpret_cast<T *>(biases_it.ptr()) + m));
+            }
+            wrapper::vstore(output_ptr + m, acc);
         }
 
-        if(has_biases)
+        for(; m < depth_multiplier; ++m)
         {
-            for(size_t m = 0; m < depth_multiplier; ++m)
+            auto acc_scalar = T{ 0 };
+
+            for(uint32_t h = taps.h_start; h < taps.h_end; ++h)
             {
-                const auto biases_val                                     = *(reinterpret_cast<T *>(biases_it.ptr() + m * sizeof(T)));
-                *(reinterpret_cast<T *>(output_it.ptr() + m * sizeof(T))) = acc.at(m) + biases_val;
+                const int64_t row_offset  = base_input_offset + h * dilation.y() * run_info.input_stride_z;
+                const auto    weights_row = weights_ptr + h * run_info.weights_stride_z;
+
+                for(uint32_t w = taps.w_start; w < taps.w_end; ++w)
+                {
+                    const auto input_val   = *reinterpret_cast<T *>(input_it.ptr() + row_offset + w * dilation.x() * run_info.input_stride_y);
+                    const auto weights_val = *(reinterpret_cast<T *>(weights_row + w * run_info.weights_stride_y) + m);
+                    acc_scalar             = support::cpp11::fma(weights_val, input_val, acc_scalar);
+                }
             }
-        }
-        else
-        {
-            for(size_t m = 0; m < depth_multiplier; ++m)
+
+            if(has_biases)
             {
-                *(reinterpret_cast<T *>(output_it.ptr() + m * sizeof(T))) = acc.at(m);
+                acc_scalar += *(reinterpret_cast<T *>(biases_it.ptr()) + m);
             }
+            output_ptr[m] = acc_scalar;
         }
     },
     input_it, weights_it, biases_it, output_it);
 }
 
+inline int32_t requantize_depthwise_acc(int32_t acc, int32_t out_mul, int32_t out_shift, int32_t output_qoffset)
+{
+    if(out_shift < 0)
+    {
+        return saturating_doubling_high_mul(acc * (1 << (-out_shift)), out_mul) + output_qoffset;
+    }
+    return rounding_divide_by_exp2(saturating_doubling_high_mul(acc, out_mul), out_shift) + output_qoffset;
+}
+
+inline int16x8_t widen_to_s16(const uint8x8_t &v)
+{
+    return vreinterpretq_s16_u16(vmovl_u8(v));
+}
+
+inline int16x8_t widen_to_s16(const int8x8_t &v)
+{
+    return vmovl_s8(v);
+}
+
+/** Multiply-accumulate 16 8-bit input and weights values, with their offsets removed, into four vectors of 32-bit accumulators
+ *
+ * The offsets of 8-bit quantized types fit in 16 bits, so the offset-corrected values are multiplied as 16-bit lanes and widened into the accumulators.
+ */
+template <typename T, typename TW>
+inline void depthwise_quantized_mla(int32x4_t (&acc)[4], const T *in_ptr, const TW *we_ptr, const int16x8_t &input_qoffset, const int16x8_t &weights_qoffset)
+{
+    const auto      in_vec  = wrapper::vloadq(in_ptr);
+    const auto      we_vec  = wrapper::vloadq(we_ptr);
+    const int16x8_t in_low  = vsubq_s16(widen_to_s16(wrapper::vgetlow(in_vec)), input_qoffset);
+    const int16x8_t in_high = vsubq_s16(widen_to_s16(wrapper::vgethigh(in_vec)), input_qoffset);
+    const int16x8_t we_low  = vsubq_s16(widen_to_s16(wrapper::vgetlow(we_vec)), weights_qoffset);
+    const int16x8_t we_high = vsubq_s16(widen_to_s16(wrapper::vgethigh(we_vec)), weights_qoffset);
+
+    acc[0] = vmlal_s16(acc[0], vget_low_s16(in_low), vget_low_s16(we_low));
+    acc[1] = vmlal_s16(acc[1], vget_high_s16(in_low), vget_high_s16(we_low));
+    acc[2] = vmlal_s16(acc[2], vget_low_s16(in_high), vget_low_s16(we_high));
+    acc[3] = vmlal_s16(acc[3], vget_high_s16(in_high), vget_high_s16(we_high));
+}
+
 template <typename T, typename TW>
 void depthwise_loop_multiplier1_quantized(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const PadStrideInfo &conv_info,
-                                          const Size2D &dilation, std::vector<int> output_multiplier, std::vector<int> output_shift, const Window &window, bool has_biases)
+                                          const Size2D &dilation, std::vector<int> output_multiplier, std::vector<int> output_shift, const Window &window, const Coordinates &block_origin,
+                                          bool has_biases)
 {
     constexpr auto element_per_vector = vector_size / sizeof(T);
-    using VectorType                  = typename wrapper::traits::neon_vector<T, element_per_vector>::type;
-    using TagType                     = typename wrapper::traits::neon_vector<T, element_per_vector>::tag_type;
     using AccType                     = int32_t;
     using AccArrayType                = std::array<AccType, element_per_vector>;
 
-    const auto out_of_bound_value  = PixelValue(static_cast<uint64_t>(0), input->info()->data_type(), input->info()->quantization_info()).get<T>();
-    const auto out_of_bound_vector = wrapper::vdup_n(static_cast<T>(out_of_bound_value), TagType{});
-
     const auto run_info = DepthwiseConvolutionRunInfo(*input->info(), *weights->info(), conv_info, window);
 
     const int32_t input_qoffset   = input->info()->quantization_info().uniform().offset;
     const int32_t weights_qoffset = weights->info()->quantization_info().uniform().offset;
     const int32_t output_qoffset  = output->info()->quantization_info().uniform().offset;
-    const int32_t k_offset        = run_info.weights_width * run_info.weights_height * input_qoffset * weights_qoffset;
+
+    const int16x8_t input_qoffset_vec   = vdupq_n_s16(static_cast<int16_t>(input_qoffset));
+    const int16x8_t weights_qoffset_vec = vdupq_n_s16(static_cast<int16_t>(weights_qoffset));
 
     Window execution_window = window;
     execution_window.set(Window::DimX, dim_single_unit_step);
@@ -331,7 +426,7 @@ void depthwise_loop_multiplier1_quantized(const ITensor *input, const ITensor *w
     Window win_weights = win_input;
     win_weights.set(Window::DimW, dim_manual_loop);
 
-    Window win_output = window;
+    Window win_output = output_block_window(window, block_origin);
     win_output.set(Window::DimX, dim_manual_loop);
 
     Iterator input_it(input, win_input);
@@ -349,128 +444,74 @@ void depthwise_loop_multiplier1_quantized(const ITensor *input, const ITensor *w
         const int32_t input_y           = id.y() * run_info.conv_stride_x - run_info.conv_pad_left;
         const int32_t input_z           = id.z() * run_info.conv_stride_y - run_info.conv_pad_top;
         const int64_t base_input_offset = input_y * run_info.input_stride_y + input_z * run_info.input_stride_z;
+        const auto    taps              = compute_valid_tap_range(input_y, input_z, run_info, dilation);
         auto const    base_weights_ptr  = weights_it.ptr();
+        auto const    output_ptr        = reinterpret_cast<T *>(output_it.ptr());
         size_t        x                 = run_info.x_start;
 
+        // Offsets are removed before the multiplication so that padded taps, which would read the zero point, can be skipped
         for(; x < run_info.x_leftover_start; x += run_info.x_step)
         {
-            AccArrayType acc{};
-            AccArrayType in_sum{};
-            AccArrayType we_sum{};
-
-            auto weights_ptr  = base_weights_ptr;
-            auto input_offset = base_input_offset;
+            int32x4_t acc_vec[4] = { vdupq_n_s32(0), vdupq_n_s32(0), vdupq_n_s32(0), vdupq_n_s32(0) };
 
-            for(size_t h = 0; h < run_info.weights_height; ++h)
+            for(uint32_t h = taps.h_start; h < taps.h_end; ++h)
             {
-                int64_t offs = input_offset + x * sizeof(T);
-                for(size_t w = 0; w < run_info.weights_width; ++w)
-                {
-                    const bool is_valid_region = is_valid_input_region(input_y, input_z, w, h, run_info, dilation);
-                    const auto input_vals      = is_valid_region ?
-                                                 wrapper::vload(reinterpret_cast<T *>(input_it.ptr() + std::min(static_cast<size_t>(offs), run_info.input_max_offset))) :
-                                                 out_of_bound_vector;
-                    const auto weights_vals = wrapper::vload(reinterpret_cast<TW *>(weights_ptr + w * run_info.weights_stride_y) + x);
+                const int64_t row_offset  = base_input_offset + h * dilation.y() * run_info.input_stride_z + x * sizeof(T);
+                const auto    weights_row = base_weights_ptr + h * run_info.weights_stride_z;
 
-                    for(size_t i = 0; i < element_per_vector; ++i)
-                    {
-                        acc.at(i) += input_vals[i] * weights_vals[i];
-                        in_sum.at(i) += input_vals[i];
-                        we_sum.at(i) += weights_vals[i];
-                    }
+                for(uint32_t w = taps.w_start; w < taps.w_end; ++w)
+                {
+                    const auto in_ptr = reinterpret_cast<const T *>(input_it.ptr() + row_offset + w * dilation.x() * run_info.input_stride_y);
+                    const auto we_ptr = reinterpret_cast<const TW *>(weights_row + w * run_info.weights_stride_y) + x;
 
-                    offs += dilation.x() * run_info.input_stride_y;
+                    depthwise_quantized_mla(acc_vec, in_ptr, we_ptr, input_qoffset_vec, weights_qoffset_vec);
                 }
-
-                weights_ptr += run_info.weights_stride_z;
-                input_offset += dilation.y() * run_info.input_stride_z;
             }
 
-            VectorType out_vals = wrapper::vdup_n(static_cast<T>(0), TagType{});
-            for(size_t i = 0; i < element_per_vector; ++i)
+            AccArrayType acc{};
+            for(size_t i = 0; i < 4; ++i)
             {
-                acc.at(i) -= in_sum.at(i) * weights_qoffset;
-                acc.at(i) -= we_sum.at(i) * input_qoffset;
-                acc.at(i) += k_offset;
-
                 if(has_biases)
                 {
-                    acc.at(i) += *(reinterpret_cast<int32_t *>(biases_it.ptr() + i * sizeof(int32_t)) + x);
-                }
-
-                const int32_t out_mul   = output_multiplier.at(x + i);
-                const int32_t out_shift = output_shift.at(x + i);
-                if(out_shift < 0)
-                {
-                    acc.at(i) = saturating_doubling_high_mul(acc.at(i) * (1 << (-out_shift)), out_mul) + output_qoffset;
-                }
-                else
-                {
-                    acc.at(i) = rounding_divide_by_exp2(saturating_doubling_high_mul(acc.at(i), out_mul), out_shift) + output_qoffset;
+                    acc_vec[i] = vaddq_s32(acc_vec[i], vld1q_s32(reinterpret_cast<int32_t *>(biases_it.ptr()) + x + i * 4));
                 }
-                out_vals[i] = static_cast<T>(utility::clamp<AccType, T>(acc.at(i)));
+                vst1q_s32(acc.data() + i * 4, acc_vec[i]);
             }
 
-            wrapper::vstore(reinterpret_cast<T *>(output_it.ptr()) + x, out_vals);
+            // Requantization uses per-channel multipliers and shifts, so it is done per lane
+            for(size_t i = 0; i < element_per_vector; ++i)
+            {
+                acc[i]            = requantize_depthwise_acc(acc[i], output_multiplier.at(x + i), output_shift.at(x + i), output_qoffset);
+                output_ptr[x + i] = static_cast<T>(utility::clamp<AccType, T>(acc[i]));
+            }
         }
 
         // left-over
         for(; x < run_info.x_end; ++x)
         {
-            AccType acc    = 0;
-            AccType in_sum = 0;
-            AccType we_sum = 0;
+            AccType acc = 0;
 
-            auto weights_ptr  = base_weights_ptr;
-            auto input_offset = base_input_offset;
-
-            for(size_t h = 0; h < run_info.weights_height; ++h)
+            for(uint32_t h = taps.h_start; h < taps.h_end; ++h)
             {
-                int64_t offs = input_offset + x * sizeof(T);
-                for(size_t w = 0; w < run_info.weights_width; ++w)
-                {
-                    const bool is_valid_region = is_valid_input_region(input_y, input_z, w, h, run_info, dilation);
-                    const auto input_val       = is_valid_region ?
-                                                 *reinterpret_cast<T *>(input_it.ptr() + std::min(static_cast<size_t>(offs), run_info.input_max_offset)) :
-                                                 out_of_bound_value;
-                    const auto weights_val = *(reinterpret_cast<TW *>(weights_ptr + w * run_info.weights_stride_y) + x);
+                const int64_t row_offset  = base_input_offset + h * dilation.y() * run_info.input_stride_z + x * sizeof(T);
+                const auto    weights_row = base_weights_ptr + h * run_info.weights_stride_z;
 
-                    acc += input_val * weights_val;
-                    in_sum += input_val;
-                    we_sum += weights_val;
+                for(uint32_t w = taps.w_start; w < taps.w_end; ++w)
+                {
+                    const auto input_val   = *reinterpret_cast<T *>(input_it.ptr() + row_offset + w * dilation.x() * run_info.input_stride_y);
+                    const auto weights_val = *(reinterpret_cast<TW *>(weights_row + w * run_info.weights_stride_y) + x);
 
-                    offs += dilation.x() * run_info.input_stride_y;
+                    acc += (static_cast<AccType>(input_val) - input_qoffset) * (static_cast<AccType>(weights_val) - weights_qoffset);
                 }
-
-                weights_ptr += run_info.weights_stride_z;
-                input_offset += dilation.y() * run_info.input_stride_z;
             }
 
-            T out_vals{ 0 };
-
-            acc -= in_sum * weights_qoffset;
-            acc -= we_sum * input_qoffset;
-            acc += k_offset;
-
             if(has_biases)
             {
                 acc += *(reinterpret_cast<int32_t *>(biases_it.ptr()) + x);
             }
 
-            const int32_t out_mul   = output_multiplier.at(x);
-            const int32_t out_shift = output_shift.at(x);
-
-            if(out_shift < 0)
-            {
-                acc = saturating_doubling_high_mul(acc * (1 << (-out_shift)), out_mul) + output_qoffset;
-            }
-            else
-            {
-                acc = rounding_divide_by_exp2(saturating_doubling_high_mul(acc, out_mul), out_shift) + output_qoffset;
-            }
-
-            out_vals                                      = static_cast<T>(utility::clamp<AccType, T>(acc));
-            *(reinterpret_cast<T *>(output_it.ptr()) + x) = out_vals;
+            acc           = requantize_depthwise_acc(acc, output_multiplier.at(x), output_shift.at(x), output_qoffset);
+            output_ptr[x] = static_cast<T>(utility::clamp<AccType, T>(acc));
         }
     },
     input_it, weights_it, biases_it, output_it);
@@ -478,18 +519,16 @@ void depthwise_loop_multiplier1_quantized(const ITensor *input, const ITensor *w
 
 template <typename T, typename TW>
 void depthwise_loop_generic_quantized(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const PadStrideInfo &conv_info,
-                                      const Size2D &dilation, unsigned int depth_multiplier, std::vector<int> output_multiplier, std::vector<int> output_shift, const Window &window, bool has_biases)
+                                      const Size2D &dilation, unsigned int depth_multiplier, std::vector<int> output_multiplier, std::vector<int> output_shift, const Window &window,
+                                      const Coordinates &block_origin, bool has_biases)
 {
     using AccType = int32_t;
 
     const auto run_info = DepthwiseConvolutionRunInfo(*input->info(), *weights->info(), conv_info, window, depth_multiplier);
 
-    const auto out_of_bound_value = PixelValue(static_cast<uint64_t>(0), input->info()->data_type(), input->info()->quantization_info()).get<T>();
-
     const int32_t input_qoffset   = input->info()->quantization_info().uniform().offset;
     const int32_t weights_qoffset = weights->info()->quantization_info().uniform().offset;
     const int32_t output_qoffset  = output->info()->quantization_info().uniform().offset;
-    const int32_t k_offset        = run_info.weights_width * run_info.weights_height * input_qoffset * weights_qoffset;
 
     Window execution_window = window;
     execution_window.set(Window::DimX, Window::Dimension(0, run_info.input_depth, 1));
@@ -504,7 +543,7 @@ void depthwise_loop_generic_quantized(const ITensor *input, const ITensor *weigh
     win_weights.set(Window::DimZ, dim_manual_loop);
     win_weights.set(Window::DimW, dim_manual_loop);
 
-    Window win_output = window;
+    Window win_output = output_block_window(window, block_origin);
     win_output.set_dimension_step(Window::DimX, run_info.x_step);
 
     Iterator input_it(input, win_input);
@@ -517,63 +556,81 @@ void depthwise_loop_generic_quantized(const ITensor *input, const ITensor *weigh
         biases_it = Iterator(biases, win_weights);
     }
 
+    const int16x8_t weights_qoffset_vec = vdupq_n_s16(static_cast<int16_t>(weights_qoffset));
+
+    // Allocated once per window rather than once per output element
+    std::vector<AccType> acc(depth_multiplier, 0);
+
     execute_window_loop(execution_window, [&](const Coordinates & id)
     {
-        std::vector<AccType> acc(depth_multiplier, 0);
-        std::vector<AccType> we_sum(depth_multiplier, 0);
-        AccType              in_sum = 0;
+        std::fill(acc.begin(), acc.end(), 0);
+
+        const int32_t input_y           = id.y() * run_info.conv_stride_x - run_info.conv_pad_left;
+        const int32_t input_z           = id.z() * run_info.conv_stride_y - run_info.conv_pad_top;
+        const int64_t base_input_offset = input_y * run_info.input_stride_y + input_z * run_info.input_stride_z;
+        const auto    taps              = compute_valid_tap_range(input_y, input_z, run_info, dilation);
 
-        const int32_t input_y      = id.y() * run_info.conv_stride_x - run_info.conv_pad_left;
-        const int32_t input_z      = id.z() * run_info.conv_stride_y - run_info.conv_pad_top;
-        int64_t       input_offset = input_y * run_info.input_stride_y + input_z * run_info.input_stride_z;
+        auto const weights_ptr = weights_it.ptr();
+        size_t     m           = 0;
 
-        auto weights_ptr = weights_it.ptr();
-        for(size_t h = 0; h < run_info.weights_height; ++h)
+        // Blocks of 8 multipliers share the broadcast input value and accumulate in two vectors
+        for(; m + 8 <= depth_multiplier; m += 8)
         {
-            int offs = input_offset;
-            for(size_t w = 0; w < run_info.weights_width; ++w)
+            int32x4_t acc_low  = vdupq_n_s32(0);
+            int32x4_t acc_high = vdupq_n_s32(0);
+
+            for(uint32_t h = taps.h_start; h < taps.h_end; ++h)
             {
-                const bool is_valid_region = is_valid_input_region(input_y, input_z, w, h, run_info, dilation);
-                const auto input_val       = is_valid_region ? *(reinterpret_cast<T *>(input_it.ptr() + std::min(static_cast<size_t>(offs), run_info.input_max_offset))) : out_of_bound_value;
+                const int64_t row_offset  = base_input_offset + h * dilation.y() * run_info.input_stride_z;
+                const auto    weights_row = weights_ptr + h * run_info.weights_stride_z;
 
-                for(size_t m = 0; m < depth_multiplier; ++m)
+                for(uint32_t w = taps.w_start; w < taps.w_end; ++w)
                 {
-                    const auto weights_val = *(reinterpret_cast<TW *>(weights_ptr + m * sizeof(T) + w * run_info.weights_stride_y));
-                    acc.at(m) += input_val * weights_val;
+                    const AccType   input_val = static_cast<AccType>(*reinterpret_cast<T *>(input_it.ptr() + row_offset + w * dilation.x() * run_info.input_stride_y)) - input_qoffset;
+                    const int16x4_t input_vec = vdup_n_s16(static_cast<int16_t>(input_val));
+                    const auto      we_ptr    = reinterpret_cast<const TW *>(weights_row + w * run_info.weights_stride_y) + m;
+                    const int16x8_t we_vec    = vsubq_s16(widen_to_s16(wrapper::vload(we_ptr)), weights_qoffset_vec);
 
-                    we_sum.at(m) += weights_val;
+                    acc_low  = vmlal_s16(acc_low, vget_low_s16(we_vec), input_vec);
+                    acc_high = vmlal_s16(acc_high, vget_high_s16(we_vec), input_vec);
                 }
-
-                offs += dilation.x() * run_info.input_stride_y;
-                in_sum += input_val;
             }
 
-            weights_ptr += run_info.weights_stride_z;
-            input_offset += dilation.y() * run_info.input_stride_z;
+            vst1q_s32(acc.data() + m, acc_low);
+            vst1q_s32(acc.data() + m + 4, acc_high);
         }
 
-        for(size_t m = 0; m < depth_multiplier; ++m)
+        // left-over
+        if(m < depth_multiplier)
         {
-            acc.at(m) -= in_sum * weights_qoffset;
-            acc.at(m) -= we_sum.at(m) * input_qoffset;
-            acc.at(m) += k_offset;
-
-            if(has_biases)
+            for(uint32_t h = taps.h_start; h < taps.h_end; ++h)
             {
-                acc.at(m) += *(reinterpret_cast<int32_t *>(biases_it.ptr() + m * sizeof(int32_t)));
-            }
+                const int64_t row_offset  = base_input_offset + h * dilation.y() * run_info.input_stride_z;
+                const auto    weights_row = weights_ptr + h * run_info.weights_stride_z;
 
-            const int32_t out_mul   = output_multiplier.at(id.x() * depth_multiplier + m);
-            const int32_t out_shift = output_shift.at(id.x() * depth_multiplier + m);
-            if(out_shift < 0)
-            {
-                acc.at(m) = saturating_doubling_high_mul(acc.at(m) * (1 << (-out_shift)), out_mul) + output_qoffset;
+                for(uint32_t w = taps.w_start; w < taps.w_end; ++w)
+                {
+                    const AccType input_val = static_cast<AccType>(*reinterpret_cast<T *>(input_it.ptr() + row_offset + w * dilation.x() * run_info.input_stride_y)) - input_qoffset;
+                    const auto    we_ptr    = reinterpret_cast<const TW *>(weights_row + w * run_info.weights_stride_y);
+
+                    for(size_t i = m; i < depth_multiplier; ++i)
+                    {
+                        acc[i] += input_val * (static_cast<AccType>(we_ptr[i]) - weights_qoffset);
+                    }
+                }
             }
-            else
+        }
+
+        for(m = 0; m < depth_multiplier; ++m)
+        {
+            if(has_biases)
             {
-                acc.at(m) = rounding_divide_by_exp2(saturating_doubling_high_mul(acc.at(m), out_mul), out_shift) + output_qoffset;
+                acc[m] += *(reinterpret_cast<int32_t *>(biases_it.ptr() + m * sizeof(int32_t)));
             }
-            *(reinterpret_cast<T *>(output_it.ptr() + m * sizeof(T))) = static_cast<T>(utility::clamp<AccType, T>(acc.at(m)));
+
+            const size_t oc = id.x() * depth_multiplier + m;
+            acc[m]          = requantize_depthwise_acc(acc[m], output_multiplier.at(oc), output_shift.at(oc), output_qoffset);
+            *(reinterpret_cast<T *>(output_it.ptr() + m * sizeof(T))) = static_cast<T>(utility::clamp<AccType, T>(acc[m]));
         }
     },
     input_it, weights_it, biases_it, output_it);
@@ -630,7 +687,7 @@ Status validate_arguments(const ITensorInfo *input, const ITensorInfo *weights,
 } // namespace
 
 NEDepthwiseConvolutionLayerNativeKernel::NEDepthwiseConvolutionLayerNativeKernel()
-    : _func(), _input(), _weights(), _biases(), _output(), _conv_info(), _depth_multiplier(1), _dilation(), _output_multiplier(), _output_shift(), _has_biases()
+    : _func(), _input(), _weights(), _biases(), _output(), _conv_info(), _depth_multiplier(1), _dilation(), _output_multiplier(), _output_shift(), _has_biases(), _block_origin(), _block_num_rows(0)
 {
 }
 
@@ -724,13 +781,33 @@ Status NEDepthwiseConvolutionLayerNativeKernel::validate(const ITensorInfo *inpu
     return Status{};
 }
 
+void NEDepthwiseConvolutionLayerNativeKernel::set_output_block(unsigned int batch, unsigned int first_row, unsigned int num_rows)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON(num_rows != 0 && first_row + num_rows > INEKernel::window().z().end());
+    ARM_COMPUTE_ERROR_ON(num_rows != 0 && batch >= static_cast<unsigned int>(INEKernel::window()[Window::DimW].end()));
+
+    _block_origin   = Coordinates(0, 0, first_row, batch);
+    _block_num_rows = num_rows;
+}
+
 void NEDepthwiseConvolutionLayerNativeKernel::run(const Window &window, const ThreadInfo &info)
 {
     ARM_COMPUTE_UNUSED(info);
     ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
     ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
 
-    (this->*_func)(window, _has_biases);
+    if(_block_num_rows == 0)
+    {
+        (this->*_func)(window, _has_biases);
+        return;
+    }
+
+    // Only compute the rows of the current block. The window is split along the width, so every thread computes its part of the block
+    Window block_window = window;
+    block_window.set(Window::DimZ, Window::Dimension(_block_origin.z(), _block_origin.z() + _block_num_rows, 1));
+    block_window.set(Window::DimW, Window::Dimension(_block_origin[Window::DimW], _block_origin[Window::DimW] + 1, 1));
+    (this->*_func)(block_window, _has_biases);
 }
 
 template <typename T, typename TW, NEDepthwiseConvolutionLayerNativeKernel::FloatEnalber<T>>
@@ -741,11 +818,11 @@ void NEDepthwiseConvolutionLayerNativeKernel::run_depthwise(const Window &window
 
     if(_depth_multiplier == 1)
     {
-        depthwise_loop_multiplier1_fp<T>(_input, _weights, _biases, _output, _conv_info, _dilation, window, has_biases);
+        depthwise_loop_multiplier1_fp<T>(_input, _weights, _biases, _output, _conv_info, _dilation, window, _block_origin, has_biases);
     }
     else
     {
-        depthwise_loop_generic_fp<T>(_input, _weights, _biases, _output, _conv_info, _dilation, _depth_multiplier, window, has_biases);
+        depthwise_loop_generic_fp<T>(_input, _weights, _biases, _output, _conv_info, _dilation, _depth_multiplier, window, _block_origin, has_biases);
     }
 }
 
@@ -757,11 +834,11 @@ void NEDepthwiseConvolutionLayerNativeKernel::run_depthwise(const Window &window
 
     if(_depth_multiplier == 1)
     {
-        depthwise_loop_multiplier1_quantized<T, TW>(_input, _weights, _biases, _output, _conv_info, _dilation, _output_multiplier, _output_shift, window, has_biases);
+        depthwise_loop_multiplier1_quantized<T, TW>(_input, _weights, _biases, _output, _conv_info, _dilation, _output_multiplier, _output_shift, window, _block_origin, has_biases);
     }
     else
     {
-        depthwise_loop_generic_quantized<T, TW>(_input, _weights, _biases, _output, _conv_info, _dilation, _depth_multiplier, _output_multiplier, _output_shift, window, has_biases);
+        depthwise_loop_generic_quantized<T, TW>(_input, _weights, _biases, _output, _conv_info, _dilation, _depth_multiplier, _output_multiplier, _output_shift, window, _block_origin, has_biases);
     }
 }
 } // namespace arm_compute
@@ -93,6 +93,17 @@ public:
     static Status validate(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *biases, const ITensorInfo *output, const PadStrideInfo &conv_info, unsigned int depth_multiplier = 1,
                            const Size2D &dilation = Size2D(1U, 1U));
 
+    /** Restrict the following runs to a block of output rows of a single batch
+     *
+     * The block is written at the origin of the output tensor, whose buffer then only needs to hold @p num_rows rows of one batch.
+     * This allows a consumer to process the depthwise output block by block while it is still in cache.
+     *
+     * @param[in] batch     Batch the block belongs to.
+     * @param[in] first_row First output row of the block.
+     * @param[in] num_rows  Number of output rows in the block. 0 computes the whole output, which is the default.
+     */
+    void set_output_block(unsigned int batch, unsigned int first_row, unsigned int num_rows);
+
     // Inherited methods overridden:
     void run(const Window &window, const ThreadInfo &info) override;
 
@@ -126,6 +137,8 @@ private:
     std::vector<int>     _output_multiplier;
     std::vector<int>     _output_shift;
     bool                 _has_biases;
+    Coordinates          _block_origin;
+    unsigned int         _block_num_rows;
 };
 } // namespace arm_compute
 #endif /* ARM_COMPUTE_NEDEPTHWISECONVOLUTIONLAYERNATIVEKERNEL_H */
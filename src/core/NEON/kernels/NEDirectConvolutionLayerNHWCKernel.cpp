@@ -0,0 +1,324 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/core/NEON/kernels/NEDirectConvolutionLayerNHWCKernel.h"
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+#include "src/core/CPP/Validate.h"
+#include "src/core/NEON/wrapper/wrapper.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/WindowHelpers.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace arm_compute
+{
+namespace
+{
+/** Number of consecutive output pixels of a row computed at a time */
+constexpr int num_pixels_per_block = 4;
+
+TensorShape compute_output_shape(const ITensorInfo *input, const ITensorInfo *weights, const PadStrideInfo &conv_info, const Size2D &dilation)
+{
+    unsigned int output_width  = 0;
+    unsigned int output_height = 0;
+    std::tie(output_width, output_height) = scaled_dimensions(input->dimension(1), input->dimension(2), weights->dimension(2), weights->dimension(3), conv_info, dilation);
+
+    TensorShape output_shape{ input->tensor_shape() };
+    output_shape.set(0, weights->dimension(0));
+    output_shape.set(1, output_width);
+    output_shape.set(2, output_height);
+    return output_shape;
+}
+
+Status validate_arguments(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *output, const PadStrideInfo &conv_info, const Size2D &dilation)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, weights, output);
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(input);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F16, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_LAYOUT_NOT_IN(input, DataLayout::NHWC);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, weights);
+    ARM_COMPUTE_RETURN_ERROR_ON(weights->num_dimensions() > 4);
+    ARM_COMPUTE_RETURN_ERROR_ON(weights->dimension(1) != input->dimension(0));
+    ARM_COMPUTE_RETURN_ERROR_ON(dilation.x() < 1 || dilation.y() < 1);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(input->strides_in_bytes()[0] != input->element_size() || weights->strides_in_bytes()[0] != weights->element_size(),
+                                    "The channels of the input and the output feature maps of the weights must be contiguous");
+
+    // The kernel must cover at least one input element for each output element
+    const int dilated_kernel_w = (weights->dimension(2) - 1) * dilation.x() + 1;
+    const int dilated_kernel_h = (weights->dimension(3) - 1) * dilation.y() + 1;
+    ARM_COMPUTE_RETURN_ERROR_ON(dilated_kernel_w > static_cast<int>(input->dimension(1) + conv_info.pad_left() + conv_info.pad_right()));
+    ARM_COMPUTE_RETURN_ERROR_ON(dilated_kernel_h > static_cast<int>(input->dimension(2) + conv_info.pad_top() + conv_info.pad_bottom()));
+
+    // Checks performed when output is configured
+    if(output->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(output->tensor_shape(), compute_output_shape(input, weights, conv_info, dilation));
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_LAYOUT_NOT_IN(output, DataLayout::NHWC);
+        ARM_COMPUTE_RETURN_ERROR_ON(output->strides_in_bytes()[0] != output->element_size());
+    }
+
+    return Status{};
+}
+
+/** Compute a block of output pixels on a block of output feature maps
+ *
+ * @param[in]  in_ptrs      Pointers to the input channels read by each tap of the kernel, for each pixel of the block.
+ *                          Laid out as [kernel_y][kernel_x][num_pixels_per_block].
+ * @param[in]  weights      Pointer to the first output feature map of the block, for the first input channel of the first tap.
+ * @param[out] out          Pointer to the first output feature map of the block, for the first pixel of the block.
+ * @param[in]  num_pixels   Number of valid pixels in the block.
+ * @param[in]  out_stride_w Stride of the output along the width, in elements.
+ * @param[in]  num_channels Number of input channels.
+ * @param[in]  num_taps     Number of taps of the kernel.
+ * @param[in]  w_stride_c   Stride of the weights along the input channels, in elements.
+ * @param[in]  w_tap_offset Offsets of the weights of each tap, in elements.
+ */
+template <typename T, int num_vectors>
+inline void convolve_block(const T *const *in_ptrs, const T *weights, T *out, int num_pixels, int out_stride_w, int num_channels, int num_taps, int w_stride_c, const int *w_tap_offset)
+{
+    using vtype       = wrapper::traits::neon_bitvector<T, wrapper::traits::BitWidth::W128>;
+    using vector_type = typename vtype::type;
+    using tag_type    = typename vtype::tag_type;
+
+    constexpr int vec_size = 16 / sizeof(T);
+
+    vector_type acc[num_pixels_per_block][num_vectors];
+    for(int p = 0; p < num_pixels_per_block; ++p)
+    {
+        for(int v = 0; v < num_vectors; ++v)
+        {
+            acc[p][v] = wrapper::vdup_n(static_cast<T>(0), tag_type());
+        }
+    }
+
+    for(int tap = 0; tap < num_taps; ++tap, in_ptrs += num_pixels_per_block)
+    {
+        const T *w_ptr = weights + w_tap_offset[tap];
+        for(int c = 0; c < num_channels; ++c, w_ptr += w_stride_c)
+        {
+            vector_type w[num_vectors];
+            for(int v = 0; v < num_vectors; ++v)
+            {
+                w[v] = wrapper::vloadq(w_ptr + v * vec_size);
+            }
+            for(int p = 0; p < num_pixels_per_block; ++p)
+            {
+                const vector_type in = wrapper::vdup_n(in_ptrs[p][c], tag_type());
+                for(int v = 0; v < num_vectors; ++v)
+                {
+                    acc[p][v] = wrapper::vmla(acc[p][v], w[v], in);
+                }
+            }
+        }
+    }
+
+    for(int p = 0; p < num_pixels; ++p)
+    {
+        for(int v = 0; v < num_vectors; ++v)
+        {
+            wrapper::vstore(out + p * out_stride_w + v * vec_size, acc[p][v]);
+        }
+    }
+}
+
+/** Compute a block of output pixels for a single output feature map. See @ref convolve_block for the parameters */
+template <typename T>
+inline void convolve_block_scalar(const T *const *in_ptrs, const T *weights, T *out, int num_pixels, int out_stride_w, int num_channels, int num_taps, int w_stride_c, const int *w_tap_offset)
+{
+    T acc[num_pixels_per_block] = {};
+    for(int tap = 0; tap < num_taps; ++tap, in_ptrs += num_pixels_per_block)
+    {
+        const T *w_ptr = weights + w_tap_offset[tap];
+        for(int c = 0; c < num_channels; ++c, w_ptr += w_stride_c)
+        {
+            for(int p = 0; p < num_pixels_per_block; ++p)
+            {
+                acc[p] += in_ptrs[p][c] * *w_ptr;
+            }
+        }
+    }
+
+    for(int p = 0; p < num_pixels; ++p)
+    {
+        out[p * out_stride_w] = acc[p];
+    }
+}
+} // namespace
+
+NEDirectConvolutionLayerNHWCKernel::NEDirectConvolutionLayerNHWCKernel()
+    : _func(nullptr), _input(nullptr), _weights(nullptr), _output(nullptr), _conv_info(), _dilation(1U, 1U)
+{
+}
+
+void NEDirectConvolutionLayerNHWCKernel::configure(const ITensor *input, const ITensor *weights, ITensor *output, const PadStrideInfo &conv_info, const Size2D &dilation)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, weights, output);
+
+    // Output auto inizialitation if not yet initialized
+    auto_init_if_empty(*output->info(), input->info()->clone()->set_tensor_shape(compute_output_shape(input->info(), weights->info(), conv_info, dilation)));
+
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(input->info(), weights->info(), output->info(), conv_info, dilation));
+
+    _input     = input;
+    _weights   = weights;
+    _output    = output;
+    _conv_info = conv_info;
+    _dilation  = dilation;
+
+    switch(input->info()->data_type())
+    {
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+        case DataType::F16:
+            _func = &NEDirectConvolutionLayerNHWCKernel::convolve<float16_t>;
+            break;
+#endif /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
+        case DataType::F32:
+            _func = &NEDirectConvolutionLayerNHWCKernel::convolve<float>;
+            break;
+        default:
+            ARM_COMPUTE_ERROR("Data type not supported");
+    }
+
+    // Configure kernel window: the feature maps are computed in the kernel and the output pixels of a row are processed in blocks
+    Window win = calculate_max_window(*output->info(), Steps(output->info()->dimension(0), num_pixels_per_block));
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    Coordinates coord;
+    coord.set_num_dimensions(output->info()->num_dimensions());
+    output->info()->set_valid_region(ValidRegion(coord, output->info()->tensor_shape()));
+
+    INEKernel::configure(win);
+}
+
+Status NEDirectConvolutionLayerNHWCKernel::validate(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *output, const PadStrideInfo &conv_info, const Size2D &dilation)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(input, weights, output, conv_info, dilation));
+    return Status{};
+}
+
+template <typename T>
+void NEDirectConvolutionLayerNHWCKernel::convolve(const Window &window)
+{
+    constexpr int vec_size = 16 / sizeof(T);
+
+    const ITensorInfo &in_info  = *_input->info();
+    const ITensorInfo &w_info   = *_weights->info();
+    const ITensorInfo &out_info = *_output->info();
+
+    const int num_channels  = in_info.dimension(0);
+    const int in_dim_w      = in_info.dimension(1);
+    const int in_dim_h      = in_info.dimension(2);
+    const int in_stride_w   = in_info.strides_in_bytes()[1] / sizeof(T);
+    const int in_stride_h   = in_info.strides_in_bytes()[2] / sizeof(T);
+    const int in_stride_n   = in_info.strides_in_bytes()[3] / sizeof(T);
+    const int num_ofm       = w_info.dimension(0);
+    const int kernel_w      = w_info.dimension(2);
+    const int kernel_h      = w_info.dimension(3);
+    const int w_stride_c    = w_info.strides_in_bytes()[1] / sizeof(T);
+    const int out_dim_w     = out_info.dimension(1);
+    const int out_stride_w  = out_info.strides_in_bytes()[1] / sizeof(T);
+    const int num_taps      = kernel_w * kernel_h;
+    const int conv_pad_left = _conv_info.pad_left();
+    const int conv_pad_top  = _conv_info.pad_top();
+    const int conv_stride_w = std::get<0>(_conv_info.stride());
+    const int conv_stride_h = std::get<1>(_conv_info.stride());
+
+    const T *const in_base = reinterpret_cast<const T *>(_input->buffer() + in_info.offset_first_element_in_bytes());
+    const T *const w_base  = reinterpret_cast<const T *>(_weights->buffer() + w_info.offset_first_element_in_bytes());
+
+    // Reads outside the input point to a row of zeros instead
+    const std::vector<T> zeros(num_channels, static_cast<T>(0));
+
+    std::vector<int> w_tap_offset(num_taps);
+    for(int ky = 0; ky < kernel_h; ++ky)
+    {
+        for(int kx = 0; kx < kernel_w; ++kx)
+        {
+            w_tap_offset[ky * kernel_w + kx] = (kx * w_info.strides_in_bytes()[2] + ky * w_info.strides_in_bytes()[3]) / sizeof(T);
+        }
+    }
+
+    // Input channels read by each tap of the kernel for each pixel of the current block
+    std::vector<const T *> in_ptrs(num_taps * num_pixels_per_block);
+
+    Iterator out(_output, window);
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        const int out_x      = id.y();
+        const int out_y      = id.z();
+        const int num_pixels = std::min(num_pixels_per_block, out_dim_w - out_x);
+        const T  *in_batch   = in_base + id[3] * in_stride_n;
+
+        for(int ky = 0; ky < kernel_h; ++ky)
+        {
+            const int  in_y         = out_y * conv_stride_h - conv_pad_top + ky * static_cast<int>(_dilation.y());
+            const bool is_row_valid = in_y >= 0 && in_y < in_dim_h;
+            for(int kx = 0; kx < kernel_w; ++kx)
+            {
+                const T **tap_ptrs = in_ptrs.data() + (ky * kernel_w + kx) * num_pixels_per_block;
+                for(int p = 0; p < num_pixels_per_block; ++p)
+                {
+                    const int in_x = (out_x + p) * conv_stride_w - conv_pad_left + kx * static_cast<int>(_dilation.x());
+                    tap_ptrs[p]    = (is_row_valid && p < num_pixels && in_x >= 0 && in_x < in_dim_w) ? in_batch + in_y * in_stride_h + in_x * in_stride_w : zeros.data();
+                }
+            }
+        }
+
+        T  *out_ptr = reinterpret_cast<T *>(out.ptr());
+        int ofm     = 0;
+        for(; ofm <= num_ofm - 2 * vec_size; ofm += 2 * vec_size)
+        {
+            convolve_block<T, 2>(in_ptrs.data(), w_base + ofm, out_ptr + ofm, num_pixels, out_stride_w, num_channels, num_taps, w_stride_c, w_tap_offset.data());
+        }
+        for(; ofm <= num_ofm - vec_size; ofm += vec_size)
+        {
+            convolve_block<T, 1>(in_ptrs.data(), w_base + ofm, out_ptr + ofm, num_pixels, out_stride_w, num_channels, num_taps, w_stride_c, w_tap_offset.data());
+        }
+        for(; ofm < num_ofm; ++ofm)
+        {
+            convolve_block_scalar<T>(in_ptrs.data(), w_base + ofm, out_ptr + ofm, num_pixels, out_stride_w, num_channels, num_taps, w_stride_c, w_tap_offset.data());
+        }
+    },
+    out);
+}
+
+void NEDirectConvolutionLayerNHWCKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(_func == nullptr);
+
+    (this->*_func)(window);
+}
+} // namespace arm_compute
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_NEDIRECTCONVOLUTIONLAYERNHWCKERNEL_H
+#define ARM_COMPUTE_NEDIRECTCONVOLUTIONLAYERNHWCKERNEL_H
+
+#include "arm_compute/core/Types.h"
+#include "src/core/NEON/INEKernel.h"
+
+namespace arm_compute
+{
+// Forward declarations
+class ITensor;
+
+/** NEON kernel to compute a direct convolution on NHWC tensors.
+ *
+ * The kernel vectorises over the output feature maps and computes a block of consecutive output pixels of a row at a time,
+ * so that each weights vector loaded is reused across the block. Out of bounds input elements are read as zeros, so the
+ * input does not need to be padded: any kernel size, stride and dilation is supported.
+ *
+ * The weights must be reshaped so that the output feature maps are the innermost dimension, which can be done with
+ * @ref NEPermute and the permutation vector (3, 0, 1, 2).
+ */
+class NEDirectConvolutionLayerNHWCKernel : public INEKernel
+{
+public:
+    const char *name() const override
+    {
+        return "NEDirectConvolutionLayerNHWCKernel";
+    }
+    /** Default constructor */
+    NEDirectConvolutionLayerNHWCKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEDirectConvolutionLayerNHWCKernel(const NEDirectConvolutionLayerNHWCKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEDirectConvolutionLayerNHWCKernel &operator=(const NEDirectConvolutionLayerNHWCKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NEDirectConvolutionLayerNHWCKernel(NEDirectConvolutionLayerNHWCKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NEDirectConvolutionLayerNHWCKernel &operator=(NEDirectConvolutionLayerNHWCKernel &&) = default;
+    /** Default destructor */
+    ~NEDirectConvolutionLayerNHWCKernel() = default;
+    /** Set the input, weights, and output tensors.
+     *
+     * @param[in]  input     The input tensor to convolve. 3 lower dimensions represent a single input [IFM, width, height],
+     *                       while every optional dimension from 4 and above represent a batch of inputs. Data types supported: F16/F32.
+     *                       Data layout supported: NHWC.
+     * @param[in]  weights   Reshaped weights tensor. A 4D tensor with dimensions [OFM, IFM, kernel_x, kernel_y]. Data type supported: Same as @p input.
+     * @param[out] output    Output tensor. 3 lower dimensions represent a single output [OFM, width, height]. Data types supported: Same as @p input.
+     * @param[in]  conv_info Contains padding and stride information described in @ref PadStrideInfo.
+     * @param[in]  dilation  (Optional) Dilation, in elements, across x and y. Defaults to (1, 1).
+     */
+    void configure(const ITensor *input, const ITensor *weights, ITensor *output, const PadStrideInfo &conv_info, const Size2D &dilation = Size2D(1U, 1U));
+    /** Static function to check if given info will lead to a valid configuration of @ref NEDirectConvolutionLayerNHWCKernel
+     *
+     * @param[in] input     The input tensor info. 3 lower dimensions represent a single input [IFM, width, height],
+     *                      while every optional dimension from 4 and above represent a batch of inputs. Data types supported: F16/F32.
+     *                      Data layout supported: NHWC.
+     * @param[in] weights   Reshaped weights tensor info. A 4D tensor with dimensions [OFM, IFM, kernel_x, kernel_y]. Data type supported: Same as @p input.
+     * @param[in] output    Output tensor info. 3 lower dimensions represent a single output [OFM, width, height]. Data types supported: Same as @p input.
+     * @param[in] conv_info Contains padding and stride information described in @ref PadStrideInfo.
+     * @param[in] dilation  (Optional) Dilation, in elements, across x and y. Defaults to (1, 1).
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *output, const PadStrideInfo &conv_info, const Size2D &dilation = Size2D(1U, 1U));
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+
+private:
+    /** Common signature for all the specialised convolution functions
+     *
+     * @param[in] window Region on which to execute the kernel.
+     */
+    using ConvolutionFunctionPtr = void (NEDirectConvolutionLayerNHWCKernel::*)(const Window &window);
+
+    /** Compute the convolution on the given window
+     *
+     * @param[in] window Region on which to execute the kernel.
+     */
+    template <typename T>
+    void convolve(const Window &window);
+
+    ConvolutionFunctionPtr _func;
+    const ITensor         *_input;
+    const ITensor         *_weights;
+    ITensor               *_output;
+    PadStrideInfo          _conv_info;
+    Size2D                 _dilation;
+};
+} // namespace arm_compute
+#endif /*ARM_COMPUTE_NEDIRECTCONVOLUTIONLAYERNHWCKERNEL_H */
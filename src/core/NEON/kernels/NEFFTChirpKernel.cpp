@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/core/NEON/kernels/NEFFTChirpKernel.h"
+
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/WindowHelpers.h"
+
+#include <algorithm>
+#include <cmath>
+#include <set>
+
+namespace arm_compute
+{
+namespace
+{
+Status validate_arguments(const ITensorInfo *input, const ITensorInfo *output, const FFTChirpKernelInfo &config)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, output);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 2, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON(std::set<unsigned int>({ 0, 1 }).count(config.axis) == 0);
+    ARM_COMPUTE_RETURN_ERROR_ON(config.length == 0);
+    ARM_COMPUTE_RETURN_ERROR_ON(config.scale == 0.f);
+
+    // Checks performed when output is configured
+    if(output->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON(output->num_channels() != 2);
+        ARM_COMPUTE_RETURN_ERROR_ON(std::min(input->dimension(config.axis), output->dimension(config.axis)) > config.length);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
+        for(size_t d = 0; d < TensorShape::num_max_dimensions; ++d)
+        {
+            ARM_COMPUTE_RETURN_ERROR_ON(d != config.axis && input->dimension(d) != output->dimension(d));
+        }
+    }
+    else
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON(input->dimension(config.axis) > config.length);
+    }
+
+    return Status{};
+}
+
+std::pair<Status, Window> validate_and_configure_window(ITensorInfo *input, ITensorInfo *output, const FFTChirpKernelInfo &config)
+{
+    // Output auto inizialitation if not yet initialized
+    auto_init_if_empty(*output, *input->clone());
+
+    // Every line along the axis is processed at once
+    Window win = calculate_max_window(*output, Steps());
+    win.set(config.axis, Window::Dimension(0, 1, 1));
+
+    Coordinates coord;
+    coord.set_num_dimensions(output->num_dimensions());
+    output->set_valid_region(ValidRegion(coord, output->tensor_shape()));
+
+    return std::make_pair(Status{}, win);
+}
+} // namespace
+
+NEFFTChirpKernel::NEFFTChirpKernel()
+    : _input(nullptr), _output(nullptr), _chirp(), _axis(0)
+{
+}
+
+void NEFFTChirpKernel::configure(const ITensor *input, ITensor *output, const FFTChirpKernelInfo &config)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, output);
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(input->info(), output->info(), config));
+
+    _input  = input;
+    _output = output;
+    _axis   = config.axis;
+
+    // Configure kernel window
+    auto win_config = validate_and_configure_window(input->info(), output->info(), config);
+    ARM_COMPUTE_ERROR_THROW_ON(win_config.first);
+    INEKernel::configure(win_config.second);
+
+    // Chirp values, stored as interleaved real and imaginary parts. n^2 is reduced modulo 2 * N to keep the phase accurate
+    const size_t   length = std::min(input->info()->dimension(_axis), output->info()->dimension(_axis));
+    const uint64_t period = 2 * static_cast<uint64_t>(config.length);
+    const double   sign   = config.conjugate ? 1.0 : -1.0;
+    _chirp.resize(2 * length);
+    for(size_t n = 0; n < length; ++n)
+    {
+        const double phase = sign * M_PI * static_cast<double>((static_cast<uint64_t>(n) * n) % period) / static_cast<double>(config.length);
+        _chirp[2 * n]      = static_cast<float>(std::cos(phase) / config.scale);
+        _chirp[2 * n + 1]  = static_cast<float>(std::sin(phase) / config.scale);
+    }
+}
+
+Status NEFFTChirpKernel::validate(const ITensorInfo *input, const ITensorInfo *output, const FFTChirpKernelInfo &config)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(input, output, config));
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_and_configure_window(input->clone().get(), output->clone().get(), config).first);
+    return Status{};
+}
+
+void NEFFTChirpKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+    ARM_COMPUTE_UNUSED(info);
+
+    const size_t out_length    = _output->info()->dimension(_axis);
+    const size_t length        = _chirp.size() / 2;
+    const size_t in_stride     = _input->info()->strides_in_bytes()[_axis];
+    const size_t out_stride    = _output->info()->strides_in_bytes()[_axis];
+    const size_t element_size  = _output->info()->element_size();
+    const bool   is_contiguous = (_axis == 0);
+
+    Iterator in(_input, window);
+    Iterator out(_output, window);
+
+    execute_window_loop(window, [&](const Coordinates &)
+    {
+        const uint8_t *in_ptr  = in.ptr();
+        uint8_t       *out_ptr = out.ptr();
+
+        for(size_t n = 0; n < length; ++n)
+        {
+            const auto  src  = reinterpret_cast<const float *>(in_ptr + n * in_stride);
+            const auto  dst  = reinterpret_cast<float *>(out_ptr + n * out_stride);
+            const float c_re = _chirp[2 * n];
+            const float c_im = _chirp[2 * n + 1];
+            const float x_re = src[0];
+            const float x_im = src[1];
+
+            dst[0] = x_re * c_re - x_im * c_im;
+            dst[1] = x_re * c_im + x_im * c_re;
+        }
+
+        // Zero padding
+        if(out_length > length)
+        {
+            if(is_contiguous)
+            {
+                std::fill_n(reinterpret_cast<float *>(out_ptr + length * out_stride), 2 * (out_length - length), 0.f);
+            }
+            else
+            {
+                for(size_t n = length; n < out_length; ++n)
+                {
+                    std::fill_n(out_ptr + n * out_stride, element_size, 0);
+                }
+            }
+        }
+    },
+    in, out);
+}
+} // namespace arm_compute
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_NEFFTCHIRPKERNEL_H
+#define ARM_COMPUTE_NEFFTCHIRPKERNEL_H
+
+#include "arm_compute/core/KernelDescriptors.h"
+#include "src/core/NEON/INEKernel.h"
+
+#include <vector>
+
+namespace arm_compute
+{
+// Forward declarations
+class ITensor;
+
+/** Interface for the kernel multiplying a complex signal by the chirp used by Bluestein's algorithm.
+ *
+ * Along the given axis, the first elements of the output are:
+ *  \f[
+ *       out(n) = in(n) \cdot \frac{e^{-i \pi n^2 / N}}{scale}
+ *  \f]
+ * The input is truncated to the length of the output, or the output is zero padded past the length of the input.
+ */
+class NEFFTChirpKernel : public INEKernel
+{
+public:
+    const char *name() const override
+    {
+        return "NEFFTChirpKernel";
+    }
+    /** Constructor */
+    NEFFTChirpKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEFFTChirpKernel(const NEFFTChirpKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEFFTChirpKernel &operator=(const NEFFTChirpKernel &) = delete;
+    /** Default Move Constructor. */
+    NEFFTChirpKernel(NEFFTChirpKernel &&) = default;
+    /** Default move assignment operator */
+    NEFFTChirpKernel &operator=(NEFFTChirpKernel &&) = default;
+    /** Default destructor */
+    ~NEFFTChirpKernel() = default;
+    /** Set the input and output tensors.
+     *
+     * @param[in]  input  Source tensor. Data types supported: F32. Number of channels supported: 2 (complex tensor).
+     * @param[out] output Destination tensor. Data type supported: same as @p input. Number of channels supported: same as @p input.
+     *                    Can only differ from @p input along the axis of the kernel. Auto-initialized to the shape of @p input if empty.
+     * @param[in]  config Kernel configuration. The shortest of @p input and @p output must not be longer than the chirp length along the axis.
+     */
+    void configure(const ITensor *input, ITensor *output, const FFTChirpKernelInfo &config);
+    /** Static function to check if given info will lead to a valid configuration of @ref NEFFTChirpKernel
+     *
+     * @param[in] input  Source tensor info. Data types supported: F32. Number of channels supported: 2 (complex tensor).
+     * @param[in] output Destination tensor info. Data type supported: same as @p input. Number of channels supported: same as @p input.
+     *                   Can only differ from @p input along the axis of the kernel.
+     * @param[in] config Kernel configuration. The shortest of @p input and @p output must not be longer than the chirp length along the axis.
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *input, const ITensorInfo *output, const FFTChirpKernelInfo &config);
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+
+private:
+    const ITensor     *_input;
+    ITensor           *_output;
+    std::vector<float> _chirp;
+    unsigned int       _axis;
+};
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_NEFFTCHIRPKERNEL_H */
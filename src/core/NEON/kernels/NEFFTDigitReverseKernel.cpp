@@ -43,13 +43,25 @@ Status validate_arguments(const ITensorInfo *input, const ITensorInfo *output, c
     ARM_COMPUTE_RETURN_ERROR_ON(input->num_channels() > 2);
     ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(idx, 1, DataType::U32);
     ARM_COMPUTE_RETURN_ERROR_ON(std::set<unsigned int>({ 0, 1 }).count(config.axis) == 0);
-    ARM_COMPUTE_RETURN_ERROR_ON(input->tensor_shape()[config.axis] != idx->tensor_shape().x());
+
+    if(config.packed_real_input)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON(config.axis != 0);
+        ARM_COMPUTE_RETURN_ERROR_ON(input->num_channels() != 1);
+        ARM_COMPUTE_RETURN_ERROR_ON(input->dimension(0) % 2 != 0);
+        ARM_COMPUTE_RETURN_ERROR_ON(input->dimension(0) / 2 != idx->tensor_shape().x());
+    }
+    else
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON(input->tensor_shape()[config.axis] != idx->tensor_shape().x());
+    }
 
     // Checks performed when output is configured
     if((output != nullptr) && (output->total_size() != 0))
     {
         ARM_COMPUTE_RETURN_ERROR_ON(output->num_channels() != 2);
-        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(input, output);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(config.packed_real_input ? 1U : 0U, input, output);
+        ARM_COMPUTE_RETURN_ERROR_ON(config.packed_real_input && output->dimension(0) != input->dimension(0) / 2);
         ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
     }
 
@@ -58,9 +70,15 @@ Status validate_arguments(const ITensorInfo *input, const ITensorInfo *output, c
 
 std::pair<Status, Window> validate_and_configure_window(ITensorInfo *input, ITensorInfo *output, ITensorInfo *idx, const FFTDigitReverseKernelInfo &config)
 {
-    ARM_COMPUTE_UNUSED(idx, config);
+    ARM_COMPUTE_UNUSED(idx);
 
-    auto_init_if_empty(*output, input->clone()->set_num_channels(2));
+    // Pairs of real elements are read as a single complex element when the input is packed
+    TensorShape output_shape = input->tensor_shape();
+    if(config.packed_real_input)
+    {
+        output_shape.set(0, input->dimension(0) / 2);
+    }
+    auto_init_if_empty(*output, input->clone()->set_num_channels(2).set_tensor_shape(output_shape));
 
     Window win = calculate_max_window(*input, Steps());
     input->set_valid_region(ValidRegion(Coordinates(), input->tensor_shape()));
@@ -92,7 +110,12 @@ void NEFFTDigitReverseKernel::configure(const ITensor *input, ITensor *output, c
     ARM_COMPUTE_ERROR_THROW_ON(win_config.first);
     INEKernel::configure(win_config.second);
 
-    if(axis == 0)
+    if(config.packed_real_input)
+    {
+        // The packed real input has the same memory layout as a complex input
+        _func = &NEFFTDigitReverseKernel::digit_reverse_kernel_axis_0<true, false>;
+    }
+    else if(axis == 0)
     {
         if(is_input_complex)
         {
@@ -144,7 +167,7 @@ Status NEFFTDigitReverseKernel::validate(const ITensorInfo *input, const ITensor
 template <bool is_input_complex, bool is_conj>
 void NEFFTDigitReverseKernel::digit_reverse_kernel_axis_0(const Window &window)
 {
-    const size_t N = _input->info()->dimension(0);
+    const size_t N = _output->info()->dimension(0);
 
     // Copy the look-up buffer to a local array
     std::vector<unsigned int> buffer_idx(N);
@@ -56,6 +56,7 @@ public:
      *
      * @param[in]  input  Source tensor. Data types supported: F32. Number of channels supported: 1 (real tensor) or 2 (complex tensor).
      * @param[out] output Destination tensor. Data type supported: same as @p input. Number of channels supported: 2 (complex tensor).
+     *                    If @p config packs a real input, the output has half as many elements as @p input along the x axis.
      * @param[in]  idx    Digit reverse index tensor. Data type supported: U32
      * @param[in]  config Kernel configuration.
      */
@@ -65,6 +66,7 @@ public:
      *
      * @param[in] input  Source tensor info. Data types supported: F32. Number of channels supported: 1 (real tensor) or 2 (complex tensor).
      * @param[in] output Destination tensor info. Data type supported: same as @p input. Number of channels supported: 2 (complex tensor).
+     *                   If @p config packs a real input, the output has half as many elements as @p input along the x axis.
      * @param[in] idx    Digit reverse index tensor info. Data type supported: U32
      * @param[in] config Kernel configuration
      *
@@ -65,6 +65,41 @@ constexpr float kW7_5 = 0.43388373911755f;
 // Constant used in the fft_8 kernel
 constexpr float kSqrt2Div2 = 0.707106781186548;
 
+// Constants used in the fft_11 and fft_13 kernels: cos(2 * pi * m / P) and sin(2 * pi * m / P) for m = 1, ..., (P - 1) / 2
+constexpr float kW11_cos[] = { 0.84125353283118f, 0.41541501300189f, -0.14231483827329f, -0.65486073394528f, -0.95949297361450f };
+constexpr float kW11_sin[] = { 0.54064081745560f, 0.90963199535452f, 0.98982144188093f, 0.75574957435426f, 0.28173255684143f };
+constexpr float kW13_cos[] = { 0.88545602565321f, 0.56806474673116f, 0.12053668025532f, -0.35460488704254f, -0.74851074817110f, -0.97094181742605f };
+constexpr float kW13_sin[] = { 0.46472317204377f, 0.82298386589366f, 0.99270887409805f, 0.93501624268541f, 0.66312265824080f, 0.23931566428756f };
+
+template <unsigned int P>
+struct PrimeRadixConstants;
+
+template <>
+struct PrimeRadixConstants<11>
+{
+    static const float *cos()
+    {
+        return kW11_cos;
+    }
+    static const float *sin()
+    {
+        return kW11_sin;
+    }
+};
+
+template <>
+struct PrimeRadixConstants<13>
+{
+    static const float *cos()
+    {
+        return kW13_cos;
+    }
+    static const float *sin()
+    {
+        return kW13_sin;
+    }
+};
+
 float32x2_t c_mul_neon(float32x2_t a, float32x2_t b)
 {
     using ExactTagType = typename wrapper::traits::neon_vector<float, 2>::tag_type;
@@ -350,6 +385,55 @@ void fft_8(float32x2_t &x1, float32x2_t &x2, float32x2_t &x3, float32x2_t &x4, f
     x8 = reduce_sum_8(a, b6, c6, d6, e6, f6, g6, h6);
 }
 
+/** Base-case transform of an odd prime radix P.
+ *
+ * Inputs x[j] and x[P - j] are combined in sums and differences, so that each pair of outputs X[k] and X[P - k]
+ * shares the same (P - 1) / 2 real multiplications by the cosine and sine constants.
+ */
+template <unsigned int P>
+void fft_odd_prime(float32x2_t (&x)[P], const float32x2_t (&w)[P])
+{
+    using ExactTagType       = typename wrapper::traits::neon_vector<float, 2>::tag_type;
+    constexpr unsigned int H = (P - 1) / 2;
+
+    const float *cos_table = PrimeRadixConstants<P>::cos();
+    const float *sin_table = PrimeRadixConstants<P>::sin();
+
+    const float32x2_t x0  = x[0];
+    float32x2_t       sum = x0;
+    float32x2_t       sums[H];
+    float32x2_t       diffs[H];
+    for(unsigned int j = 1; j <= H; ++j)
+    {
+        const float32x2_t a = c_mul_neon(w[j], x[j]);
+        const float32x2_t b = c_mul_neon(w[P - j], x[P - j]);
+        sums[j - 1]         = wrapper::vadd(a, b);
+        diffs[j - 1]        = wrapper::vsub(a, b);
+        sum                 = wrapper::vadd(sum, sums[j - 1]);
+    }
+
+    x[0] = sum;
+    for(unsigned int k = 1; k <= H; ++k)
+    {
+        float32x2_t re = x0;
+        float32x2_t im = wrapper::vdup_n(0.f, ExactTagType{});
+        for(unsigned int j = 1; j <= H; ++j)
+        {
+            // cos(2 * pi * j * k / P) and sin(2 * pi * j * k / P) from the tables, using the symmetries around pi
+            const unsigned int m     = (j * k) % P;
+            const float        cos_m = (m <= H) ? cos_table[m - 1] : cos_table[P - m - 1];
+            const float        sin_m = (m <= H) ? sin_table[m - 1] : -sin_table[P - m - 1];
+            re                       = wrapper::vmla(re, sums[j - 1], wrapper::vdup_n(cos_m, ExactTagType{}));
+            im                       = wrapper::vmla(im, diffs[j - 1], wrapper::vdup_n(sin_m, ExactTagType{}));
+        }
+
+        // X[k] = re - i * im and X[P - k] = re + i * im
+        const float32x2_t i_im = c_mul_neon_img(im, 1.f);
+        x[k]                   = wrapper::vsub(re, i_im);
+        x[P - k]               = wrapper::vadd(re, i_im);
+    }
+}
+
 template <bool first_stage>
 void fft_radix_2_axes_0(float *X, float *x, unsigned int Nx, unsigned int NxRadix, const float32x2_t &w_m, unsigned int N)
 {
@@ -899,6 +983,78 @@ void fft_radix_8_axes_1(float *X, float *x, unsigned int Nx, unsigned int NxRadi
     }
 }
 
+template <unsigned int P>
+void fft_radix_odd_prime_axes_0(float *X, float *x, unsigned int Nx, unsigned int NxRadix, const float32x2_t &w_m, unsigned int N)
+{
+    float32x2_t w{ 1.0f, 0.0f };
+    for(unsigned int j = 0; j < Nx; j++)
+    {
+        float32x2_t wi[P];
+        wi[0] = float32x2_t{ 1.0f, 0.0f };
+        for(unsigned int i = 1; i < P; ++i)
+        {
+            wi[i] = c_mul_neon(wi[i - 1], w);
+        }
+
+        for(unsigned int k = 2 * j; k < 2 * N; k += 2 * NxRadix)
+        {
+            // Load inputs
+            float32x2_t v[P];
+            for(unsigned int i = 0; i < P; ++i)
+            {
+                v[i] = wrapper::vload(x + k + 2 * i * Nx);
+            }
+
+            // Base-case prime transform
+            fft_odd_prime<P>(v, wi);
+
+            // Store outputs
+            for(unsigned int i = 0; i < P; ++i)
+            {
+                wrapper::vstore(X + k + 2 * i * Nx, v[i]);
+            }
+        }
+
+        w = c_mul_neon(w, w_m);
+    }
+}
+
+template <unsigned int P>
+void fft_radix_odd_prime_axes_1(float *X, float *x, unsigned int Nx, unsigned int NxRadix, const float32x2_t &w_m, unsigned int M, unsigned int N)
+{
+    float32x2_t w{ 1.0f, 0.0f };
+    for(unsigned int j = 0; j < Nx; j++)
+    {
+        float32x2_t wi[P];
+        wi[0] = float32x2_t{ 1.0f, 0.0f };
+        for(unsigned int i = 1; i < P; ++i)
+        {
+            wi[i] = c_mul_neon(wi[i - 1], w);
+        }
+
+        for(unsigned int k = 2 * j; k < 2 * N; k += 2 * NxRadix)
+        {
+            // Load inputs
+            float32x2_t v[P];
+            for(unsigned int i = 0; i < P; ++i)
+            {
+                v[i] = wrapper::vload(x + M * (k + 2 * i * Nx));
+            }
+
+            // Base-case prime transform
+            fft_odd_prime<P>(v, wi);
+
+            // Store outputs
+            for(unsigned int i = 0; i < P; ++i)
+            {
+                wrapper::vstore(X + M * (k + 2 * i * Nx), v[i]);
+            }
+        }
+
+        w = c_mul_neon(w, w_m);
+    }
+}
+
 Status validate_arguments(const ITensorInfo *input, const ITensorInfo *output, const FFTRadixStageKernelInfo &config)
 {
     ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 2, DataType::F32);
@@ -947,19 +1103,23 @@ void NEFFTRadixStageKernel::set_radix_stage_axis0(const FFTRadixStageKernelInfo
 
     if(fft_table_axis0.empty())
     {
-        fft_table_axis0[2][false] = &fft_radix_2_axes_0<false>;
-        fft_table_axis0[3][false] = &fft_radix_3_axes_0<false>;
-        fft_table_axis0[4][false] = &fft_radix_4_axes_0<false>;
-        fft_table_axis0[5][false] = &fft_radix_5_axes_0<false>;
-        fft_table_axis0[7][false] = &fft_radix_7_axes_0<false>;
-        fft_table_axis0[8][false] = &fft_radix_8_axes_0<false>;
-
-        fft_table_axis0[2][true] = &fft_radix_2_axes_0<true>;
-        fft_table_axis0[3][true] = &fft_radix_3_axes_0<true>;
-        fft_table_axis0[4][true] = &fft_radix_4_axes_0<true>;
-        fft_table_axis0[5][true] = &fft_radix_5_axes_0<true>;
-        fft_table_axis0[7][true] = &fft_radix_7_axes_0<true>;
-        fft_table_axis0[8][true] = &fft_radix_8_axes_0<true>;
+        fft_table_axis0[2][false]  = &fft_radix_2_axes_0<false>;
+        fft_table_axis0[3][false]  = &fft_radix_3_axes_0<false>;
+        fft_table_axis0[4][false]  = &fft_radix_4_axes_0<false>;
+        fft_table_axis0[5][false]  = &fft_radix_5_axes_0<false>;
+        fft_table_axis0[7][false]  = &fft_radix_7_axes_0<false>;
+        fft_table_axis0[8][false]  = &fft_radix_8_axes_0<false>;
+        fft_table_axis0[11][false] = &fft_radix_odd_prime_axes_0<11>;
+        fft_table_axis0[13][false] = &fft_radix_odd_prime_axes_0<13>;
+
+        fft_table_axis0[2][true]  = &fft_radix_2_axes_0<true>;
+        fft_table_axis0[3][true]  = &fft_radix_3_axes_0<true>;
+        fft_table_axis0[4][true]  = &fft_radix_4_axes_0<true>;
+        fft_table_axis0[5][true]  = &fft_radix_5_axes_0<true>;
+        fft_table_axis0[7][true]  = &fft_radix_7_axes_0<true>;
+        fft_table_axis0[8][true]  = &fft_radix_8_axes_0<true>;
+        fft_table_axis0[11][true] = &fft_radix_odd_prime_axes_0<11>;
+        fft_table_axis0[13][true] = &fft_radix_odd_prime_axes_0<13>;
     }
 
     _func_0 = fft_table_axis0[config.radix][config.is_first_stage];
@@ -972,12 +1132,14 @@ void NEFFTRadixStageKernel::set_radix_stage_axis1(const FFTRadixStageKernelInfo
 
     if(fft_table_axis1.empty())
     {
-        fft_table_axis1[2] = &fft_radix_2_axes_1;
-        fft_table_axis1[3] = &fft_radix_3_axes_1;
-        fft_table_axis1[4] = &fft_radix_4_axes_1;
-        fft_table_axis1[5] = &fft_radix_5_axes_1;
-        fft_table_axis1[7] = &fft_radix_7_axes_1;
-        fft_table_axis1[8] = &fft_radix_8_axes_1;
+        fft_table_axis1[2]  = &fft_radix_2_axes_1;
+        fft_table_axis1[3]  = &fft_radix_3_axes_1;
+        fft_table_axis1[4]  = &fft_radix_4_axes_1;
+        fft_table_axis1[5]  = &fft_radix_5_axes_1;
+        fft_table_axis1[7]  = &fft_radix_7_axes_1;
+        fft_table_axis1[8]  = &fft_radix_8_axes_1;
+        fft_table_axis1[11] = &fft_radix_odd_prime_axes_1<11>;
+        fft_table_axis1[13] = &fft_radix_odd_prime_axes_1<13>;
     }
 
     _func_1 = fft_table_axis1[config.radix];
@@ -1035,7 +1197,7 @@ Status NEFFTRadixStageKernel::validate(const ITensorInfo *input, const ITensorIn
 
 std::set<unsigned int> NEFFTRadixStageKernel::supported_radix()
 {
-    return std::set<unsigned int> { 2, 3, 4, 5, 7, 8 };
+    return std::set<unsigned int> { 2, 3, 4, 5, 7, 8, 11, 13 };
 }
 
 void NEFFTRadixStageKernel::run(const Window &window, const ThreadInfo &info)
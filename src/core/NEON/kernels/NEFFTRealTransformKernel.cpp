@@ -0,0 +1,229 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/core/NEON/kernels/NEFFTRealTransformKernel.h"
+
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/WindowHelpers.h"
+
+#include <cmath>
+
+namespace arm_compute
+{
+namespace
+{
+/** Number of elements along the x axis of the packed spectrum of a transform */
+size_t packed_size(const ITensorInfo &input, const FFTRealTransformKernelInfo &config)
+{
+    return config.inverse ? input.dimension(0) - 1 : input.dimension(0);
+}
+
+/** Number of elements along the x axis of the output of a transform */
+size_t output_size(const ITensorInfo &input, const FFTRealTransformKernelInfo &config)
+{
+    if(config.is_odd)
+    {
+        // Full spectrum of N elements and its N / 2 + 1 non-redundant bins
+        return config.inverse ? 2 * input.dimension(0) - 1 : input.dimension(0) / 2 + 1;
+    }
+    return config.inverse ? packed_size(input, config) : packed_size(input, config) + 1;
+}
+
+Status validate_arguments(const ITensorInfo *input, const ITensorInfo *output, const FFTRealTransformKernelInfo &config)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, output);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 2, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON(packed_size(*input, config) == 0);
+    ARM_COMPUTE_RETURN_ERROR_ON(config.is_odd && !config.inverse && (input->dimension(0) % 2 == 0));
+
+    // Checks performed when output is configured
+    if(output->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON(output->num_channels() != 2);
+        ARM_COMPUTE_RETURN_ERROR_ON(output->dimension(0) != output_size(*input, config));
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(1U, input, output);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
+    }
+
+    return Status{};
+}
+
+std::pair<Status, Window> validate_and_configure_window(ITensorInfo *input, ITensorInfo *output, const FFTRealTransformKernelInfo &config)
+{
+    // Output auto inizialitation if not yet initialized
+    TensorShape output_shape = input->tensor_shape();
+    output_shape.set(0, output_size(*input, config));
+    auto_init_if_empty(*output, input->clone()->set_tensor_shape(output_shape));
+
+    // Every row is processed at once
+    Window win = calculate_max_window(*output, Steps());
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    Coordinates coord;
+    coord.set_num_dimensions(output->num_dimensions());
+    output->set_valid_region(ValidRegion(coord, output->tensor_shape()));
+
+    return std::make_pair(Status{}, win);
+}
+} // namespace
+
+NEFFTRealTransformKernel::NEFFTRealTransformKernel()
+    : _input(nullptr), _output(nullptr), _twiddles(), _is_inverse(false), _is_odd(false)
+{
+}
+
+void NEFFTRealTransformKernel::configure(const ITensor *input, ITensor *output, const FFTRealTransformKernelInfo &config)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, output);
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(input->info(), output->info(), config));
+
+    _input      = input;
+    _output     = output;
+    _is_inverse = config.inverse;
+    _is_odd     = config.is_odd;
+
+    // Twiddle factors e^(-2 * pi * i * k / N), with N = 2 * M, stored as interleaved real and imaginary parts
+    if(!_is_odd)
+    {
+        const size_t M = packed_size(*input->info(), config);
+        _twiddles.resize(2 * (M + 1));
+        for(size_t k = 0; k <= M; ++k)
+        {
+            const double phase   = -M_PI * static_cast<double>(k) / static_cast<double>(M);
+            _twiddles[2 * k]     = static_cast<float>(std::cos(phase));
+            _twiddles[2 * k + 1] = static_cast<float>(std::sin(phase));
+        }
+    }
+
+    // Configure kernel window
+    auto win_config = validate_and_configure_window(input->info(), output->info(), config);
+    ARM_COMPUTE_ERROR_THROW_ON(win_config.first);
+    INEKernel::configure(win_config.second);
+}
+
+Status NEFFTRealTransformKernel::validate(const ITensorInfo *input, const ITensorInfo *output, const FFTRealTransformKernelInfo &config)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(input, output, config));
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_and_configure_window(input->clone().get(), output->clone().get(), config).first);
+    return Status{};
+}
+
+void NEFFTRealTransformKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+    ARM_COMPUTE_UNUSED(info);
+
+    const size_t M = _is_inverse ? _output->info()->dimension(0) : _input->info()->dimension(0);
+    const size_t K = _is_inverse ? _input->info()->dimension(0) : _output->info()->dimension(0);
+
+    Iterator in(_input, window);
+    Iterator out(_output, window);
+
+    execute_window_loop(window, [&](const Coordinates &)
+    {
+        const auto in_ptr  = reinterpret_cast<const float *>(in.ptr());
+        const auto out_ptr = reinterpret_cast<float *>(out.ptr());
+
+        if(_is_odd)
+        {
+            // The imaginary part of the DC bin of a real signal is zero
+            out_ptr[0] = in_ptr[0];
+            out_ptr[1] = 0.f;
+            for(size_t k = 1; k < K; ++k)
+            {
+                out_ptr[2 * k]     = in_ptr[2 * k];
+                out_ptr[2 * k + 1] = in_ptr[2 * k + 1];
+            }
+
+            // The upper half of the spectrum is the conjugate of the lower one
+            if(_is_inverse)
+            {
+                for(size_t k = 1; k < K; ++k)
+                {
+                    out_ptr[2 * (M - k)]     = in_ptr[2 * k];
+                    out_ptr[2 * (M - k) + 1] = -in_ptr[2 * k + 1];
+                }
+            }
+        }
+        else if(_is_inverse)
+        {
+            for(size_t k = 0; k < M; ++k)
+            {
+                // Even and odd halves of the spectrum. The imaginary parts of the DC and Nyquist bins of a real signal are zero
+                const float a_re = in_ptr[2 * k];
+                const float a_im = (k == 0) ? 0.f : in_ptr[2 * k + 1];
+                const float b_re = in_ptr[2 * (M - k)];
+                const float b_im = (k == 0) ? 0.f : -in_ptr[2 * (M - k) + 1];
+
+                const float e_re = 0.5f * (a_re + b_re);
+                const float e_im = 0.5f * (a_im + b_im);
+                const float d_re = 0.5f * (a_re - b_re);
+                const float d_im = 0.5f * (a_im - b_im);
+
+                // O = conj(w) * D
+                const float w_re = _twiddles[2 * k];
+                const float w_im = _twiddles[2 * k + 1];
+                const float o_re = w_re * d_re + w_im * d_im;
+                const float o_im = w_re * d_im - w_im * d_re;
+
+                // Z = E + i * O
+                out_ptr[2 * k]     = e_re - o_im;
+                out_ptr[2 * k + 1] = e_im + o_re;
+            }
+        }
+        else
+        {
+            for(size_t k = 0; k <= M; ++k)
+            {
+                const size_t k0 = (k == M) ? 0 : k;
+                const size_t k1 = (k == 0) ? 0 : M - k;
+
+                // Spectra of the even and odd samples
+                const float a_re = in_ptr[2 * k0];
+                const float a_im = in_ptr[2 * k0 + 1];
+                const float b_re = in_ptr[2 * k1];
+                const float b_im = -in_ptr[2 * k1 + 1];
+
+                const float e_re = 0.5f * (a_re + b_re);
+                const float e_im = 0.5f * (a_im + b_im);
+                const float o_re = 0.5f * (a_im - b_im);
+                const float o_im = -0.5f * (a_re - b_re);
+
+                // X = E + w * O
+                const float w_re = _twiddles[2 * k];
+                const float w_im = _twiddles[2 * k + 1];
+
+                out_ptr[2 * k]     = e_re + w_re * o_re - w_im * o_im;
+                out_ptr[2 * k + 1] = e_im + w_re * o_im + w_im * o_re;
+            }
+        }
+    },
+    in, out);
+}
+} // namespace arm_compute
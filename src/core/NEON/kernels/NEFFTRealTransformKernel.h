@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_NEFFTREALTRANSFORMKERNEL_H
+#define ARM_COMPUTE_NEFFTREALTRANSFORMKERNEL_H
+
+#include "arm_compute/core/KernelDescriptors.h"
+#include "src/core/NEON/INEKernel.h"
+
+#include <vector>
+
+namespace arm_compute
+{
+// Forward declarations
+class ITensor;
+
+/** Interface for the kernel converting between the spectrum of a real signal and the spectrum of the same signal packed as a complex signal of half the length.
+ *
+ * A real signal x of even length N is packed as the complex signal z(n) = x(2n) + i * x(2n + 1) of length M = N / 2. Given Z, the FFT of z:
+ *
+ * - Forward: the N / 2 + 1 non-redundant bins of the FFT of x are computed from Z, which has M bins:
+ *  \f[
+ *       X(k) = \frac{Z(k) + \overline{Z(M - k)}}{2} - i \cdot e^{-2 \pi i k / N} \cdot \frac{Z(k) - \overline{Z(M - k)}}{2}
+ *  \f]
+ * - Inverse: Z is rebuilt from the N / 2 + 1 non-redundant bins of X, so that the inverse FFT of Z gives the packed real signal back:
+ *  \f[
+ *       Z(k) = \frac{X(k) + \overline{X(M - k)}}{2} + i \cdot e^{2 \pi i k / N} \cdot \frac{X(k) - \overline{X(M - k)}}{2}
+ *  \f]
+ *
+ * A real signal of odd length N cannot be packed, so its full spectrum of N bins is computed instead:
+ *
+ * - Forward: the N / 2 + 1 non-redundant bins are copied from the full spectrum.
+ * - Inverse: the full spectrum is rebuilt from the N / 2 + 1 non-redundant bins, as X(N - k) is the conjugate of X(k).
+ *
+ * The imaginary parts of the DC and Nyquist bins of the spectrum of a real signal are zero and are ignored by inverse transforms.
+ *
+ * The kernel works along the x axis.
+ */
+class NEFFTRealTransformKernel : public INEKernel
+{
+public:
+    const char *name() const override
+    {
+        return "NEFFTRealTransformKernel";
+    }
+    /** Constructor */
+    NEFFTRealTransformKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEFFTRealTransformKernel(const NEFFTRealTransformKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEFFTRealTransformKernel &operator=(const NEFFTRealTransformKernel &) = delete;
+    /** Default Move Constructor. */
+    NEFFTRealTransformKernel(NEFFTRealTransformKernel &&) = default;
+    /** Default move assignment operator */
+    NEFFTRealTransformKernel &operator=(NEFFTRealTransformKernel &&) = default;
+    /** Default destructor */
+    ~NEFFTRealTransformKernel() = default;
+    /** Set the input and output tensors.
+     *
+     * @param[in]  input  Source tensor. Data types supported: F32. Number of channels supported: 2 (complex tensor).
+     *                    M elements along the x axis for a forward transform, M + 1 for an inverse one.
+     *                    N elements for a forward transform of odd length, N / 2 + 1 for an inverse one.
+     * @param[out] output Destination tensor. Data type supported: same as @p input. Number of channels supported: 2 (complex tensor).
+     *                    M + 1 elements along the x axis for a forward transform, M for an inverse one.
+     *                    N / 2 + 1 elements for a forward transform of odd length, N for an inverse one.
+     * @param[in]  config Kernel configuration.
+     */
+    void configure(const ITensor *input, ITensor *output, const FFTRealTransformKernelInfo &config);
+    /** Static function to check if given info will lead to a valid configuration of @ref NEFFTRealTransformKernel
+     *
+     * @param[in] input  Source tensor info. Data types supported: F32. Number of channels supported: 2 (complex tensor).
+     *                   M elements along the x axis for a forward transform, M + 1 for an inverse one.
+     *                   N elements for a forward transform of odd length, N / 2 + 1 for an inverse one.
+     * @param[in] output Destination tensor info. Data type supported: same as @p input. Number of channels supported: 2 (complex tensor).
+     *                   M + 1 elements along the x axis for a forward transform, M for an inverse one.
+     *                   N / 2 + 1 elements for a forward transform of odd length, N for an inverse one.
+     * @param[in] config Kernel configuration.
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *input, const ITensorInfo *output, const FFTRealTransformKernelInfo &config);
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+
+private:
+    const ITensor     *_input;
+    ITensor           *_output;
+    std::vector<float> _twiddles;
+    bool               _is_inverse;
+    bool               _is_odd;
+};
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_NEFFTREALTRANSFORMKERNEL_H */
@@ -51,22 +51,32 @@ void scale_complex(float *c_in, float *c_out, bool is_conjugate, float scale)
     wrapper::vstore(c_out, b);
 }
 
-Status validate_arguments(const ITensorInfo *input, const ITensorInfo *output)
+Status validate_arguments(const ITensorInfo *input, const ITensorInfo *output, const FFTScaleKernelInfo &config)
 {
     ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 2, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON(config.packed_real_output && (output == nullptr || output == input));
 
     // Checks performed when output is configured
     if((output != nullptr) && (output->total_size() != 0))
     {
-        ARM_COMPUTE_RETURN_ERROR_ON(output->num_channels() != 1 && output->num_channels() != 2);
-        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(input, output);
+        if(config.packed_real_output)
+        {
+            ARM_COMPUTE_RETURN_ERROR_ON(output->num_channels() != 1);
+            ARM_COMPUTE_RETURN_ERROR_ON(output->dimension(0) != 2 * input->dimension(0));
+            ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(1U, input, output);
+        }
+        else
+        {
+            ARM_COMPUTE_RETURN_ERROR_ON(output->num_channels() != 1 && output->num_channels() != 2);
+            ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(input, output);
+        }
         ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
     }
 
     return Status{};
 }
 
-std::pair<Status, Window> validate_and_configure_window(ITensorInfo *input, ITensorInfo *output)
+std::pair<Status, Window> validate_and_configure_window(ITensorInfo *input, ITensorInfo *output, const FFTScaleKernelInfo &config)
 {
     // Configure kernel window
     Window win = calculate_max_window(*input, Steps());
@@ -74,7 +84,16 @@ std::pair<Status, Window> validate_and_configure_window(ITensorInfo *input, ITen
     if(output != nullptr)
     {
         // Output auto inizialitation if not yet initialized
-        auto_init_if_empty(*output, *input->clone());
+        if(config.packed_real_output)
+        {
+            TensorShape output_shape = input->tensor_shape();
+            output_shape.set(0, 2 * input->dimension(0));
+            auto_init_if_empty(*output, input->clone()->set_num_channels(1).set_tensor_shape(output_shape));
+        }
+        else
+        {
+            auto_init_if_empty(*output, *input->clone());
+        }
 
         // NEFFTScaleKernel doesn't need padding so update_window_and_padding() can be skipped
         Coordinates coord;
@@ -87,32 +106,32 @@ std::pair<Status, Window> validate_and_configure_window(ITensorInfo *input, ITen
 } // namespace
 
 NEFFTScaleKernel::NEFFTScaleKernel()
-    : _input(nullptr), _output(nullptr), _scale(), _run_in_place(false), _is_conj(false)
+    : _input(nullptr), _output(nullptr), _scale(), _run_in_place(false), _is_conj(false), _is_packed_real_output(false)
 {
 }
 
 void NEFFTScaleKernel::configure(ITensor *input, ITensor *output, const FFTScaleKernelInfo &config)
 {
     ARM_COMPUTE_ERROR_ON_NULLPTR(input);
-    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(input->info(), (output != nullptr) ? output->info() : nullptr));
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(input->info(), (output != nullptr) ? output->info() : nullptr, config));
 
-    _input        = input;
-    _output       = output;
-    _run_in_place = (output == nullptr) || (output == input);
-    _is_conj      = config.conjugate;
-    _scale        = config.scale;
+    _input                 = input;
+    _output                = output;
+    _run_in_place          = (output == nullptr) || (output == input);
+    _is_conj               = config.conjugate;
+    _scale                 = config.scale;
+    _is_packed_real_output = config.packed_real_output;
 
     // Configure kernel window
-    auto win_config = validate_and_configure_window(input->info(), _run_in_place ? nullptr : output->info());
+    auto win_config = validate_and_configure_window(input->info(), _run_in_place ? nullptr : output->info(), config);
     ARM_COMPUTE_ERROR_THROW_ON(win_config.first);
     INEKernel::configure(win_config.second);
 }
 
 Status NEFFTScaleKernel::validate(const ITensorInfo *input, const ITensorInfo *output, const FFTScaleKernelInfo &config)
 {
-    ARM_COMPUTE_UNUSED(config);
-    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(input, output));
-    ARM_COMPUTE_RETURN_ON_ERROR(validate_and_configure_window(input->clone().get(), output->clone().get()).first);
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(input, output, config));
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_and_configure_window(input->clone().get(), (output != nullptr) ? output->clone().get() : nullptr, config).first);
 
     return Status{};
 }
@@ -126,8 +145,15 @@ void NEFFTScaleKernel::run(const Window &window, const ThreadInfo &info)
     Window input_window = window;
     input_window.set(Window::DimX, 0);
 
+    // Each complex element is written as two real elements when the output is packed
+    Window output_window = input_window;
+    if(_is_packed_real_output)
+    {
+        output_window.set(Window::DimX, Window::Dimension(0, 2, 2));
+    }
+
     Iterator in(_input, input_window);
-    Iterator out(_run_in_place ? _input : _output, input_window);
+    Iterator out(_run_in_place ? _input : _output, output_window);
 
     execute_window_loop(window, [&](const Coordinates &)
     {
@@ -57,6 +57,7 @@ public:
      *
      * @param[in,out] input  Source tensor. Data types supported: F32. Number of channels supported: 2 (complex tensor).
      * @param[out]    output Destination tensor. Data type supported: same as @p input. Number of channels supported: 1 (real tensor) or 2 (complex tensor).
+     *                       If @p config packs the output, it is a real tensor with twice as many elements as @p input along the x axis.
      * @param[in]     config Kernel configuration
      */
     void configure(ITensor *input, ITensor *output, const FFTScaleKernelInfo &config);
@@ -64,6 +65,7 @@ public:
      *
      * @param[in] input  Source tensor info. Data types supported: F32. Number of channels supported: 2 (complex tensor).
      * @param[in] output Destination tensor info. Data type supported: same as @p input. Number of channels supported: 1 (real tensor) or 2 (complex tensor).
+     *                   If @p config packs the output, it is a real tensor with twice as many elements as @p input along the x axis.
      * @param[in] config Kernel configuration
      *
      * @return a status
@@ -79,6 +81,7 @@ private:
     float    _scale;
     bool     _run_in_place;
     bool     _is_conj;
+    bool     _is_packed_real_output;
 };
 } // namespace arm_compute
 #endif /*ARM_COMPUTE_NEFFTSCALEKERNEL_H */
@@ -0,0 +1,181 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/core/NEON/kernels/NEGEMMLowpDequantizeInt32ToFloatKernel.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/WindowHelpers.h"
+
+#include <arm_neon.h>
+#include <cstdint>
+
+namespace arm_compute
+{
+namespace
+{
+Status validate_arguments(const ITensorInfo *input, const ITensorInfo *lhs, const ITensorInfo *rhs, const ITensorInfo *rhs_sums, const ITensorInfo *bias, const ITensorInfo *output)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, lhs, rhs, rhs_sums, output);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::S32);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(lhs, 1, DataType::QASYMM8, DataType::QASYMM8_SIGNED);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(rhs, 1, DataType::QSYMM8_PER_CHANNEL);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(rhs_sums, 1, DataType::S32);
+    ARM_COMPUTE_RETURN_ERROR_ON(rhs->quantization_info().scale().size() != input->dimension(0));
+    ARM_COMPUTE_RETURN_ERROR_ON(rhs_sums->num_dimensions() > 1);
+    ARM_COMPUTE_RETURN_ERROR_ON(rhs_sums->dimension(0) != input->dimension(0));
+
+    // Check biases if exist
+    if(bias != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(bias, 1, DataType::F32);
+        ARM_COMPUTE_RETURN_ERROR_ON(bias->num_dimensions() > 1);
+        ARM_COMPUTE_RETURN_ERROR_ON(input->dimension(0) != bias->dimension(0));
+    }
+
+    if(output->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::F32);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(input, output);
+    }
+
+    return Status{};
+}
+} // namespace
+
+NEGEMMLowpDequantizeInt32ToFloatKernel::NEGEMMLowpDequantizeInt32ToFloatKernel()
+    : _input(nullptr), _lhs(nullptr), _rhs(nullptr), _rhs_sums(nullptr), _bias(nullptr), _output(nullptr)
+{
+}
+
+void NEGEMMLowpDequantizeInt32ToFloatKernel::configure(const ITensor *input, const ITensor *lhs, const ITensor *rhs, const ITensor *rhs_sums, const ITensor *bias, ITensor *output)
+{
+    // Perform validate step
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, lhs, rhs, rhs_sums, output);
+
+    // Output auto inizialitation if not yet initialized
+    auto_init_if_empty(*output->info(), input->info()->clone()->set_data_type(DataType::F32));
+
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(input->info(), lhs->info(), rhs->info(), rhs_sums->info(), (bias != nullptr) ? bias->info() : nullptr, output->info()));
+
+    _input    = input;
+    _lhs      = lhs;
+    _rhs      = rhs;
+    _rhs_sums = rhs_sums;
+    _bias     = bias;
+    _output   = output;
+
+    // Configure kernel window
+    Window      win = calculate_max_window(*input->info(), Steps());
+    Coordinates coord;
+    coord.set_num_dimensions(output->info()->num_dimensions());
+    output->info()->set_valid_region(ValidRegion(coord, output->info()->tensor_shape()));
+
+    INEKernel::configure(win);
+}
+
+Status NEGEMMLowpDequantizeInt32ToFloatKernel::validate(const ITensorInfo *input, const ITensorInfo *lhs, const ITensorInfo *rhs, const ITensorInfo *rhs_sums, const ITensorInfo *bias,
+                                                        const ITensorInfo *output)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(input, lhs, rhs, rhs_sums, bias, output));
+    return Status{};
+}
+
+void NEGEMMLowpDequantizeInt32ToFloatKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+
+    const UniformQuantizationInfo lhs_qinfo  = _lhs->info()->quantization_info().uniform();
+    const float                  *rhs_scales = _rhs->info()->quantization_info().scale().data();
+
+    const auto rhs_sums_ptr = reinterpret_cast<const int32_t *>(_rhs_sums->buffer() + _rhs_sums->info()->offset_first_element_in_bytes());
+    const auto bias_ptr     = (_bias != nullptr) ? reinterpret_cast<const float *>(_bias->buffer() + _bias->info()->offset_first_element_in_bytes()) : nullptr;
+
+    const float32x4_t lhs_scale_f32  = vdupq_n_f32(lhs_qinfo.scale);
+    const int32x4_t   lhs_offset_s32 = vdupq_n_s32(lhs_qinfo.offset);
+
+    const int  window_step_x  = 8;
+    const auto window_start_x = static_cast<int>(window.x().start());
+    const auto window_end_x   = static_cast<int>(window.x().end());
+
+    Window win(window);
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    Iterator in(_input, win);
+    Iterator out(_output, win);
+
+    execute_window_loop(win, [&](const Coordinates &)
+    {
+        const auto in_ptr  = reinterpret_cast<const int32_t *>(in.ptr());
+        const auto out_ptr = reinterpret_cast<float *>(out.ptr());
+
+        // Compute 8 elements per iteration
+        int x = window_start_x;
+        for(; x <= (window_end_x - window_step_x); x += window_step_x)
+        {
+            // Remove the contribution of the LHS offset in integer arithmetic, so that large accumulators don't lose precision before the conversion
+            float32x4x2_t res =
+            {
+                {
+                    vcvtq_f32_s32(vmlsq_s32(vld1q_s32(in_ptr + x + 0), vld1q_s32(rhs_sums_ptr + x + 0), lhs_offset_s32)),
+                    vcvtq_f32_s32(vmlsq_s32(vld1q_s32(in_ptr + x + 4), vld1q_s32(rhs_sums_ptr + x + 4), lhs_offset_s32))
+                }
+            };
+
+            // Scale back to real values
+            res.val[0] = vmulq_f32(vmulq_f32(res.val[0], lhs_scale_f32), vld1q_f32(rhs_scales + x + 0));
+            res.val[1] = vmulq_f32(vmulq_f32(res.val[1], lhs_scale_f32), vld1q_f32(rhs_scales + x + 4));
+
+            if(bias_ptr != nullptr)
+            {
+                res.val[0] = vaddq_f32(res.val[0], vld1q_f32(bias_ptr + x + 0));
+                res.val[1] = vaddq_f32(res.val[1], vld1q_f32(bias_ptr + x + 4));
+            }
+
+            vst1q_f32(out_ptr + x + 0, res.val[0]);
+            vst1q_f32(out_ptr + x + 4, res.val[1]);
+        }
+
+        // Compute left-over elements
+        for(; x < window_end_x; ++x)
+        {
+            float res = static_cast<float>(in_ptr[x] - lhs_qinfo.offset * rhs_sums_ptr[x]);
+            res = res * lhs_qinfo.scale * rhs_scales[x];
+            if(bias_ptr != nullptr)
+            {
+                res += bias_ptr[x];
+            }
+            out_ptr[x] = res;
+        }
+    },
+    in, out);
+}
+} // namespace arm_compute
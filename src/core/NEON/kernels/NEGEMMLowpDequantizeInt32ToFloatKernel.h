@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_NEGEMMLOWPDEQUANTIZEINT32TOFLOATKERNEL_H
+#define ARM_COMPUTE_NEGEMMLOWPDEQUANTIZEINT32TOFLOATKERNEL_H
+
+#include "src/core/NEON/INEKernel.h"
+
+namespace arm_compute
+{
+class ITensor;
+
+/** NEON kernel used to dequantize the int32 accumulator values of GEMMLowp to F32
+ *
+ * This kernel takes the int32 accumulators of a GEMMLowp computed without offset contribution, where the LHS matrix
+ * is asymmetrically quantized and the RHS matrix is symmetrically quantized per output channel.
+ * The following computations will be performed by the kernel:
+ *
+ *  -# Subtract the LHS offset multiplied by the sum of each RHS column
+ *  -# Multiply each entry of result by the LHS scale and the scale of its output channel
+ *  -# Add bias to final result if bias tensor is not a nullptr
+ *
+ * @note The quantization info of the LHS and RHS tensors is read at run time, so it can be updated between executions.
+ */
+class NEGEMMLowpDequantizeInt32ToFloatKernel : public INEKernel
+{
+public:
+    const char *name() const override
+    {
+        return "NEGEMMLowpDequantizeInt32ToFloatKernel";
+    }
+    /** Constructor */
+    NEGEMMLowpDequantizeInt32ToFloatKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers)*/
+    NEGEMMLowpDequantizeInt32ToFloatKernel(const NEGEMMLowpDequantizeInt32ToFloatKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers)*/
+    NEGEMMLowpDequantizeInt32ToFloatKernel &operator=(const NEGEMMLowpDequantizeInt32ToFloatKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NEGEMMLowpDequantizeInt32ToFloatKernel(NEGEMMLowpDequantizeInt32ToFloatKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NEGEMMLowpDequantizeInt32ToFloatKernel &operator=(NEGEMMLowpDequantizeInt32ToFloatKernel &&) = default;
+    /** Default destructor */
+    ~NEGEMMLowpDequantizeInt32ToFloatKernel() = default;
+    /** Initialise the kernel's input and output.
+     *
+     * @param[in]  input    Input tensor containing the GEMMLowp accumulators. Data type supported: S32
+     * @param[in]  lhs      LHS matrix of the GEMMLowp. Only its quantization info is used. Data type supported: QASYMM8/QASYMM8_SIGNED
+     * @param[in]  rhs      RHS matrix of the GEMMLowp. Only its quantization info is used. Data type supported: QSYMM8_PER_CHANNEL
+     * @param[in]  rhs_sums 1D tensor with dimensions [OFM] containing the sum of each RHS column. Data type supported: S32
+     * @param[in]  bias     Biases tensor. Only shared biases supported and it can be a nullptr if the biases addition is not required.
+     *                      Biases are 1D tensor with dimensions [OFM]. Data type supported: F32.
+     * @param[out] output   Output tensor. Data type supported: F32
+     */
+    void configure(const ITensor *input, const ITensor *lhs, const ITensor *rhs, const ITensor *rhs_sums, const ITensor *bias, ITensor *output);
+    /** Static function to check if given info will lead to a valid configuration of @ref NEGEMMLowpDequantizeInt32ToFloatKernel
+     *
+     * @param[in] input    Input tensor info containing the GEMMLowp accumulators. Data type supported: S32
+     * @param[in] lhs      LHS matrix info of the GEMMLowp. Data type supported: QASYMM8/QASYMM8_SIGNED
+     * @param[in] rhs      RHS matrix info of the GEMMLowp. Data type supported: QSYMM8_PER_CHANNEL
+     * @param[in] rhs_sums 1D tensor info with dimensions [OFM] containing the sum of each RHS column. Data type supported: S32
+     * @param[in] bias     Biases tensor info. It can be a nullptr if the biases addition is not required. Data type supported: F32.
+     * @param[in] output   Output tensor info. Data type supported: F32
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *input, const ITensorInfo *lhs, const ITensorInfo *rhs, const ITensorInfo *rhs_sums, const ITensorInfo *bias, const ITensorInfo *output);
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+
+private:
+    const ITensor *_input;
+    const ITensor *_lhs;
+    const ITensor *_rhs;
+    const ITensor *_rhs_sums;
+    const ITensor *_bias;
+    ITensor       *_output;
+};
+} // namespace arm_compute
+
+#endif /* ARM_COMPUTE_NEGEMMLOWPDEQUANTIZEINT32TOFLOATKERNEL_H */
@@ -47,6 +47,20 @@ using namespace misc::shape_calculator;
 
 namespace
 {
+TensorShape get_output_shape(const ITensorInfo *input, const Size2D &kernel_dims, const PadStrideInfo &conv_info, bool has_bias, const Size2D &dilation, unsigned int num_groups)
+{
+    TensorShape output_shape = compute_im2col_conv_shape(input, kernel_dims, conv_info, has_bias, dilation, false, num_groups);
+
+    if(num_groups > 1)
+    {
+        // Keep the groups on the outermost dimension, [K / num_groups, M, batches, num_groups], so that each group is a separate GEMM multi
+        output_shape.set(2, input->tensor_shape().total_size_upper(3));
+        output_shape.set(3, num_groups);
+    }
+
+    return output_shape;
+}
+
 Status validate_arguments(const ITensorInfo *input, const ITensorInfo *output, const Size2D &kernel_dims, const PadStrideInfo &conv_info,
                           bool has_bias, const Size2D &dilation, unsigned int num_groups)
 {
@@ -54,11 +68,14 @@ Status validate_arguments(const ITensorInfo *input, const ITensorInfo *output, c
     ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::QASYMM8, DataType::QASYMM8_SIGNED, DataType::BFLOAT16, DataType::F16, DataType::F32);
     ARM_COMPUTE_RETURN_ERROR_ON(is_data_type_quantized(input->data_type()) && has_bias);
     ARM_COMPUTE_RETURN_ERROR_ON((dilation.x() < 1) || (dilation.y() < 1));
-    ARM_COMPUTE_RETURN_ERROR_ON_MSG(num_groups > 1, "Number of groups greater than one are not supported on NEON");
+    ARM_COMPUTE_RETURN_ERROR_ON(num_groups == 0);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG((num_groups > 1) && (input->num_dimensions() > 4), "Grouped im2col supports at most one batch dimension");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG((input->dimension(get_data_layout_dimension_index(input->data_layout(), DataLayoutDimension::CHANNEL)) % num_groups) != 0,
+                                    "The number of input channels must be a multiple of the number of groups");
 
     if(output->total_size() > 0)
     {
-        TensorInfo expected_output = output->clone()->set_tensor_shape(compute_im2col_conv_shape(input, kernel_dims, conv_info, has_bias, dilation, false));
+        TensorInfo expected_output = output->clone()->set_tensor_shape(get_output_shape(input, kernel_dims, conv_info, has_bias, dilation, num_groups));
         ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(&expected_output, output);
         ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
         ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_QUANTIZATION_INFO(input, output);
@@ -68,7 +85,7 @@ Status validate_arguments(const ITensorInfo *input, const ITensorInfo *output, c
 }
 
 std::pair<Status, Window> validate_and_configure_window(ITensorInfo *input, ITensorInfo *output, const Size2D &kernel_dims, const PadStrideInfo &conv_info,
-                                                        bool has_bias, const Size2D &dilation)
+                                                        bool has_bias, const Size2D &dilation, unsigned int num_groups)
 {
     const unsigned int width_idx   = get_data_layout_dimension_index(input->data_layout(), DataLayoutDimension::WIDTH);
     const unsigned int height_idx  = get_data_layout_dimension_index(input->data_layout(), DataLayoutDimension::HEIGHT);
@@ -79,7 +96,7 @@ std::pair<Status, Window> validate_and_configure_window(ITensorInfo *input, ITen
                                                                              conv_info, dilation);
 
     // Output tensor auto initialization if not yet initialized
-    auto_init_if_empty(*output, input->clone()->set_tensor_shape(compute_im2col_conv_shape(input, kernel_dims, conv_info, has_bias, dilation, false)));
+    auto_init_if_empty(*output, input->clone()->set_tensor_shape(get_output_shape(input, kernel_dims, conv_info, has_bias, dilation, num_groups)));
 
     Window win = calculate_max_window(*input, Steps());
     win.set(width_idx, Window::Dimension(0, convolved_dims.first, 1));
@@ -273,7 +290,7 @@ void NEIm2ColKernel::run_im2col(const Window &window)
 
     const int input_w        = _input->info()->dimension(width_idx);
     const int input_h        = _input->info()->dimension(height_idx);
-    const int input_c        = _input->info()->dimension(channel_idx);
+    const int input_c        = _input->info()->dimension(channel_idx) / _num_groups;
     const int input_stride_x = _input->info()->strides_in_bytes().x();
     const int input_stride_y = _input->info()->strides_in_bytes().y();
     const int input_stride_z = _input->info()->strides_in_bytes().z();
@@ -283,15 +300,27 @@ void NEIm2ColKernel::run_im2col(const Window &window)
     const int stride_y       = _conv_info.stride().second;
     const int pad_value      = is_data_type_quantized(_input->info()->data_type()) ? _input->info()->quantization_info().uniform().offset : 0;
 
+    // Grouped output is [K / num_groups, M, batches, num_groups]: the batch is addressed explicitly and each group fills its own plane
+    const bool   is_grouped       = _num_groups > 1;
+    const size_t out_stride_batch = is_grouped ? _output->info()->strides_in_bytes().z() : 0;
+    const size_t out_stride_group = is_grouped ? _output->info()->strides_in_bytes()[3] : 0;
+    const size_t in_stride_group  = static_cast<size_t>(input_c) * _input->info()->strides_in_bytes()[channel_idx];
+
     Window window_in_out(window);
     // The first three dimensions of the input and output are increased by the inner loops
     window_in_out.set(Window::DimX, Window::Dimension(0, 0, 0));
     window_in_out.set(Window::DimY, Window::Dimension(0, 0, 0));
     window_in_out.set(Window::DimZ, Window::Dimension(0, 0, 0));
 
+    Window window_out(window_in_out);
+    if(is_grouped)
+    {
+        window_out.set(3, Window::Dimension(0, 0, 0));
+    }
+
     // Create iterators
     Iterator in(_input, window_in_out);
-    Iterator out(_output, window_in_out);
+    Iterator out(_output, window_out);
 
     execute_window_loop(window, [&](const Coordinates & id)
     {
@@ -300,52 +329,59 @@ void NEIm2ColKernel::run_im2col(const Window &window)
 
         // Get pointers
         const uint8_t *const input_ptr  = in.ptr();
-        auto                 output_ptr = reinterpret_cast<T *>(out.ptr() + (id[width_idx] + id[height_idx] * _convolved_dims.first) * _output->info()->strides_in_bytes().y());
+        uint8_t *const       output_row = out.ptr() + (id[width_idx] + id[height_idx] * _convolved_dims.first) * _output->info()->strides_in_bytes().y() + id[3] * out_stride_batch;
 
         // Linearize volume
         if(is_nchw)
         {
-            linearize_volume_nchw<T, has_pads>(input_ptr,
-                                               output_ptr,
-                                               _has_bias,
-                                               start_w,
-                                               start_h,
-                                               _kernel_width,
-                                               _kernel_height,
-                                               input_c,
-                                               input_w,
-                                               input_h,
-                                               input_stride_x,
-                                               input_stride_y,
-                                               input_stride_z,
-                                               pad_value,
-                                               _dilation.x(),
-                                               _dilation.y());
+            for(unsigned int g = 0; g < _num_groups; ++g)
+            {
+                linearize_volume_nchw<T, has_pads>(input_ptr + g * in_stride_group,
+                                                   reinterpret_cast<T *>(output_row + g * out_stride_group),
+                                                   _has_bias,
+                                                   start_w,
+                                                   start_h,
+                                                   _kernel_width,
+                                                   _kernel_height,
+                                                   input_c,
+                                                   input_w,
+                                                   input_h,
+                                                   input_stride_x,
+                                                   input_stride_y,
+                                                   input_stride_z,
+                                                   pad_value,
+                                                   _dilation.x(),
+                                                   _dilation.y());
+            }
         }
         else
         {
-            linearize_volume_nhwc<T, has_pads>(input_ptr,
-                                               output_ptr,
-                                               _has_bias,
-                                               start_w,
-                                               start_h,
-                                               _kernel_width,
-                                               _kernel_height,
-                                               input_w,
-                                               input_h,
-                                               input_c,
-                                               input_stride_y,
-                                               input_stride_z,
-                                               pad_value,
-                                               _dilation.x(),
-                                               _dilation.y());
+            for(unsigned int g = 0; g < _num_groups; ++g)
+            {
+                linearize_volume_nhwc<T, has_pads>(input_ptr + g * in_stride_group,
+                                                   reinterpret_cast<T *>(output_row + g * out_stride_group),
+                                                   _has_bias,
+                                                   start_w,
+                                                   start_h,
+                                                   _kernel_width,
+                                                   _kernel_height,
+                                                   input_w,
+                                                   input_h,
+                                                   input_c,
+                                                   input_stride_y,
+                                                   input_stride_z,
+                                                   pad_value,
+                                                   _dilation.x(),
+                                                   _dilation.y());
+            }
         }
     },
     in, out);
 }
 
 NEIm2ColKernel::NEIm2ColKernel()
-    : _func(), _input(nullptr), _output(nullptr), _convolved_dims(), _conv_info(), _kernel_width(0), _kernel_height(0), _has_bias(false), _dilation(1U, 1U), _data_layout(DataLayout::UNKNOWN)
+    : _func(), _input(nullptr), _output(nullptr), _convolved_dims(), _conv_info(), _kernel_width(0), _kernel_height(0), _has_bias(false), _dilation(1U, 1U), _data_layout(DataLayout::UNKNOWN),
+      _num_groups(1)
 {
 }
 
@@ -354,7 +390,6 @@ void NEIm2ColKernel::configure(const ITensor *input, ITensor *output, const Size
 {
     ARM_COMPUTE_ERROR_ON_NULLPTR(input, output);
     ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(input->info(), output->info(), kernel_dims, conv_info, has_bias, dilation, num_groups));
-    ARM_COMPUTE_UNUSED(num_groups);
 
     _data_layout                  = input->info()->data_layout();
     const unsigned int width_idx  = get_data_layout_dimension_index(_data_layout, DataLayoutDimension::WIDTH);
@@ -369,7 +404,8 @@ void NEIm2ColKernel::configure(const ITensor *input, ITensor *output, const Size
     _convolved_dims = scaled_dimensions(input->info()->dimension(width_idx), input->info()->dimension(height_idx),
                                         _kernel_width, _kernel_height,
                                         _conv_info, _dilation);
-    _has_bias = has_bias;
+    _has_bias   = has_bias;
+    _num_groups = num_groups;
 
     if(_data_layout == DataLayout::NCHW)
     {
@@ -427,7 +463,7 @@ void NEIm2ColKernel::configure(const ITensor *input, ITensor *output, const Size
     }
 
     // Configure kernel window
-    auto win_config = validate_and_configure_window(input->info(), output->info(), kernel_dims, conv_info, has_bias, dilation);
+    auto win_config = validate_and_configure_window(input->info(), output->info(), kernel_dims, conv_info, has_bias, dilation, num_groups);
     ARM_COMPUTE_ERROR_THROW_ON(win_config.first);
     INEKernel::configure(win_config.second);
 }
@@ -436,7 +472,7 @@ Status NEIm2ColKernel::validate(const ITensorInfo *input, const ITensorInfo *out
                                 bool has_bias, const Size2D &dilation, unsigned int num_groups)
 {
     ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(input, output, kernel_dims, conv_info, has_bias, dilation, num_groups));
-    ARM_COMPUTE_RETURN_ON_ERROR(validate_and_configure_window(input->clone().get(), output->clone().get(), kernel_dims, conv_info, has_bias, dilation).first);
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_and_configure_window(input->clone().get(), output->clone().get(), kernel_dims, conv_info, has_bias, dilation, num_groups).first);
     return Status{};
 }
 
@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/core/NEON/kernels/NEMinMaxRangeKernel.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+#include "src/core/helpers/WindowHelpers.h"
+
+#include <algorithm>
+#include <arm_neon.h>
+#include <limits>
+
+namespace arm_compute
+{
+namespace
+{
+Status validate_arguments(const ITensorInfo *input)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON(input->tensor_shape().total_size() == 0);
+
+    return Status{};
+}
+} // namespace
+
+NEMinMaxRangeKernel::NEMinMaxRangeKernel()
+    : _input(nullptr), _min(std::numeric_limits<float>::max()), _max(std::numeric_limits<float>::lowest()), _mtx()
+{
+}
+
+void NEMinMaxRangeKernel::configure(const ITensor *input)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input);
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(input->info()));
+
+    _input = input;
+
+    // Configure kernel window
+    Window win = calculate_max_window(*input->info(), Steps());
+    INEKernel::configure(win);
+}
+
+Status NEMinMaxRangeKernel::validate(const ITensorInfo *input)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(input));
+    return Status{};
+}
+
+void NEMinMaxRangeKernel::reset()
+{
+    _min = std::numeric_limits<float>::max();
+    _max = std::numeric_limits<float>::lowest();
+}
+
+float NEMinMaxRangeKernel::min() const
+{
+    return _min;
+}
+
+float NEMinMaxRangeKernel::max() const
+{
+    return _max;
+}
+
+void NEMinMaxRangeKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+
+    const int  window_step_x  = 8;
+    const auto window_start_x = static_cast<int>(window.x().start());
+    const auto window_end_x   = static_cast<int>(window.x().end());
+
+    Window win(window);
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    Iterator input(_input, win);
+
+    float32x4_t carry_min = vdupq_n_f32(std::numeric_limits<float>::max());
+    float32x4_t carry_max = vdupq_n_f32(std::numeric_limits<float>::lowest());
+
+    float carry_min_scalar = std::numeric_limits<float>::max();
+    float carry_max_scalar = std::numeric_limits<float>::lowest();
+
+    execute_window_loop(win, [&](const Coordinates &)
+    {
+        const auto in_ptr = reinterpret_cast<const float *>(input.ptr());
+
+        // Compute 8 elements per iteration
+        int x = window_start_x;
+        for(; x <= (window_end_x - window_step_x); x += window_step_x)
+        {
+            const float32x4_t pixels0 = vld1q_f32(in_ptr + x);
+            const float32x4_t pixels1 = vld1q_f32(in_ptr + x + 4);
+            carry_min                 = vminq_f32(carry_min, vminq_f32(pixels0, pixels1));
+            carry_max                 = vmaxq_f32(carry_max, vmaxq_f32(pixels0, pixels1));
+        }
+
+        // Compute left-over elements
+        for(; x < window_end_x; ++x)
+        {
+            const float pixel = in_ptr[x];
+            carry_min_scalar  = std::min(pixel, carry_min_scalar);
+            carry_max_scalar  = std::max(pixel, carry_max_scalar);
+        }
+    },
+    input);
+
+    // Reduce result
+    float32x2_t min_f32x2 = vpmin_f32(vget_high_f32(carry_min), vget_low_f32(carry_min));
+    float32x2_t max_f32x2 = vpmax_f32(vget_high_f32(carry_max), vget_low_f32(carry_max));
+    min_f32x2             = vpmin_f32(min_f32x2, min_f32x2);
+    max_f32x2             = vpmax_f32(max_f32x2, max_f32x2);
+
+    update_min_max(std::min(vget_lane_f32(min_f32x2, 0), carry_min_scalar), std::max(vget_lane_f32(max_f32x2, 0), carry_max_scalar));
+}
+
+void NEMinMaxRangeKernel::update_min_max(float min, float max)
+{
+    arm_compute::lock_guard<Mutex> lock(_mtx);
+
+    _min = std::min(_min, min);
+    _max = std::max(_max, max);
+}
+} // namespace arm_compute
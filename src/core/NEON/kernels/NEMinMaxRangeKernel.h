@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_NEMINMAXRANGEKERNEL_H
+#define ARM_COMPUTE_NEMINMAXRANGEKERNEL_H
+
+#include "src/core/NEON/INEKernel.h"
+#include "support/Mutex.h"
+
+namespace arm_compute
+{
+class ITensor;
+
+/** Interface for the kernel to compute the global minimum and maximum values of a tensor.
+ *
+ * The result is accumulated across all the threads the kernel is scheduled on and can be read back with @ref min() and @ref max().
+ * @ref reset() must be called before each execution.
+ */
+class NEMinMaxRangeKernel : public INEKernel
+{
+public:
+    const char *name() const override
+    {
+        return "NEMinMaxRangeKernel";
+    }
+    /** Default constructor */
+    NEMinMaxRangeKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEMinMaxRangeKernel(const NEMinMaxRangeKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEMinMaxRangeKernel &operator=(const NEMinMaxRangeKernel &) = delete;
+    /** Prevent instances of this class from being moved (As this class contains non movable objects) */
+    NEMinMaxRangeKernel(NEMinMaxRangeKernel &&) = delete;
+    /** Prevent instances of this class from being moved (As this class contains non movable objects) */
+    NEMinMaxRangeKernel &operator=(NEMinMaxRangeKernel &&) = delete;
+    /** Default destructor */
+    ~NEMinMaxRangeKernel() = default;
+    /** Initialise the kernel's input.
+     *
+     * @param[in] input Input tensor. Data type supported: F32.
+     */
+    void configure(const ITensor *input);
+    /** Static function to check if given info will lead to a valid configuration of @ref NEMinMaxRangeKernel
+     *
+     * @param[in] input Input tensor info. Data type supported: F32.
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *input);
+    /** Resets the accumulated minimum and maximum values. */
+    void reset();
+    /** Minimum value found during the last execution */
+    float min() const;
+    /** Maximum value found during the last execution */
+    float max() const;
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+
+private:
+    void update_min_max(float min, float max);
+
+    const ITensor     *_input;
+    float              _min;
+    float              _max;
+    arm_compute::Mutex _mtx;
+};
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_NEMINMAXRANGEKERNEL_H */
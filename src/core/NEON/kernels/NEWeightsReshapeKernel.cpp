@@ -32,23 +32,37 @@ namespace arm_compute
 {
 namespace
 {
-TensorShape get_output_shape(const ITensorInfo *input, bool has_bias)
+TensorShape get_output_shape(const ITensorInfo *input, bool has_bias, unsigned int num_groups)
 {
     TensorShape output_shape{ input->tensor_shape() };
 
+    if(num_groups > 1)
+    {
+        // Each group becomes a [OFM / num_groups, K] plane: [OFM / num_groups, K, num_groups]
+        output_shape.set(3, output_shape[3] / num_groups);
+    }
+
     output_shape.collapse(3);
     const size_t tmp_dim = output_shape[0];
     output_shape.set(0, output_shape[1]);
     output_shape.set(1, tmp_dim + (has_bias ? 1 : 0));
 
+    if(num_groups > 1)
+    {
+        output_shape.set(2, num_groups);
+    }
+
     return output_shape;
 }
 
-Status validate_arguments(const ITensorInfo *input, const ITensorInfo *biases, const ITensorInfo *output)
+Status validate_arguments(const ITensorInfo *input, const ITensorInfo *biases, const ITensorInfo *output, unsigned int num_groups)
 {
     ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, output);
     //Note: ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(input) is not needed here as this kernel doesn't use NEON FP16 instructions.
     ARM_COMPUTE_RETURN_ERROR_ON(input->data_type() == DataType::UNKNOWN);
+    ARM_COMPUTE_RETURN_ERROR_ON(num_groups == 0);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG((num_groups > 1) && (input->num_dimensions() > 4), "Grouped reshape is only supported for shared weights");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG((input->dimension(3) % num_groups) != 0, "The number of kernels must be a multiple of the number of groups");
 
     if(biases != nullptr)
     {
@@ -63,7 +77,7 @@ Status validate_arguments(const ITensorInfo *input, const ITensorInfo *biases, c
     // Checks performed when output is configured
     if(output->total_size() != 0)
     {
-        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(output->tensor_shape(), get_output_shape(input, biases != nullptr));
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(output->tensor_shape(), get_output_shape(input, biases != nullptr, num_groups));
         ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
         ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_QUANTIZATION_INFO(input, output);
     }
@@ -86,25 +100,27 @@ std::pair<Status, Window> validate_and_configure_window(ITensorInfo *input, ITen
 } // namespace
 
 NEWeightsReshapeKernel::NEWeightsReshapeKernel()
-    : _input(nullptr), _bias(nullptr), _output(nullptr)
+    : _input(nullptr), _bias(nullptr), _output(nullptr), _num_groups(1)
 {
 }
 
-void NEWeightsReshapeKernel::configure(const ITensor *input, const ITensor *bias, ITensor *output)
+void NEWeightsReshapeKernel::configure(const ITensor *input, const ITensor *bias, ITensor *output, unsigned int num_groups)
 {
     ARM_COMPUTE_ERROR_ON_NULLPTR(input, output);
 
     // Output tensor auto inizialitation if not yet initialized
-    auto_init_if_empty(*output->info(), input->info()->clone()->set_tensor_shape(get_output_shape(input->info(), (bias != nullptr))));
+    auto_init_if_empty(*output->info(), input->info()->clone()->set_tensor_shape(get_output_shape(input->info(), (bias != nullptr), num_groups)));
 
     // Perform validation step
     ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(input->info(),
                                                   (bias != nullptr) ? bias->info() : nullptr,
-                                                  output->info()));
+                                                  output->info(),
+                                                  num_groups));
 
-    _input  = input;
-    _bias   = bias;
-    _output = output;
+    _input      = input;
+    _bias       = bias;
+    _output     = output;
+    _num_groups = num_groups;
 
     // Configure kernel
     auto win_config = validate_and_configure_window(input->info(), output->info());
@@ -112,9 +128,9 @@ void NEWeightsReshapeKernel::configure(const ITensor *input, const ITensor *bias
     INEKernel::configure(win_config.second);
 }
 
-Status NEWeightsReshapeKernel::validate(const ITensorInfo *input, const ITensorInfo *biases, const ITensorInfo *output)
+Status NEWeightsReshapeKernel::validate(const ITensorInfo *input, const ITensorInfo *biases, const ITensorInfo *output, unsigned int num_groups)
 {
-    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(input, biases, output));
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(input, biases, output, num_groups));
     ARM_COMPUTE_RETURN_ON_ERROR(validate_and_configure_window(input->clone().get(), output->clone().get()).first);
 
     return Status{};
@@ -133,14 +149,15 @@ void NEWeightsReshapeKernel::run(const Window &window, const ThreadInfo &info)
     const unsigned int input_stride_y  = _input->info()->strides_in_bytes().y();
     const unsigned int input_stride_z  = _input->info()->strides_in_bytes().z();
     const unsigned int output_stride_y = _output->info()->strides_in_bytes().y();
+    const unsigned int kernels_per_grp = _input->info()->dimension(3) / _num_groups;
 
     // Create iterators
     Iterator in(_input, window);
     execute_window_loop(window, [&](const Coordinates & id)
     {
-        // Get column index
-        const int kernel_idx = id[3];
-        const int kernel_idz = id[4];
+        // Get column index. For grouped convolutions the group selects the output plane
+        const int kernel_idx = id[3] % kernels_per_grp;
+        const int kernel_idz = (_num_groups > 1) ? id[3] / kernels_per_grp : id[4];
 
         // Setup pointers
         const uint8_t *tmp_input_ptr        = in.ptr();
@@ -170,7 +187,8 @@ void NEWeightsReshapeKernel::run(const Window &window, const ThreadInfo &info)
         // Add bias
         if(_bias != nullptr)
         {
-            std::memcpy(tmp_output_ptr, _bias->ptr_to_element(Coordinates(kernel_idx, kernel_idz)), _input->info()->element_size());
+            const Coordinates bias_coord = (_num_groups > 1) ? Coordinates(id[3]) : Coordinates(kernel_idx, kernel_idz);
+            std::memcpy(tmp_output_ptr, _bias->ptr_to_element(bias_coord), _input->info()->element_size());
         }
     },
     in);
@@ -39,6 +39,8 @@
 
 #include "src/core/NEON/kernels/convolution/winograd/winograd_layer.hpp"
 
+#include <arm_neon.h>
+
 namespace arm_compute
 {
 //Batched Gemms
@@ -49,9 +51,13 @@ inline bool is_kernel_size_supported(DataType data_type, Size2D size)
 {
     const std::array<Size2D, 8> f32_support = { { Size2D(1, 3), Size2D(3, 1), Size2D(5, 5), Size2D(3, 3), Size2D(1, 5), Size2D(5, 1), Size2D(7, 1), Size2D(1, 7) } };
     const std::array<Size2D, 8> f16_support = { { Size2D(3, 3) } };
+    const std::array<Size2D, 1> int_support = { { Size2D(3, 3) } };
 
     switch(data_type)
     {
+        case DataType::S16:
+        case DataType::S32:
+            return std::end(int_support) != std::find(std::begin(int_support), std::end(int_support), size);
         case DataType::F16:
             return std::end(f16_support) != std::find(std::begin(f16_support), std::end(f16_support), size);
         case DataType::F32:
@@ -65,7 +71,7 @@ Status validate_arguments_winograd_weight_trans(const ITensorInfo *input, const
 {
     ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input);
     ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(output);
-    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F16, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::S16, DataType::F16, DataType::F32);
 
     const size_t idx_width    = get_data_layout_dimension_index(input->data_layout(), DataLayoutDimension::WIDTH);
     const size_t idx_height   = get_data_layout_dimension_index(input->data_layout(), DataLayoutDimension::HEIGHT);
@@ -75,6 +81,7 @@ Status validate_arguments_winograd_weight_trans(const ITensorInfo *input, const
                                     "Only 1x3, 3x1, 1x5, 5x1, 7x1, 1x7, 3x3 and 5x5 kernels are supported");
     ARM_COMPUTE_RETURN_ERROR_ON(input->num_dimensions() > 4);
     const Size2D &output_tile = winograd_info.output_tile_size;
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(input->data_type() == DataType::S16 && output_tile != Size2D(2U, 2U), "Only F(2x2, 3x3) is supported for integer weights");
     const std::array<Size2D, 8> supported_tile_sizes = { { Size2D(2U, 2U), Size2D(4U, 4U), Size2D(1U, 6U), Size2D(6U, 1U), Size2D(4, 1), Size2D(1, 4), Size2D(2, 1), Size2D(1, 2) } };
     ARM_COMPUTE_RETURN_ERROR_ON(std::end(supported_tile_sizes) == std::find(std::begin(supported_tile_sizes), std::end(supported_tile_sizes), output_tile));
 
@@ -104,8 +111,9 @@ Status validate_arguments_winograd_input_trans(const ITensorInfo *input, const I
     const PadStrideInfo &conv_info   = winograd_info.convolution_info;
     ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input);
     ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(output);
-    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F16, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::S16, DataType::F16, DataType::F32);
     ARM_COMPUTE_RETURN_ERROR_ON_MSG(conv_info.stride().first != 1 || conv_info.stride().second != 1, "Winograd input transform only supports unit strides");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(input->data_type() == DataType::S16 && winograd_info.output_tile_size != Size2D(2U, 2U), "Only F(2x2, 3x3) is supported for integer inputs");
     ARM_COMPUTE_RETURN_ERROR_ON_MSG(!is_kernel_size_supported(input->data_type(), Size2D(kernel_dims.width, kernel_dims.height)),
                                     "Only 1x3, 3x1, 3x3 and 5x5 kernels are supported");
 
@@ -143,8 +151,9 @@ Status validate_arguments_winograd_output_trans(const ITensorInfo *input, const
 
     ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input);
     ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(output);
-    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F16, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::S32, DataType::F16, DataType::F32);
     ARM_COMPUTE_RETURN_ERROR_ON(input->dimension(1) != num_tiles.area());
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(input->data_type() == DataType::S32 && winograd_info.output_tile_size != Size2D(2U, 2U), "Only F(2x2, 3x3) is supported for integer outputs");
     ARM_COMPUTE_RETURN_ERROR_ON_MSG(!is_kernel_size_supported(input->data_type(), Size2D(kernel_dims.width, kernel_dims.height)),
                                     "Only 1x3, 3x1, 3x3 and 5x5 kernels are supported");
 
@@ -275,6 +284,8 @@ template class NEWinogradLayerTransformWeightsKernel<float, 4, 1, 5, 1>;
 template class NEWinogradLayerTransformWeightsKernel<float, 1, 2, 1, 7>;
 template class NEWinogradLayerTransformWeightsKernel<float, 2, 1, 7, 1>;
 
+template class NEWinogradLayerTransformWeightsKernel<int16_t, 2, 2, 3, 3>;
+
 #ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
 template class NEWinogradLayerTransformWeightsKernel<__fp16, 4, 4, 3, 3>;
 #endif // __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
@@ -317,7 +328,7 @@ int NEWinogradLayerTransformInputKernel<T, OutputTileRows, OutputTileCols, Kerne
 template <typename T, int OutputTileRows, int OutputTileCols, int KernelRows, int KernelCols>
 NEWinogradLayerTransformInputKernel<T, OutputTileRows, OutputTileCols, KernelRows, KernelCols>::NEWinogradLayerTransformInputKernel()
     : _transform(nullptr), _input_nhwc(nullptr), _num_batches(0), _num_rows(0), _num_cols(0), _num_channels(0), _padding(), _output(nullptr), _matrix_stride(0), _padding_top(), _padding_left(),
-      _padding_right(), _padding_bottom(), _workspace(nullptr)
+      _padding_right(), _padding_bottom(), _workspace(nullptr), _block_transforms(), _block_row_starts(), _block(0)
 {
 }
 
@@ -367,6 +378,38 @@ void NEWinogradLayerTransformInputKernel<T, OutputTileRows, OutputTileCols, Kern
     INEKernel::configure(win);
 }
 
+template <typename T, int OutputTileRows, int OutputTileCols, int KernelRows, int KernelCols>
+void NEWinogradLayerTransformInputKernel<T, OutputTileRows, OutputTileCols, KernelRows, KernelCols>::configure_tile_row_blocks(unsigned int tile_rows_per_block)
+{
+    ARM_COMPUTE_ERROR_ON(tile_rows_per_block == 0);
+    _block_transforms.clear();
+    _block_row_starts.clear();
+    _block = 0;
+
+    const int num_output_rows = (_padding == PADDING_SAME) ? _num_rows : _num_rows - KernelRows + 1;
+    const int num_tile_rows   = iceildiv(num_output_rows, OutputTileRows);
+    for(int first_tile_row = 0; first_tile_row < num_tile_rows; first_tile_row += static_cast<int>(tile_rows_per_block))
+    {
+        // Input rows covered by the block of tiles: the rows outside of the input tensor are treated as padding
+        const int block_tile_rows = std::min(static_cast<int>(tile_rows_per_block), num_tile_rows - first_tile_row);
+        const int block_start     = first_tile_row * OutputTileRows - _padding_top;
+        const int block_end       = block_start + block_tile_rows * OutputTileRows + KernelRows - 1;
+        const int row_start       = std::max(0, block_start);
+        const int row_end         = std::min(_num_rows, block_end);
+
+        _block_transforms.emplace_back(arm_compute::support::cpp14::make_unique<InputTransform>(KernelRows, KernelCols, _num_batches, row_end - row_start, _num_cols, _num_channels,
+                                                                                                  row_start - block_start, _padding_left, block_end - row_end, _padding_right));
+        _block_row_starts.push_back(row_start);
+    }
+}
+
+template <typename T, int OutputTileRows, int OutputTileCols, int KernelRows, int KernelCols>
+void NEWinogradLayerTransformInputKernel<T, OutputTileRows, OutputTileCols, KernelRows, KernelCols>::set_tile_row_block(unsigned int block)
+{
+    ARM_COMPUTE_ERROR_ON(block >= _block_transforms.size());
+    _block = block;
+}
+
 template <typename T, int OutputTileRows, int OutputTileCols, int KernelRows, int KernelCols>
 void NEWinogradLayerTransformInputKernel<T, OutputTileRows, OutputTileCols, KernelRows, KernelCols>::run(const Window &window, const ThreadInfo &info)
 {
@@ -382,15 +425,23 @@ void NEWinogradLayerTransformInputKernel<T, OutputTileRows, OutputTileCols, Kern
     auto       output_ptr            = reinterpret_cast<T *>(_output->buffer() + _output->info()->offset_first_element_in_bytes());
     ARM_COMPUTE_ERROR_ON_NULLPTR(output_ptr);
 
-    _transform->set_input_tensor(input_nhwc_ptr, input_batch_stride, input_row_stride, input_col_stride);
-    _transform->set_output_matrices(output_ptr, _matrix_stride, _num_channels);
+    InputTransform *transform  = _transform.get();
+    int             row_offset = 0;
+    if(!_block_transforms.empty())
+    {
+        transform  = _block_transforms[_block].get();
+        row_offset = _block_row_starts[_block] * input_row_stride;
+    }
+
+    transform->set_input_tensor(input_nhwc_ptr + row_offset, input_batch_stride, input_row_stride, input_col_stride);
+    transform->set_output_matrices(output_ptr, _matrix_stride, _num_channels);
 
-    _transform->set_working_space(_workspace->buffer());
+    transform->set_working_space(_workspace->buffer());
 
     // The code below cannot be moved to configure because biases hasn't been allocated at that point
     const size_t fst = window.x().start();
     const size_t lst = window.x().end();
-    _transform->run(fst, lst, info.thread_id);
+    transform->run(fst, lst, info.thread_id);
 }
 
 template <typename T, int OutputTileRows, int OutputTileCols, int KernelRows, int KernelCols>
@@ -413,6 +464,8 @@ template class NEWinogradLayerTransformInputKernel<float, 4, 1, 5, 1>;
 template class NEWinogradLayerTransformInputKernel<float, 1, 2, 1, 7>;
 template class NEWinogradLayerTransformInputKernel<float, 2, 1, 7, 1>;
 
+template class NEWinogradLayerTransformInputKernel<int16_t, 2, 2, 3, 3>;
+
 #ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
 template class NEWinogradLayerTransformInputKernel<__fp16, 4, 4, 3, 3>;
 #endif // __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
@@ -438,7 +491,7 @@ unsigned int NEWinogradLayerTransformOutputKernel<T, OutputTileRows, OutputTileC
 template <typename T, int OutputTileRows, int OutputTileCols, int KernelRows, int KernelCols>
 NEWinogradLayerTransformOutputKernel<T, OutputTileRows, OutputTileCols, KernelRows, KernelCols>::NEWinogradLayerTransformOutputKernel()
     : _transform(nullptr), _biases(nullptr), _transformed_output(nullptr), _workspace(nullptr), _matrix_stride(0), _matrix_row_stride(0), _output_nhwc(nullptr), _num_batches(0), _num_rows(0),
-      _num_cols(0), _num_channels(0)
+      _num_cols(0), _num_channels(0), _activation(), _block_transforms(), _block_row_starts(), _block(0)
 {
 }
 
@@ -491,6 +544,7 @@ void NEWinogradLayerTransformOutputKernel<T, OutputTileRows, OutputTileCols, Ker
     _num_rows           = num_rows;
     _num_cols           = num_cols;
     _num_channels       = num_channels;
+    _activation         = activation;
     // We don't have the biases buffer at this stage as it hasn't been allocated, we pass in nullptr OutputTransform is only used here to compute the window
     _transform = arm_compute::support::cpp14::make_unique<OutputTransform>(num_batches, num_rows, num_cols, num_channels, activation);
     Window win;
@@ -501,6 +555,33 @@ void NEWinogradLayerTransformOutputKernel<T, OutputTileRows, OutputTileCols, Ker
     INEKernel::configure(win);
 }
 
+template <typename T, int OutputTileRows, int OutputTileCols, int KernelRows, int KernelCols>
+void NEWinogradLayerTransformOutputKernel<T, OutputTileRows, OutputTileCols, KernelRows, KernelCols>::configure_tile_row_blocks(unsigned int tile_rows_per_block)
+{
+    ARM_COMPUTE_ERROR_ON(tile_rows_per_block == 0);
+    _block_transforms.clear();
+    _block_row_starts.clear();
+    _block = 0;
+
+    const int num_tile_rows = iceildiv(_num_rows, OutputTileRows);
+    for(int first_tile_row = 0; first_tile_row < num_tile_rows; first_tile_row += static_cast<int>(tile_rows_per_block))
+    {
+        // Output rows produced by the block of tiles
+        const int row_start = first_tile_row * OutputTileRows;
+        const int num_rows  = std::min(static_cast<int>(tile_rows_per_block) * OutputTileRows, _num_rows - row_start);
+
+        _block_transforms.emplace_back(arm_compute::support::cpp14::make_unique<OutputTransform>(_num_batches, num_rows, _num_cols, _num_channels, _activation));
+        _block_row_starts.push_back(row_start);
+    }
+}
+
+template <typename T, int OutputTileRows, int OutputTileCols, int KernelRows, int KernelCols>
+void NEWinogradLayerTransformOutputKernel<T, OutputTileRows, OutputTileCols, KernelRows, KernelCols>::set_tile_row_block(unsigned int block)
+{
+    ARM_COMPUTE_ERROR_ON(block >= _block_transforms.size());
+    _block = block;
+}
+
 template <typename T, int OutputTileRows, int OutputTileCols, int KernelRows, int KernelCols>
 void NEWinogradLayerTransformOutputKernel<T, OutputTileRows, OutputTileCols, KernelRows, KernelCols>::run(const Window &window, const ThreadInfo &info)
 {
@@ -514,14 +595,22 @@ void NEWinogradLayerTransformOutputKernel<T, OutputTileRows, OutputTileCols, Ker
     const int out_row_stride   = _output_nhwc->info()->strides_in_bytes()[2] / sizeof(T);
     const int out_col_stride   = _output_nhwc->info()->strides_in_bytes()[1] / sizeof(T);
 
-    _transform->set_input_matrices(_transformed_output->buffer(), _matrix_stride, _matrix_row_stride);
-    _transform->set_bias((_biases ? reinterpret_cast<T *>(_biases->buffer() + _biases->info()->offset_first_element_in_bytes()) : nullptr));
-    _transform->set_output_tensor(_output_nhwc->buffer() + _output_nhwc->info()->offset_first_element_in_bytes(), out_batch_stride, out_row_stride, out_col_stride);
-    _transform->set_working_space(_workspace->buffer());
+    OutputTransform *transform  = _transform.get();
+    int              row_offset = 0;
+    if(!_block_transforms.empty())
+    {
+        transform  = _block_transforms[_block].get();
+        row_offset = _block_row_starts[_block] * out_row_stride;
+    }
+
+    transform->set_input_matrices(_transformed_output->buffer(), _matrix_stride, _matrix_row_stride);
+    transform->set_bias((_biases ? reinterpret_cast<T *>(_biases->buffer() + _biases->info()->offset_first_element_in_bytes()) : nullptr));
+    transform->set_output_tensor(reinterpret_cast<T *>(_output_nhwc->buffer() + _output_nhwc->info()->offset_first_element_in_bytes()) + row_offset, out_batch_stride, out_row_stride, out_col_stride);
+    transform->set_working_space(_workspace->buffer());
     // The code below cannot be moved to configure because biases hasn't been allocated at that point
     const size_t fst = window.x().start();
     const size_t lst = window.x().end();
-    _transform->run(fst, lst, info.thread_id);
+    transform->run(fst, lst, info.thread_id);
 }
 
 template <typename T, int OutputTileRows, int OutputTileCols, int KernelRows, int KernelCols>
@@ -545,7 +634,121 @@ template class NEWinogradLayerTransformOutputKernel<float, 4, 1, 5, 1>;
 template class NEWinogradLayerTransformOutputKernel<float, 1, 2, 1, 7>;
 template class NEWinogradLayerTransformOutputKernel<float, 2, 1, 7, 1>;
 
+template class NEWinogradLayerTransformOutputKernel<int32_t, 2, 2, 3, 3>;
+
 #ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
 template class NEWinogradLayerTransformOutputKernel<__fp16, 4, 4, 3, 3>;
 #endif // __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+
+// Offset removal for the quantized transforms
+
+namespace
+{
+Status validate_arguments_winograd_remove_offset(const ITensorInfo *input, const ITensorInfo *output)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, output);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::QASYMM8, DataType::QASYMM8_SIGNED, DataType::QSYMM8_PER_CHANNEL);
+
+    // Validate output if initialized
+    if(output->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::S16);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(input, output);
+    }
+    return Status{};
+}
+
+template <typename T>
+void run_winograd_remove_offset(const ITensor *input, ITensor *output, int32_t offset, const Window &window)
+{
+    Window win_collapsed = window.collapse_if_possible(window, Window::DimZ);
+    win_collapsed.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    Iterator in(input, win_collapsed);
+    Iterator out(output, win_collapsed);
+
+    const int  window_step_x  = 16;
+    const auto window_start_x = static_cast<int>(window.x().start());
+    const auto window_end_x   = static_cast<int>(window.x().end());
+
+    const int16x8_t voffset = vdupq_n_s16(static_cast<int16_t>(offset));
+
+    execute_window_loop(win_collapsed, [&](const Coordinates &)
+    {
+        const auto input_ptr  = reinterpret_cast<const T *>(in.ptr());
+        const auto output_ptr = reinterpret_cast<int16_t *>(out.ptr());
+
+        int x = window_start_x;
+        for(; x <= (window_end_x - window_step_x); x += window_step_x)
+        {
+            int16x8_t lo{};
+            int16x8_t hi{};
+            if(std::is_same<T, uint8_t>::value)
+            {
+                const uint8x16_t vin = vld1q_u8(reinterpret_cast<const uint8_t *>(input_ptr + x));
+                lo                   = vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(vin)));
+                hi                   = vreinterpretq_s16_u16(vmovl_u8(vget_high_u8(vin)));
+            }
+            else
+            {
+                const int8x16_t vin = vld1q_s8(reinterpret_cast<const int8_t *>(input_ptr + x));
+                lo                  = vmovl_s8(vget_low_s8(vin));
+                hi                  = vmovl_s8(vget_high_s8(vin));
+            }
+            vst1q_s16(output_ptr + x, vsubq_s16(lo, voffset));
+            vst1q_s16(output_ptr + x + 8, vsubq_s16(hi, voffset));
+        }
+
+        // Compute left-over elements
+        for(; x < window_end_x; ++x)
+        {
+            *(output_ptr + x) = static_cast<int16_t>(static_cast<int32_t>(*(input_ptr + x)) - offset);
+        }
+    },
+    in, out);
+}
+} // namespace
+
+NEWinogradLayerRemoveOffsetKernel::NEWinogradLayerRemoveOffsetKernel()
+    : _input(nullptr), _output(nullptr), _offset(0)
+{
+}
+
+void NEWinogradLayerRemoveOffsetKernel::configure(const ITensor *input, ITensor *output, int32_t offset)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, output);
+
+    // Output auto inizialitation if not yet initialized
+    auto_init_if_empty(*output->info(), input->info()->clone()->set_data_type(DataType::S16).set_quantization_info(QuantizationInfo()));
+
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments_winograd_remove_offset(input->info(), output->info()));
+
+    _input  = input;
+    _output = output;
+    _offset = offset;
+
+    INEKernel::configure(calculate_max_window(*output->info()));
+}
+
+Status NEWinogradLayerRemoveOffsetKernel::validate(const ITensorInfo *input, const ITensorInfo *output)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments_winograd_remove_offset(input, output));
+    return Status{};
+}
+
+void NEWinogradLayerRemoveOffsetKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+
+    if(_input->info()->data_type() == DataType::QASYMM8)
+    {
+        run_winograd_remove_offset<uint8_t>(_input, _output, _offset, window);
+    }
+    else
+    {
+        run_winograd_remove_offset<int8_t>(_input, _output, _offset, window);
+    }
+}
 } // namespace arm_compute
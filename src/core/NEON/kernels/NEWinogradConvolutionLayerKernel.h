@@ -30,6 +30,8 @@
 
 #include "src/core/NEON/kernels/convolution/winograd/winograd_layer.hpp"
 
+#include <vector>
+
 namespace arm_compute
 {
 // Forward declarations
@@ -90,6 +92,23 @@ public:
     virtual void configure(const ITensor *input_nhwc, const int num_batches, const int num_rows, const int num_cols, const int num_channels,
                            const PaddingType padding, ITensor *output, const int matrix_stride, ITensor *workspace) = 0;
 
+    /** Split the transform into blocks of rows of tiles.
+     *
+     * The transforms of the blocks are created here so that selecting a block with @ref set_tile_row_block is cheap.
+     * By default the whole tensor is transformed.
+     *
+     * @param[in] tile_rows_per_block Number of rows of tiles in each block, the last block may be smaller.
+     */
+    virtual void configure_tile_row_blocks(unsigned int tile_rows_per_block) = 0;
+
+    /** Restrict the transform to a block of rows of tiles.
+     *
+     * Once called, each run of the kernel only transforms the rows of tiles of the block, which are written at the start of the output matrices.
+     *
+     * @param[in] block Index of the block, must be less than the number of blocks set up by @ref configure_tile_row_blocks.
+     */
+    virtual void set_tile_row_block(unsigned int block) = 0;
+
     /** Destructor */
     virtual ~INEWinogradLayerTransformInputKernel()
     {
@@ -191,6 +210,8 @@ public:
         ITensor          *workspace) override;
 
     // Inherited methods overridden:
+    void configure_tile_row_blocks(unsigned int tile_rows_per_block) override;
+    void set_tile_row_block(unsigned int block) override;
     void run(const Window &window, const ThreadInfo &info) override;
 
     /** Winograd base kernel */
@@ -211,20 +232,23 @@ public:
 private:
     using InputTransform = typename WinogradBase::template InputTransform<T, T>;
 
-    std::unique_ptr<InputTransform> _transform{ nullptr };
-    const ITensor                  *_input_nhwc;
-    int                             _num_batches;    /**< Number of batches in input tensor. */
-    int                             _num_rows;       /**< Number of rows in input tensor. */
-    int                             _num_cols;       /**< Number of columns in input tensor. */
-    int                             _num_channels;   /**< Number of channels in input tensor. */
-    PaddingType                     _padding;        /**< Padding type. */
-    ITensor                        *_output;         /**< Base of output matrices. */
-    int                             _matrix_stride;  /**< Stride between output matrices. */
-    int                             _padding_top;    /**< Padding to apply to the top of the image. */
-    int                             _padding_left;   /**< Padding to apply to the left of the image. */
-    int                             _padding_right;  /**< Padding to apply to the right of the image. */
-    int                             _padding_bottom; /**< Padding to apply to the bottom of the image. */
-    ITensor                        *_workspace;
+    std::unique_ptr<InputTransform>              _transform{ nullptr };
+    const ITensor                               *_input_nhwc;
+    int                                          _num_batches;      /**< Number of batches in input tensor. */
+    int                                          _num_rows;         /**< Number of rows in input tensor. */
+    int                                          _num_cols;         /**< Number of columns in input tensor. */
+    int                                          _num_channels;     /**< Number of channels in input tensor. */
+    PaddingType                                  _padding;          /**< Padding type. */
+    ITensor                                     *_output;           /**< Base of output matrices. */
+    int                                          _matrix_stride;    /**< Stride between output matrices. */
+    int                                          _padding_top;      /**< Padding to apply to the top of the image. */
+    int                                          _padding_left;     /**< Padding to apply to the left of the image. */
+    int                                          _padding_right;    /**< Padding to apply to the right of the image. */
+    int                                          _padding_bottom;   /**< Padding to apply to the bottom of the image. */
+    ITensor                                     *_workspace;
+    std::vector<std::unique_ptr<InputTransform>> _block_transforms; /**< Transforms of the blocks of rows of tiles, empty to transform the whole tensor. */
+    std::vector<int>                             _block_row_starts; /**< First input row read by each block. */
+    unsigned int                                 _block;            /**< Block to transform. */
 };
 
 /** Interface for the NEON kernel to perform Winograd output transform. */
@@ -305,6 +329,23 @@ public:
         ITensor                    *workspace,
         const arm_gemm::Activation &activation) = 0;
 
+    /** Split the transform into blocks of rows of tiles.
+     *
+     * The transforms of the blocks are created here so that selecting a block with @ref set_tile_row_block is cheap.
+     * By default the whole tensor is transformed.
+     *
+     * @param[in] tile_rows_per_block Number of rows of tiles in each block, the last block may be smaller.
+     */
+    virtual void configure_tile_row_blocks(unsigned int tile_rows_per_block) = 0;
+
+    /** Restrict the transform to a block of rows of tiles.
+     *
+     * Once called, each run of the kernel only transforms the rows of tiles of the block, which are read from the start of the input matrices.
+     *
+     * @param[in] block Index of the block, must be less than the number of blocks set up by @ref configure_tile_row_blocks.
+     */
+    virtual void set_tile_row_block(unsigned int block) = 0;
+
     virtual ~INEWinogradLayerTransformOutputKernel()
     {
     }
@@ -406,6 +447,8 @@ public:
         ITensor                    *workspace,
         const arm_gemm::Activation &activation) override;
 
+    void configure_tile_row_blocks(unsigned int tile_rows_per_block) override;
+    void set_tile_row_block(unsigned int block) override;
     void run(const Window &window, const ThreadInfo &info) override;
 
     /** Static function to check if given info will lead to a valid configuration of @ref NEWinogradLayerTransformOutputKernel
@@ -424,17 +467,21 @@ private:
     using WinogradConv    = typename WinogradBase::template Convolution<T, T>;
     using OutputTransform = typename WinogradBase::template OutputTransform<T, T>;
 
-    std::unique_ptr<OutputTransform> _transform{ nullptr };
-    const ITensor                   *_biases;
-    const ITensor                   *_transformed_output;
-    ITensor                         *_workspace;
-    int                              _matrix_stride;
-    int                              _matrix_row_stride;
-    ITensor                         *_output_nhwc;
-    int                              _num_batches;
-    int                              _num_rows;
-    int                              _num_cols;
-    int                              _num_channels;
+    std::unique_ptr<OutputTransform>              _transform{ nullptr };
+    const ITensor                                *_biases;
+    const ITensor                                *_transformed_output;
+    ITensor                                      *_workspace;
+    int                                           _matrix_stride;
+    int                                           _matrix_row_stride;
+    ITensor                                      *_output_nhwc;
+    int                                           _num_batches;
+    int                                           _num_rows;
+    int                                           _num_cols;
+    int                                           _num_channels;
+    arm_gemm::Activation                          _activation;
+    std::vector<std::unique_ptr<OutputTransform>> _block_transforms;
+    std::vector<int>                              _block_row_starts;
+    unsigned int                                  _block;
 };
 
 /** Interface for the NEON kernel to perform Winograd weights transform. */
@@ -577,6 +624,55 @@ private:
     int                               _num_input_channels;
 };
 
+/** NEON kernel to remove the zero-point of an 8-bit quantized tensor and widen it to S16.
+ *
+ * Used by the quantized Winograd convolution so that the integer transforms can work on
+ * offset-free values and pad the input tile with zeros.
+ */
+class NEWinogradLayerRemoveOffsetKernel : public INEKernel
+{
+public:
+    const char *name() const override
+    {
+        return "NEWinogradLayerRemoveOffsetKernel";
+    }
+    /** Default constructor */
+    NEWinogradLayerRemoveOffsetKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEWinogradLayerRemoveOffsetKernel(const NEWinogradLayerRemoveOffsetKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEWinogradLayerRemoveOffsetKernel &operator=(const NEWinogradLayerRemoveOffsetKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NEWinogradLayerRemoveOffsetKernel(NEWinogradLayerRemoveOffsetKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NEWinogradLayerRemoveOffsetKernel &operator=(NEWinogradLayerRemoveOffsetKernel &&) = default;
+    /** Default destructor */
+    ~NEWinogradLayerRemoveOffsetKernel() = default;
+    /** Initialise the kernel's input and output.
+     *
+     * @param[in]  input  Source tensor. Data types supported: QASYMM8/QASYMM8_SIGNED/QSYMM8_PER_CHANNEL.
+     * @param[out] output Destination tensor holding input - offset. Data types supported: S16.
+     * @param[in]  offset Zero-point to subtract from each element of @p input.
+     */
+    void configure(const ITensor *input, ITensor *output, int32_t offset);
+    /** Static function to check if given info will lead to a valid configuration of @ref NEWinogradLayerRemoveOffsetKernel
+     *
+     * @param[in] input  Source tensor info. Data types supported: QASYMM8/QASYMM8_SIGNED/QSYMM8_PER_CHANNEL.
+     * @param[in] output Destination tensor info. Data types supported: S16.
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *input, const ITensorInfo *output);
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+
+private:
+    const ITensor *_input;
+    ITensor       *_output;
+    int32_t        _offset;
+};
+
 /** NEON kernel to perform Winograd. */
 template <typename TIn, typename TOut, int OutputTileRows, int OutputTileCols, int KernelRows, int KernelCols>
 class NEWinogradLayerConfiguration
@@ -33,17 +33,29 @@
 #include "gemm_implementation.hpp"
 #include "gemm_interleaved.hpp"
 #include "gemm_interleaved_pretransposed_2d.hpp"
+#include "gemm_small_m.hpp"
 
 #include "kernels/a32_sgemm_8x6.hpp"
 #include "kernels/a64_hgemm_8x24.hpp"
 #include "kernels/a64_hybrid_fp16_mla_6x32.hpp"
 #include "kernels/a64_sgemm_8x12.hpp"
+#include "kernels/a64_smallM_fp16_mla_8x16.hpp"
 #include "kernels/sve_hybrid_fp16_mla_6x4VL.hpp"
 #include "kernels/sve_interleaved_fp16_mla_8x3VL.hpp"
 
 namespace arm_gemm {
 
 static const GemmImplementation<__fp16, __fp16> gemm_fp16_methods[] = {
+#if defined(__aarch64__) && defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC)
+// Small M (micro-batches): keep all the rows of A in registers and stream B once.
+{
+    GemmMethod::GEMM_HYBRID,
+    "a64_smallM_fp16_mla_8x16",
+    [](const GemmArgs &args) { return args._Msize>=2 && args._Msize<=8 && !args._indirect_input; },
+    nullptr,
+    [](const GemmArgs &args) { return new GemmSmallM<cls_a64_smallM_fp16_mla_8x16, __fp16, __fp16>(args); }
+},
+#endif // __aarch64__ && __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
 #if defined(__ARM_FEATURE_SVE)
 {
     GemmMethod::GEMM_HYBRID,
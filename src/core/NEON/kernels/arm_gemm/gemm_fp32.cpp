@@ -28,16 +28,22 @@
 #include "gemm_implementation.hpp"
 #include "gemm_interleaved.hpp"
 #include "gemm_interleaved_pretransposed_2d.hpp"
+#include "gemm_small_m.hpp"
+#include "gemm_sparse.hpp"
 #include "gemv_batched.hpp"
 #include "gemv_pretransposed.hpp"
 
 #include "kernels/a32_sgemm_8x6.hpp"
+#include "kernels/a64_interleaved_bf16fp32_dot_8x12.hpp"
+#include "kernels/a64_interleaved_bf16fp32_mmla_8x12.hpp"
 #include "kernels/a64_gemv_fp32_mla_32.hpp"
 #include "kernels/a64_hybrid_fp32_mla_6x16.hpp"
 #include "kernels/a64_hybrid_fp32_mla_8x4.hpp"
 #include "kernels/a64_sgemm_8x12.hpp"
+#include "kernels/a64_smallM_fp32_mla_8x8.hpp"
 #include "kernels/a64_smallK_hybrid_fp32_mla_6x4.hpp"
 #include "kernels/a64_smallK_hybrid_fp32_mla_8x4.hpp"
+#include "kernels/a64_sparse_fp32_mla_4x16.hpp"
 
 #include "kernels/sve_gemv_fp32_mla_8VL.hpp"
 #include "kernels/sve_hybrid_fp32_mla_6x4VL.hpp"
@@ -50,6 +56,16 @@ namespace arm_gemm {
 
 static const GemmImplementation<float, float> gemm_fp32_methods[] =
 {
+#ifdef __aarch64__
+// Block-sparse B, only used when the caller flags the weights as sparse.
+{
+    GemmMethod::GEMM_SPARSE,
+    "a64_sparse_fp32_mla_4x16",
+    [](const GemmArgs &args) { return args._sparse_weights && !args._indirect_input; },
+    nullptr,
+    [](const GemmArgs &args) { return new GemmSparse<cls_a64_sparse_fp32_mla_4x16, float, float>(args); }
+},
+#endif // __aarch64__
 // GEMV cases - starting with 'gemv_batched' wrapper to turn batched GEMV into GEMM.
 {
     GemmMethod::GEMV_BATCHED,
@@ -75,6 +91,32 @@ static const GemmImplementation<float, float> gemm_fp32_methods[] =
     nullptr,
     [](const GemmArgs &args) { return new GemvPretransposed<cls_a64_gemv_fp32_mla_32, float, float>(args); }
 },
+// Small M (micro-batches): keep all the rows of A in registers and stream B once.
+{
+    GemmMethod::GEMM_HYBRID,
+    "a64_smallM_fp32_mla_8x8",
+    [](const GemmArgs &args) { return args._Msize>=2 && args._Msize<=8 && !args._indirect_input; },
+    nullptr,
+    [](const GemmArgs &args) { return new GemmSmallM<cls_a64_smallM_fp32_mla_8x8, float, float>(args); }
+},
+
+#ifdef V8P6_BF
+// Fast mode: operands are rounded to bfloat16 while being interleaved and accumulated in FP32.
+{
+    GemmMethod::GEMM_INTERLEAVED,
+    "a64_interleaved_bf16fp32_mmla_8x12",
+    [](const GemmArgs &args) { return args._fast_mode && (args._Ksize>4); },
+    nullptr,
+    [](const GemmArgs &args) { return new GemmInterleaved<cls_a64_interleaved_bf16fp32_mmla_8x12, float, float>(args); }
+},
+{
+    GemmMethod::GEMM_INTERLEAVED,
+    "a64_interleaved_bf16fp32_dot_8x12",
+    [](const GemmArgs &args) { return args._fast_mode && (args._Ksize>2); },
+    nullptr,
+    [](const GemmArgs &args) { return new GemmInterleaved<cls_a64_interleaved_bf16fp32_dot_8x12, float, float>(args); }
+},
+#endif // V8P6_BF
 
 // MMLA next due to higher throughput (SVE only)
 #if defined(__ARM_FEATURE_SVE) && defined(MMLA_FP32)
@@ -29,14 +29,18 @@
 #include "gemm_hybrid_indirect.hpp"
 #include "gemm_implementation.hpp"
 #include "gemm_interleaved.hpp"
+#include "gemm_small_m.hpp"
+#include "gemm_sparse.hpp"
 
 #include "kernels/a64_gemm_s16_8x12.hpp"
 #include "kernels/a64_gemm_s8_8x12.hpp"
 #include "kernels/a64_gemm_s8_4x4.hpp"
 #include "kernels/a64_hybrid_s8s32_dot_6x16.hpp"
 #include "kernels/a64_interleaved_s8s32_mmla_8x12.hpp"
+#include "kernels/a64_smallM_s8s32_mla_8x8.hpp"
 #include "kernels/a64_smallK_hybrid_s8s32_dot_6x4.hpp"
 #include "kernels/a64_smallK_hybrid_s8s32_dot_8x4.hpp"
+#include "kernels/a64_sparse_s8s32_mla_4x16.hpp"
 
 #include "kernels/sve_hybrid_s8s32_dot_6x4VL.hpp"
 #include "kernels/sve_interleaved_s8s32_dot_8x3VL.hpp"
@@ -46,6 +50,23 @@
 namespace arm_gemm {
 
 static const GemmImplementation<int8_t, int32_t> gemm_s8_methods[] = {
+// Block-sparse B, only used when the caller flags the weights as sparse.
+{
+    GemmMethod::GEMM_SPARSE,
+    "a64_sparse_s8s32_mla_4x16",
+    [](const GemmArgs &args) { return args._sparse_weights && !args._indirect_input && args._act.type == Activation::Type::None; },
+    nullptr,
+    [](const GemmArgs &args) { return new GemmSparse<cls_a64_sparse_s8s32_mla_4x16, int8_t, int32_t>(args); }
+},
+// Small M (micro-batches): keep all the rows of A in registers and stream B once.
+// Dot product kernels have twice the MAC throughput, so only use this for the smallest M when they are available.
+{
+    GemmMethod::GEMM_HYBRID,
+    "a64_smallM_s8s32_mla_8x8",
+    [](const GemmArgs &args) { return args._Msize<=(args._ci->has_dotprod() ? 3u : 8u) && !args._indirect_input && args._act.type == Activation::Type::None; },
+    nullptr,
+    [](const GemmArgs &args) { return new GemmSmallM<cls_a64_smallM_s8s32_mla_8x8, int8_t, int32_t>(args); }
+},
 #ifdef __ARM_FEATURE_SVE
 #ifdef MMLA_INT8
 {
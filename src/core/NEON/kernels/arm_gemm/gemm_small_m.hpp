@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+
+#include "arm_gemm.hpp"
+#include "ndrange.hpp"
+#include "utils.hpp"
+
+#ifdef CYCLE_PROFILING
+#include "profiler.hpp"
+#endif
+
+namespace arm_gemm {
+
+// Implementation of the GemmCommon abstract class.
+//
+// This implementation is for GEMMs with only a few rows in A (up to
+// strategy::out_height(), e.g. micro-batched inference).  B is
+// pretransposed into panels of strategy::out_width() columns; the kernel
+// keeps the accumulators for all the rows of A in registers and streams
+// each B panel exactly once.
+template<typename strategy, typename To, typename Tr>
+class GemmSmallM : public GemmCommon<To, Tr> {
+    typedef typename strategy::operand_type Toi;
+    typedef typename strategy::result_type Tri;
+
+    /* const properties set by constructor */
+    const CPUInfo * const _ci;
+
+    const unsigned int _Msize;
+    const unsigned int _Nsize;
+    const unsigned int _Ksize;
+
+    const unsigned int _nbatches;
+    const unsigned int _nmulti;
+
+    const Activation _act;
+
+    const unsigned int _buffer_per_multi;
+
+    /* Pretransposed buffer. */
+    const Toi *_B_pretransposed = nullptr;
+
+    const NDRange<3> _window_range;
+
+public:
+    GemmSmallM(GemmSmallM &) = delete;
+    GemmSmallM & operator= (GemmSmallM &) = delete;
+
+    /* Constructor */
+    GemmSmallM(const GemmArgs &args)
+              : _ci(args._ci), _Msize(args._Msize), _Nsize(args._Nsize), _Ksize(args._Ksize),
+                _nbatches(args._nbatches), _nmulti(args._nmulti),
+                _act(args._act),
+                _buffer_per_multi(roundup(args._Nsize, strategy::out_width()) * roundup(args._Ksize, strategy::k_unroll())),
+                _window_range(iceildiv(args._Nsize, strategy::out_width()), _nbatches, _nmulti) {
+        assert(args._Msize <= strategy::out_height());
+    }
+
+    // Window is the number of out_width blocks, times number of batches, times number of multis.
+    ndrange_t get_window_size() const override {
+        return { _window_range.total_size() };
+    }
+
+    // Execute
+    void execute(const ndcoord_t &work_range, const ndcoord_t &, int) override {
+#ifdef CYCLE_PROFILING
+        profiler prof;
+#endif
+        strategy strat(_ci);
+
+        /* Make sure we've been set up correctly. */
+        assert(_B_pretransposed);
+        static_assert(std::is_same<To, Toi>::value, "gemm_small_m: Operand types must be the same.");
+        static_assert(std::is_same<Tr, Tri>::value, "gemm_small_m: Result types must be the same.");
+
+        auto p = _window_range.iterator(work_range.get_position(0), work_range.get_position_end(0));
+
+        if (p.done()) {
+            return;
+        }
+
+        do {
+            // Each contiguous run of panels is handed to the kernel in one call.
+            const unsigned int n0    = p.dim(0) * strategy::out_width();
+            const unsigned int nmax  = std::min(p.dim0_max() * strategy::out_width(), _Nsize);
+            const unsigned int batch = p.dim(1);
+            const unsigned int multi = p.dim(2);
+
+#ifdef CYCLE_PROFILING
+            auto prof_scope = prof.ScopedProfiler(PROFILE_KERNEL, (unsigned long)_Msize * (nmax - n0) * _Ksize);
+#endif
+            strat.kernel(this->_Aptr + (multi * this->_A_multi_stride) + (batch * this->_A_batch_stride), this->_lda,
+                         _B_pretransposed + (multi * _buffer_per_multi) + (n0 * roundup(_Ksize, strategy::k_unroll())),
+                         this->_Cptr + (multi * this->_C_multi_stride) + (batch * this->_C_batch_stride) + n0, this->_ldc,
+                         _Msize, (nmax - n0), _Ksize,
+                         this->_bias ? this->_bias + (multi * this->_bias_multi_stride) + n0 : nullptr,
+                         _act);
+        } while (p.next_dim1());
+    }
+
+    /* Pretransposed interface implementation */
+    bool B_is_pretransposed() const override {
+        return true;
+    }
+
+    bool B_pretranspose_required() const override {
+        return (_B_pretransposed == nullptr);
+    }
+
+    size_t get_B_pretransposed_array_size() const override {
+        return _buffer_per_multi * _nmulti * sizeof(Toi);
+    }
+
+    void pretranspose_B_array(void *buffer, const To *B, const int ldb, const int B_multi_stride) override {
+        Toi *B_buffer = reinterpret_cast<Toi *>(buffer);
+        strategy strat(_ci);
+
+        for (unsigned int multi=0; multi<_nmulti; multi++) {
+            strat.transforms.PrepareB(B_buffer + (multi * _buffer_per_multi), B + (multi * B_multi_stride), ldb, 0, _Nsize, 0, _Ksize);
+        }
+
+        _B_pretransposed = B_buffer;
+    }
+
+    void set_pretransposed_B_data(void *buffer) override {
+        _B_pretransposed = reinterpret_cast<Toi *>(buffer);
+    }
+};
+
+} // namespace arm_gemm
@@ -0,0 +1,222 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+
+#include "arm_gemm.hpp"
+#include "ndrange.hpp"
+#include "utils.hpp"
+
+#ifdef CYCLE_PROFILING
+#include "profiler.hpp"
+#endif
+
+namespace arm_gemm {
+
+// Implementation of the GemmCommon abstract class for block-sparse B matrices.
+//
+// B is split into panels of strategy::out_width() columns.  When B is
+// pretransposed each panel is compressed to the list of its rows which
+// contain at least one non-zero value, together with an index array giving
+// the K position of each retained row.  The kernel then only iterates over
+// the retained rows.  Structured sparsity patterns (e.g. 2:4 along K) which
+// are shared by the output channels of a panel are captured by this format
+// as well.
+//
+// The compressed buffer is sized for the dense case as the sparsity of B is
+// only known once the data is available.
+template<typename strategy, typename To, typename Tr>
+class GemmSparse : public GemmCommon<To, Tr> {
+    typedef typename strategy::operand_type Toi;
+    typedef typename strategy::result_type Tri;
+
+    /* const properties set by constructor */
+    const CPUInfo * const _ci;
+
+    const unsigned int _Msize;
+    const unsigned int _Nsize;
+    const unsigned int _Ksize;
+
+    const unsigned int _nbatches;
+    const unsigned int _nmulti;
+
+    const Activation _act;
+
+    /* Number of panels of B per multi */
+    const unsigned int _npanels;
+
+    /* Compressed B: packed blocks, K indices and number of retained blocks for each panel. */
+    const Toi      *_B_blocks = nullptr;
+    const uint32_t *_B_index  = nullptr;
+    const uint32_t *_B_count  = nullptr;
+
+    const NDRange<4> _window_range;
+
+    size_t get_blocks_size() const {
+        return static_cast<size_t>(_nmulti) * _npanels * _Ksize * strategy::out_width() * sizeof(Toi);
+    }
+
+    size_t get_index_size() const {
+        return static_cast<size_t>(_nmulti) * _npanels * _Ksize * sizeof(uint32_t);
+    }
+
+    void set_compressed_pointers(void *in_buffer) {
+        uint8_t *buffer = reinterpret_cast<uint8_t *>(in_buffer);
+
+        _B_blocks = reinterpret_cast<const Toi *>(buffer);
+        _B_index  = reinterpret_cast<const uint32_t *>(buffer + get_blocks_size());
+        _B_count  = reinterpret_cast<const uint32_t *>(buffer + get_blocks_size() + get_index_size());
+    }
+
+public:
+    GemmSparse(GemmSparse &) = delete;
+    GemmSparse & operator= (GemmSparse &) = delete;
+
+    /* Constructor */
+    GemmSparse(const GemmArgs &args)
+              : _ci(args._ci), _Msize(args._Msize), _Nsize(args._Nsize), _Ksize(args._Ksize),
+                _nbatches(args._nbatches), _nmulti(args._nmulti),
+                _act(args._act),
+                _npanels(iceildiv(args._Nsize, strategy::out_width())),
+                _window_range(iceildiv(args._Msize, strategy::out_height()), _nbatches, _npanels, _nmulti) { }
+
+    // Interface implementation - Compulsory functions
+    ndrange_t get_window_size() const override {
+        return { _window_range.total_size() };
+    }
+
+    // The number of retained blocks varies between panels, so allow dynamic scheduling to balance the load.
+    bool supports_dynamic_scheduling() const override {
+        return true;
+    }
+
+    // Execute
+    void execute(const ndcoord_t &work_range, const ndcoord_t &, int) override {
+#ifdef CYCLE_PROFILING
+        profiler prof;
+#endif
+        strategy strat(_ci);
+
+        /* Make sure we've been set up correctly. */
+        assert(_B_blocks);
+        static_assert(std::is_same<To, Toi>::value, "gemm_sparse: Operand types must be the same.");
+        static_assert(std::is_same<Tr, Tri>::value, "gemm_sparse: Result types must be the same.");
+
+        auto p = _window_range.iterator(work_range.get_position(0), work_range.get_position_end(0));
+
+        if (p.done()) {
+            return;
+        }
+
+        do {
+            const unsigned int m_start = p.dim(0) * strategy::out_height();
+            const unsigned int m_end   = std::min(p.dim0_max() * strategy::out_height(), _Msize);
+            const unsigned int batch   = p.dim(1);
+            const unsigned int panel   = p.dim(2);
+            const unsigned int multi   = p.dim(3);
+
+            const unsigned int n0   = panel * strategy::out_width();
+            const unsigned int nmax = std::min(n0 + strategy::out_width(), _Nsize);
+
+            const unsigned int panel_id   = (multi * _npanels) + panel;
+            const Toi         *b_blocks   = _B_blocks + (static_cast<size_t>(panel_id) * _Ksize * strategy::out_width());
+            const uint32_t    *b_index    = _B_index + (static_cast<size_t>(panel_id) * _Ksize);
+            const unsigned int num_blocks = _B_count[panel_id];
+
+            for (unsigned int m=m_start; m<m_end; m+=strategy::out_height()) {
+                const unsigned int rows = std::min(m_end - m, strategy::out_height());
+
+#ifdef CYCLE_PROFILING
+                auto prof_scope = prof.ScopedProfiler(PROFILE_KERNEL, (unsigned long)rows * num_blocks * strategy::out_width());
+#endif
+                strat.kernel(this->_Aptr + (multi * this->_A_multi_stride) + (batch * this->_A_batch_stride) + (m * this->_lda), this->_lda,
+                             b_blocks, b_index, num_blocks,
+                             this->_Cptr + (multi * this->_C_multi_stride) + (batch * this->_C_batch_stride) + (m * this->_ldc) + n0, this->_ldc,
+                             rows, (nmax - n0),
+                             this->_bias ? this->_bias + (multi * this->_bias_multi_stride) + n0 : nullptr,
+                             _act);
+            }
+        } while (p.next_dim1());
+    }
+
+    // Interface implementation - pretransposed
+    bool B_is_pretransposed() const override {
+        return true;
+    }
+
+    bool B_pretranspose_required() const override {
+        return (_B_blocks == nullptr);
+    }
+
+    size_t get_B_pretransposed_array_size() const override {
+        return get_blocks_size() + get_index_size() + (static_cast<size_t>(_nmulti) * _npanels * sizeof(uint32_t));
+    }
+
+    // Compress B: for each panel, only the rows holding at least one non-zero value are kept.
+    void pretranspose_B_array(void *in_buffer, const To *B, const int ldb, const int B_multi_stride) override {
+        uint8_t  *buffer = reinterpret_cast<uint8_t *>(in_buffer);
+        Toi      *blocks = reinterpret_cast<Toi *>(buffer);
+        uint32_t *index  = reinterpret_cast<uint32_t *>(buffer + get_blocks_size());
+        uint32_t *count  = reinterpret_cast<uint32_t *>(buffer + get_blocks_size() + get_index_size());
+
+        for (unsigned int multi=0; multi<_nmulti; multi++) {
+            for (unsigned int panel=0; panel<_npanels; panel++) {
+                const unsigned int panel_id = (multi * _npanels) + panel;
+                const unsigned int n0       = panel * strategy::out_width();
+                const unsigned int width    = std::min(_Nsize - n0, strategy::out_width());
+
+                Toi      *panel_blocks = blocks + (static_cast<size_t>(panel_id) * _Ksize * strategy::out_width());
+                uint32_t *panel_index  = index + (static_cast<size_t>(panel_id) * _Ksize);
+                uint32_t  num_blocks   = 0;
+
+                for (unsigned int k=0; k<_Ksize; k++) {
+                    const To *b_row = B + (multi * B_multi_stride) + (k * ldb) + n0;
+
+                    if (std::all_of(b_row, b_row + width, [](const To &v) { return v == static_cast<To>(0); })) {
+                        continue;
+                    }
+
+                    Toi *out = panel_blocks + (num_blocks * strategy::out_width());
+                    std::copy(b_row, b_row + width, out);
+                    std::fill(out + width, out + strategy::out_width(), static_cast<Toi>(0));
+
+                    panel_index[num_blocks++] = k;
+                }
+
+                count[panel_id] = num_blocks;
+            }
+        }
+
+        set_compressed_pointers(in_buffer);
+    }
+
+    void set_pretransposed_B_data(void *in_buffer) override {
+        set_compressed_pointers(in_buffer);
+    }
+};
+
+} // namespace arm_gemm
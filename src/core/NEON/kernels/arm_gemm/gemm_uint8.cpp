@@ -30,12 +30,14 @@
 #include "gemm_interleaved_pretransposed_2d.hpp"
 #include "gemm_hybrid.hpp"
 #include "gemm_hybrid_indirect.hpp"
+#include "gemm_small_m.hpp"
 
 #include "kernels/a64_gemm_u16_8x12.hpp"
 #include "kernels/a64_gemm_u8_4x4.hpp"
 #include "kernels/a64_gemm_u8_8x12.hpp"
 #include "kernels/a64_hybrid_u8u32_dot_6x16.hpp"
 #include "kernels/a64_interleaved_u8u32_mmla_8x12.hpp"
+#include "kernels/a64_smallM_u8u32_mla_8x8.hpp"
 #include "kernels/a64_smallK_hybrid_u8u32_dot_6x4.hpp"
 #include "kernels/a64_smallK_hybrid_u8u32_dot_8x4.hpp"
 
@@ -47,6 +49,15 @@
 namespace arm_gemm {
 
 static const GemmImplementation<uint8_t, uint32_t> gemm_u8_methods[] = {
+// Small M (micro-batches): keep all the rows of A in registers and stream B once.
+// Dot product kernels have twice the MAC throughput, so only use this for the smallest M when they are available.
+{
+    GemmMethod::GEMM_HYBRID,
+    "a64_smallM_u8u32_mla_8x8",
+    [](const GemmArgs &args) { return args._Msize<=(args._ci->has_dotprod() ? 3u : 8u) && !args._indirect_input && args._act.type == Activation::Type::None; },
+    nullptr,
+    [](const GemmArgs &args) { return new GemmSmallM<cls_a64_smallM_u8u32_mla_8x8, uint8_t, uint32_t>(args); }
+},
 #ifdef __ARM_FEATURE_SVE
 #ifdef MMLA_INT8
 {
@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifdef __aarch64__
+
+#include "arm_gemm.hpp"
+
+#include <algorithm>
+#include <arm_neon.h>
+#include <limits>
+
+namespace arm_gemm {
+
+namespace {
+
+// Accumulate one row of the B panel, multiplied by lane 'lane' of each row of A.
+template<unsigned int height, int lane>
+inline void mla_lane(float32x4_t (&acc)[height][2], const float32x4_t (&a)[height], const float *b) {
+    const float32x4_t b0 = vld1q_f32(b + (lane * 8));
+    const float32x4_t b1 = vld1q_f32(b + (lane * 8) + 4);
+
+    for (unsigned int r=0; r<height; r++) {
+        acc[r][0] = vfmaq_laneq_f32(acc[r][0], b0, a[r], lane);
+        acc[r][1] = vfmaq_laneq_f32(acc[r][1], b1, a[r], lane);
+    }
+}
+
+template<unsigned int height>
+void smallM_fp32_mla_rows(const float *A_ptr, int lda, const float *B_ptr, float *output_ptr, int ldc,
+                          unsigned int N, unsigned int K, const float *bias, Activation act) {
+    float minval = -std::numeric_limits<float>::infinity();
+    float maxval = std::numeric_limits<float>::infinity();
+
+    switch(act.type) {
+        default:
+        case Activation::Type::None:
+            break;
+        case Activation::Type::BoundedReLU:
+            maxval = static_cast<float>(act.param1);
+            /* fall through */
+        case Activation::Type::ReLU:
+            minval = 0.0f;
+            break;
+    }
+
+    const float32x4_t vmin = vdupq_n_f32(minval);
+    const float32x4_t vmax = vdupq_n_f32(maxval);
+
+    for (unsigned int n0=0; n0<N; n0+=8, B_ptr+=(K * 8)) {
+        const unsigned int width = std::min(N - n0, 8u);
+
+        float32x4_t acc[height][2];
+
+        float bias_buf[8] = { 0 };
+        if (bias != nullptr) {
+            std::copy(bias + n0, bias + n0 + width, bias_buf);
+        }
+
+        for (unsigned int r=0; r<height; r++) {
+            acc[r][0] = vld1q_f32(bias_buf);
+            acc[r][1] = vld1q_f32(bias_buf + 4);
+        }
+
+        // Main loop: four K values of every row of A are kept in registers.
+        unsigned int k=0;
+        for (; k+4<=K; k+=4) {
+            float32x4_t a[height];
+            for (unsigned int r=0; r<height; r++) {
+                a[r] = vld1q_f32(A_ptr + (r * lda) + k);
+            }
+
+            const float *b = B_ptr + (k * 8);
+            mla_lane<height, 0>(acc, a, b);
+            mla_lane<height, 1>(acc, a, b);
+            mla_lane<height, 2>(acc, a, b);
+            mla_lane<height, 3>(acc, a, b);
+        }
+
+        for (; k<K; k++) {
+            const float32x4_t b0 = vld1q_f32(B_ptr + (k * 8));
+            const float32x4_t b1 = vld1q_f32(B_ptr + (k * 8) + 4);
+
+            for (unsigned int r=0; r<height; r++) {
+                const float a = A_ptr[(r * lda) + k];
+                acc[r][0] = vfmaq_n_f32(acc[r][0], b0, a);
+                acc[r][1] = vfmaq_n_f32(acc[r][1], b1, a);
+            }
+        }
+
+        for (unsigned int r=0; r<height; r++) {
+            float *out = output_ptr + (r * ldc) + n0;
+
+            acc[r][0] = vminq_f32(vmaxq_f32(acc[r][0], vmin), vmax);
+            acc[r][1] = vminq_f32(vmaxq_f32(acc[r][1], vmin), vmax);
+
+            if (width == 8) {
+                vst1q_f32(out, acc[r][0]);
+                vst1q_f32(out + 4, acc[r][1]);
+            } else {
+                float out_buf[8];
+                vst1q_f32(out_buf, acc[r][0]);
+                vst1q_f32(out_buf + 4, acc[r][1]);
+                std::copy(out_buf, out_buf + width, out);
+            }
+        }
+    }
+}
+
+} // anonymous namespace
+
+void a64_smallM_fp32_mla_8x8(const float *A_ptr, int lda, const float *B_ptr, float *output_ptr, int ldc,
+                             unsigned int M, unsigned int N, unsigned int K, const float *bias, Activation act) {
+    switch(M) {
+        case 1:
+            smallM_fp32_mla_rows<1>(A_ptr, lda, B_ptr, output_ptr, ldc, N, K, bias, act);
+            break;
+        case 2:
+            smallM_fp32_mla_rows<2>(A_ptr, lda, B_ptr, output_ptr, ldc, N, K, bias, act);
+            break;
+        case 3:
+            smallM_fp32_mla_rows<3>(A_ptr, lda, B_ptr, output_ptr, ldc, N, K, bias, act);
+            break;
+        case 4:
+            smallM_fp32_mla_rows<4>(A_ptr, lda, B_ptr, output_ptr, ldc, N, K, bias, act);
+            break;
+        case 5:
+            smallM_fp32_mla_rows<5>(A_ptr, lda, B_ptr, output_ptr, ldc, N, K, bias, act);
+            break;
+        case 6:
+            smallM_fp32_mla_rows<6>(A_ptr, lda, B_ptr, output_ptr, ldc, N, K, bias, act);
+            break;
+        case 7:
+            smallM_fp32_mla_rows<7>(A_ptr, lda, B_ptr, output_ptr, ldc, N, K, bias, act);
+            break;
+        default:
+            smallM_fp32_mla_rows<8>(A_ptr, lda, B_ptr, output_ptr, ldc, N, K, bias, act);
+            break;
+    }
+}
+
+} // namespace arm_gemm
+
+#endif // __aarch64__
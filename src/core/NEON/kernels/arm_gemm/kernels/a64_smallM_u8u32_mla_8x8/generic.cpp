@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifdef __aarch64__
+
+#include "arm_gemm.hpp"
+
+#include <algorithm>
+#include <arm_neon.h>
+
+namespace arm_gemm {
+
+namespace {
+
+// Widen one row of the B panel to 16 bits and accumulate it, multiplied by lane 'lane' of each row of A.
+template<unsigned int height, int lane>
+inline void mla_lane(uint32x4_t (&acc)[height][2], const uint16x8_t (&a)[height], const uint8_t *b) {
+    const uint16x8_t b16 = vmovl_u8(vld1_u8(b + (lane * 8)));
+
+    for (unsigned int r=0; r<height; r++) {
+        acc[r][0] = vmlal_laneq_u16(acc[r][0], vget_low_u16(b16), a[r], lane);
+        acc[r][1] = vmlal_high_laneq_u16(acc[r][1], b16, a[r], lane);
+    }
+}
+
+template<unsigned int height>
+void smallM_u8u32_mla_rows(const uint8_t *A_ptr, int lda, const uint8_t *B_ptr, uint32_t *output_ptr, int ldc,
+                           unsigned int N, unsigned int K, const uint32_t *bias) {
+    for (unsigned int n0=0; n0<N; n0+=8, B_ptr+=(K * 8)) {
+        const unsigned int width = std::min(N - n0, 8u);
+
+        uint32x4_t acc[height][2];
+
+        uint32_t bias_buf[8] = { 0 };
+        if (bias != nullptr) {
+            std::copy(bias + n0, bias + n0 + width, bias_buf);
+        }
+
+        for (unsigned int r=0; r<height; r++) {
+            acc[r][0] = vld1q_u32(bias_buf);
+            acc[r][1] = vld1q_u32(bias_buf + 4);
+        }
+
+        // Main loop: eight K values of every row of A are kept (widened) in registers.
+        unsigned int k=0;
+        for (; k+8<=K; k+=8) {
+            uint16x8_t a[height];
+            for (unsigned int r=0; r<height; r++) {
+                a[r] = vmovl_u8(vld1_u8(A_ptr + (r * lda) + k));
+            }
+
+            const uint8_t *b = B_ptr + (k * 8);
+            mla_lane<height, 0>(acc, a, b);
+            mla_lane<height, 1>(acc, a, b);
+            mla_lane<height, 2>(acc, a, b);
+            mla_lane<height, 3>(acc, a, b);
+            mla_lane<height, 4>(acc, a, b);
+            mla_lane<height, 5>(acc, a, b);
+            mla_lane<height, 6>(acc, a, b);
+            mla_lane<height, 7>(acc, a, b);
+        }
+
+        for (; k<K; k++) {
+            const uint16x8_t b16 = vmovl_u8(vld1_u8(B_ptr + (k * 8)));
+
+            for (unsigned int r=0; r<height; r++) {
+                const uint16_t a = A_ptr[(r * lda) + k];
+                acc[r][0] = vmlal_n_u16(acc[r][0], vget_low_u16(b16), a);
+                acc[r][1] = vmlal_high_n_u16(acc[r][1], b16, a);
+            }
+        }
+
+        for (unsigned int r=0; r<height; r++) {
+            uint32_t *out = output_ptr + (r * ldc) + n0;
+
+            if (width == 8) {
+                vst1q_u32(out, acc[r][0]);
+                vst1q_u32(out + 4, acc[r][1]);
+            } else {
+                uint32_t out_buf[8];
+                vst1q_u32(out_buf, acc[r][0]);
+                vst1q_u32(out_buf + 4, acc[r][1]);
+                std::copy(out_buf, out_buf + width, out);
+            }
+        }
+    }
+}
+
+} // anonymous namespace
+
+void a64_smallM_u8u32_mla_8x8(const uint8_t *A_ptr, int lda, const uint8_t *B_ptr, uint32_t *output_ptr, int ldc,
+                              unsigned int M, unsigned int N, unsigned int K, const uint32_t *bias, Activation) {
+    switch(M) {
+        case 1:
+            smallM_u8u32_mla_rows<1>(A_ptr, lda, B_ptr, output_ptr, ldc, N, K, bias);
+            break;
+        case 2:
+            smallM_u8u32_mla_rows<2>(A_ptr, lda, B_ptr, output_ptr, ldc, N, K, bias);
+            break;
+        case 3:
+            smallM_u8u32_mla_rows<3>(A_ptr, lda, B_ptr, output_ptr, ldc, N, K, bias);
+            break;
+        case 4:
+            smallM_u8u32_mla_rows<4>(A_ptr, lda, B_ptr, output_ptr, ldc, N, K, bias);
+            break;
+        case 5:
+            smallM_u8u32_mla_rows<5>(A_ptr, lda, B_ptr, output_ptr, ldc, N, K, bias);
+            break;
+        case 6:
+            smallM_u8u32_mla_rows<6>(A_ptr, lda, B_ptr, output_ptr, ldc, N, K, bias);
+            break;
+        case 7:
+            smallM_u8u32_mla_rows<7>(A_ptr, lda, B_ptr, output_ptr, ldc, N, K, bias);
+            break;
+        default:
+            smallM_u8u32_mla_rows<8>(A_ptr, lda, B_ptr, output_ptr, ldc, N, K, bias);
+            break;
+    }
+}
+
+} // namespace arm_gemm
+
+#endif // __aarch64__
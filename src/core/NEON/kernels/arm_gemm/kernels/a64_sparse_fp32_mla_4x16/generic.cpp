@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifdef __aarch64__
+
+#include "arm_gemm.hpp"
+
+#include <arm_neon.h>
+#include <cstdint>
+#include <limits>
+
+namespace arm_gemm {
+
+namespace {
+
+template<unsigned int height>
+void sparse_fp32_mla_rows(const float *A_ptr, int lda, const float *B_ptr, const uint32_t *B_index, unsigned int num_blocks,
+                          float *output_ptr, int ldc, unsigned int N, const float *bias, Activation act) {
+    float32x4_t acc[height][4];
+
+    // Initialise the accumulators with the bias (padded out to the full block width).
+    float bias_buf[16] = { 0 };
+    if (bias != nullptr) {
+        for (unsigned int i=0; i<N; i++) {
+            bias_buf[i] = bias[i];
+        }
+    }
+
+    for (unsigned int r=0; r<height; r++) {
+        for (unsigned int i=0; i<4; i++) {
+            acc[r][i] = vld1q_f32(bias_buf + (i * 4));
+        }
+    }
+
+    // Only the retained (non-zero) rows of this B panel are visited.
+    for (unsigned int blk=0; blk<num_blocks; blk++) {
+        const float *b = B_ptr + (blk * 16);
+        const unsigned int k = B_index[blk];
+
+        const float32x4_t b0 = vld1q_f32(b);
+        const float32x4_t b1 = vld1q_f32(b + 4);
+        const float32x4_t b2 = vld1q_f32(b + 8);
+        const float32x4_t b3 = vld1q_f32(b + 12);
+
+        for (unsigned int r=0; r<height; r++) {
+            const float a = A_ptr[(r * lda) + k];
+
+            acc[r][0] = vfmaq_n_f32(acc[r][0], b0, a);
+            acc[r][1] = vfmaq_n_f32(acc[r][1], b1, a);
+            acc[r][2] = vfmaq_n_f32(acc[r][2], b2, a);
+            acc[r][3] = vfmaq_n_f32(acc[r][3], b3, a);
+        }
+    }
+
+    float minval = -std::numeric_limits<float>::infinity();
+    float maxval = std::numeric_limits<float>::infinity();
+
+    switch(act.type) {
+        default:
+        case Activation::Type::None:
+            break;
+        case Activation::Type::BoundedReLU:
+            maxval = static_cast<float>(act.param1);
+            /* fall through */
+        case Activation::Type::ReLU:
+            minval = 0.0f;
+            break;
+    }
+
+    const float32x4_t vmin = vdupq_n_f32(minval);
+    const float32x4_t vmax = vdupq_n_f32(maxval);
+
+    for (unsigned int r=0; r<height; r++) {
+        float *out = output_ptr + (r * ldc);
+
+        for (unsigned int i=0; i<4; i++) {
+            acc[r][i] = vminq_f32(vmaxq_f32(acc[r][i], vmin), vmax);
+        }
+
+        if (N == 16) {
+            vst1q_f32(out, acc[r][0]);
+            vst1q_f32(out + 4, acc[r][1]);
+            vst1q_f32(out + 8, acc[r][2]);
+            vst1q_f32(out + 12, acc[r][3]);
+        } else {
+            float out_buf[16];
+
+            for (unsigned int i=0; i<4; i++) {
+                vst1q_f32(out_buf + (i * 4), acc[r][i]);
+            }
+
+            for (unsigned int i=0; i<N; i++) {
+                out[i] = out_buf[i];
+            }
+        }
+    }
+}
+
+} // anonymous namespace
+
+void a64_sparse_fp32_mla_4x16(const float *A_ptr, int lda, const float *B_ptr, const uint32_t *B_index, unsigned int num_blocks,
+                              float *output_ptr, int ldc, unsigned int M, unsigned int N, const float *bias, Activation act) {
+    switch(M) {
+        case 1:
+            sparse_fp32_mla_rows<1>(A_ptr, lda, B_ptr, B_index, num_blocks, output_ptr, ldc, N, bias, act);
+            break;
+        case 2:
+            sparse_fp32_mla_rows<2>(A_ptr, lda, B_ptr, B_index, num_blocks, output_ptr, ldc, N, bias, act);
+            break;
+        case 3:
+            sparse_fp32_mla_rows<3>(A_ptr, lda, B_ptr, B_index, num_blocks, output_ptr, ldc, N, bias, act);
+            break;
+        default:
+            sparse_fp32_mla_rows<4>(A_ptr, lda, B_ptr, B_index, num_blocks, output_ptr, ldc, N, bias, act);
+            break;
+    }
+}
+
+} // namespace arm_gemm
+
+#endif // __aarch64__
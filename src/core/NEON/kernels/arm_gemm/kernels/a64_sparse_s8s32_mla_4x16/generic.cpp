@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifdef __aarch64__
+
+#include "arm_gemm.hpp"
+
+#include <arm_neon.h>
+#include <cstdint>
+
+namespace arm_gemm {
+
+namespace {
+
+template<unsigned int height>
+void sparse_s8s32_mla_rows(const int8_t *A_ptr, int lda, const int8_t *B_ptr, const uint32_t *B_index, unsigned int num_blocks,
+                           int32_t *output_ptr, int ldc, unsigned int N, const int32_t *bias) {
+    int32x4_t acc[height][4];
+
+    int32_t bias_buf[16] = { 0 };
+    if (bias != nullptr) {
+        for (unsigned int i=0; i<N; i++) {
+            bias_buf[i] = bias[i];
+        }
+    }
+
+    for (unsigned int r=0; r<height; r++) {
+        for (unsigned int i=0; i<4; i++) {
+            acc[r][i] = vld1q_s32(bias_buf + (i * 4));
+        }
+    }
+
+    for (unsigned int blk=0; blk<num_blocks; blk++) {
+        const int8x16_t b = vld1q_s8(B_ptr + (blk * 16));
+        const unsigned int k = B_index[blk];
+
+        // Widen the block to 16 bits so it can be used with the multiply-accumulate-long instructions.
+        const int16x8_t b_lo = vmovl_s8(vget_low_s8(b));
+        const int16x8_t b_hi = vmovl_high_s8(b);
+
+        for (unsigned int r=0; r<height; r++) {
+            const int16_t a = A_ptr[(r * lda) + k];
+
+            acc[r][0] = vmlal_n_s16(acc[r][0], vget_low_s16(b_lo), a);
+            acc[r][1] = vmlal_high_n_s16(acc[r][1], b_lo, a);
+            acc[r][2] = vmlal_n_s16(acc[r][2], vget_low_s16(b_hi), a);
+            acc[r][3] = vmlal_high_n_s16(acc[r][3], b_hi, a);
+        }
+    }
+
+    for (unsigned int r=0; r<height; r++) {
+        int32_t *out = output_ptr + (r * ldc);
+
+        if (N == 16) {
+            vst1q_s32(out, acc[r][0]);
+            vst1q_s32(out + 4, acc[r][1]);
+            vst1q_s32(out + 8, acc[r][2]);
+            vst1q_s32(out + 12, acc[r][3]);
+        } else {
+            int32_t out_buf[16];
+
+            for (unsigned int i=0; i<4; i++) {
+                vst1q_s32(out_buf + (i * 4), acc[r][i]);
+            }
+
+            for (unsigned int i=0; i<N; i++) {
+                out[i] = out_buf[i];
+            }
+        }
+    }
+}
+
+} // anonymous namespace
+
+void a64_sparse_s8s32_mla_4x16(const int8_t *A_ptr, int lda, const int8_t *B_ptr, const uint32_t *B_index, unsigned int num_blocks,
+                               int32_t *output_ptr, int ldc, unsigned int M, unsigned int N, const int32_t *bias, Activation) {
+    switch(M) {
+        case 1:
+            sparse_s8s32_mla_rows<1>(A_ptr, lda, B_ptr, B_index, num_blocks, output_ptr, ldc, N, bias);
+            break;
+        case 2:
+            sparse_s8s32_mla_rows<2>(A_ptr, lda, B_ptr, B_index, num_blocks, output_ptr, ldc, N, bias);
+            break;
+        case 3:
+            sparse_s8s32_mla_rows<3>(A_ptr, lda, B_ptr, B_index, num_blocks, output_ptr, ldc, N, bias);
+            break;
+        default:
+            sparse_s8s32_mla_rows<4>(A_ptr, lda, B_ptr, B_index, num_blocks, output_ptr, ldc, N, bias);
+            break;
+    }
+}
+
+} // namespace arm_gemm
+
+#endif // __aarch64__
@@ -45,7 +45,8 @@ enum class GemmMethod
     QUANTIZE_WRAPPER_2D,
     GEMM_HYBRID_QUANTIZED,
     INDIRECT_GEMM,
-    CONVOLUTION_GEMM
+    CONVOLUTION_GEMM,
+    GEMM_SPARSE
 };
 
 struct KernelDescription
@@ -113,12 +114,15 @@ public:
     Activation        _act;
     int               _maxthreads;
     const GemmConfig *_cfg;
+    bool              _sparse_weights;
+    bool              _fast_mode;
 
     GemmArgs(const CPUInfo *ci, unsigned int M, unsigned int N,
              unsigned int K, unsigned int Ksections, unsigned int nbatches,
              unsigned int nmulti, bool indirect_input, Activation act, const int maxthreads,
              const GemmConfig *cfg = nullptr)
-        : _ci(ci), _Msize(M), _Nsize(N), _Ksize(K), _Ksections(Ksections), _nbatches(nbatches), _nmulti(nmulti), _indirect_input(indirect_input), _act(act), _maxthreads(maxthreads), _cfg(cfg)
+        : _ci(ci), _Msize(M), _Nsize(N), _Ksize(K), _Ksections(Ksections), _nbatches(nbatches), _nmulti(nmulti), _indirect_input(indirect_input), _act(act), _maxthreads(maxthreads), _cfg(cfg),
+          _sparse_weights(false), _fast_mode(false)
     {
     }
 };
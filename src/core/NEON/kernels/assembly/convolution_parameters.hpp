@@ -38,7 +38,7 @@ namespace arm_gemm
  * The parameters describe the convolution details - the notional shape of
  * the input and output tensors, whether padding is to be applied, the size
  * of the kernel and a constant value to be used for padding (needed for
- * quantized tensors).
+ * quantized tensors).  Kernel points are 'dilation' input elements apart.
  *
  * The second part describes the layout of the input tensor in memory, which
  * is assumed to be in NHWC format.  This consists of a base pointer and
@@ -60,6 +60,8 @@ struct ConvolutionParameters
     int64_t padding_top;
     int64_t padding_left;
     float   padding_value;
+    int64_t dilation_w;
+    int64_t dilation_h;
 };
 
 } // namespace arm_gemm
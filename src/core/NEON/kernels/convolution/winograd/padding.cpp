@@ -85,6 +85,13 @@ template void copy_and_pad_tile(
   unsigned int, unsigned int, unsigned int, unsigned int, float
 );
 
+template void copy_and_pad_tile(
+  unsigned int, unsigned int, unsigned int,
+  const int16_t *, unsigned int, unsigned int,
+  int16_t *, unsigned int, unsigned int,
+  unsigned int, unsigned int, unsigned int, unsigned int, int16_t
+);
+
 #ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
 template void copy_and_pad_tile(
     unsigned int, unsigned int, unsigned int,
@@ -172,6 +179,22 @@ template void crop_and_copy_tile(
   unsigned int crop_right
 );
 
+template void crop_and_copy_tile(
+  unsigned int tile_rows,
+  unsigned int tile_cols,
+  unsigned int n_channels,
+  const int32_t *inptr,
+  unsigned int in_row_stride,
+  unsigned int in_col_stride,
+  int32_t *outptr,
+  unsigned int out_row_stride,
+  unsigned int out_col_stride,
+  unsigned int crop_top,
+  unsigned int crop_left,
+  unsigned int crop_bottom,
+  unsigned int crop_right
+);
+
 #ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
 template void crop_and_copy_tile(
     unsigned int tile_rows,
@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "arm.hpp"
+#include "output.hpp"
+
+namespace winograd
+{
+
+/* Output transform used by the quantized F(2x2, 3x3) Winograd convolution.
+ *
+ * The weights have been transformed with 2G rather than G, so the result of
+ * A^T F A is four times the convolution result and is divided by four before
+ * the bias is added. The integer arithmetic is exact as long as the final
+ * accumulator fits in 32 bits; requantization is left to the caller.
+ */
+template <>
+void OutputTransform<3, 3, 4, 4, int32_t, int32_t, WinogradRoots::Integers>::transform_tile(
+  const int n_channels,
+  const int32_t* inptr,
+  const int matrix_stride,
+  const int32_t* bptr,
+  int32_t* const output,
+  const int output_row_stride,
+  const int output_col_stride,
+  const int32_t output_min,
+  const int32_t output_max
+)
+{
+  // Construct a map to the output cells
+  int32_t *outptrs[output_tile_rows][output_tile_cols];
+  for (int i = 0; i < output_tile_rows; i++)
+  {
+    for (int j = 0; j < output_tile_cols; j++)
+    {
+      outptrs[i][j] = output + i*output_row_stride + j*output_col_stride;
+    }
+  }
+
+  // For each channel of the output
+  int channels_remaining = n_channels;
+#ifdef __arm_any__
+  for (; channels_remaining >= 4; channels_remaining -= 4)
+  {
+    // Matrices used and computed during this transform
+    int32x4_t F[4][4], FZ[4][2], f[2][2], b;
+
+    // Read a 4x4 tile in the Winograd domain
+    for (int i = 0, m = 0; i < 4; i++)
+    {
+      for (int j = 0; j < 4; j++, m++)
+      {
+        F[i][j] = vld1q_s32(inptr + m*matrix_stride);
+      }
+    }
+    inptr += 4;
+
+    // Compute the matrix F Z
+    for (int i = 0; i < 4; i++)
+    {
+      // FZ[i][0] =  F[i][0] + F[i][1] + F[i][2];
+      FZ[i][0] = vaddq_s32(vaddq_s32(F[i][0], F[i][1]), F[i][2]);
+
+      // FZ[i][1] =  F[i][1] - F[i][2] - F[i][3];
+      FZ[i][1] = vsubq_s32(vsubq_s32(F[i][1], F[i][2]), F[i][3]);
+    }
+
+    // Compute the output tile f = ZT F Z
+    for (int j = 0; j < 2; j++)
+    {
+      // f[0][j] =  (FZ[0][j] + FZ[1][j] + FZ[2][j]) / 4;
+      f[0][j] = vshrq_n_s32(vaddq_s32(vaddq_s32(FZ[0][j], FZ[1][j]), FZ[2][j]), 2);
+
+      // f[1][j] =  (FZ[1][j] - FZ[2][j] - FZ[3][j]) / 4;
+      f[1][j] = vshrq_n_s32(vsubq_s32(vsubq_s32(FZ[1][j], FZ[2][j]), FZ[3][j]), 2);
+    }
+
+    // Load the bias vector
+    if (bptr != nullptr)
+    {
+      b = vld1q_s32(bptr);
+      bptr += 4;
+    }
+    else
+    {
+      b = vdupq_n_s32(0);
+    }
+
+    // Write out the output tile
+    for (int i = 0; i < output_tile_rows; i++)
+    {
+      for (int j = 0; j < output_tile_cols; j++)
+      {
+        const auto y =
+            vmaxq_s32(vminq_s32(vaddq_s32(f[i][j], b), vdupq_n_s32(output_max)),
+                      vdupq_n_s32(output_min));
+        vst1q_s32(outptrs[i][j], y);
+        outptrs[i][j] += 4;
+      }
+    }
+  }
+#endif  // __arm_any__
+  for (; channels_remaining; channels_remaining--)
+  {
+    // Matrices used and computed during this transform
+    int32_t F[4][4], FZ[4][2], f[2][2], b;
+
+    // Read a 4x4 tile in the Winograd domain
+    for (int i = 0, m = 0; i < 4; i++)
+    {
+      for (int j = 0; j < 4; j++, m++)
+      {
+        F[i][j] = *(inptr + m*matrix_stride);
+      }
+    }
+    inptr++;
+
+    // Compute the matrix F Z
+    for (int i = 0; i < 4; i++)
+    {
+      FZ[i][0] =  F[i][0] + F[i][1] + F[i][2];
+      FZ[i][1] =  F[i][1] - F[i][2] - F[i][3];
+    }
+
+    // Compute the output tile f = ZT F Z
+    for (int j = 0; j < 2; j++)
+    {
+      f[0][j] =  (FZ[0][j] + FZ[1][j] + FZ[2][j]) >> 2;
+      f[1][j] =  (FZ[1][j] - FZ[2][j] - FZ[3][j]) >> 2;
+    }
+
+    // Load the bias
+    if (bptr != nullptr)
+    {
+      b = *(bptr++);
+    }
+    else
+    {
+      b = 0;
+    }
+
+    // Write out the output tile
+    for (int i = 0; i < output_tile_rows; i++)
+    {
+      for (int j = 0; j < output_tile_cols; j++)
+      {
+        const auto y = std::max(std::min(f[i][j] + b, output_max), output_min);
+        *(outptrs[i][j]++) = y;
+      }
+    }
+  }
+}
+
+template class OutputTransform<3, 3, 4, 4, int32_t, int32_t, WinogradRoots::Integers>;
+
+}  // namespace
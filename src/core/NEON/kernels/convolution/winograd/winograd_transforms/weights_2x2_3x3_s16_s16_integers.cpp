@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "arm.hpp"
+#include "kernel.hpp"
+
+namespace winograd
+{
+
+/* Weight transform used by the quantized F(2x2, 3x3) Winograd convolution.
+ *
+ * The fractional transform matrix G is replaced by 2G so that the transform
+ * can be computed exactly with integer arithmetic; the transformed weights
+ * are therefore four times larger than the ones produced by the floating
+ * point transform and the output transform divides its result by four.
+ * Weights are expected to have had their zero-point removed, hence each
+ * transformed value is bounded by 9 * 255 and fits in 16 bits.
+ */
+template <>
+void WeightTransform<3, 3, 4, 4, int16_t, int16_t, WinogradRoots::Integers>::execute(
+  const int n_output_channels,
+  const int n_input_channels,
+  const int16_t* const input,
+  int16_t* const output,
+  const int matrix_stride,
+  const int matrix_row_stride
+)
+{
+  constexpr int inner_tile_i = 4;
+  constexpr int inner_tile_j = 4;
+
+  // Get pointers to each cell of the weight tensor
+  const auto weight_col_stride = n_input_channels * n_output_channels;
+  const auto weight_row_stride = 3 * weight_col_stride;
+  const int16_t *inptrs[3][3];
+  for (int i = 0; i < 3; i++)
+  {
+    for (int j = 0; j < 3; j++)
+    {
+      inptrs[i][j] = input + i*weight_row_stride + j*weight_col_stride;
+    }
+  }
+
+  // For each input channel
+  for (int ic = 0; ic < n_input_channels; ic++)
+  {
+    int16_t *outptr = output + ic * matrix_row_stride;
+
+    // For each output channel
+    int channels_remaining = n_output_channels;
+#ifdef __arm_any__
+    for (; channels_remaining >= 8; channels_remaining -= 8)
+    {
+      // Matrices used and computed in this kernel
+      int16x8_t w[3][3], Ww[inner_tile_i][3], V[inner_tile_i][inner_tile_j];
+
+      // Read weights
+      for (int i = 0; i < 3; i++)
+      {
+        for (int j = 0; j < 3; j++)
+        {
+          w[i][j] = vld1q_s16(inptrs[i][j]);
+          inptrs[i][j] += 8;
+        }
+      }
+
+      // Compute the matrix W w
+      for (int j = 0; j < 3; j++)
+      {
+        // Ww[0][j] = 2*w[0][j];
+        Ww[0][j] = vshlq_n_s16(w[0][j], 1);
+
+        // Ww[1][j] = w[0][j] + w[1][j] + w[2][j];
+        Ww[1][j] = vaddq_s16(vaddq_s16(w[0][j], w[1][j]), w[2][j]);
+
+        // Ww[2][j] = w[0][j] - w[1][j] + w[2][j];
+        Ww[2][j] = vaddq_s16(vsubq_s16(w[0][j], w[1][j]), w[2][j]);
+
+        // Ww[3][j] = 2*w[2][j];
+        Ww[3][j] = vshlq_n_s16(w[2][j], 1);
+      }
+
+      // Compute V = W w WT
+      for (int i = 0; i < inner_tile_i; i++)
+      {
+        // V[i][0] = 2*Ww[i][0];
+        V[i][0] = vshlq_n_s16(Ww[i][0], 1);
+
+        // V[i][1] = Ww[i][0] + Ww[i][1] + Ww[i][2];
+        V[i][1] = vaddq_s16(vaddq_s16(Ww[i][0], Ww[i][1]), Ww[i][2]);
+
+        // V[i][2] = Ww[i][0] - Ww[i][1] + Ww[i][2];
+        V[i][2] = vaddq_s16(vsubq_s16(Ww[i][0], Ww[i][1]), Ww[i][2]);
+
+        // V[i][3] = 2*Ww[i][2];
+        V[i][3] = vshlq_n_s16(Ww[i][2], 1);
+      }
+
+      // Store the transformed weights
+      for (int i = 0, m = 0; i < inner_tile_i; i++)
+      {
+        for (int j = 0; j < inner_tile_j; j++, m++)
+        {
+          vst1q_s16(outptr + m*matrix_stride, V[i][j]);
+        }
+      }
+      outptr += 8;
+    }
+#endif  // __arm_any__
+    for (; channels_remaining; channels_remaining--)
+    {
+      // Matrices used and computed in this kernel
+      int16_t w[3][3], Ww[inner_tile_i][3], V[inner_tile_i][inner_tile_j];
+
+      // Read weights
+      for (int i = 0; i < 3; i++)
+      {
+        for (int j = 0; j < 3; j++)
+        {
+          w[i][j] = *(inptrs[i][j]++);
+        }
+      }
+
+      // Compute the matrix W w
+      for (int j = 0; j < 3; j++)
+      {
+        Ww[0][j] = 2*w[0][j];
+        Ww[1][j] = w[0][j] + w[1][j] + w[2][j];
+        Ww[2][j] = w[0][j] - w[1][j] + w[2][j];
+        Ww[3][j] = 2*w[2][j];
+      }
+
+      // Compute V = W w WT
+      for (int i = 0; i < inner_tile_i; i++)
+      {
+        V[i][0] = 2*Ww[i][0];
+        V[i][1] = Ww[i][0] + Ww[i][1] + Ww[i][2];
+        V[i][2] = Ww[i][0] - Ww[i][1] + Ww[i][2];
+        V[i][3] = 2*Ww[i][2];
+      }
+
+      // Store the transformed weights
+      for (int i = 0, m = 0; i < inner_tile_i; i++)
+      {
+        for (int j = 0; j < inner_tile_j; j++, m++)
+        {
+          *(outptr + m*matrix_stride) = V[i][j];
+        }
+      }
+      outptr++;
+    }
+  }
+}
+
+template class WeightTransform<3, 3, 4, 4, int16_t, int16_t, WinogradRoots::Integers>;
+
+}  // namespace
@@ -23,6 +23,8 @@
  */
 #include "src/core/utils/helpers/fft.h"
 
+#include <algorithm>
+#include <limits>
 #include <numeric>
 
 namespace arm_compute
@@ -119,6 +121,84 @@ std::vector<unsigned int> digit_reverse_indices(unsigned int N, const std::vecto
 
     return idx_digit_reverse;
 }
+
+namespace
+{
+/** Work per element of a stage of the given radix: the power of two radixes only need trivial rotations */
+float stage_cost(unsigned int radix)
+{
+    switch(radix)
+    {
+        case 4:
+            return 3.f;
+        case 8:
+            return 4.f;
+        default:
+            return static_cast<float>(radix);
+    }
+}
+
+float estimate_decomposed_fft_cost(unsigned int N, const std::vector<unsigned int> &stages)
+{
+    float cost = 0.f;
+    for(const auto radix : stages)
+    {
+        cost += stage_cost(radix);
+    }
+    return cost * N;
+}
+
+/** Find the cheapest decomposable size in [N, 2 * N] */
+unsigned int cheapest_decomposable_length(unsigned int N, const std::set<unsigned int> &supported_factors, float &cost)
+{
+    unsigned int best_length = 0;
+    cost                     = std::numeric_limits<float>::max();
+    for(unsigned int length = N; length <= 2 * N; ++length)
+    {
+        const auto stages = decompose_stages(length, supported_factors);
+        if(!stages.empty())
+        {
+            const float length_cost = estimate_decomposed_fft_cost(length, stages);
+            if(length_cost < cost)
+            {
+                best_length = length;
+                cost        = length_cost;
+            }
+        }
+    }
+    return best_length;
+}
+} // namespace
+
+float estimate_fft_cost(unsigned int N, const std::set<unsigned int> &supported_factors)
+{
+    const auto stages = decompose_stages(N, supported_factors);
+    if(!stages.empty())
+    {
+        return estimate_decomposed_fft_cost(N, stages);
+    }
+
+    // Bluestein: forward and inverse FFTs of the padded size, chirp multiplications and spectrum product
+    const unsigned int L = bluestein_length(N, supported_factors);
+    return 2.f * estimate_decomposed_fft_cost(L, decompose_stages(L, supported_factors)) + 3.f * L;
+}
+
+unsigned int bluestein_length(unsigned int N, const std::set<unsigned int> &supported_factors)
+{
+    float cost = 0.f;
+    return cheapest_decomposable_length(std::max(2 * N, 2U) - 1, supported_factors, cost);
+}
+
+unsigned int plan_padded_length(unsigned int N, const std::set<unsigned int> &supported_factors, bool allow_bluestein)
+{
+    float              padded_cost   = 0.f;
+    const unsigned int padded_length = cheapest_decomposable_length(N, supported_factors, padded_cost);
+    if(allow_bluestein && (padded_length == 0 || estimate_fft_cost(N, supported_factors) < padded_cost))
+    {
+        return N;
+    }
+    return padded_length;
+}
 } // namespace fft
 } // namespace helpers
 } // namespace arm_compute
@@ -49,6 +49,37 @@ std::vector<unsigned int> decompose_stages(unsigned int N, const std::set<unsign
  * @return A vector with the digit reverse indices. Will be empty if it failed.
  */
 std::vector<unsigned int> digit_reverse_indices(unsigned int N, const std::vector<unsigned int> &fft_stages);
+/** Estimate the relative cost of a 1D FFT of a given size
+ *
+ * Sizes that can be decomposed cost one pass per stage, weighted by the work per element of the stage radix.
+ * Other sizes are computed with Bluestein's algorithm, whose cost is the one of two FFTs of @ref bluestein_length
+ * plus the elementwise passes around them.
+ *
+ * @param[in] N                 Input size of the FFT.
+ * @param[in] supported_factors Supported factors that can be used for decomposition.
+ *
+ * @return The estimated cost. Only meaningful when compared to other estimates.
+ */
+float estimate_fft_cost(unsigned int N, const std::set<unsigned int> &supported_factors);
+/** Calculate the size of the FFTs used by Bluestein's algorithm to compute a FFT of a size that cannot be decomposed
+ *
+ * @param[in] N                 Input size of the FFT.
+ * @param[in] supported_factors Supported factors that can be used for decomposition.
+ *
+ * @return The cheapest size that can be decomposed and is at least 2 * N - 1.
+ */
+unsigned int bluestein_length(unsigned int N, const std::set<unsigned int> &supported_factors);
+/** Choose the cheapest size to compute the FFT of a signal that can be zero padded
+ *
+ * Padding to a size that can be decomposed is compared to computing the exact size with Bluestein's algorithm.
+ *
+ * @param[in] N                 Minimum size of the FFT.
+ * @param[in] supported_factors Supported factors that can be used for decomposition.
+ * @param[in] allow_bluestein   (Optional) Whether sizes that cannot be decomposed can be picked. Defaults to true.
+ *
+ * @return The size of the FFT, at least @p N.
+ */
+unsigned int plan_padded_length(unsigned int N, const std::set<unsigned int> &supported_factors, bool allow_bluestein = true);
 } // namespace fft
 } // namespace helpers
 } // namespace arm_compute
@@ -27,12 +27,14 @@
 #include "arm_compute/graph/Utils.h"
 #include "arm_compute/graph/backends/BackendRegistry.h"
 
+#include <algorithm>
+
 namespace arm_compute
 {
 namespace graph
 {
 GraphContext::GraphContext()
-    : _config(), _memory_managers(), _weights_managers()
+    : _config(), _memory_managers(), _weights_managers(), _plan()
 {
 }
 
@@ -99,9 +101,15 @@ std::map<Target, WeightsManagerContext> &GraphContext::weights_managers()
     return _weights_managers;
 }
 
+GraphPlan &GraphContext::plan()
+{
+    return _plan;
+}
+
 void GraphContext::finalize()
 {
-    const size_t num_pools = 1;
+    // Functions running concurrently need their own pool of auxiliary memory
+    const size_t num_pools = std::max({ 1U, _config.num_parallel_branches, _config.num_pipeline_stages });
     for(auto &mm_obj : _memory_managers)
     {
         ARM_COMPUTE_ERROR_ON(!mm_obj.second.allocator);
@@ -31,15 +31,82 @@
 #include "arm_compute/graph/Utils.h"
 #include "arm_compute/graph/detail/CrossLayerMemoryManagerHelpers.h"
 #include "arm_compute/graph/detail/ExecutionHelpers.h"
+#include "arm_compute/graph/nodes/ConvolutionLayerNode.h"
+#include "arm_compute/graph/printers/DotGraphPrinter.h"
 
 #include "arm_compute/graph/algorithms/TopologicalSort.h"
 
+#include "support/Cast.h"
+#include "support/MemorySupport.h"
+
+#include <algorithm>
+#include <chrono>
+#include <set>
+
 namespace arm_compute
 {
 namespace graph
 {
+namespace
+{
+/** Checks if a tensor holds a constant */
+bool is_const_tensor(Graph &g, const Tensor &tensor)
+{
+    const std::set<EdgeID> bound_edges = tensor.bound_edges();
+    return std::any_of(std::begin(bound_edges), std::end(bound_edges), [&](EdgeID eid)
+    {
+        const Edge *edge = g.edge(eid);
+        return edge != nullptr && edge->producer() != nullptr && edge->producer()->type() == NodeType::Const;
+    });
+}
+
+/** Checks that the nodes whose output shape is fixed at construction keep the input shapes they were built for
+ *
+ * @param[in] g              Graph whose tensor shapes have been inferred for new input shapes
+ * @param[in] previous_descs Descriptors of the non-constant tensors before the inference
+ *
+ * @return a status
+ */
+Status validate_fixed_shape_nodes(Graph &g, const std::map<TensorID, TensorDescriptor> &previous_descs)
+{
+    for(auto &node : g.nodes())
+    {
+        if(node == nullptr || (node->type() != NodeType::ReshapeLayer && node->type() != NodeType::DetectionPostProcessLayer && node->type() != NodeType::Dummy))
+        {
+            continue;
+        }
+
+        for(size_t i = 0; i < node->num_inputs(); ++i)
+        {
+            const Tensor *input    = node->input(i);
+            const auto    previous = (input != nullptr) ? previous_descs.find(input->id()) : std::end(previous_descs);
+            ARM_COMPUTE_RETURN_ERROR_ON_MSG_VAR(previous != std::end(previous_descs) && previous->second.shape != input->desc().shape,
+                                                "Node %s has a fixed output shape, so its input shape can't change", node->name().c_str());
+        }
+    }
+    return Status{};
+}
+
+/** Sets the convolution methods recorded in a plan to the convolution nodes left to the heuristics of the backend */
+void apply_convolution_methods(Graph &g, const GraphPlan &plan)
+{
+    for(const auto &convolution_method : plan.convolution_methods())
+    {
+        INode *node = g.node(convolution_method.first);
+        if(node != nullptr && node->type() == NodeType::ConvolutionLayer)
+        {
+            auto *conv_node = arm_compute::utils::cast::polymorphic_downcast<ConvolutionLayerNode *>(node);
+            if(conv_node->convolution_method() == ConvolutionMethod::Default)
+            {
+                conv_node->set_convolution_method(convolution_method.second);
+            }
+        }
+    }
+}
+} // namespace
+
 GraphManager::GraphManager()
-    : _workloads()
+    : _reshape_states(), _workloads()
 {
 }
 
@@ -51,9 +118,42 @@ void GraphManager::finalize_graph(Graph &graph, GraphContext &ctx, PassManager &
         ARM_COMPUTE_ERROR("Graph is already registered!");
     }
 
+    const auto start = std::chrono::steady_clock::now();
+
+    // Load the plan recorded by a previous finalization of the graph
+    const std::string &plan_file = ctx.config().plan_file;
+    if(!plan_file.empty() && ctx.plan().load(plan_file, GraphPlan::fingerprint(graph, target, ctx.config())))
+    {
+        ARM_COMPUTE_LOG_GRAPH_INFO("Loaded the plan of graph with ID : " << graph.id() << " from " << plan_file << std::endl);
+    }
+
     // Apply IR mutating passes
     pm.run_type(graph, IGraphMutator::MutationType::IR);
 
+    // Record the plan if it wasn't loaded, the passes gave another graph or the constants changed, else replay its convolution methods
+    bool record_plan = false;
+    if(!plan_file.empty())
+    {
+        std::string ir = GraphPlan::describe(graph);
+        record_plan    = !ctx.plan().is_loaded() || ctx.plan().ir() != ir || ctx.plan().is_modified();
+        if(record_plan)
+        {
+            if(ctx.plan().is_loaded())
+            {
+                ARM_COMPUTE_LOG_GRAPH_INFO("The plan in " << plan_file << " doesn't match the mutated graph or its constants, recording it again" << std::endl);
+            }
+            ctx.plan().set_ir(std::move(ir));
+        }
+        else
+        {
+            apply_convolution_methods(graph, ctx.plan());
+        }
+    }
+    if(!record_plan)
+    {
+        ctx.plan().release_folded_constants();
+    }
+
     // Force target to all graph construct
     // TODO (COMPMID-2014) : Support heterogeneous execution
     Target forced_target = target;
@@ -74,6 +174,42 @@ void GraphManager::finalize_graph(Graph &graph, GraphContext &ctx, PassManager &
     // Apply backend mutating passes
     pm.run_type(graph, IGraphMutator::MutationType::Backend);
 
+    // Configure all nodes and setup their memory
+    auto workload = configure_workload(graph, ctx, forced_target, true);
+
+    // Save the plan once the backend has recorded the convolution methods it selected
+    if(record_plan)
+    {
+        ctx.plan().save(plan_file);
+        ctx.plan().release_folded_constants();
+    }
+
+    // Keep track of the shapes of the inputs if they can change
+    if(ctx.config().input_shape_cache_size > 0)
+    {
+        ReshapeState state;
+        state.target = forced_target;
+        state.ctx    = &ctx;
+        state.pm     = &pm;
+        for(const auto &input_id : graph.nodes(NodeType::Input))
+        {
+            state.input_shapes.push_back(graph.node(input_id)->output(0)->desc().shape);
+        }
+        _reshape_states.emplace(graph.id(), std::move(state));
+    }
+
+    // Register graph
+    _workloads.insert(std::make_pair(graph.id(), std::move(workload)));
+    ARM_COMPUTE_LOG_GRAPH_VERBOSE("Created workload for graph with ID : " << graph.id() << std::endl);
+
+    ARM_COMPUTE_UNUSED(start);
+    ARM_COMPUTE_LOG_GRAPH_INFO("Finalized graph with ID : " << graph.id() << " in "
+                               << (std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count()) << " ms"
+                               << (ctx.plan().is_loaded() ? " from its plan" : "") << std::endl);
+}
+
+ExecutionWorkload GraphManager::configure_workload(Graph &graph, GraphContext &ctx, Target target, bool setup_constants)
+{
     // Perform topological sort
     std::vector<NodeID> topological_sorted_nodes = dfs(graph);
 
@@ -84,15 +220,40 @@ void GraphManager::finalize_graph(Graph &graph, GraphContext &ctx, PassManager &
     auto workload = detail::configure_all_nodes(graph, ctx, topological_sorted_nodes);
     ARM_COMPUTE_ERROR_ON_MSG(workload.tasks.empty(), "Could not configure all nodes!");
 
-    // Allocate const tensors and call accessors
-    detail::allocate_const_tensors(graph);
-    detail::call_all_const_node_accessors(graph);
+    // Cut the graph in pipeline stages or group independent tasks to run them concurrently
+    if(target == Target::NEON && ctx.config().num_pipeline_stages > 1)
+    {
+        detail::configure_pipeline_stages(workload, ctx.config().num_pipeline_stages);
+    }
+    else if(target == Target::NEON && ctx.config().num_parallel_branches > 1)
+    {
+        detail::configure_parallel_execution(workload, ctx.config().num_parallel_branches);
+    }
+
+    if(setup_constants)
+    {
+        // Allocate const tensors and call accessors
+        detail::allocate_const_tensors(graph);
+        detail::call_all_const_node_accessors(graph);
+    }
+    else
+    {
+        // The constants have already been marked as unused by the functions configured for the previous shapes
+        for(auto &tensor : graph.tensors())
+        {
+            if(tensor != nullptr && tensor->handle() != nullptr && is_const_tensor(graph, *tensor))
+            {
+                tensor->handle()->tensor().mark_as_used();
+            }
+        }
+    }
 
     // Prepare graph
     detail::prepare_all_tasks(workload);
 
     // Setup tensor memory (Allocate all tensors or setup transition manager)
-    if(ctx.config().use_transition_memory_manager)
+    // Pipeline stages process different frames at the same time, so they can't share the transition buffers
+    if(ctx.config().use_transition_memory_manager && workload.pipeline_stages.empty())
     {
         detail::configure_transition_manager(graph, ctx, workload);
     }
@@ -104,9 +265,7 @@ void GraphManager::finalize_graph(Graph &graph, GraphContext &ctx, PassManager &
     // Finalize Graph context
     ctx.finalize();
 
-    // Register graph
-    _workloads.insert(std::make_pair(graph.id(), std::move(workload)));
-    ARM_COMPUTE_LOG_GRAPH_VERBOSE("Created workload for graph with ID : " << graph.id() << std::endl);
+    return workload;
 }
 
 void GraphManager::execute_graph(Graph &graph)
@@ -115,6 +274,18 @@ void GraphManager::execute_graph(Graph &graph)
     auto it = _workloads.find(graph.id());
     ARM_COMPUTE_ERROR_ON_MSG(it == std::end(_workloads), "Graph is not registered!");
 
+    if(!it->second.pipeline_stages.empty())
+    {
+        detail::execute_pipeline_stages(it->second);
+        return;
+    }
+
+    if(it->second.ctx->config().use_pipelined_execution)
+    {
+        detail::execute_pipelined(it->second);
+        return;
+    }
+
     while(true)
     {
         // Call input accessors
@@ -134,12 +305,265 @@ void GraphManager::execute_graph(Graph &graph)
     }
 }
 
+Status GraphManager::reshape_graph_inputs(Graph &graph, const std::vector<TensorShape> &shapes)
+{
+    auto it = _workloads.find(graph.id());
+    ARM_COMPUTE_ERROR_ON_MSG(it == std::end(_workloads), "Graph is not registered!");
+    auto state_it = _reshape_states.find(graph.id());
+    ARM_COMPUTE_ERROR_ON_MSG(state_it == std::end(_reshape_states), "Input reshaping is not enabled for this graph!");
+    ReshapeState &state = state_it->second;
+
+    const std::vector<NodeID> input_ids = graph.nodes(NodeType::Input);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(shapes.size() != input_ids.size(), "A shape has to be given for each input!");
+    if(shapes == state.input_shapes)
+    {
+        return Status{};
+    }
+
+    std::map<TensorID, TensorDescriptor> current_descs;
+    for(auto &tensor : graph.tensors())
+    {
+        if(tensor != nullptr && !is_const_tensor(graph, *tensor))
+        {
+            current_descs[tensor->id()] = tensor->desc();
+        }
+    }
+
+    auto cached = std::find_if(std::begin(state.cache), std::end(state.cache), [&](const ShapeWorkload & sw)
+    {
+        return sw.input_shapes == shapes;
+    });
+    if(cached == std::end(state.cache))
+    {
+        // Infer the shapes of the tensors again, and check them before the current workload is touched
+        for(size_t i = 0; i < input_ids.size(); ++i)
+        {
+            graph.node(input_ids[i])->output(0)->desc().shape = shapes[i];
+        }
+        for(const auto &node_id : dfs(graph))
+        {
+            INode *node = graph.node(node_id);
+            if(node != nullptr && node->type() != NodeType::Input)
+            {
+                node->forward_descriptors();
+            }
+        }
+
+        const Status status = validate_fixed_shape_nodes(graph, current_descs);
+        if(!bool(status))
+        {
+            for(auto &desc : current_descs)
+            {
+                graph.tensor(desc.first)->desc() = desc.second;
+            }
+            return status;
+        }
+    }
+
+    // Move the current workload and its tensors to the cache
+    ShapeWorkload current;
+    current.input_shapes = state.input_shapes;
+    current.ctx          = std::move(state.active_ctx);
+    current.transforms   = std::move(state.active_transforms);
+    current.workload     = std::move(it->second);
+    current.descs        = std::move(current_descs);
+    for(auto &tensor : graph.tensors())
+    {
+        if(tensor != nullptr && !is_const_tensor(graph, *tensor))
+        {
+            current.handles[tensor->id()] = tensor->extract_handle();
+        }
+    }
+    _workloads.erase(it);
+    state.cache.push_front(std::move(current));
+
+    if(cached != std::end(state.cache))
+    {
+        // Restore the workload configured for these shapes
+        for(auto &handle : cached->handles)
+        {
+            Tensor *tensor = graph.tensor(handle.first);
+            tensor->desc() = cached->descs[handle.first];
+            tensor->set_handle(std::move(handle.second));
+        }
+        state.active_ctx        = std::move(cached->ctx);
+        state.active_transforms = std::move(cached->transforms);
+        _workloads.insert(std::make_pair(graph.id(), std::move(cached->workload)));
+        state.cache.erase(cached);
+        ARM_COMPUTE_LOG_GRAPH_VERBOSE("Restored cached workload for graph with ID : " << graph.id() << std::endl);
+    }
+    else
+    {
+        // The new context shares the weights managers of the one given at finalization, so that the transformed weights are reused
+        auto ctx = support::cpp14::make_unique<GraphContext>();
+        ctx->set_config(state.ctx->config());
+        for(auto &wm_ctx : state.ctx->weights_managers())
+        {
+            ctx->insert_weights_management_ctx(WeightsManagerContext(wm_ctx.second));
+        }
+        setup_requested_backend_context(*ctx, state.target);
+
+        detail::configure_all_tensors(graph);
+        state.pm->run_type(graph, IGraphMutator::MutationType::Backend);
+
+        // Record the transforms acquired by the new functions, to know which evicted functions own weights they use
+        for(auto &wm_ctx : ctx->weights_managers())
+        {
+            wm_ctx.second.wm->take_acquired_transforms();
+        }
+        _workloads.insert(std::make_pair(graph.id(), configure_workload(graph, *ctx, state.target, false)));
+        state.active_transforms = TransformUsage();
+        for(auto &wm_ctx : ctx->weights_managers())
+        {
+            for(const auto &acquired : wm_ctx.second.wm->take_acquired_transforms())
+            {
+                auto &transforms = acquired.is_owner ? state.active_transforms.owned : state.active_transforms.used;
+                transforms.push_back(acquired.transform);
+            }
+        }
+        state.active_ctx = std::move(ctx);
+        ARM_COMPUTE_LOG_GRAPH_VERBOSE("Created workload for new input shapes of graph with ID : " << graph.id() << std::endl);
+    }
+    state.input_shapes = shapes;
+
+    // Evict the least recently used workloads, apart from the one created at finalization
+    while(state.cache.size() > state.ctx->config().input_shape_cache_size)
+    {
+        auto evicted = std::find_if(state.cache.rbegin(), state.cache.rend(), [](const ShapeWorkload & sw)
+        {
+            return sw.ctx != nullptr;
+        });
+        if(evicted == state.cache.rend())
+        {
+            break;
+        }
+
+        // The functions may own weights used by other workloads through the weights manager, so they are retired and only their memory is released
+        for(auto &mm_ctx : evicted->ctx->memory_managers())
+        {
+            if(mm_ctx.second.intra_mm != nullptr)
+            {
+                mm_ctx.second.intra_mm->clear();
+            }
+            if(mm_ctx.second.cross_mm != nullptr)
+            {
+                mm_ctx.second.cross_mm->clear();
+            }
+        }
+        RetiredWorkload retired;
+        retired.owned_transforms = std::move(evicted->transforms.owned);
+        retired.tasks            = std::move(evicted->workload.tasks);
+        state.retired.push_back(std::move(retired));
+        state.cache.erase(std::next(evicted).base());
+    }
+
+    // Destroy the retired functions whose transformed weights are not used by the remaining workloads anymore
+    std::set<ITransformWeights *> used_transforms(std::begin(state.active_transforms.used), std::end(state.active_transforms.used));
+    for(const auto &sw : state.cache)
+    {
+        used_transforms.insert(std::begin(sw.transforms.used), std::end(sw.transforms.used));
+    }
+    for(auto retired = std::begin(state.retired); retired != std::end(state.retired);)
+    {
+        const bool is_used = std::any_of(std::begin(retired->owned_transforms), std::end(retired->owned_transforms), [&](ITransformWeights * transform)
+        {
+            return used_transforms.count(transform) != 0;
+        });
+        if(is_used)
+        {
+            ++retired;
+            continue;
+        }
+
+        for(auto &transform : retired->owned_transforms)
+        {
+            for(auto &wm_ctx : state.ctx->weights_managers())
+            {
+                wm_ctx.second.wm->release_transform(transform);
+            }
+        }
+        retired = state.retired.erase(retired);
+    }
+
+    return Status{};
+}
+
+Status GraphManager::set_graph_batch_size(Graph &graph, unsigned int batch_size)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(_workloads.find(graph.id()) == std::end(_workloads), "Graph is not registered!");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(batch_size == 0, "The batch size can't be 0!");
+
+    // Tensors exchanged through the input and output accessors
+    std::vector<Tensor *> io_tensors;
+    for(const auto &input_id : graph.nodes(NodeType::Input))
+    {
+        io_tensors.push_back(graph.node(input_id)->output(0));
+    }
+    const size_t num_inputs = io_tensors.size();
+    for(const auto &output_id : graph.nodes(NodeType::Output))
+    {
+        io_tensors.push_back(graph.node(output_id)->input(0));
+    }
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(num_inputs == 0, "The graph has no inputs!");
+    for(auto *io_tensor : io_tensors)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON(io_tensor == nullptr || io_tensor->handle() == nullptr);
+    }
+
+    // The batches are the outermost dimension: it is the batch dimension of the layout, unless the tensor has been flattened (e.g. by a fully connected layer)
+    const TensorDescriptor &first_input = io_tensors[0]->desc();
+    const size_t            max_batches = first_input.shape[get_dimension_idx(first_input.layout, DataLayoutDimension::BATCHES)];
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(batch_size > max_batches, "The batch size is greater than the one the graph was configured with!");
+
+    std::vector<size_t> batch_dims;
+    for(size_t i = 0; i < io_tensors.size(); ++i)
+    {
+        const TensorDescriptor &desc      = io_tensors[i]->desc();
+        size_t                  batch_idx = get_dimension_idx(desc.layout, DataLayoutDimension::BATCHES);
+        if(i >= num_inputs && desc.shape[batch_idx] != max_batches)
+        {
+            batch_idx = std::max<size_t>(desc.shape.num_dimensions(), 1) - 1;
+        }
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(desc.shape[batch_idx] != max_batches, "All the inputs and outputs need the same number of batches!");
+        batch_dims.push_back(batch_idx);
+    }
+
+    // Only the valid region of the tensors changes: the functions stay configured for all the batches
+    for(size_t i = 0; i < io_tensors.size(); ++i)
+    {
+        ITensorInfo *info         = io_tensors[i]->handle()->tensor().info();
+        ValidRegion  valid_region = info->valid_region();
+        valid_region.set(batch_dims[i], 0, batch_size);
+        info->set_valid_region(valid_region);
+    }
+
+    return Status{};
+}
+
+void GraphManager::print_profile_csv(Graph &graph, std::ostream &os)
+{
+    auto it = _workloads.find(graph.id());
+    ARM_COMPUTE_ERROR_ON_MSG(it == std::end(_workloads), "Graph is not registered!");
+
+    graph::print_profile_csv(it->second, os);
+}
+
+void GraphManager::print_profile_dot(Graph &graph, std::ostream &os)
+{
+    auto it = _workloads.find(graph.id());
+    ARM_COMPUTE_ERROR_ON_MSG(it == std::end(_workloads), "Graph is not registered!");
+
+    DotGraphPrinter printer(get_profile_annotations(it->second));
+    printer.print(graph, os);
+}
+
 void GraphManager::invalidate_graph(Graph &graph)
 {
     auto it = _workloads.find(graph.id());
     ARM_COMPUTE_ERROR_ON_MSG(it == std::end(_workloads), "Graph is not registered!");
 
     _workloads.erase(it);
+    _reshape_states.erase(graph.id());
 }
 } // namespace graph
 } // namespace arm_compute
\ No newline at end of file
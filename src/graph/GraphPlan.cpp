@@ -0,0 +1,606 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/GraphPlan.h"
+
+#include "arm_compute/core/Version.h"
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/INode.h"
+#include "arm_compute/graph/Logger.h"
+#include "arm_compute/graph/Tensor.h"
+#include "arm_compute/graph/TypePrinter.h"
+#include "arm_compute/graph/nodes/Nodes.h"
+
+#include "support/Cast.h"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <sstream>
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace
+{
+constexpr char     plan_magic[]   = "ACLGRAPHPLAN";
+constexpr uint32_t plan_version   = 3;
+constexpr size_t   plan_magic_len = sizeof(plan_magic) - 1;
+
+/** Writes a value in the native representation */
+template <typename T>
+void write_value(std::ofstream &fs, const T &value)
+{
+    fs.write(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+
+/** Reads a value in the native representation, returns false on failure */
+template <typename T>
+bool read_value(std::ifstream &fs, T &value)
+{
+    return static_cast<bool>(fs.read(reinterpret_cast<char *>(&value), sizeof(T)));
+}
+
+/** Reads a sequence of bytes preceded by its size, returns false on failure or if the size goes past the end of the file */
+template <typename T>
+bool read_bytes(std::ifstream &fs, T &bytes, uint64_t file_size)
+{
+    uint64_t size = 0;
+    if(!read_value(fs, size))
+    {
+        return false;
+    }
+    const std::streamoff position = fs.tellg();
+    if(position < 0 || size > file_size - static_cast<uint64_t>(position))
+    {
+        return false;
+    }
+    bytes.resize(size);
+    return size == 0 || static_cast<bool>(fs.read(reinterpret_cast<char *>(&bytes[0]), size));
+}
+
+/** Writes every field of an activation, as the type printer only gives its function */
+void describe_activation(std::ostream &os, const ActivationLayerInfo &info)
+{
+    os << " act:";
+    if(info.enabled())
+    {
+        os << static_cast<int>(info.activation()) << "," << info.a() << "," << info.b();
+    }
+    else
+    {
+        os << "none";
+    }
+}
+
+/** Writes every field of a pad and stride information, as the type printer skips the rounding */
+void describe_pad_stride(std::ostream &os, const PadStrideInfo &info)
+{
+    os << " conv:" << info.stride().first << "," << info.stride().second << "," << info.pad_left() << "," << info.pad_right() << ","
+       << info.pad_top() << "," << info.pad_bottom() << "," << static_cast<int>(info.round());
+}
+
+/** Writes every scale and offset of a quantization information, as the type printer only gives the first ones */
+void describe_quantization(std::ostream &os, const QuantizationInfo &info)
+{
+    os << "q:";
+    for(const auto &scale : info.scale())
+    {
+        os << scale << ";";
+    }
+    os << "/";
+    for(const auto &offset : info.offset())
+    {
+        os << offset << ";";
+    }
+}
+
+/** Writes the coordinates of a slice */
+template <typename T>
+void describe_dimensions(std::ostream &os, const T &dims)
+{
+    for(size_t d = 0; d < dims.num_dimensions(); ++d)
+    {
+        os << (d == 0 ? "" : "x") << dims[d];
+    }
+}
+
+/** Writes the parameters of a node, which change its output without changing its output descriptor */
+void describe_parameters(std::ostream &os, const INode &node)
+{
+    using arm_compute::utils::cast::polymorphic_downcast;
+
+    switch(node.type())
+    {
+        case NodeType::ActivationLayer:
+            describe_activation(os, polymorphic_downcast<const ActivationLayerNode *>(&node)->activation_info());
+            break;
+        case NodeType::ArgMinMaxLayer:
+        {
+            const auto *n = polymorphic_downcast<const ArgMinMaxLayerNode *>(&node);
+            os << " op:" << static_cast<int>(n->reduction_operation()) << " axis:" << n->axis();
+            break;
+        }
+        case NodeType::BatchNormalizationLayer:
+        {
+            const auto *n = polymorphic_downcast<const BatchNormalizationLayerNode *>(&node);
+            os << " eps:" << n->epsilon();
+            describe_activation(os, n->fused_activation());
+            break;
+        }
+        case NodeType::BoundingBoxTransformLayer:
+        {
+            const BoundingBoxTransformInfo &info = polymorphic_downcast<const BoundingBoxTransformLayerNode *>(&node)->info();
+            os << " bbox:" << info.img_width() << "," << info.img_height() << "," << info.scale() << "," << info.apply_scale() << "," << info.correct_transform_coords()
+               << "," << info.bbox_xform_clip();
+            for(const auto &weight : info.weights())
+            {
+                os << "," << weight;
+            }
+            break;
+        }
+        case NodeType::ChannelShuffleLayer:
+            os << " groups:" << polymorphic_downcast<const ChannelShuffleLayerNode *>(&node)->num_groups();
+            break;
+        case NodeType::ConcatenateLayer:
+        {
+            const auto *n = polymorphic_downcast<const ConcatenateLayerNode *>(&node);
+            os << " enabled:" << n->is_enabled() << " axis:" << static_cast<int>(n->concatenation_axis()) << " ";
+            describe_quantization(os, n->output_quantization_info());
+            break;
+        }
+        case NodeType::ConvolutionLayer:
+        {
+            const auto *n = polymorphic_downcast<const ConvolutionLayerNode *>(&node);
+            os << " method:" << static_cast<int>(n->convolution_method()) << " fast_math:" << static_cast<int>(n->fast_math_hint()) << " groups:" << n->num_groups();
+            describe_pad_stride(os, n->convolution_info());
+            describe_activation(os, n->fused_activation());
+            break;
+        }
+        case NodeType::DeconvolutionLayer:
+            describe_pad_stride(os, polymorphic_downcast<const DeconvolutionLayerNode *>(&node)->deconvolution_info());
+            break;
+        case NodeType::DepthToSpaceLayer:
+            os << " block:" << polymorphic_downcast<const DepthToSpaceLayerNode *>(&node)->block_shape();
+            break;
+        case NodeType::DepthwiseConvolutionLayer:
+        {
+            const auto *n = polymorphic_downcast<const DepthwiseConvolutionLayerNode *>(&node);
+            os << " method:" << static_cast<int>(n->depthwise_convolution_method()) << " multiplier:" << n->depth_multiplier();
+            describe_pad_stride(os, n->convolution_info());
+            describe_activation(os, n->fused_activation());
+            break;
+        }
+        case NodeType::DepthwiseSeparableConvolutionLayer:
+        {
+            const auto *n = polymorphic_downcast<const DepthwiseSeparableConvolutionLayerNode *>(&node);
+            os << " multiplier:" << n->depth_multiplier();
+            describe_pad_stride(os, n->depthwise_convolution_info());
+            os << " ";
+            describe_quantization(os, n->depthwise_output_quant_info());
+            describe_activation(os, n->depthwise_fused_activation());
+            describe_activation(os, n->fused_activation());
+            break;
+        }
+        case NodeType::DetectionOutputLayer:
+            os << " " << polymorphic_downcast<const DetectionOutputLayerNode *>(&node)->detection_output_info();
+            break;
+        case NodeType::DetectionPostProcessLayer:
+            os << " " << polymorphic_downcast<const DetectionPostProcessLayerNode *>(&node)->detection_post_process_info();
+            break;
+        case NodeType::EltwiseLayer:
+        {
+            const auto *n = polymorphic_downcast<const EltwiseLayerNode *>(&node);
+            os << " op:" << static_cast<int>(n->eltwise_operation()) << " policy:" << static_cast<int>(n->convert_policy()) << "," << static_cast<int>(n->rounding_policy()) << " ";
+            describe_quantization(os, n->output_quant_info());
+            describe_activation(os, n->fused_activation());
+            break;
+        }
+        case NodeType::FullyConnectedLayer:
+        {
+            const FullyConnectedLayerInfo info = polymorphic_downcast<const FullyConnectedLayerNode *>(&node)->info();
+            os << " fc:" << static_cast<int>(info.weights_trained_layout) << "," << info.transpose_weights << "," << info.are_weights_reshaped << "," << info.retain_internal_weights
+               << "," << info.fp_mixed_precision << "," << info.enable_dynamic_quantization << "," << info.sparse_weights;
+            describe_activation(os, info.activation_info);
+            break;
+        }
+        case NodeType::FusedConvolutionBatchNormalizationLayer:
+        {
+            const auto *n = polymorphic_downcast<const FusedConvolutionBatchNormalizationNode *>(&node);
+            os << " method:" << static_cast<int>(n->convolution_method()) << " fast_math:" << static_cast<int>(n->fast_math_hint()) << " groups:" << n->num_groups() << " eps:" << n->epsilon();
+            describe_pad_stride(os, n->convolution_info());
+            describe_activation(os, n->fused_activation());
+            break;
+        }
+        case NodeType::FusedDepthwiseConvolutionBatchNormalizationLayer:
+        {
+            const auto *n = polymorphic_downcast<const FusedDepthwiseConvolutionBatchNormalizationNode *>(&node);
+            os << " method:" << static_cast<int>(n->depthwise_convolution_method()) << " multiplier:" << n->depth_multiplier() << " eps:" << n->epsilon();
+            describe_pad_stride(os, n->convolution_info());
+            describe_activation(os, n->fused_activation());
+            break;
+        }
+        case NodeType::GenerateProposalsLayer:
+        {
+            const GenerateProposalsInfo &info = polymorphic_downcast<const GenerateProposalsLayerNode *>(&node)->info();
+            os << " proposals:" << info.im_width() << "," << info.im_height() << "," << info.im_scale() << "," << info.spatial_scale() << "," << info.pre_nms_topN() << ","
+               << info.post_nms_topN() << "," << info.nms_thres() << "," << info.min_size() << "," << info.values_per_roi();
+            break;
+        }
+        case NodeType::L2NormalizeLayer:
+        {
+            const auto *n = polymorphic_downcast<const L2NormalizeLayerNode *>(&node);
+            os << " axis:" << n->axis() << " eps:" << n->epsilon();
+            break;
+        }
+        case NodeType::NormalizationLayer:
+        {
+            const NormalizationLayerInfo info = polymorphic_downcast<const NormalizationLayerNode *>(&node)->normalization_info();
+            os << " norm:" << static_cast<int>(info.type()) << "," << info.norm_size() << "," << info.alpha() << "," << info.beta() << "," << info.kappa() << "," << info.is_scaled();
+            break;
+        }
+        case NodeType::PadLayer:
+        {
+            const auto *n = polymorphic_downcast<const PadLayerNode *>(&node);
+            os << " pad:";
+            for(const auto &padding : n->padding())
+            {
+                os << padding.first << "," << padding.second << ";";
+            }
+            os << n->pad_value().get<uint64_t>();
+            break;
+        }
+        case NodeType::PermuteLayer:
+            os << " perm:";
+            describe_dimensions(os, polymorphic_downcast<const PermuteLayerNode *>(&node)->permutation_vector());
+            break;
+        case NodeType::PoolingLayer:
+        {
+            const PoolingLayerInfo info = polymorphic_downcast<const PoolingLayerNode *>(&node)->pooling_info();
+            os << " pool:" << static_cast<int>(info.pool_type) << "," << info.pool_size.width << "," << info.pool_size.height << "," << static_cast<int>(info.data_layout) << ","
+               << info.exclude_padding << "," << info.is_global_pooling << "," << info.fp_mixed_precision;
+            describe_pad_stride(os, info.pad_stride_info);
+            break;
+        }
+        case NodeType::PriorBoxLayer:
+            os << " " << polymorphic_downcast<const PriorBoxLayerNode *>(&node)->priorbox_info();
+            break;
+        case NodeType::ReductionOperationLayer:
+        {
+            const auto *n = polymorphic_downcast<const ReductionLayerNode *>(&node);
+            os << " op:" << static_cast<int>(n->op()) << " axis:" << n->axis() << " keep_dims:" << n->keep_dims();
+            break;
+        }
+        case NodeType::ReorgLayer:
+            os << " stride:" << polymorphic_downcast<const ReorgLayerNode *>(&node)->stride();
+            break;
+        case NodeType::ResizeLayer:
+        {
+            const auto *n = polymorphic_downcast<const ResizeLayerNode *>(&node);
+            os << " resize:" << static_cast<int>(n->policy()) << "," << n->scaling_factor().first << "," << n->scaling_factor().second;
+            break;
+        }
+        case NodeType::ROIAlignLayer:
+        {
+            const ROIPoolingLayerInfo &info = polymorphic_downcast<const ROIAlignLayerNode *>(&node)->pooling_info();
+            os << " roi:" << info.pooled_width() << "," << info.pooled_height() << "," << info.spatial_scale() << "," << info.sampling_ratio();
+            break;
+        }
+        case NodeType::SliceLayer:
+        {
+            const auto *n = polymorphic_downcast<const SliceLayerNode *>(&node);
+            os << " starts:";
+            describe_dimensions(os, n->starts());
+            os << " ends:";
+            describe_dimensions(os, n->ends());
+            break;
+        }
+        case NodeType::SoftmaxLayer:
+            os << " beta:" << polymorphic_downcast<const SoftmaxLayerNode *>(&node)->beta();
+            break;
+        case NodeType::SplitLayer:
+        {
+            const auto *n = polymorphic_downcast<const SplitLayerNode *>(&node);
+            os << " splits:" << n->num_splits() << " axis:" << n->axis();
+            break;
+        }
+        case NodeType::StackLayer:
+            os << " axis:" << polymorphic_downcast<const StackLayerNode *>(&node)->axis();
+            break;
+        case NodeType::StridedSliceLayer:
+        {
+            const auto                 *n    = polymorphic_downcast<const StridedSliceLayerNode *>(&node);
+            const StridedSliceLayerInfo info = n->strided_slice_info();
+            os << " starts:";
+            describe_dimensions(os, n->starts());
+            os << " ends:";
+            describe_dimensions(os, n->ends());
+            os << " strides:";
+            describe_dimensions(os, n->strides());
+            os << " masks:" << info.begin_mask() << "," << info.end_mask() << "," << info.shrink_axis_mask();
+            break;
+        }
+        case NodeType::UnaryEltwiseLayer:
+        {
+            const descriptors::UnaryEltwiseLayerDescriptor desc = polymorphic_downcast<const UnaryEltwiseLayerNode *>(&node)->eltwise_descriptor();
+            os << " op:" << static_cast<int>(desc.op) << " policy:" << static_cast<int>(desc.c_policy) << "," << static_cast<int>(desc.r_policy) << " ";
+            describe_quantization(os, desc.out_quant_info);
+            break;
+        }
+        case NodeType::UpsampleLayer:
+        {
+            const auto *n = polymorphic_downcast<const UpsampleLayerNode *>(&node);
+            os << " upsample:" << n->info().width << "," << n->info().height << "," << static_cast<int>(n->upsampling_policy());
+            break;
+        }
+        case NodeType::YOLOLayer:
+        {
+            const auto *n = polymorphic_downcast<const YOLOLayerNode *>(&node);
+            os << " classes:" << n->num_classes();
+            describe_activation(os, n->activation_info());
+            break;
+        }
+        default:
+            // The other nodes have no parameters besides their output descriptor
+            break;
+    }
+}
+} // namespace
+
+uint64_t GraphPlan::fingerprint(const Graph &g, Target target, const GraphConfig &config)
+{
+    std::stringstream ss;
+    // The library build is part of the fingerprint, as the passes and the folded functions may give other results
+    ss << plan_version << " " << build_information() << " " << target << " " << config.convert_to_uint8 << " " << config.input_shape_cache_size << "\n";
+    ss << describe(g);
+
+    const std::string description = ss.str();
+    return hash_bytes(reinterpret_cast<const uint8_t *>(description.data()), description.size());
+}
+
+uint64_t GraphPlan::hash_bytes(const uint8_t *bytes, size_t size, uint64_t seed)
+{
+    // FNV-1a hash
+    uint64_t hash = seed;
+    for(size_t i = 0; i < size; ++i)
+    {
+        hash ^= bytes[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+std::string GraphPlan::describe(const Graph &g)
+{
+    std::stringstream ss;
+    // Write the floats with enough digits to tell them apart
+    ss.precision(std::numeric_limits<float>::max_digits10);
+    for(const auto &node : g.nodes())
+    {
+        if(node == nullptr)
+        {
+            continue;
+        }
+
+        ss << node->id() << " " << node->type() << " " << node->name();
+        describe_parameters(ss, *node);
+        for(unsigned int i = 0; i < node->num_inputs(); ++i)
+        {
+            const Edge *input_edge = node->input_edge(i);
+            if(input_edge != nullptr)
+            {
+                ss << " in:" << input_edge->producer_id() << "." << input_edge->producer_idx();
+            }
+        }
+        for(unsigned int i = 0; i < node->num_outputs(); ++i)
+        {
+            const Tensor *output = node->output(i);
+            if(output != nullptr)
+            {
+                const TensorDescriptor &desc = output->desc();
+                ss << " out:" << desc.shape << "," << desc.data_type << "," << desc.layout << ",";
+                describe_quantization(ss, desc.quant_info);
+            }
+        }
+        ss << "\n";
+    }
+    return ss.str();
+}
+
+bool GraphPlan::load(const std::string &filename, uint64_t fingerprint)
+{
+    reset(fingerprint);
+
+    std::ifstream fs(filename, std::ios::in | std::ios::binary);
+    if(!fs.is_open())
+    {
+        return false;
+    }
+    fs.seekg(0, std::ios::end);
+    const std::streamoff file_size = fs.tellg();
+    fs.seekg(0, std::ios::beg);
+    if(file_size < 0)
+    {
+        return false;
+    }
+
+    char     magic[plan_magic_len] = {};
+    uint32_t version               = 0;
+    uint64_t file_fingerprint      = 0;
+    if(!fs.read(magic, plan_magic_len) || std::memcmp(magic, plan_magic, plan_magic_len) != 0 || !read_value(fs, version) || version != plan_version)
+    {
+        ARM_COMPUTE_LOG_GRAPH_WARNING("Ignoring invalid graph plan file " << filename << std::endl);
+        return false;
+    }
+    if(!read_value(fs, file_fingerprint) || file_fingerprint != fingerprint)
+    {
+        ARM_COMPUTE_LOG_GRAPH_INFO("Ignoring the graph plan file " << filename << " recorded for another graph" << std::endl);
+        return false;
+    }
+
+    std::string ir;
+    uint64_t    num_folded_constants = 0;
+    if(!read_bytes(fs, ir, file_size) || !read_value(fs, num_folded_constants))
+    {
+        ARM_COMPUTE_LOG_GRAPH_WARNING("Ignoring truncated graph plan file " << filename << std::endl);
+        return false;
+    }
+    for(uint64_t i = 0; i < num_folded_constants; ++i)
+    {
+        uint32_t       id = 0;
+        FoldedConstant folded;
+        if(!read_value(fs, id) || !read_value(fs, folded.inputs_hash) || !read_bytes(fs, folded.data, file_size))
+        {
+            ARM_COMPUTE_LOG_GRAPH_WARNING("Ignoring truncated graph plan file " << filename << std::endl);
+            reset(fingerprint);
+            return false;
+        }
+        _folded_constants.emplace(id, std::move(folded));
+    }
+    uint64_t num_convolution_methods = 0;
+    if(!read_value(fs, num_convolution_methods))
+    {
+        ARM_COMPUTE_LOG_GRAPH_WARNING("Ignoring truncated graph plan file " << filename << std::endl);
+        reset(fingerprint);
+        return false;
+    }
+    for(uint64_t i = 0; i < num_convolution_methods; ++i)
+    {
+        uint32_t id     = 0;
+        uint32_t method = 0;
+        if(!read_value(fs, id) || !read_value(fs, method) || method > static_cast<uint32_t>(ConvolutionMethod::Winograd))
+        {
+            ARM_COMPUTE_LOG_GRAPH_WARNING("Ignoring truncated graph plan file " << filename << std::endl);
+            reset(fingerprint);
+            return false;
+        }
+        _convolution_methods.emplace(id, static_cast<ConvolutionMethod>(method));
+    }
+
+    _ir        = std::move(ir);
+    _is_loaded = true;
+    return true;
+}
+
+void GraphPlan::save(const std::string &filename) const
+{
+    // The plan is written next to the file and moved in place once complete, so that an interrupted save doesn't leave a partial plan
+    const std::string tmp_filename = filename + ".tmp";
+    std::ofstream     fs(tmp_filename, std::ios::out | std::ios::binary | std::ios::trunc);
+    if(!fs.is_open())
+    {
+        ARM_COMPUTE_LOG_GRAPH_WARNING("Couldn't open " << tmp_filename << " to save the graph plan" << std::endl);
+        return;
+    }
+
+    fs.write(plan_magic, plan_magic_len);
+    write_value(fs, plan_version);
+    write_value(fs, _fingerprint);
+    write_value(fs, static_cast<uint64_t>(_ir.size()));
+    fs.write(_ir.data(), _ir.size());
+    write_value(fs, static_cast<uint64_t>(_folded_constants.size()));
+    for(const auto &folded_constant : _folded_constants)
+    {
+        write_value(fs, static_cast<uint32_t>(folded_constant.first));
+        write_value(fs, folded_constant.second.inputs_hash);
+        write_value(fs, static_cast<uint64_t>(folded_constant.second.data.size()));
+        fs.write(reinterpret_cast<const char *>(folded_constant.second.data.data()), folded_constant.second.data.size());
+    }
+    write_value(fs, static_cast<uint64_t>(_convolution_methods.size()));
+    for(const auto &convolution_method : _convolution_methods)
+    {
+        write_value(fs, static_cast<uint32_t>(convolution_method.first));
+        write_value(fs, static_cast<uint32_t>(convolution_method.second));
+    }
+
+    fs.close();
+    if(fs.fail() || std::rename(tmp_filename.c_str(), filename.c_str()) != 0)
+    {
+        ARM_COMPUTE_LOG_GRAPH_WARNING("Couldn't save the graph plan to " << filename << std::endl);
+        std::remove(tmp_filename.c_str());
+    }
+}
+
+void GraphPlan::reset(uint64_t fingerprint)
+{
+    _fingerprint = fingerprint;
+    _is_loaded   = false;
+    _is_modified = false;
+    _ir.clear();
+    _folded_constants.clear();
+    _convolution_methods.clear();
+}
+
+bool GraphPlan::is_loaded() const
+{
+    return _is_loaded;
+}
+
+bool GraphPlan::is_modified() const
+{
+    return _is_modified;
+}
+
+const std::string &GraphPlan::ir() const
+{
+    return _ir;
+}
+
+void GraphPlan::set_ir(std::string ir)
+{
+    _ir = std::move(ir);
+    _convolution_methods.clear();
+}
+
+const std::map<NodeID, ConvolutionMethod> &GraphPlan::convolution_methods() const
+{
+    return _convolution_methods;
+}
+
+void GraphPlan::add_convolution_method(NodeID id, ConvolutionMethod method)
+{
+    _convolution_methods[id] = method;
+}
+
+const GraphPlan::FoldedConstant *GraphPlan::folded_constant(NodeID id) const
+{
+    auto it = _folded_constants.find(id);
+    return (it != std::end(_folded_constants)) ? &it->second : nullptr;
+}
+
+void GraphPlan::add_folded_constant(NodeID id, uint64_t inputs_hash, std::vector<uint8_t> data)
+{
+    FoldedConstant &folded = _folded_constants[id];
+    folded.inputs_hash     = inputs_hash;
+    folded.data            = std::move(data);
+    _is_modified           = true;
+}
+
+void GraphPlan::release_folded_constants()
+{
+    _folded_constants.clear();
+}
+} // namespace graph
+} // namespace arm_compute
@@ -57,6 +57,11 @@ ITensorHandle *Tensor::handle()
     return _handle.get();
 }
 
+std::unique_ptr<ITensorHandle> Tensor::extract_handle()
+{
+    return std::move(_handle);
+}
+
 void Tensor::set_accessor(std::unique_ptr<ITensorAccessor> accessor)
 {
     _accessor = std::move(accessor);
@@ -74,7 +74,7 @@ void force_target_to_graph(Graph &g, Target target)
     }
 }
 
-PassManager create_default_pass_manager(Target target, const GraphConfig &cfg)
+PassManager create_default_pass_manager(Target target, const GraphConfig &cfg, GraphPlan *plan)
 {
     PassManager pm;
 
@@ -85,7 +85,10 @@ PassManager create_default_pass_manager(Target target, const GraphConfig &cfg)
     {
         pm.append(support::cpp14::make_unique<SyntheticDataTypeMutator>(), !is_target_gc);
     }
-    pm.append(support::cpp14::make_unique<NodeFusionMutator>(), !is_target_gc);
+    pm.append(support::cpp14::make_unique<DeadCodeEliminationMutator>());
+    pm.append(support::cpp14::make_unique<PermuteEliminationMutator>(target));
+    pm.append(support::cpp14::make_unique<ConstantFoldingMutator>(cfg.input_shape_cache_size == 0, plan), !is_target_gc);
+    pm.append(support::cpp14::make_unique<NodeFusionMutator>(cfg.fuse_depthwise_separable), !is_target_gc);
     pm.append(support::cpp14::make_unique<GroupedConvolutionMutator>());
     pm.append(support::cpp14::make_unique<InPlaceOperationMutator>(), !is_target_gc);
 
@@ -25,18 +25,88 @@
 
 #include "arm_compute/graph/INode.h"
 #include "arm_compute/graph/ITensorHandle.h"
+#include "arm_compute/graph/TypePrinter.h"
+#include "arm_compute/graph/Utils.h"
+#include "arm_compute/graph/backends/BackendRegistry.h"
+#include "arm_compute/graph/nodes/NormalizationLayerNode.h"
+#include "arm_compute/graph/nodes/PoolingLayerNode.h"
 #include "arm_compute/graph/nodes/PrintLayerNode.h"
 
+#include "support/Cast.h"
+
+#include <algorithm>
+#include <chrono>
+#include <sstream>
+
 namespace arm_compute
 {
 namespace graph
 {
-void ExecutionTask::operator()()
+namespace
 {
-    TaskExecutor::get().execute_function(*this);
+/** Size in bytes of the tensor described by a descriptor */
+uint64_t tensor_bytes(const TensorDescriptor &desc)
+{
+    return desc.shape.total_size() * data_size_from_type(desc.data_type);
 }
 
-void execute_task(ExecutionTask &task)
+/** Throughputs and roofline position of a measured task */
+struct ProfileSummary
+{
+    double      average_time_us{ 0 }; /**< Average execution time in microseconds */
+    double      gflops{ 0 };          /**< Achieved GFLOP/s */
+    double      gbytes{ 0 };          /**< Achieved GB/s */
+    double      intensity{ 0 };       /**< Arithmetic intensity in FLOPs per byte */
+    std::string bound{};              /**< Roof limiting the task: "compute" or "memory" */
+    double      roof_fraction{ 0 };   /**< Fraction of the attainable throughput achieved by the task */
+};
+
+/** Summarizes the profile of each measured task of a workload, against the best throughputs achieved in the workload */
+std::vector<std::pair<const ExecutionTask *, ProfileSummary>> summarize_profiles(const ExecutionWorkload &workload)
+{
+    std::vector<std::pair<const ExecutionTask *, ProfileSummary>> summaries;
+    double                                                        peak_gflops = 0;
+    double                                                        peak_gbytes = 0;
+    for(const auto &task : workload.tasks)
+    {
+        const TaskProfile *profile = task.profile.get();
+        if(profile == nullptr || profile->num_runs == 0 || profile->total_time_us <= 0)
+        {
+            continue;
+        }
+
+        // FLOPs per microsecond are MFLOP/s
+        ProfileSummary summary;
+        summary.average_time_us = profile->total_time_us / profile->num_runs;
+        summary.gflops          = profile->flops / summary.average_time_us / 1000.0;
+        summary.gbytes          = profile->bytes / summary.average_time_us / 1000.0;
+        summary.intensity       = (profile->bytes > 0) ? static_cast<double>(profile->flops) / profile->bytes : 0;
+        peak_gflops             = std::max(peak_gflops, summary.gflops);
+        peak_gbytes             = std::max(peak_gbytes, summary.gbytes);
+        summaries.emplace_back(&task, summary);
+    }
+
+    // The ridge point is where the memory roof meets the compute roof
+    const double ridge_point = (peak_gbytes > 0) ? peak_gflops / peak_gbytes : 0;
+    for(auto &summary : summaries)
+    {
+        ProfileSummary &s = summary.second;
+        if(s.gflops > 0 && s.intensity >= ridge_point)
+        {
+            s.bound         = "compute";
+            s.roof_fraction = s.gflops / peak_gflops;
+        }
+        else
+        {
+            s.bound         = "memory";
+            s.roof_fraction = (peak_gbytes > 0) ? s.gbytes / peak_gbytes : 0;
+        }
+    }
+    return summaries;
+}
+
+/** Runs a task, or prints the input of a print node */
+void run_task(ExecutionTask &task)
 {
     if(task.task)
     {
@@ -57,6 +127,149 @@ void execute_task(ExecutionTask &task)
     }
 #endif // ARM_COMPUTE_ASSERTS_ENABLED
 }
+} // namespace
+
+void ExecutionTask::operator()()
+{
+    TaskExecutor::get().execute_function(*this);
+}
+
+void execute_task(ExecutionTask &task)
+{
+    if(task.profile == nullptr)
+    {
+        run_task(task);
+        return;
+    }
+
+    // Wait for the asynchronous backends to complete the task before stopping the clock
+    const auto start = std::chrono::steady_clock::now();
+    run_task(task);
+    backends::BackendRegistry::get().get_backend(task.node->assigned_target()).sync();
+    const double time_us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+
+    TaskProfile &profile = *task.profile;
+    profile.min_time_us  = (profile.num_runs == 0) ? time_us : std::min(profile.min_time_us, time_us);
+    profile.total_time_us += time_us;
+    ++profile.num_runs;
+}
+
+TaskProfile compute_node_cost(const INode &node)
+{
+    TaskProfile profile;
+
+    uint64_t output_elements = 0;
+    for(unsigned int i = 0; i < node.num_inputs(); ++i)
+    {
+        if(node.input(i) != nullptr)
+        {
+            profile.bytes += tensor_bytes(node.input(i)->desc());
+        }
+    }
+    for(unsigned int i = 0; i < node.num_outputs(); ++i)
+    {
+        if(node.output(i) != nullptr)
+        {
+            profile.bytes += tensor_bytes(node.output(i)->desc());
+            output_elements += node.output(i)->desc().shape.total_size();
+        }
+    }
+
+    switch(node.type())
+    {
+        case NodeType::ConvolutionLayer:
+        case NodeType::DepthwiseConvolutionLayer:
+        case NodeType::FullyConnectedLayer:
+        case NodeType::FusedConvolutionBatchNormalizationLayer:
+        case NodeType::FusedDepthwiseConvolutionBatchNormalizationLayer:
+        {
+            // Each output element accumulates the products with the weights of its channel
+            const Tensor *weights = node.input(1);
+            const Tensor *output  = node.output(0);
+            if(weights != nullptr && output != nullptr)
+            {
+                const TensorDescriptor &output_desc  = output->desc();
+                const size_t            num_channels = (node.type() == NodeType::FullyConnectedLayer) ? output_desc.shape[0] : get_dimension_size(output_desc, DataLayoutDimension::CHANNEL);
+                profile.flops                        = 2 * output_desc.shape.total_size() * (weights->desc().shape.total_size() / std::max<size_t>(num_channels, 1));
+            }
+            break;
+        }
+        case NodeType::DeconvolutionLayer:
+        {
+            // Each input element is multiplied by the weights of its channel and scattered to the output
+            const Tensor *input   = node.input(0);
+            const Tensor *weights = node.input(1);
+            if(input != nullptr && weights != nullptr)
+            {
+                const TensorDescriptor &input_desc   = input->desc();
+                const size_t            num_channels = get_dimension_size(input_desc, DataLayoutDimension::CHANNEL);
+                profile.flops                        = 2 * input_desc.shape.total_size() * (weights->desc().shape.total_size() / std::max<size_t>(num_channels, 1));
+            }
+            break;
+        }
+        case NodeType::PoolingLayer:
+        {
+            const auto             &pool_node = *arm_compute::utils::cast::polymorphic_downcast<const PoolingLayerNode *>(&node);
+            const PoolingLayerInfo &pool_info = pool_node.pooling_info();
+            const Tensor           *input     = node.input(0);
+            size_t                  pool_area = pool_info.pool_size.area();
+            if(pool_info.is_global_pooling && input != nullptr)
+            {
+                pool_area = get_dimension_size(input->desc(), DataLayoutDimension::WIDTH) * get_dimension_size(input->desc(), DataLayoutDimension::HEIGHT);
+            }
+            profile.flops = output_elements * pool_area;
+            break;
+        }
+        case NodeType::NormalizationLayer:
+        {
+            const auto &norm_node = *arm_compute::utils::cast::polymorphic_downcast<const NormalizationLayerNode *>(&node);
+            profile.flops         = 2 * output_elements * norm_node.normalization_info().norm_size();
+            break;
+        }
+        case NodeType::BatchNormalizationLayer:
+            profile.flops = 2 * output_elements;
+            break;
+        case NodeType::ActivationLayer:
+        case NodeType::EltwiseLayer:
+        case NodeType::UnaryEltwiseLayer:
+        case NodeType::SoftmaxLayer:
+            profile.flops = output_elements;
+            break;
+        default:
+            // Data movement only
+            break;
+    }
+
+    return profile;
+}
+
+void print_profile_csv(const ExecutionWorkload &workload, std::ostream &os)
+{
+    os << "id,name,type,target,runs,average_time_us,min_time_us,flops,bytes,gflops_per_s,gbytes_per_s,flops_per_byte,bound,roof_fraction\n";
+    for(const auto &summary : summarize_profiles(workload))
+    {
+        const INode          &node    = *summary.first->node;
+        const TaskProfile    &profile = *summary.first->profile;
+        const ProfileSummary &s       = summary.second;
+        os << node.id() << "," << node.name() << "," << node.type() << "," << node.assigned_target() << ","
+           << profile.num_runs << "," << s.average_time_us << "," << profile.min_time_us << ","
+           << profile.flops << "," << profile.bytes << "," << s.gflops << "," << s.gbytes << ","
+           << s.intensity << "," << s.bound << "," << s.roof_fraction << "\n";
+    }
+}
+
+std::map<NodeID, std::string> get_profile_annotations(const ExecutionWorkload &workload)
+{
+    std::map<NodeID, std::string> annotations;
+    for(const auto &summary : summarize_profiles(workload))
+    {
+        const ProfileSummary &s = summary.second;
+        std::stringstream     ss;
+        ss << s.average_time_us << " us" << R"( \n )" << s.gflops << " GFLOP/s, " << s.gbytes << " GB/s" << R"( \n )" << s.bound << " bound, " << static_cast<int>(s.roof_fraction * 100) << "% of roof";
+        annotations.emplace(summary.first->node->id(), ss.str());
+    }
+    return annotations;
+}
 
 void ExecutionTask::prepare()
 {
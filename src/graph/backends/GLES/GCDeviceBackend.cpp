@@ -158,6 +158,11 @@ std::shared_ptr<arm_compute::IWeightsManager> GCDeviceBackend::create_weights_ma
 {
     return nullptr;
 }
+
+void GCDeviceBackend::sync()
+{
+    GCScheduler::get().memory_barrier();
+}
 } // namespace backends
 } // namespace graph
 } // namespace arm_compute
@@ -40,26 +40,43 @@
 #include "arm_compute/runtime/IWeightsManager.h"
 #include "arm_compute/runtime/MemoryGroup.h"
 #include "arm_compute/runtime/MemoryManagerOnDemand.h"
+#include "arm_compute/runtime/NEON/functions/NEConvolutionLayer.h"
 #include "arm_compute/runtime/OffsetLifetimeManager.h"
 #include "arm_compute/runtime/PoolManager.h"
 #include "arm_compute/runtime/Scheduler.h"
 
 #include "support/ToolchainSupport.h"
 
+#include <fstream>
+
 namespace arm_compute
 {
 namespace graph
 {
 namespace backends
 {
+namespace
+{
+bool file_exists(const std::string &filename)
+{
+    std::ifstream file(filename);
+    return file.good();
+}
+} // namespace
+
 /** Register NEON backend */
 static detail::BackendRegistrar<NEDeviceBackend> NEDeviceBackend_registrar(Target::NEON);
 
 NEDeviceBackend::NEDeviceBackend()
-    : _allocator()
+    : _allocator(), _conv_method_tuner(), _conv_method_tuner_file()
 {
 }
 
+NEDeviceBackend::~NEDeviceBackend()
+{
+    NEConvolutionLayer::set_tuner(nullptr);
+}
+
 void NEDeviceBackend::initialize_backend()
 {
     //Nothing to do
@@ -79,6 +96,17 @@ void NEDeviceBackend::setup_backend_context(GraphContext &ctx)
         Scheduler::get().set_num_threads(ctx.config().num_threads);
     }
 
+    // Setup the convolution method tuner
+    if(ctx.config().use_conv_method_tuner)
+    {
+        _conv_method_tuner_file = ctx.config().conv_method_tuner_file;
+        if(file_exists(_conv_method_tuner_file))
+        {
+            _conv_method_tuner.load_from_file(_conv_method_tuner_file);
+        }
+        NEConvolutionLayer::set_tuner(&_conv_method_tuner);
+    }
+
     // Create function level memory manager
     if(ctx.memory_management_ctx(Target::NEON) == nullptr)
     {
@@ -142,7 +170,16 @@ std::unique_ptr<arm_compute::IFunction> NEDeviceBackend::configure_node(INode &n
     ARM_COMPUTE_ERROR_ON(node.assigned_target() != Target::NEON);
 
     // Configure node
-    return NEFunctionFactory::create(&node, ctx);
+    const size_t num_tuned_configs = _conv_method_tuner.methods_table().size();
+    auto         func              = NEFunctionFactory::create(&node, ctx);
+
+    // Save the tuner's methods as soon as a new configuration has been measured
+    if(ctx.config().use_conv_method_tuner && !_conv_method_tuner_file.empty() && _conv_method_tuner.methods_table().size() != num_tuned_configs)
+    {
+        _conv_method_tuner.save_to_file(_conv_method_tuner_file);
+    }
+
+    return func;
 }
 
 arm_compute::Status NEDeviceBackend::validate_node(INode &node)
@@ -175,6 +212,11 @@ std::shared_ptr<arm_compute::IWeightsManager> NEDeviceBackend::create_weights_ma
     auto weights_mgr = std::make_shared<IWeightsManager>();
     return weights_mgr;
 }
+
+void NEDeviceBackend::sync()
+{
+    // NEON functions run synchronously
+}
 } // namespace backends
 } // namespace graph
 } // namespace arm_compute
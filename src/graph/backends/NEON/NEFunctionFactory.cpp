@@ -118,6 +118,55 @@ std::unique_ptr<IFunction> create_normalization_layer<NENormalizationLayer, NETa
 
     return RETURN_UNIQUE_PTR(func);
 }
+
+/** Selects the method of a convolution node left to the heuristics, and records it to the plan of the graph
+ *
+ * The next finalizations of the graph set the recorded method to the node, so that they don't run the heuristics again.
+ *
+ * @note The method is left to @ref NEConvolutionLayer when the convolution method tuner is used,
+ *       when the fastest method can't be created by the graph (FFT) or needs fast math (GEMM)
+ *
+ * @param[in, out] node Node to select the method of
+ * @param[in, out] ctx  Graph context
+ */
+void select_convolution_method(ConvolutionLayerNode &node, GraphContext &ctx)
+{
+    if(node.convolution_method() != ConvolutionMethod::Default || node.num_groups() != 1 || ctx.config().use_conv_method_tuner)
+    {
+        return;
+    }
+
+    const ITensor *input   = get_backing_tensor<NETargetInfo>(node.input(0));
+    const ITensor *weights = get_backing_tensor<NETargetInfo>(node.input(1));
+    const ITensor *output  = get_backing_tensor<NETargetInfo>(node.output(0));
+    ARM_COMPUTE_ERROR_ON(input == nullptr || weights == nullptr || output == nullptr);
+
+    const bool        fast_math = node.fast_math_hint() == FastMathHint::Enabled;
+    ConvolutionMethod method    = ConvolutionMethod::Default;
+    switch(NEConvolutionLayer::get_convolution_method(input->info(), weights->info(), output->info(), node.convolution_info(), WeightsInfo(), Size2D(1U, 1U),
+                                                      node.fused_activation(), fast_math))
+    {
+        case arm_compute::ConvolutionMethod::GEMM:
+        case arm_compute::ConvolutionMethod::GEMM_CONV2D:
+            // NEGEMMConvolutionLayer dispatches to NEGEMMConv2d itself
+            method = fast_math ? ConvolutionMethod::Default : ConvolutionMethod::GEMM;
+            break;
+        case arm_compute::ConvolutionMethod::DIRECT:
+            method = ConvolutionMethod::Direct;
+            break;
+        case arm_compute::ConvolutionMethod::WINOGRAD:
+            method = ConvolutionMethod::Winograd;
+            break;
+        default:
+            break;
+    }
+
+    if(method != ConvolutionMethod::Default)
+    {
+        node.set_convolution_method(method);
+        ctx.plan().add_convolution_method(node.id(), method);
+    }
+}
 } // namespace detail
 
 std::unique_ptr<IFunction> NEFunctionFactory::create(INode *node, GraphContext &ctx)
@@ -139,6 +188,7 @@ std::unique_ptr<IFunction> NEFunctionFactory::create(INode *node, GraphContext &
         case NodeType::ChannelShuffleLayer:
             return detail::create_channel_shuffle_layer<NEChannelShuffleLayer, NETargetInfo>(*polymorphic_downcast<ChannelShuffleLayerNode *>(node));
         case NodeType::ConvolutionLayer:
+            detail::select_convolution_method(*polymorphic_downcast<ConvolutionLayerNode *>(node), ctx);
             return detail::create_convolution_layer<NEConvolutionLayerFunctions, NETargetInfo>(*polymorphic_downcast<ConvolutionLayerNode *>(node), ctx);
         case NodeType::DepthToSpaceLayer:
             return detail::create_depth_to_space_layer<NEDepthToSpaceLayer, NETargetInfo>(*polymorphic_downcast<DepthToSpaceLayerNode *>(node));
@@ -148,6 +198,8 @@ std::unique_ptr<IFunction> NEFunctionFactory::create(INode *node, GraphContext &
             return detail::create_concatenate_layer<NEConcatenateLayer, NETargetInfo>(*polymorphic_downcast<ConcatenateLayerNode *>(node));
         case NodeType::DepthwiseConvolutionLayer:
             return detail::create_depthwise_convolution_layer<NEDepthwiseConvolutionLayer, NETargetInfo>(*polymorphic_downcast<DepthwiseConvolutionLayerNode *>(node));
+        case NodeType::DepthwiseSeparableConvolutionLayer:
+            return detail::create_depthwise_separable_convolution_layer<NEDepthwiseSeparableConvolutionLayer, NETargetInfo>(*polymorphic_downcast<DepthwiseSeparableConvolutionLayerNode *>(node), ctx);
         case NodeType::DequantizationLayer:
             return detail::create_dequantization_layer<NEDequantizationLayer, NETargetInfo>(*polymorphic_downcast<DequantizationLayerNode *>(node));
         case NodeType::DetectionOutputLayer:
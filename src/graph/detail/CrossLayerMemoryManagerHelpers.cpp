@@ -180,11 +180,14 @@ void count_input_handles_per_target(const TaskHandles &task_handles, TargetHandl
 }
 
 /** Calculates the lifetime of each tensor handle
+ *
+ * The tasks of a stage can run concurrently, so the lifetimes of all their handles start before the end of any of them.
  *
  * @param[in, out] tasks_handles Tensor handles for each task
+ * @param[in]      stages        Indices of the tasks of each stage
  * @param[in]      hc            Data structure that keeps the handles reference count
  */
-void configure_handle_lifetime(std::vector<TaskHandles> &tasks_handles, const HandleCounter &hc)
+void configure_handle_lifetime(std::vector<TaskHandles> &tasks_handles, const std::vector<std::vector<size_t>> &stages, const HandleCounter &hc)
 {
     // Identify max number of tensors in flight
     HandleCounter tensors_in_flight;
@@ -208,25 +211,31 @@ void configure_handle_lifetime(std::vector<TaskHandles> &tasks_handles, const Ha
         }
     };
 
-    for(auto &task_handle : tasks_handles)
+    for(const auto &stage : stages)
     {
-        // Marking all the input and output tensors of the task as in flight
-        acquire(task_handle.input_handles);
-        acquire(task_handle.output_handles);
+        // Marking all the input and output tensors of the tasks of the stage as in flight
+        for(const auto &task : stage)
+        {
+            acquire(tasks_handles[task].input_handles);
+            acquire(tasks_handles[task].output_handles);
+        }
 
         // Releasing the input tensors
-        for(auto &input_handle : task_handle.input_handles)
+        for(const auto &task : stage)
         {
-            ITensorHandle *ihandle = input_handle.first;
-            ARM_COMPUTE_ERROR_ON(ihandle == nullptr);
-            ARM_COMPUTE_ERROR_ON(tensors_in_flight.find(ihandle) == std::end(tensors_in_flight));
-            --tensors_in_flight[ihandle];
-            if(tensors_in_flight[ihandle] <= 0)
+            for(auto &input_handle : tasks_handles[task].input_handles)
             {
-                // Remove tensor for tensors in flight
-                tensors_in_flight.erase(ihandle);
-                // End of allocation's lifetime
-                ihandle->allocate();
+                ITensorHandle *ihandle = input_handle.first;
+                ARM_COMPUTE_ERROR_ON(ihandle == nullptr);
+                ARM_COMPUTE_ERROR_ON(tensors_in_flight.find(ihandle) == std::end(tensors_in_flight));
+                --tensors_in_flight[ihandle];
+                if(tensors_in_flight[ihandle] <= 0)
+                {
+                    // Remove tensor for tensors in flight
+                    tensors_in_flight.erase(ihandle);
+                    // End of allocation's lifetime
+                    ihandle->allocate();
+                }
             }
         }
     }
@@ -251,6 +260,16 @@ void configure_transition_manager(Graph &g, GraphContext &ctx, ExecutionWorkload
         count_input_handles_per_target(tasks_handles.back(), target_handle_count);
     }
 
+    // Tasks run one after the other unless they have been grouped in stages
+    std::vector<std::vector<size_t>> stages = workload.stages;
+    if(stages.empty())
+    {
+        for(size_t i = 0; i < workload.tasks.size(); ++i)
+        {
+            stages.push_back({ i });
+        }
+    }
+
     // Setup memory managers
     for(auto &hc : target_handle_count)
     {
@@ -260,7 +279,7 @@ void configure_transition_manager(Graph &g, GraphContext &ctx, ExecutionWorkload
             if(mm_ctx->cross_mm != nullptr && mm_ctx->cross_group != nullptr)
             {
                 // Manage and allocate tensors
-                configure_handle_lifetime(tasks_handles, hc.second);
+                configure_handle_lifetime(tasks_handles, stages, hc.second);
             }
         }
     }
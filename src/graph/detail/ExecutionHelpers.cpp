@@ -28,8 +28,26 @@
 #include "arm_compute/graph/GraphManager.h"
 #include "arm_compute/graph/Tensor.h"
 #include "arm_compute/graph/Utils.h"
+#include "arm_compute/graph/algorithms/TopologicalSort.h"
 #include "arm_compute/graph/backends/BackendRegistry.h"
 
+#include "arm_compute/runtime/Scheduler.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "support/MemorySupport.h"
+
+#if ARM_COMPUTE_CPP_SCHEDULER
+#include "arm_compute/runtime/CPP/CPPScheduler.h"
+#endif /* ARM_COMPUTE_CPP_SCHEDULER */
+
+#include <algorithm>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <limits>
+#include <mutex>
+#include <numeric>
+#include <thread>
+
 namespace arm_compute
 {
 namespace graph
@@ -151,6 +169,10 @@ ExecutionWorkload configure_all_nodes(Graph &g, GraphContext &ctx, const std::ve
             if(func != nullptr || is_utility_node(node))
             {
                 workload.tasks.emplace_back(ExecutionTask(std::move(func), node));
+                if(ctx.config().enable_node_profiling)
+                {
+                    workload.tasks.back().profile = support::cpp14::make_unique<TaskProfile>(compute_node_cost(*node));
+                }
             }
         }
     }
@@ -173,6 +195,86 @@ ExecutionWorkload configure_all_nodes(Graph &g, GraphContext &ctx, const std::ve
     return workload;
 }
 
+void configure_parallel_execution(ExecutionWorkload &workload, unsigned int num_branches)
+{
+    ARM_COMPUTE_ERROR_ON(workload.graph == nullptr);
+#if ARM_COMPUTE_CPP_SCHEDULER
+    const unsigned int num_threads = Scheduler::get().num_threads();
+    num_branches                   = std::min(num_branches, num_threads);
+    if(num_branches < 2)
+    {
+        return;
+    }
+
+    Graph &g = *workload.graph;
+
+    std::map<NodeID, size_t> node_tasks;
+    for(size_t i = 0; i < workload.tasks.size(); ++i)
+    {
+        node_tasks[workload.tasks[i].node->id()] = i;
+    }
+
+    // A task runs in the stage following the last stage computing one of its inputs.
+    // Nodes without a task (e.g. inputs, constants, concatenations into sub-tensors) forward the stage of their inputs
+    std::map<NodeID, size_t> ready_stage;
+    for(const auto &node_id : dfs(g))
+    {
+        INode *node = g.node(node_id);
+        if(node == nullptr)
+        {
+            continue;
+        }
+
+        size_t stage = 0;
+        for(unsigned int i = 0; i < node->num_inputs(); ++i)
+        {
+            const Edge *input_edge = node->input_edge(i);
+            if(input_edge != nullptr)
+            {
+                stage = std::max(stage, ready_stage[input_edge->producer_id()]);
+            }
+        }
+
+        auto task_it = node_tasks.find(node_id);
+        if(task_it != node_tasks.end())
+        {
+            if(workload.stages.size() <= stage)
+            {
+                workload.stages.resize(stage + 1);
+            }
+            workload.stages[stage].push_back(task_it->second);
+            ++stage;
+        }
+        ready_stage[node_id] = stage;
+    }
+
+    // Share the threads between the tasks of the stages run concurrently
+    for(const auto &stage : workload.stages)
+    {
+        const size_t width = std::min<size_t>(stage.size(), num_branches);
+        if(width > 1 && workload.branch_schedulers.find(width) == workload.branch_schedulers.end())
+        {
+            std::vector<std::unique_ptr<IScheduler>> schedulers;
+            for(size_t b = 0; b < width; ++b)
+            {
+                auto scheduler = support::cpp14::make_unique<CPPScheduler>();
+                scheduler->set_num_threads(num_threads / width + ((b < num_threads % width) ? 1 : 0));
+                schedulers.push_back(std::move(scheduler));
+            }
+            workload.branch_schedulers.emplace(width, std::move(schedulers));
+        }
+    }
+
+    // Nothing runs concurrently
+    if(workload.branch_schedulers.empty())
+    {
+        workload.stages.clear();
+    }
+#else  /* ARM_COMPUTE_CPP_SCHEDULER */
+    ARM_COMPUTE_UNUSED(workload, num_branches);
+#endif /* ARM_COMPUTE_CPP_SCHEDULER */
+}
+
 void release_unused_tensors(Graph &g)
 {
     for(auto &tensor : g.tensors())
@@ -220,10 +322,17 @@ bool call_all_input_node_accessors(ExecutionWorkload &workload)
 void prepare_all_tasks(ExecutionWorkload &workload)
 {
     ARM_COMPUTE_ERROR_ON(workload.graph == nullptr);
+    ARM_COMPUTE_ERROR_ON(workload.ctx == nullptr);
+
+    // The original weights are kept if the functions can be configured again for other input shapes
+    const bool release_unused = workload.ctx->config().input_shape_cache_size == 0;
     for(auto &task : workload.tasks)
     {
         task.prepare();
-        release_unused_tensors(*workload.graph);
+        if(release_unused)
+        {
+            release_unused_tensors(*workload.graph);
+        }
     }
 }
 
@@ -241,9 +350,42 @@ void call_all_tasks(ExecutionWorkload &workload)
     }
 
     // Execute tasks
-    for(auto &task : workload.tasks)
+    if(workload.stages.empty())
     {
-        task();
+        for(auto &task : workload.tasks)
+        {
+            task();
+        }
+    }
+    else
+    {
+        const size_t max_width = workload.branch_schedulers.rbegin()->first;
+        for(const auto &stage : workload.stages)
+        {
+            if(stage.size() == 1)
+            {
+                workload.tasks[stage[0]]();
+                continue;
+            }
+
+            // Each branch runs its share of the tasks of the stage on its own scheduler
+            const size_t                      width      = std::min(stage.size(), max_width);
+            auto                             &schedulers = workload.branch_schedulers.at(width);
+            std::vector<IScheduler::Workload> branches(width);
+            for(size_t b = 0; b < width; ++b)
+            {
+                branches[b] = [&, b](const ThreadInfo &)
+                {
+                    Scheduler::set_thread_scheduler(schedulers[b].get());
+                    for(size_t t = b; t < stage.size(); t += width)
+                    {
+                        workload.tasks[stage[t]]();
+                    }
+                    Scheduler::set_thread_scheduler(nullptr);
+                };
+            }
+            Scheduler::get().run_tagged_workloads(branches, "GraphBranches");
+        }
     }
 
     // Release memory for the transition buffers
@@ -267,6 +409,396 @@ bool call_all_output_node_accessors(ExecutionWorkload &workload)
 
     return is_valid;
 }
+
+namespace
+{
+using StagingTensors = std::vector<std::unique_ptr<arm_compute::Tensor>>;
+
+#ifndef NO_MULTI_THREADING
+constexpr std::launch helper_launch_policy = std::launch::async;
+#else  /* NO_MULTI_THREADING */
+constexpr std::launch helper_launch_policy = std::launch::deferred;
+#endif /* NO_MULTI_THREADING */
+
+/** Creates a host copy of each of the given tensors, on which their accessors can be called */
+StagingTensors create_staging_tensors(const std::vector<Tensor *> &tensors)
+{
+    StagingTensors staging(tensors.size());
+    for(size_t i = 0; i < tensors.size(); ++i)
+    {
+        if(tensors[i] != nullptr && tensors[i]->handle() != nullptr)
+        {
+            staging[i] = support::cpp14::make_unique<arm_compute::Tensor>();
+            staging[i]->allocator()->init(tensors[i]->handle()->tensor().info()->clone()->set_is_resizable(true).reset_padding());
+            staging[i]->allocator()->allocate();
+        }
+    }
+    return staging;
+}
+
+/** Calls the accessors of the given tensors on their staging copies */
+bool call_all_staging_accessors(const std::vector<Tensor *> &tensors, StagingTensors &staging)
+{
+    bool is_valid = true;
+    for(size_t i = 0; i < tensors.size(); ++i)
+    {
+        const bool valid_access = (staging[i] != nullptr) && (tensors[i]->accessor() != nullptr) && tensors[i]->accessor()->access_tensor(*staging[i]);
+        is_valid                = is_valid && valid_access;
+    }
+    return is_valid;
+}
+
+/** Copies the staging copies to the given tensors, or the given tensors to their staging copies */
+void copy_staging_tensors(const std::vector<Tensor *> &tensors, StagingTensors &staging, bool to_staging)
+{
+    for(size_t i = 0; i < tensors.size(); ++i)
+    {
+        if(staging[i] != nullptr)
+        {
+            ITensorHandle *handle = tensors[i]->handle();
+            handle->map(true);
+            if(to_staging)
+            {
+                staging[i]->copy_from(handle->tensor());
+            }
+            else
+            {
+                handle->tensor().copy_from(*staging[i]);
+            }
+            handle->unmap();
+        }
+    }
+}
+} // namespace
+
+void execute_pipelined(ExecutionWorkload &workload)
+{
+    StagingTensors staged_inputs  = create_staging_tensors(workload.inputs);
+    StagingTensors staged_outputs = create_staging_tensors(workload.outputs);
+
+    const auto read_inputs = [&]()
+    {
+        return call_all_staging_accessors(workload.inputs, staged_inputs);
+    };
+    const auto write_outputs = [&]()
+    {
+        return call_all_staging_accessors(workload.outputs, staged_outputs);
+    };
+
+    std::future<bool> next_inputs = std::async(helper_launch_policy, read_inputs);
+    std::future<bool> prev_outputs;
+    while(next_inputs.get())
+    {
+        // The staging inputs are free again once copied, so the next frame can be read during the execution
+        copy_staging_tensors(workload.inputs, staged_inputs, false);
+        next_inputs = std::async(helper_launch_policy, read_inputs);
+
+        call_all_tasks(workload);
+
+        // The staging outputs can only be overwritten once the previous frame has been consumed
+        if(prev_outputs.valid() && !prev_outputs.get())
+        {
+            break;
+        }
+        copy_staging_tensors(workload.outputs, staged_outputs, true);
+        prev_outputs = std::async(helper_launch_policy, write_outputs);
+    }
+
+    // Wait for the helpers before releasing the staging tensors
+    if(next_inputs.valid())
+    {
+        next_inputs.wait();
+    }
+    if(prev_outputs.valid())
+    {
+        prev_outputs.get();
+    }
+}
+
+namespace
+{
+#if ARM_COMPUTE_CPP_SCHEDULER
+/** Step of a pipeline stage */
+struct PipelineStep
+{
+    std::function<bool()>                  run{};     /**< Runs the step, returns false if the stream has to stop */
+    std::vector<ITensorHandle *>           handles{}; /**< Handles accessed by the step */
+    std::vector<std::pair<size_t, size_t>> acquire{}; /**< Shared handles to wait for before the step, along with the rank of the stage among the stages using them */
+    std::vector<size_t>                    release{}; /**< Shared handles to pass on after the step */
+};
+
+/** Collects the handles accessed by a task, apart from the constant ones */
+std::vector<ITensorHandle *> get_task_handles(const ExecutionTask &task)
+{
+    std::vector<ITensorHandle *> handles;
+    INode                       *node = task.node;
+    for(unsigned int i = 0; i < node->num_inputs(); ++i)
+    {
+        const Edge *input_edge = node->input_edge(i);
+        if(input_edge != nullptr && input_edge->tensor() != nullptr && input_edge->tensor()->handle() != nullptr && input_edge->producer()->type() != NodeType::Const)
+        {
+            handles.push_back(input_edge->tensor()->handle()->parent_handle());
+        }
+    }
+    for(unsigned int i = 0; i < node->num_outputs(); ++i)
+    {
+        Tensor *output = node->output(i);
+        if(output != nullptr && output->handle() != nullptr)
+        {
+            handles.push_back(output->handle()->parent_handle());
+        }
+    }
+    return handles;
+}
+
+/** Collects the handles of the given graph tensors */
+std::vector<ITensorHandle *> get_tensors_handles(const std::vector<Tensor *> &tensors)
+{
+    std::vector<ITensorHandle *> handles;
+    for(const auto &tensor : tensors)
+    {
+        if(tensor != nullptr && tensor->handle() != nullptr)
+        {
+            handles.push_back(tensor->handle()->parent_handle());
+        }
+    }
+    return handles;
+}
+#endif /* ARM_COMPUTE_CPP_SCHEDULER */
+} // namespace
+
+void configure_pipeline_stages(ExecutionWorkload &workload, unsigned int num_stages)
+{
+#if ARM_COMPUTE_CPP_SCHEDULER
+    const unsigned int num_threads = Scheduler::get().num_threads();
+    const size_t       num_tasks   = workload.tasks.size();
+    num_stages                     = std::min<size_t>({ num_stages, num_threads, num_tasks });
+    if(num_stages < 2)
+    {
+        return;
+    }
+
+    std::vector<uint64_t> costs(num_tasks);
+    std::transform(std::begin(workload.tasks), std::end(workload.tasks), std::begin(costs), [](const ExecutionTask & task)
+    {
+        return std::max<uint64_t>(compute_node_cost(*task.node).flops, 1);
+    });
+    const uint64_t total_cost = std::accumulate(std::begin(costs), std::end(costs), uint64_t(0));
+
+    // A task goes in the current stage if most of it falls before the end of the stage, as long as one task is left for each next stage
+    workload.pipeline_stages.resize(num_stages);
+    size_t   task      = 0;
+    uint64_t done_cost = 0;
+    for(size_t s = 0; s < num_stages; ++s)
+    {
+        const uint64_t stage_end = (s + 1 == num_stages) ? total_cost : total_cost * (s + 1) / num_stages;
+        auto          &stage     = workload.pipeline_stages[s];
+        while(task < num_tasks - (num_stages - s - 1) && (stage.empty() || done_cost + costs[task] / 2 <= stage_end))
+        {
+            stage.push_back(task);
+            done_cost += costs[task];
+            ++task;
+        }
+    }
+
+    // Share the threads between the stages, binding the worker threads of each stage to their own cores when there are enough of them.
+    // The first thread of a stage is the one running the stage: it is left unbound so that configuring doesn't change the affinity of the calling thread,
+    // and its core is kept free of the other stages' threads.
+    const bool   bind_threads = num_threads <= Scheduler::get().cpu_info().get_cpu_num();
+    unsigned int first_core   = 0;
+    for(size_t s = 0; s < num_stages; ++s)
+    {
+        const unsigned int stage_threads = num_threads / num_stages + ((s < num_threads % num_stages) ? 1 : 0);
+        auto               scheduler     = support::cpp14::make_unique<CPPScheduler>();
+        if(bind_threads)
+        {
+            scheduler->set_num_threads_with_affinity(stage_threads, [first_core](int i, int)
+            {
+                return (i == 0) ? -1 : static_cast<int>(first_core) + i;
+            });
+        }
+        else
+        {
+            scheduler->set_num_threads(stage_threads);
+        }
+        workload.pipeline_schedulers.push_back(std::move(scheduler));
+        first_core += stage_threads;
+    }
+#else  /* ARM_COMPUTE_CPP_SCHEDULER */
+    ARM_COMPUTE_UNUSED(workload, num_stages);
+#endif /* ARM_COMPUTE_CPP_SCHEDULER */
+}
+
+void execute_pipeline_stages(ExecutionWorkload &workload)
+{
+#if ARM_COMPUTE_CPP_SCHEDULER
+    const size_t num_stages = workload.pipeline_stages.size();
+    ARM_COMPUTE_ERROR_ON(num_stages < 2);
+
+    // The input accessors are the first step of the first stage, the output accessors the last step of the last stage
+    std::vector<std::vector<PipelineStep>> steps(num_stages);
+    steps[0].push_back(PipelineStep{ [&]()
+    {
+        return call_all_input_node_accessors(workload);
+    },
+    get_tensors_handles(workload.inputs), {}, {} });
+    for(size_t s = 0; s < num_stages; ++s)
+    {
+        for(const auto &task : workload.pipeline_stages[s])
+        {
+            steps[s].push_back(PipelineStep{ [&workload, task]()
+            {
+                workload.tasks[task]();
+                return true;
+            },
+            get_task_handles(workload.tasks[task]), {}, {} });
+        }
+    }
+    steps[num_stages - 1].push_back(PipelineStep{ [&]()
+    {
+        return call_all_output_node_accessors(workload);
+    },
+    get_tensors_handles(workload.outputs), {}, {} });
+
+    // Find the stages using each handle
+    std::map<ITensorHandle *, std::vector<size_t>> handle_stages;
+    for(size_t s = 0; s < num_stages; ++s)
+    {
+        for(const auto &step : steps[s])
+        {
+            for(const auto &handle : step.handles)
+            {
+                auto &stages = handle_stages[handle];
+                if(stages.empty() || stages.back() != s)
+                {
+                    stages.push_back(s);
+                }
+            }
+        }
+    }
+
+    // The accesses to a handle shared by several stages are passed from one stage to the next, frame after frame:
+    // a stage waits for its turn before its first step using the handle and passes it on after its last one
+    std::map<ITensorHandle *, size_t> shared_handles;
+    std::vector<size_t>               num_sharing_stages;
+    for(const auto &hs : handle_stages)
+    {
+        if(hs.second.size() > 1)
+        {
+            shared_handles[hs.first] = num_sharing_stages.size();
+            num_sharing_stages.push_back(hs.second.size());
+        }
+    }
+    for(size_t s = 0; s < num_stages; ++s)
+    {
+        for(const auto &sh : shared_handles)
+        {
+            const auto  &stages = handle_stages[sh.first];
+            const size_t rank   = std::find(std::begin(stages), std::end(stages), s) - std::begin(stages);
+            if(rank == stages.size())
+            {
+                continue;
+            }
+
+            const auto uses_handle = [&](const PipelineStep & step)
+            {
+                return std::find(std::begin(step.handles), std::end(step.handles), sh.first) != std::end(step.handles);
+            };
+            std::find_if(std::begin(steps[s]), std::end(steps[s]), uses_handle)->acquire.emplace_back(sh.second, rank);
+            std::find_if(steps[s].rbegin(), steps[s].rend(), uses_handle)->release.push_back(sh.second);
+        }
+    }
+
+    std::mutex              mtx;
+    std::condition_variable cv;
+    std::vector<size_t>     turns(num_sharing_stages.size(), 0);
+    std::vector<size_t>     started_frames(num_stages, 0);
+    size_t                  num_frames = std::numeric_limits<size_t>::max();
+    bool                    stopped    = false;
+
+    const auto run_stage = [&](size_t s)
+    {
+        // The kernels of the stage are run by its own scheduler, whose threads were set up by configure_pipeline_stages()
+        Scheduler::set_thread_scheduler(workload.pipeline_schedulers[s].get());
+
+        for(size_t frame = 0;; ++frame)
+        {
+            std::unique_lock<std::mutex> lock(mtx);
+            const auto                   has_stopped = [&]()
+            {
+                return stopped || frame >= num_frames;
+            };
+
+            // A stage can't get ahead of the previous one
+            cv.wait(lock, [&]()
+            {
+                return has_stopped() || s == 0 || started_frames[s - 1] > frame;
+            });
+            if(has_stopped())
+            {
+                break;
+            }
+            ++started_frames[s];
+            cv.notify_all();
+
+            for(auto &step : steps[s])
+            {
+                cv.wait(lock, [&]()
+                {
+                    return has_stopped() || std::all_of(std::begin(step.acquire), std::end(step.acquire), [&](const std::pair<size_t, size_t> &h)
+                    {
+                        return turns[h.first] == frame * num_sharing_stages[h.first] + h.second;
+                    });
+                });
+                if(has_stopped())
+                {
+                    break;
+                }
+
+                lock.unlock();
+                const bool is_valid = step.run();
+                lock.lock();
+
+                if(!is_valid)
+                {
+                    // The inputs of this frame couldn't be read, or the outputs don't expect more frames
+                    if(s == 0)
+                    {
+                        num_frames = frame;
+                    }
+                    else
+                    {
+                        stopped = true;
+                    }
+                    cv.notify_all();
+                    break;
+                }
+                for(const auto &h : step.release)
+                {
+                    ++turns[h];
+                }
+                cv.notify_all();
+            }
+        }
+
+        Scheduler::set_thread_scheduler(nullptr);
+    };
+
+    // Every stage runs on its own thread, so that the affinity of the calling thread is left untouched
+    std::vector<std::thread> threads;
+    for(size_t s = 0; s < num_stages; ++s)
+    {
+        threads.emplace_back(run_stage, s);
+    }
+    for(auto &thread : threads)
+    {
+        thread.join();
+    }
+#else  /* ARM_COMPUTE_CPP_SCHEDULER */
+    ARM_COMPUTE_UNUSED(workload);
+    ARM_COMPUTE_ERROR("Pipeline stages need the CPP scheduler");
+#endif /* ARM_COMPUTE_CPP_SCHEDULER */
+}
 } // namespace detail
 } // namespace graph
 } // namespace arm_compute
@@ -33,15 +33,15 @@ namespace graph
 namespace frontend
 {
 Stream::Stream(size_t id, std::string name)
-    : _ctx(), _manager(), _g(id, std::move(name))
+    : _ctx(), _pm(), _manager(), _g(id, std::move(name))
 {
 }
 
 void Stream::finalize(Target target, const GraphConfig &config)
 {
-    PassManager pm = create_default_pass_manager(target, config);
+    _pm = create_default_pass_manager(target, config, config.plan_file.empty() ? nullptr : &_ctx.plan());
     _ctx.set_config(config);
-    _manager.finalize_graph(_g, _ctx, pm, target);
+    _manager.finalize_graph(_g, _ctx, _pm, target);
 }
 
 void Stream::run()
@@ -49,6 +49,26 @@ void Stream::run()
     _manager.execute_graph(_g);
 }
 
+Status Stream::reshape_inputs(const std::vector<TensorShape> &shapes)
+{
+    return _manager.reshape_graph_inputs(_g, shapes);
+}
+
+Status Stream::set_batch_size(unsigned int batch_size)
+{
+    return _manager.set_graph_batch_size(_g, batch_size);
+}
+
+void Stream::print_profile_csv(std::ostream &os)
+{
+    _manager.print_profile_csv(_g, os);
+}
+
+void Stream::print_profile_dot(std::ostream &os)
+{
+    _manager.print_profile_dot(_g, os);
+}
+
 void Stream::add_layer(ILayer &layer)
 {
     auto nid   = layer.create_layer(*this);
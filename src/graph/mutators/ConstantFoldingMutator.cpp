@@ -0,0 +1,359 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/mutators/ConstantFoldingMutator.h"
+
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/GraphContext.h"
+#include "arm_compute/graph/Logger.h"
+#include "arm_compute/graph/Utils.h"
+#include "arm_compute/graph/algorithms/TopologicalSort.h"
+#include "arm_compute/graph/backends/BackendRegistry.h"
+#include "arm_compute/graph/nodes/ConstNode.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include "support/MemorySupport.h"
+
+#include <cstring>
+#include <map>
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace
+{
+/** Accessor filling a constant tensor with the output of a folded node */
+class FoldedTensorAccessor final : public ITensorAccessor
+{
+public:
+    /** Constructor
+     *
+     * @param[in] data Output of the folded node
+     */
+    FoldedTensorAccessor(std::unique_ptr<arm_compute::Tensor> data)
+        : _data(std::move(data))
+    {
+    }
+
+    // Inherited methods overriden:
+    bool access_tensor(ITensor &tensor) override
+    {
+        tensor.copy_from(*_data);
+        return true;
+    }
+
+private:
+    std::unique_ptr<arm_compute::Tensor> _data;
+};
+
+/** Checks if a node can be folded
+ *
+ * @param[in] node             Node to check
+ * @param[in] fold_prior_boxes Fold the prior box nodes
+ *
+ * @return True if the output of the node only depends on constants that can be read
+ */
+bool is_foldable(INode &node, bool fold_prior_boxes)
+{
+    switch(node.type())
+    {
+        case NodeType::ActivationLayer:
+        case NodeType::DequantizationLayer:
+        case NodeType::EltwiseLayer:
+        case NodeType::FlattenLayer:
+        case NodeType::PermuteLayer:
+        case NodeType::QuantizationLayer:
+        case NodeType::ReshapeLayer:
+        case NodeType::UnaryEltwiseLayer:
+            break;
+        case NodeType::PriorBoxLayer:
+            // Prior boxes only depend on the shapes of the inputs
+            return fold_prior_boxes && node.num_outputs() == 1 && node.output(0) != nullptr && node.output(0)->accessor() == nullptr;
+        default:
+            return false;
+    }
+
+    if(node.num_outputs() != 1 || node.output(0) == nullptr || node.output(0)->accessor() != nullptr)
+    {
+        return false;
+    }
+
+    for(unsigned int i = 0; i < node.num_inputs(); ++i)
+    {
+        const Edge *input_edge = node.input_edge(i);
+        if(input_edge == nullptr || input_edge->producer() == nullptr || input_edge->producer()->type() != NodeType::Const)
+        {
+            return false;
+        }
+
+        // The accessors of the constants are only called once, unless they hold folded data
+        Tensor *input = input_edge->tensor();
+        if(input == nullptr || input->accessor() == nullptr)
+        {
+            return false;
+        }
+        const bool is_folded = dynamic_cast<const FoldedTensorAccessor *>(input->accessor()) != nullptr;
+        if(!is_folded && input->bound_edges().size() != 1)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/** Hashes the content of a tensor, without its padding
+ *
+ * @param[in] tensor Tensor to hash
+ * @param[in] seed   Hash to continue from
+ *
+ * @return Hash of the content of the tensor
+ */
+uint64_t hash_tensor(const arm_compute::ITensor &tensor, uint64_t seed)
+{
+    const size_t row_size = tensor.info()->dimension(0) * tensor.info()->element_size();
+
+    Window window;
+    window.use_tensor_dimensions(tensor.info()->tensor_shape(), Window::DimY);
+    Iterator it(&tensor, window);
+
+    uint64_t hash = seed;
+    execute_window_loop(window, [&](const Coordinates &)
+    {
+        hash = GraphPlan::hash_bytes(it.ptr(), row_size, hash);
+    },
+    it);
+    return hash;
+}
+
+/** Reads the output of a folded node from an execution plan
+ *
+ * @param[in] node        Node to read the output of
+ * @param[in] plan        Execution plan
+ * @param[in] inputs_hash Hash of the constant inputs of the node
+ *
+ * @return The output of the node, nullptr if the plan doesn't hold it for these inputs
+ */
+std::unique_ptr<arm_compute::Tensor> read_folded_constant(const INode &node, const GraphPlan &plan, uint64_t inputs_hash)
+{
+    const GraphPlan::FoldedConstant *folded = plan.folded_constant(node.id());
+    if(folded == nullptr)
+    {
+        return nullptr;
+    }
+    if(folded->inputs_hash != inputs_hash)
+    {
+        ARM_COMPUTE_LOG_GRAPH_INFO("Ignoring the planned output of node with ID : " << node.id() << " as its constant inputs changed" << std::endl);
+        return nullptr;
+    }
+
+    const TensorDescriptor &desc = node.output(0)->desc();
+    TensorInfo              info(desc.shape, 1, desc.data_type, desc.quant_info);
+    info.set_data_layout(desc.layout);
+    if(info.total_size() != folded->data.size())
+    {
+        ARM_COMPUTE_LOG_GRAPH_WARNING("Ignoring the planned output of node with ID : " << node.id() << " as its size doesn't match" << std::endl);
+        return nullptr;
+    }
+
+    auto output = support::cpp14::make_unique<arm_compute::Tensor>();
+    output->allocator()->init(info);
+    output->allocator()->allocate();
+    std::memcpy(output->buffer(), folded->data.data(), folded->data.size());
+    return output;
+}
+
+/** Runs a node with the NEON backend
+ *
+ * When given an execution plan, the output it holds for the content of the constant inputs is used instead of running the node,
+ * else the output computed is recorded to it.
+ *
+ * @param[in]      node    Node to run
+ * @param[in]      backend NEON backend
+ * @param[in, out] plan    Execution plan, nullptr if the outputs aren't planned
+ *
+ * @return A copy of the output of the node, nullptr if the node couldn't be run
+ */
+std::unique_ptr<arm_compute::Tensor> run_node(INode &node, backends::IDeviceBackend &backend, GraphPlan *plan)
+{
+    std::vector<Tensor *> tensors;
+    for(unsigned int i = 0; i < node.num_inputs(); ++i)
+    {
+        tensors.push_back(node.input(i));
+    }
+    tensors.push_back(node.output(0));
+
+    // Assign the node to the NEON backend for the time of the evaluation
+    const Target        assigned_target = node.assigned_target();
+    std::vector<Target> tensor_targets;
+    node.set_assigned_target(Target::NEON);
+    for(auto &tensor : tensors)
+    {
+        tensor_targets.push_back(tensor->desc().target);
+        tensor->desc().target = Target::NEON;
+    }
+
+    std::unique_ptr<arm_compute::Tensor> output;
+    if(bool(backend.validate_node(node)))
+    {
+        for(auto &tensor : tensors)
+        {
+            tensor->set_handle(backend.create_tensor(*tensor));
+        }
+
+        // Auxiliary memory is not managed as the function is only run once
+        GraphContext ctx;
+        auto         func = backend.configure_node(node, ctx);
+        if(func != nullptr)
+        {
+            for(auto &tensor : tensors)
+            {
+                tensor->handle()->allocate();
+            }
+
+            // The planned output is only valid for the content the constants have now
+            uint64_t inputs_hash = GraphPlan::hash_bytes(nullptr, 0);
+            for(unsigned int i = 0; i < node.num_inputs(); ++i)
+            {
+                if(node.input_edge(i)->producer()->type() == NodeType::Const)
+                {
+                    node.input(i)->call_accessor();
+                    inputs_hash = hash_tensor(node.input(i)->handle()->tensor(), inputs_hash);
+                }
+            }
+
+            output = (plan != nullptr) ? read_folded_constant(node, *plan, inputs_hash) : nullptr;
+            if(output == nullptr)
+            {
+                func->run();
+
+                output = support::cpp14::make_unique<arm_compute::Tensor>();
+                output->allocator()->init(node.output(0)->handle()->tensor().info()->clone()->set_is_resizable(true).reset_padding());
+                output->allocator()->allocate();
+                output->copy_from(node.output(0)->handle()->tensor());
+
+                if(plan != nullptr)
+                {
+                    const uint8_t *bytes = output->buffer();
+                    plan->add_folded_constant(node.id(), inputs_hash, std::vector<uint8_t>(bytes, bytes + output->info()->total_size()));
+                }
+            }
+        }
+
+        for(auto &tensor : tensors)
+        {
+            tensor->set_handle(nullptr);
+        }
+    }
+
+    // Restore the targets
+    node.set_assigned_target(assigned_target);
+    for(size_t i = 0; i < tensors.size(); ++i)
+    {
+        tensors[i]->desc().target = tensor_targets[i];
+    }
+
+    return output;
+}
+} // namespace
+
+ConstantFoldingMutator::ConstantFoldingMutator(bool fold_prior_boxes, GraphPlan *plan)
+    : _fold_prior_boxes(fold_prior_boxes), _plan(plan)
+{
+}
+
+const char *ConstantFoldingMutator::name()
+{
+    return "ConstantFoldingMutator";
+}
+
+IGraphMutator::MutationType ConstantFoldingMutator::type() const
+{
+    return IGraphMutator::MutationType::IR;
+}
+
+void ConstantFoldingMutator::mutate(Graph &g)
+{
+    // Constants are evaluated on the NEON backend
+    backends::IDeviceBackend *backend = backends::BackendRegistry::get().find_backend(Target::NEON);
+    if(backend == nullptr || !backend->is_backend_supported())
+    {
+        ARM_COMPUTE_LOG_GRAPH_VERBOSE("NEON backend is not available, skipping constant folding" << std::endl);
+        return;
+    }
+
+    // Nodes are visited in topological order, so that chains of constant operations are folded one node after the other
+    const std::vector<NodeID> topological_sorted_node_ids = dfs(g);
+    for(const auto &node_id : topological_sorted_node_ids)
+    {
+        INode *node = g.node(node_id);
+        if(node == nullptr || !is_foldable(*node, _fold_prior_boxes))
+        {
+            continue;
+        }
+
+        std::unique_ptr<arm_compute::Tensor> data = run_node(*node, *backend, _plan);
+        if(data == nullptr)
+        {
+            continue;
+        }
+
+        ARM_COMPUTE_LOG_GRAPH_VERBOSE("Folding node with ID : " << node->id() << " and Name: " << node->name() << std::endl);
+
+        // Collect the constants feeding the node and the nodes it drives
+        std::vector<NodeID> const_ids;
+        for(unsigned int i = 0; i < node->num_inputs(); ++i)
+        {
+            const INode *producer = node->input_edge(i)->producer();
+            if(producer->type() == NodeType::Const)
+            {
+                const_ids.push_back(producer->id());
+            }
+        }
+        const std::vector<NodeIdxPair> driving_nodes = get_driving_nodes(*node);
+        const TensorDescriptor         desc          = node->output(0)->desc();
+        const NodeParams               params        = node->common_node_params();
+
+        // Replace the node by a constant holding its output
+        g.remove_node(node->id());
+        const NodeID folded_id = g.add_node<ConstNode>(desc);
+        g.node(folded_id)->set_common_node_parameters(params);
+        g.node(folded_id)->output(0)->set_accessor(support::cpp14::make_unique<FoldedTensorAccessor>(std::move(data)));
+        for(const auto &driving_node : driving_nodes)
+        {
+            g.add_connection(folded_id, 0, driving_node.node_id, driving_node.index);
+        }
+
+        // Remove the constants that are not used anymore
+        for(const auto &const_id : const_ids)
+        {
+            const INode *const_node = g.node(const_id);
+            if(const_node != nullptr && const_node->output(0)->bound_edges().empty())
+            {
+                g.remove_node(const_id);
+            }
+        }
+    }
+}
+} // namespace graph
+} // namespace arm_compute
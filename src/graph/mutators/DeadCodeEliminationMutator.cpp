@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/mutators/DeadCodeEliminationMutator.h"
+
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/Logger.h"
+
+#include <set>
+#include <stack>
+
+namespace arm_compute
+{
+namespace graph
+{
+const char *DeadCodeEliminationMutator::name()
+{
+    return "DeadCodeEliminationMutator";
+}
+
+IGraphMutator::MutationType DeadCodeEliminationMutator::type() const
+{
+    return IGraphMutator::MutationType::IR;
+}
+
+void DeadCodeEliminationMutator::mutate(Graph &g)
+{
+    const std::vector<NodeID> &output_ids = g.nodes(NodeType::Output);
+    if(output_ids.empty())
+    {
+        return;
+    }
+
+    // Walk the graph backwards from the output nodes
+    std::set<NodeID>   live_nodes;
+    std::stack<NodeID> to_visit;
+    for(const auto &output_id : output_ids)
+    {
+        to_visit.push(output_id);
+    }
+    while(!to_visit.empty())
+    {
+        const NodeID node_id = to_visit.top();
+        to_visit.pop();
+
+        const INode *node = g.node(node_id);
+        if(node == nullptr || !live_nodes.insert(node_id).second)
+        {
+            continue;
+        }
+        for(const auto &input_eid : node->input_edges())
+        {
+            const Edge *input_edge = g.edge(input_eid);
+            if(input_edge != nullptr && input_edge->producer() != nullptr)
+            {
+                to_visit.push(input_edge->producer_id());
+            }
+        }
+    }
+
+    // Remove the dead nodes
+    unsigned int num_removed = 0;
+    const size_t num_nodes   = g.nodes().size();
+    for(NodeID node_id = 0; node_id < num_nodes; ++node_id)
+    {
+        INode *node = g.node(node_id);
+        if(node != nullptr && node->type() != NodeType::Input && live_nodes.find(node_id) == live_nodes.end())
+        {
+            ARM_COMPUTE_LOG_GRAPH_VERBOSE("Removing dead node with ID : " << node_id << " and Name: " << node->name() << std::endl);
+            g.remove_node(node_id);
+            ++num_removed;
+        }
+    }
+
+    if(num_removed > 0)
+    {
+        ARM_COMPUTE_LOG_GRAPH_INFO("Removed " << num_removed << " dead nodes" << std::endl);
+    }
+}
+} // namespace graph
+} // namespace arm_compute
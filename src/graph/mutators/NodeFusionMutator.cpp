@@ -210,6 +210,96 @@ void fuse_depthwise_convolution_with_batch_normalization(Graph &g, const Edge *o
     }
 }
 
+void fuse_depthwise_convolution_with_pointwise_convolution(Graph &g, const Edge *output_edge)
+{
+    ARM_COMPUTE_ERROR_ON(output_edge == nullptr);
+
+    auto *depth_conv_node = arm_compute::utils::cast::polymorphic_downcast<DepthwiseConvolutionLayerNode *>(output_edge->producer());
+    auto *conv_node       = arm_compute::utils::cast::polymorphic_downcast<ConvolutionLayerNode *>(output_edge->consumer());
+
+    Tensor       *depth_conv_output = depth_conv_node->output(0);
+    const Tensor *conv_weights      = conv_node->input(1);
+    ARM_COMPUTE_ERROR_ON(depth_conv_output == nullptr || conv_weights == nullptr || conv_node->output(0) == nullptr);
+
+    // Only fuse ungrouped 1x1 convolutions of stride 1 without padding, which consume the depthwise output as their input
+    const PadStrideInfo conv_info   = conv_node->convolution_info();
+    const bool          is_1x1_conv = get_dimension_size(conv_weights->desc(), DataLayoutDimension::WIDTH) == 1 && get_dimension_size(conv_weights->desc(), DataLayoutDimension::HEIGHT) == 1
+                                      && conv_info.stride() == std::make_pair(1U, 1U) && !conv_info.has_padding();
+    if(!is_1x1_conv || conv_node->num_groups() != 1 || output_edge->consumer_idx() != 0 || depth_conv_output->desc().layout != DataLayout::NHWC)
+    {
+        return;
+    }
+
+    ARM_COMPUTE_LOG_GRAPH_VERBOSE("Fusing depthwise convolution node with ID : " << output_edge->producer_id()
+                                  << " with pointwise Convolution Layer node with ID : " << output_edge->consumer_id() << std::endl);
+
+    // Prevent fusion if the depthwise output, which is no longer computed as a whole, has an accessor
+    if(depth_conv_output->accessor() == nullptr)
+    {
+        const Target assigned_target = depth_conv_node->assigned_target();
+
+        // Extract depthwise/pointwise convolution inputs
+        const auto depth_conv_input_id   = depth_conv_node->input_edge(0)->producer_id();
+        const auto depth_conv_weights_id = depth_conv_node->input_edge(1)->producer_id();
+        const auto conv_weights_id       = conv_node->input_edge(1)->producer_id();
+        const auto depth_conv_info       = depth_conv_node->convolution_info();
+        const auto depth_multiplier      = depth_conv_node->depth_multiplier();
+        const auto depth_conv_out_qinfo  = depth_conv_output->desc().quant_info;
+        const auto conv_out_qinfo        = conv_node->output(0)->desc().quant_info;
+        const auto depth_conv_fused_act  = depth_conv_node->fused_activation();
+        const auto conv_fused_act        = conv_node->fused_activation();
+
+        // Create the fused node
+        const NodeID fused_id = g.add_node<DepthwiseSeparableConvolutionLayerNode>(depth_conv_info, depth_multiplier, depth_conv_out_qinfo, conv_out_qinfo);
+
+        auto *fused_node = arm_compute::utils::cast::polymorphic_downcast<DepthwiseSeparableConvolutionLayerNode *>(g.node(fused_id));
+        fused_node->set_depthwise_fused_activation(depth_conv_fused_act);
+        fused_node->set_fused_activation(conv_fused_act);
+
+        // Add connections from the depthwise/pointwise convolution inputs to the fused node
+        g.add_connection(depth_conv_input_id, 0, fused_id, 0);
+        g.add_connection(depth_conv_weights_id, 0, fused_id, 1);
+        if(depth_conv_node->input_edge(2) != nullptr)
+        {
+            const auto depth_conv_bias_id = depth_conv_node->input_edge(2)->producer_id();
+            g.add_connection(depth_conv_bias_id, 0, fused_id, 2);
+        }
+        g.add_connection(conv_weights_id, 0, fused_id, 3);
+        if(conv_node->input_edge(2) != nullptr)
+        {
+            const auto conv_bias_id = conv_node->input_edge(2)->producer_id();
+            g.add_connection(conv_bias_id, 0, fused_id, 4);
+        }
+
+        std::vector<NodeIdxPair> conv_driving_nodes = get_driving_nodes(*conv_node);
+
+        // Extract pointwise convolution node accessor if any
+        auto conv_node_accessor = conv_node->output(0)->extract_accessor();
+        auto conv_node_name     = conv_node->name();
+
+        // Remove pointwise convolution node
+        g.remove_node(conv_node->id());
+
+        // Get driving nodes of pointwise convolution node
+        for(auto &driving_node : conv_driving_nodes)
+        {
+            g.add_connection(fused_id, 0, driving_node.node_id, driving_node.index);
+            configure_tensor(fused_node->output(0));
+        }
+        // Update fused node outputs
+        fused_node->output(0)->set_accessor(std::move(conv_node_accessor));
+        fused_node->set_assigned_target(assigned_target);
+        fused_node->set_common_node_parameters(NodeParams{ depth_conv_node->name() + "+" + conv_node_name, assigned_target });
+
+        // Remove depthwise convolution node
+        g.remove_node(depth_conv_node->id());
+    }
+    else
+    {
+        ARM_COMPUTE_LOG_GRAPH_VERBOSE("Prevented fusion of depthwise convolution with pointwise convolution due to the presence of an output accessor\n");
+    }
+}
+
 template <typename N>
 void fuse_node_with_activation(Graph &g, const Edge *output_edge, const std::set<Activation> &supported_fused_activations)
 {
@@ -287,6 +377,11 @@ void fuse_layer(Graph &g, std::function<bool(INode &)> const &prec, const F fuse
 }
 } // namespace detail
 
+NodeFusionMutator::NodeFusionMutator(bool fuse_depthwise_separable)
+    : _fuse_depthwise_separable(fuse_depthwise_separable)
+{
+}
+
 const char *NodeFusionMutator::name()
 {
     return "NodeFusionMutator";
@@ -316,6 +411,10 @@ void NodeFusionMutator::mutate(Graph &g)
     {
         return n.assigned_target() == Target::CL;
     };
+    auto neon_target_prec = [](INode & n)
+    {
+        return n.assigned_target() == Target::NEON;
+    };
     auto qs8_prec = [&g](INode & n)
     {
         ARM_COMPUTE_ERROR_ON(n.output(0) == nullptr);
@@ -337,6 +436,10 @@ void NodeFusionMutator::mutate(Graph &g)
     detail::fuse_layer<EltwiseLayerNode, ActivationLayerNode>(g, cl_target_prec, detail::fuse_node_with_activation<EltwiseLayerNode>, supported_fused_activations);
     detail::fuse_layer<ConvolutionLayerNode, BatchNormalizationLayerNode>(g, empty_prec, detail::fuse_convolution_with_batch_normalization);
     detail::fuse_layer<DepthwiseConvolutionLayerNode, BatchNormalizationLayerNode>(g, empty_prec, detail::fuse_depthwise_convolution_with_batch_normalization);
+    if(_fuse_depthwise_separable)
+    {
+        detail::fuse_layer<DepthwiseConvolutionLayerNode, ConvolutionLayerNode>(g, neon_target_prec, detail::fuse_depthwise_convolution_with_pointwise_convolution);
+    }
 }
 } // namespace graph
 } // namespace arm_compute
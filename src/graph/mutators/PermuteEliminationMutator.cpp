@@ -0,0 +1,441 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/mutators/PermuteEliminationMutator.h"
+
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/Logger.h"
+#include "arm_compute/graph/Utils.h"
+#include "arm_compute/graph/algorithms/TopologicalSort.h"
+#include "arm_compute/graph/nodes/Nodes.h"
+
+#include "support/Cast.h"
+
+#include <algorithm>
+#include <deque>
+#include <map>
+#include <set>
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace
+{
+/** Composes two permutations
+ *
+ * @param[in] first  Permutation applied first
+ * @param[in] second Permutation applied second
+ *
+ * @return The permutation equivalent to applying @p first then @p second
+ */
+PermutationVector compose_permutations(const PermutationVector &first, const PermutationVector &second)
+{
+    const auto   get_dim        = [](const PermutationVector & perm, size_t i)
+    {
+        return (i < perm.num_dimensions()) ? perm[i] : static_cast<uint32_t>(i);
+    };
+    const size_t num_dimensions = std::max(first.num_dimensions(), second.num_dimensions());
+
+    PermutationVector composed;
+    for(size_t i = 0; i < num_dimensions; ++i)
+    {
+        composed.set(i, get_dim(first, get_dim(second, i)));
+    }
+    return composed;
+}
+
+/** Checks if a permutation leaves the dimensions in place */
+bool is_identity(const PermutationVector &perm)
+{
+    for(size_t i = 0; i < perm.num_dimensions(); ++i)
+    {
+        if(perm[i] != i)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/** Checks if a node doesn't depend on the layout of its only input */
+bool is_layout_agnostic(const INode &node)
+{
+    return (node.type() == NodeType::ActivationLayer || node.type() == NodeType::UnaryEltwiseLayer) && node.num_inputs() == 1 && node.num_outputs() == 1;
+}
+
+/** Checks if the output of a node only feeds one node and has no accessor */
+bool has_single_consumer(INode &node)
+{
+    return node.output(0) != nullptr && node.output(0)->bound_edges().size() == 1 && node.output(0)->accessor() == nullptr;
+}
+
+/** Checks if a node permutes its NCHW tensors to NHWC at each execution on NEON */
+bool prefers_nhwc(const INode &node)
+{
+    return node.type() == NodeType::DepthwiseConvolutionLayer;
+}
+
+/** Checks if a node has weights, which are permuted along with its input */
+bool has_weights(const INode &node)
+{
+    return node.type() == NodeType::ConvolutionLayer || node.type() == NodeType::DepthwiseConvolutionLayer;
+}
+
+/** Checks if an input of a node holds activations, whose layout is the one the node runs in */
+bool is_data_input(const INode &node, size_t idx)
+{
+    switch(node.type())
+    {
+        case NodeType::ConcatenateLayer:
+        case NodeType::EltwiseLayer:
+            return true;
+        default:
+            return idx == 0;
+    }
+}
+
+/** Checks if a NCHW node can run in NHWC on NEON with the same result */
+bool can_run_nhwc(const INode &node)
+{
+    if(node.num_outputs() != 1 || node.output(0) == nullptr || node.output(0)->accessor() != nullptr)
+    {
+        return false;
+    }
+    for(size_t i = 0; i < node.num_inputs(); ++i)
+    {
+        const Tensor *input = node.input(i);
+        if(!is_data_input(node, i))
+        {
+            continue;
+        }
+        if(input == nullptr || input->desc().layout != DataLayout::NCHW)
+        {
+            return false;
+        }
+        // Broadcasting depends on the layout
+        if(node.type() == NodeType::EltwiseLayer && input->desc().shape != node.input(0)->desc().shape)
+        {
+            return false;
+        }
+    }
+
+    switch(node.type())
+    {
+        case NodeType::ActivationLayer:
+        case NodeType::BatchNormalizationLayer:
+        case NodeType::ConcatenateLayer:
+        case NodeType::EltwiseLayer:
+        case NodeType::UnaryEltwiseLayer:
+            return true;
+        case NodeType::PoolingLayer:
+            return arm_compute::utils::cast::polymorphic_downcast<const PoolingLayerNode *>(&node)->pooling_info().data_layout == DataLayout::UNKNOWN;
+        case NodeType::ConvolutionLayer:
+        case NodeType::DepthwiseConvolutionLayer:
+        {
+            // The permute of the weights has to be folded
+            const Edge *weights_edge = node.input_edge(1);
+            return weights_edge != nullptr && weights_edge->producer() != nullptr && weights_edge->producer()->type() == NodeType::Const;
+        }
+        default:
+            return false;
+    }
+}
+
+/** Inserts a permute node between a tensor and some of its consumers
+ *
+ * @param[in] g         Graph
+ * @param[in] source    Node and output index producing the tensor
+ * @param[in] edges     Edges to the consumers to connect to the permute node
+ * @param[in] perm      Permutation vector
+ * @param[in] layout    Layout of the output of the permute node
+ * @param[in] params    Parameters of the permute node
+ */
+void insert_permute(Graph &g, NodeIdxPair source, const std::vector<EdgeID> &edges, const PermutationVector &perm, DataLayout layout, const NodeParams &params)
+{
+    std::vector<NodeIdxPair> consumers;
+    for(const auto &eid : edges)
+    {
+        const Edge *edge = g.edge(eid);
+        consumers.push_back({ edge->consumer_id(), edge->consumer_idx() });
+        g.remove_connection(eid);
+    }
+
+    const NodeID permute_id = g.add_node<PermuteLayerNode>(perm, layout);
+    g.node(permute_id)->set_common_node_parameters(params);
+    g.add_connection(source.node_id, source.index, permute_id, 0);
+    for(const auto &consumer : consumers)
+    {
+        g.add_connection(permute_id, 0, consumer.node_id, consumer.index);
+    }
+}
+
+/** Runs the groups of NCHW nodes holding depthwise convolutions in NHWC, when this needs fewer permutes
+ *
+ * @param[in] g Graph to mutate
+ *
+ * @return The number of permutes removed from the functions and the number of permute nodes added
+ */
+std::pair<unsigned int, unsigned int> assign_nhwc_layout(Graph &g)
+{
+    unsigned int num_function_permutes = 0;
+    unsigned int num_permute_nodes     = 0;
+
+    std::set<NodeID> visited;
+    for(const auto &seed_id : dfs(g))
+    {
+        INode *seed = g.node(seed_id);
+        if(seed == nullptr || visited.count(seed_id) != 0 || !prefers_nhwc(*seed) || !can_run_nhwc(*seed))
+        {
+            continue;
+        }
+
+        // Group the connected nodes that can run in NHWC
+        std::set<NodeID>   group;
+        std::deque<NodeID> pending{ seed_id };
+        visited.insert(seed_id);
+        while(!pending.empty())
+        {
+            INode *node = g.node(pending.front());
+            pending.pop_front();
+            group.insert(node->id());
+
+            std::vector<INode *> neighbours;
+            for(size_t i = 0; i < node->num_inputs(); ++i)
+            {
+                if(is_data_input(*node, i) && node->input_edge(i) != nullptr)
+                {
+                    neighbours.push_back(node->input_edge(i)->producer());
+                }
+            }
+            for(const auto &eid : node->output_edges())
+            {
+                const Edge *edge = g.edge(eid);
+                if(is_data_input(*edge->consumer(), edge->consumer_idx()))
+                {
+                    neighbours.push_back(edge->consumer());
+                }
+            }
+            for(auto *neighbour : neighbours)
+            {
+                if(neighbour != nullptr && visited.count(neighbour->id()) == 0 && can_run_nhwc(*neighbour))
+                {
+                    visited.insert(neighbour->id());
+                    pending.push_back(neighbour->id());
+                }
+            }
+        }
+
+        // Find the tensors crossing the boundary of the group, which need a permute node unless they come from or go to one
+        std::map<std::pair<NodeID, size_t>, std::vector<EdgeID>> inputs;
+        std::map<std::pair<NodeID, size_t>, std::vector<EdgeID>> outputs;
+        unsigned int                                              cost    = 0;
+        unsigned int                                              savings = 0;
+        for(const auto &node_id : group)
+        {
+            INode *node = g.node(node_id);
+            savings += prefers_nhwc(*node) ? 2 : 0;
+            for(size_t i = 0; i < node->num_inputs(); ++i)
+            {
+                const Edge *edge = node->input_edge(i);
+                if(is_data_input(*node, i) && edge != nullptr && group.count(edge->producer_id()) == 0)
+                {
+                    inputs[std::make_pair(edge->producer_id(), edge->producer_idx())].push_back(edge->id());
+                }
+            }
+            for(const auto &eid : node->output_edges())
+            {
+                const Edge *edge = g.edge(eid);
+                if(group.count(edge->consumer_id()) == 0 || !is_data_input(*edge->consumer(), edge->consumer_idx()))
+                {
+                    outputs[std::make_pair(node_id, edge->producer_idx())].push_back(eid);
+                }
+            }
+        }
+        for(const auto &input : inputs)
+        {
+            cost += (g.node(input.first.first)->type() == NodeType::PermuteLayer) ? 0 : 1;
+        }
+        for(const auto &output : outputs)
+        {
+            cost += std::all_of(std::begin(output.second), std::end(output.second), [&](EdgeID eid)
+            {
+                return g.edge(eid)->consumer()->type() == NodeType::PermuteLayer;
+            })
+            ? 0 : 1;
+        }
+        if(cost >= savings)
+        {
+            continue;
+        }
+
+        ARM_COMPUTE_LOG_GRAPH_VERBOSE("Running " << group.size() << " nodes from node with ID : " << seed_id << " in NHWC" << std::endl);
+
+        // Permute the inputs, the weights and the outputs of the group
+        for(const auto &input : inputs)
+        {
+            const INode *consumer = g.edge(input.second.front())->consumer();
+            insert_permute(g, { input.first.first, input.first.second }, input.second, PermutationVector(2U, 0U, 1U), DataLayout::NHWC, consumer->common_node_params());
+        }
+        for(const auto &node_id : group)
+        {
+            INode *node = g.node(node_id);
+            if(has_weights(*node))
+            {
+                const Edge *weights_edge = node->input_edge(1);
+                insert_permute(g, { weights_edge->producer_id(), weights_edge->producer_idx() }, { weights_edge->id() }, PermutationVector(2U, 0U, 1U), DataLayout::NHWC,
+                               node->common_node_params());
+            }
+        }
+        for(const auto &output : outputs)
+        {
+            insert_permute(g, { output.first.first, output.first.second }, output.second, PermutationVector(1U, 2U, 0U), DataLayout::NCHW, g.node(output.first.first)->common_node_params());
+        }
+
+        num_function_permutes += savings;
+        num_permute_nodes += inputs.size() + outputs.size();
+    }
+
+    if(num_permute_nodes > 0)
+    {
+        // Infer the descriptors of the nodes that now run in NHWC
+        for(const auto &node_id : dfs(g))
+        {
+            INode *node = g.node(node_id);
+            if(node != nullptr)
+            {
+                node->forward_descriptors();
+            }
+        }
+    }
+
+    return std::make_pair(num_function_permutes, num_permute_nodes);
+}
+} // namespace
+
+PermuteEliminationMutator::PermuteEliminationMutator(Target target)
+    : _target(target)
+{
+}
+
+const char *PermuteEliminationMutator::name()
+{
+    return "PermuteEliminationMutator";
+}
+
+IGraphMutator::MutationType PermuteEliminationMutator::type() const
+{
+    return IGraphMutator::MutationType::IR;
+}
+
+void PermuteEliminationMutator::mutate(Graph &g)
+{
+    if(_target == Target::NEON)
+    {
+        const auto permutes = assign_nhwc_layout(g);
+        if(permutes.second > 0)
+        {
+            ARM_COMPUTE_LOG_GRAPH_INFO("Running in NHWC removed " << permutes.first << " permutes from the functions and added " << permutes.second << " permute nodes" << std::endl);
+        }
+    }
+
+    unsigned int num_removed = 0;
+
+    const std::vector<NodeID> permute_ids = g.nodes(NodeType::PermuteLayer);
+    for(const auto &permute_id : permute_ids)
+    {
+        INode *second = g.node(permute_id);
+        if(second == nullptr || second->input_edge(0) == nullptr || second->output(0) == nullptr || second->output(0)->accessor() != nullptr)
+        {
+            continue;
+        }
+
+        // Walk back through the layout agnostic nodes to the previous permute node
+        std::deque<INode *> chain;
+        INode              *first = second->input_edge(0)->producer();
+        while(first != nullptr && is_layout_agnostic(*first) && has_single_consumer(*first) && first->input_edge(0) != nullptr)
+        {
+            chain.push_front(first);
+            first = first->input_edge(0)->producer();
+        }
+        if(first == nullptr || first->type() != NodeType::PermuteLayer || !has_single_consumer(*first) || first->input_edge(0) == nullptr)
+        {
+            continue;
+        }
+
+        const auto             *first_permute  = arm_compute::utils::cast::polymorphic_downcast<const PermuteLayerNode *>(first);
+        const auto             *second_permute = arm_compute::utils::cast::polymorphic_downcast<const PermuteLayerNode *>(second);
+        const PermutationVector composed       = compose_permutations(first_permute->permutation_vector(), second_permute->permutation_vector());
+        const TensorDescriptor &input_desc     = first->input(0)->desc();
+        const TensorDescriptor &output_desc    = second->output(0)->desc();
+        const bool              cancel         = is_identity(composed) && input_desc.shape == output_desc.shape && input_desc.layout == output_desc.layout;
+
+        // Permutes that don't cancel each other can only be merged if nothing runs in between
+        if(!cancel && !chain.empty())
+        {
+            continue;
+        }
+
+        ARM_COMPUTE_LOG_GRAPH_VERBOSE("Removing permute nodes with ID : " << first->id() << " and " << second->id() << std::endl);
+
+        const NodeIdxPair              source{ first->input_edge(0)->producer()->id(), first->input_edge(0)->producer_idx() };
+        const std::vector<NodeIdxPair> driving_nodes = get_driving_nodes(*second);
+        const NodeParams               params        = second->common_node_params();
+        const DataLayout               layout        = output_desc.layout;
+
+        g.remove_node(first->id());
+        g.remove_node(second->id());
+
+        // Connect the nodes in between to the input of the first permute, and the output of the chain to the nodes driven by the second one
+        NodeIdxPair last = source;
+        if(!chain.empty())
+        {
+            g.add_connection(source.node_id, source.index, chain.front()->id(), 0);
+            for(auto &node : chain)
+            {
+                node->forward_descriptors();
+            }
+            last = { chain.back()->id(), 0 };
+        }
+        if(!cancel)
+        {
+            const NodeID merged_id = g.add_node<PermuteLayerNode>(composed, layout);
+            g.node(merged_id)->set_common_node_parameters(params);
+            g.add_connection(last.node_id, last.index, merged_id, 0);
+            last = { merged_id, 0 };
+        }
+        for(const auto &driving_node : driving_nodes)
+        {
+            g.add_connection(last.node_id, last.index, driving_node.node_id, driving_node.index);
+        }
+
+        num_removed += cancel ? 2 : 1;
+    }
+
+    if(num_removed > 0)
+    {
+        ARM_COMPUTE_LOG_GRAPH_INFO("Removed " << num_removed << " permute nodes" << std::endl);
+    }
+}
+} // namespace graph
+} // namespace arm_compute
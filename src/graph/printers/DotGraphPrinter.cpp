@@ -121,6 +121,11 @@ const std::string &DotGraphVisitor::info() const
     return _info;
 }
 
+DotGraphPrinter::DotGraphPrinter(std::map<NodeID, std::string> annotations)
+    : _annotations(std::move(annotations))
+{
+}
+
 void DotGraphPrinter::print(const Graph &g, std::ostream &os)
 {
     // Print header
@@ -165,7 +170,13 @@ void DotGraphPrinter::print_nodes(const Graph &g, std::ostream &os)
             std::string name             = n->name().empty() ? node_id : n->name();
             auto        node_description = _dot_node_visitor.info();
 
-            os << R"([label = ")" << name << R"( \n )" << n->assigned_target() << R"( \n )" << node_description << R"("])";
+            os << R"([label = ")" << name << R"( \n )" << n->assigned_target() << R"( \n )" << node_description;
+            const auto annotation = _annotations.find(n->id());
+            if(annotation != std::end(_annotations))
+            {
+                os << R"( \n )" << annotation->second;
+            }
+            os << R"("])";
             os << ";\n";
         }
     }
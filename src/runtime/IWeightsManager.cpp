@@ -23,10 +23,12 @@
  */
 #include "arm_compute/runtime/IWeightsManager.h"
 
+#include <algorithm>
+
 namespace arm_compute
 {
 IWeightsManager::IWeightsManager()
-    : _managed_weights(), _managed_weights_parents()
+    : _managed_weights(), _managed_weights_parents(), _acquired_transforms()
 {
 }
 
@@ -130,6 +132,7 @@ ITensor *IWeightsManager::acquire(const ITensor *weights, ITransformWeights *wei
         {
             transformed_weights = it->get_weights();
             it->increase_refcount();
+            _acquired_transforms.push_back(AcquiredTransform{ it, false });
             break;
         }
     }
@@ -139,6 +142,7 @@ ITensor *IWeightsManager::acquire(const ITensor *weights, ITransformWeights *wei
         transformed_weights = weights_transform->get_weights();
         weights_transform->increase_refcount();
         item->second.emplace_back(weights_transform);
+        _acquired_transforms.push_back(AcquiredTransform{ weights_transform, true });
     }
 
     // Manage the weights and store link to the parent node
@@ -146,4 +150,23 @@ ITensor *IWeightsManager::acquire(const ITensor *weights, ITransformWeights *wei
 
     return transformed_weights;
 }
+
+std::vector<IWeightsManager::AcquiredTransform> IWeightsManager::take_acquired_transforms()
+{
+    std::vector<AcquiredTransform> acquired_transforms;
+    std::swap(acquired_transforms, _acquired_transforms);
+    return acquired_transforms;
+}
+
+void IWeightsManager::release_transform(ITransformWeights *weights_transform)
+{
+    const ITensor *transformed_weights = weights_transform->get_weights();
+
+    for(auto &item : _managed_weights)
+    {
+        item.second.erase(std::remove(item.second.begin(), item.second.end(), weights_transform), item.second.end());
+    }
+    _managed_weights.erase(transformed_weights);
+    _managed_weights_parents.erase(transformed_weights);
+}
 } // namespace arm_compute
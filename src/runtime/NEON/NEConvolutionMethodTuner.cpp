@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NEON/NEConvolutionMethodTuner.h"
+
+#include "arm_compute/core/Error.h"
+#include "support/StringSupport.h"
+
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+namespace arm_compute
+{
+NEConvolutionMethodTuner::NEConvolutionMethodTuner(bool tune_new_configs)
+    : _methods_table(), _tune_new_configs(tune_new_configs), _mtx()
+{
+}
+
+void NEConvolutionMethodTuner::set_tune_new_configs(bool tune_new_configs)
+{
+    _tune_new_configs = tune_new_configs;
+}
+
+bool NEConvolutionMethodTuner::tune_new_configs() const
+{
+    return _tune_new_configs;
+}
+
+bool NEConvolutionMethodTuner::find_method(const std::string &config_id, ConvolutionMethod &method) const
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+    const auto p = _methods_table.find(config_id);
+    if(p == _methods_table.end())
+    {
+        return false;
+    }
+    method = p->second;
+    return true;
+}
+
+void NEConvolutionMethodTuner::add_method_to_table(const std::string &config_id, ConvolutionMethod method)
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+    _methods_table[config_id] = method;
+}
+
+std::unordered_map<std::string, ConvolutionMethod> NEConvolutionMethodTuner::methods_table() const
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+    return _methods_table;
+}
+
+void NEConvolutionMethodTuner::load_from_file(const std::string &filename)
+{
+    std::ifstream fs;
+    fs.exceptions(std::ifstream::badbit);
+    fs.open(filename, std::ios::in);
+    if(!fs.is_open())
+    {
+        ARM_COMPUTE_ERROR_VAR("Failed to open '%s' (%s [%d])", filename.c_str(), strerror(errno), errno);
+    }
+    std::string line;
+    while(!std::getline(fs, line).fail())
+    {
+        std::istringstream ss(line);
+        std::string        config_id;
+        std::string        token;
+        if(std::getline(ss, config_id, ';').fail() || std::getline(ss, token, ';').fail())
+        {
+            ARM_COMPUTE_ERROR_VAR("Malformed row '%s' in %s (Should be of the form 'config_id;method')", ss.str().c_str(), filename.c_str());
+        }
+        const int method = support::cpp11::stoi(token);
+        if(method < static_cast<int>(ConvolutionMethod::GEMM) || method > static_cast<int>(ConvolutionMethod::FFT))
+        {
+            ARM_COMPUTE_ERROR_VAR("Unknown convolution method in row '%s' in %s", ss.str().c_str(), filename.c_str());
+        }
+        add_method_to_table(config_id, static_cast<ConvolutionMethod>(method));
+    }
+    fs.close();
+}
+
+void NEConvolutionMethodTuner::save_to_file(const std::string &filename) const
+{
+    std::ofstream fs;
+    fs.exceptions(std::ifstream::failbit | std::ifstream::badbit);
+    fs.open(filename, std::ios::out);
+    std::lock_guard<std::mutex> lock(_mtx);
+    for(auto const &config_data : _methods_table)
+    {
+        fs << config_data.first << ";" << static_cast<int>(config_data.second) << std::endl;
+    }
+    fs.close();
+}
+} // namespace arm_compute
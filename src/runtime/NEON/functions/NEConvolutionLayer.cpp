@@ -26,6 +26,8 @@
 #include "arm_compute/core/PixelValue.h"
 #include "arm_compute/core/Utils.h"
 #include "arm_compute/core/Validate.h"
+#include "arm_compute/core/utils/misc/ShapeCalculator.h"
+#include "arm_compute/runtime/NEON/NEConvolutionMethodTuner.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
 #include "arm_compute/runtime/NEON/functions/NEDirectConvolutionLayer.h"
 #include "arm_compute/runtime/NEON/functions/NEFFTConvolutionLayer.h"
@@ -35,102 +37,233 @@
 
 #include "support/MemorySupport.h"
 
+#include <array>
+#include <atomic>
+#include <chrono>
 #include <cmath>
+#include <cstring>
+#include <limits>
+#include <sstream>
 #include <tuple>
 #include <utility>
 
 namespace arm_compute
 {
-NEConvolutionLayer::NEConvolutionLayer(std::shared_ptr<IMemoryManager> memory_manager) //NOLINT
-    : _memory_manager(std::move(memory_manager)),
-      _function()
+namespace
 {
-}
+/** Tuner shared by all the convolution layers, nullptr if tuning is disabled */
+std::atomic<NEConvolutionMethodTuner *> conv_method_tuner{ nullptr };
 
-void NEConvolutionLayer::configure(ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const PadStrideInfo &conv_info, const WeightsInfo &weights_info,
-                                   const Size2D &dilation, const ActivationLayerInfo &act_info, bool enable_fast_math, unsigned int num_groups)
+/** Number of timed runs of each method when tuning */
+constexpr unsigned int num_tuning_iterations = 3;
+
+/** Methods that can be picked by tuning */
+const std::array<ConvolutionMethod, 5> tunable_methods =
 {
-    // Perform validate step
-    ARM_COMPUTE_ERROR_ON_NULLPTR(input, weights, output);
-    ARM_COMPUTE_UNUSED(num_groups);
-    ARM_COMPUTE_ERROR_THROW_ON(NEConvolutionLayer::validate(input->info(), weights->info(), ((biases != nullptr) ? biases->info() : nullptr), output->info(), conv_info, weights_info, dilation, act_info,
-                                                            enable_fast_math, num_groups));
+    { ConvolutionMethod::GEMM, ConvolutionMethod::GEMM_CONV2D, ConvolutionMethod::DIRECT, ConvolutionMethod::WINOGRAD, ConvolutionMethod::FFT }
+};
 
+std::unique_ptr<IFunction> create_function(ConvolutionMethod method, std::shared_ptr<IMemoryManager> memory_manager, ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output,
+                                           const PadStrideInfo &conv_info, const WeightsInfo &weights_info, const Size2D &dilation, const ActivationLayerInfo &act_info, bool enable_fast_math,
+                                           unsigned int num_groups)
+{
     const Conv2dInfo info(conv_info, dilation, act_info, enable_fast_math, num_groups);
-    switch(NEConvolutionLayer::get_convolution_method(input->info(), weights->info(), output->info(), conv_info, weights_info, dilation, act_info, enable_fast_math))
+    switch(method)
     {
         case ConvolutionMethod::WINOGRAD:
         {
-            auto f = arm_compute::support::cpp14::make_unique<NEWinogradConvolutionLayer>(_memory_manager);
+            auto f = arm_compute::support::cpp14::make_unique<NEWinogradConvolutionLayer>(memory_manager);
             f->configure(input, weights, biases, output, conv_info, act_info, enable_fast_math);
-            _function = std::move(f);
-            break;
+            return f;
         }
         case ConvolutionMethod::GEMM:
         {
-            auto f = arm_compute::support::cpp14::make_unique<NEGEMMConvolutionLayer>(_memory_manager);
-            f->configure(input, weights, biases, output, conv_info, weights_info, dilation, act_info);
-            _function = std::move(f);
-            break;
+            auto f = arm_compute::support::cpp14::make_unique<NEGEMMConvolutionLayer>(memory_manager);
+            f->configure(input, weights, biases, output, conv_info, weights_info, dilation, act_info, num_groups, enable_fast_math);
+            return f;
         }
         case ConvolutionMethod::GEMM_CONV2D:
         {
-            auto f = arm_compute::support::cpp14::make_unique<NEGEMMConv2d>(_memory_manager);
+            auto f = arm_compute::support::cpp14::make_unique<NEGEMMConv2d>(memory_manager);
             f->configure(input, weights, biases, output, info);
-            _function = std::move(f);
-            break;
+            return f;
         }
         case ConvolutionMethod::DIRECT:
         {
-            auto f = arm_compute::support::cpp14::make_unique<NEDirectConvolutionLayer>(_memory_manager);
-            f->configure(input, weights, biases, output, conv_info, act_info);
-            _function = std::move(f);
-            break;
+            auto f = arm_compute::support::cpp14::make_unique<NEDirectConvolutionLayer>(memory_manager);
+            f->configure(input, weights, biases, output, conv_info, act_info, dilation);
+            return f;
         }
         case ConvolutionMethod::FFT:
         {
-            auto f = arm_compute::support::cpp14::make_unique<NEFFTConvolutionLayer>(_memory_manager);
+            auto f = arm_compute::support::cpp14::make_unique<NEFFTConvolutionLayer>(memory_manager);
             f->configure(input, weights, biases, output, conv_info, act_info);
-            _function = std::move(f);
-            break;
+            return f;
         }
         default:
             ARM_COMPUTE_ERROR("Not supported.");
-            break;
+            return nullptr;
     }
 }
 
-Status NEConvolutionLayer::validate(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *biases, const ITensorInfo *output, const PadStrideInfo &conv_info,
-                                    const WeightsInfo &weights_info, const Size2D &dilation, const ActivationLayerInfo &act_info, bool enable_fast_math, unsigned int num_groups)
+Status validate_method(ConvolutionMethod method, const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *biases, const ITensorInfo *output, const PadStrideInfo &conv_info,
+                       const WeightsInfo &weights_info, const Size2D &dilation, const ActivationLayerInfo &act_info, bool enable_fast_math, unsigned int num_groups)
 {
-    ARM_COMPUTE_RETURN_ERROR_ON_MSG((num_groups != 1), "Grouping (num_groups != 1) is not supported on NEON");
-
     const Conv2dInfo info(conv_info, dilation, act_info, enable_fast_math, num_groups);
-    switch(NEConvolutionLayer::get_convolution_method(input, weights, output, conv_info, weights_info, dilation, act_info, enable_fast_math))
+    switch(method)
     {
         case ConvolutionMethod::WINOGRAD:
             ARM_COMPUTE_RETURN_ON_ERROR(NEWinogradConvolutionLayer::validate(input, weights, biases, output, conv_info, act_info, enable_fast_math));
             break;
         case ConvolutionMethod::GEMM:
-            ARM_COMPUTE_RETURN_ON_ERROR(NEGEMMConvolutionLayer::validate(input, weights, biases, output, conv_info, weights_info, dilation, act_info));
+            ARM_COMPUTE_RETURN_ON_ERROR(NEGEMMConvolutionLayer::validate(input, weights, biases, output, conv_info, weights_info, dilation, act_info, num_groups, enable_fast_math));
             break;
         case ConvolutionMethod::GEMM_CONV2D:
             ARM_COMPUTE_RETURN_ON_ERROR(NEGEMMConv2d::validate(input, weights, biases, output, info));
             break;
         case ConvolutionMethod::DIRECT:
-            ARM_COMPUTE_RETURN_ON_ERROR(NEDirectConvolutionLayer::validate(input, weights, biases, output, conv_info, act_info));
+            ARM_COMPUTE_RETURN_ON_ERROR(NEDirectConvolutionLayer::validate(input, weights, biases, output, conv_info, act_info, dilation));
             break;
         case ConvolutionMethod::FFT:
             ARM_COMPUTE_RETURN_ON_ERROR(NEFFTConvolutionLayer::validate(input, weights, nullptr, output, conv_info, act_info));
             break;
         default:
-            ARM_COMPUTE_ERROR("Not supported.");
-            break;
+            ARM_COMPUTE_RETURN_ERROR_MSG("Not supported.");
     }
 
     return Status{};
 }
 
+/** Identifier of a convolution configuration in the tuner table: everything the performance of the methods depends on */
+std::string configuration_id(const ITensorInfo *input, const ITensorInfo *weights, const PadStrideInfo &conv_info, const Size2D &dilation, const ActivationLayerInfo &act_info,
+                             bool enable_fast_math)
+{
+    std::stringstream ss;
+    ss << string_from_data_type(input->data_type()) << "_" << string_from_data_layout(input->data_layout());
+    for(const auto *info : { input, weights })
+    {
+        ss << "_";
+        for(size_t d = 0; d < info->num_dimensions(); ++d)
+        {
+            ss << (d == 0 ? "" : "x") << info->dimension(d);
+        }
+    }
+    ss << "_s" << conv_info.stride().first << "x" << conv_info.stride().second;
+    ss << "_p" << conv_info.pad_left() << "x" << conv_info.pad_right() << "x" << conv_info.pad_top() << "x" << conv_info.pad_bottom();
+    ss << "_d" << dilation.x() << "x" << dilation.y();
+    ss << "_a" << (act_info.enabled() ? static_cast<int>(act_info.activation()) : -1);
+    ss << "_f" << enable_fast_math;
+    ss << "_t" << NEScheduler::get().num_threads();
+    return ss.str();
+}
+
+/** Measure every valid method on tensors with the same configuration and return the fastest */
+ConvolutionMethod find_fastest_method(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *biases, const ITensorInfo *output, const PadStrideInfo &conv_info,
+                                      const WeightsInfo &weights_info, const Size2D &dilation, const ActivationLayerInfo &act_info, bool enable_fast_math)
+{
+    // Output might not be initialized yet
+    TensorInfo output_info(*output);
+    if(output_info.total_size() == 0)
+    {
+        output_info = input->clone()->set_tensor_shape(misc::shape_calculator::compute_deep_convolution_shape(*input, *weights, conv_info)).set_quantization_info(output->quantization_info());
+    }
+
+    ConvolutionMethod             fastest_method = NEConvolutionLayer::get_convolution_method(input, weights, output, conv_info, weights_info, dilation, act_info, enable_fast_math);
+    std::chrono::nanoseconds::rep fastest_time   = std::numeric_limits<std::chrono::nanoseconds::rep>::max();
+    for(const auto method : tunable_methods)
+    {
+        if(!bool(validate_method(method, input, weights, biases, &output_info, conv_info, weights_info, dilation, act_info, enable_fast_math, 1)))
+        {
+            continue;
+        }
+
+        Tensor src{};
+        Tensor wei{};
+        Tensor bia{};
+        Tensor dst{};
+        src.allocator()->init(input->clone()->set_is_resizable(true).reset_padding());
+        wei.allocator()->init(weights->clone()->set_is_resizable(true).reset_padding());
+        if(biases != nullptr)
+        {
+            bia.allocator()->init(biases->clone()->set_is_resizable(true).reset_padding());
+        }
+        dst.allocator()->init(output_info.clone()->set_is_resizable(true).reset_padding());
+
+        auto f = create_function(method, nullptr, &src, &wei, (biases != nullptr) ? &bia : nullptr, &dst, conv_info, weights_info, dilation, act_info, enable_fast_math, 1);
+
+        for(auto *tensor : { &src, &wei, &bia, &dst })
+        {
+            if(tensor->info()->total_size() != 0)
+            {
+                tensor->allocator()->allocate();
+                std::memset(tensor->buffer(), 0, tensor->info()->total_size());
+            }
+        }
+
+        // Warm up, then keep the best of a few runs
+        f->run();
+        std::chrono::nanoseconds::rep best_time = std::numeric_limits<std::chrono::nanoseconds::rep>::max();
+        for(unsigned int i = 0; i < num_tuning_iterations; ++i)
+        {
+            const auto start = std::chrono::steady_clock::now();
+            f->run();
+            const auto end = std::chrono::steady_clock::now();
+            best_time      = std::min(best_time, std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+        }
+
+        if(best_time < fastest_time)
+        {
+            fastest_method = method;
+            fastest_time   = best_time;
+        }
+    }
+    return fastest_method;
+}
+} // namespace
+
+NEConvolutionLayer::NEConvolutionLayer(std::shared_ptr<IMemoryManager> memory_manager) //NOLINT
+    : _memory_manager(std::move(memory_manager)),
+      _function()
+{
+}
+
+void NEConvolutionLayer::configure(ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const PadStrideInfo &conv_info, const WeightsInfo &weights_info,
+                                   const Size2D &dilation, const ActivationLayerInfo &act_info, bool enable_fast_math, unsigned int num_groups)
+{
+    // Perform validate step
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, weights, output);
+    ARM_COMPUTE_ERROR_THROW_ON(NEConvolutionLayer::validate(input->info(), weights->info(), ((biases != nullptr) ? biases->info() : nullptr), output->info(), conv_info, weights_info, dilation, act_info,
+                                                            enable_fast_math, num_groups));
+
+    // Grouped convolutions are only supported by NEGEMMConvolutionLayer
+    ConvolutionMethod method = (num_groups != 1) ? ConvolutionMethod::GEMM :
+                               NEConvolutionLayer::get_convolution_method(input->info(), weights->info(), output->info(), conv_info, weights_info, dilation, act_info, enable_fast_math);
+
+    NEConvolutionMethodTuner *tuner = conv_method_tuner.load();
+    if(num_groups == 1 && tuner != nullptr && tuner->tune_new_configs())
+    {
+        // Measure every valid method unless the configuration has already been tuned, in which case get_convolution_method() returned the tuned method
+        const std::string config_id = configuration_id(input->info(), weights->info(), conv_info, dilation, act_info, enable_fast_math);
+        if(!tuner->find_method(config_id, method))
+        {
+            method = find_fastest_method(input->info(), weights->info(), (biases != nullptr) ? biases->info() : nullptr, output->info(), conv_info, weights_info, dilation, act_info, enable_fast_math);
+            tuner->add_method_to_table(config_id, method);
+        }
+    }
+
+    _function = create_function(method, _memory_manager, input, weights, biases, output, conv_info, weights_info, dilation, act_info, enable_fast_math, num_groups);
+}
+
+Status NEConvolutionLayer::validate(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *biases, const ITensorInfo *output, const PadStrideInfo &conv_info,
+                                    const WeightsInfo &weights_info, const Size2D &dilation, const ActivationLayerInfo &act_info, bool enable_fast_math, unsigned int num_groups)
+{
+    const ConvolutionMethod method = (num_groups != 1) ? ConvolutionMethod::GEMM :
+                                     NEConvolutionLayer::get_convolution_method(input, weights, output, conv_info, weights_info, dilation, act_info, enable_fast_math);
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_method(method, input, weights, biases, output, conv_info, weights_info, dilation, act_info, enable_fast_math, num_groups));
+
+    return Status{};
+}
+
 ConvolutionMethod NEConvolutionLayer::get_convolution_method(const ITensorInfo *input, const ITensorInfo *weights,
                                                              const ITensorInfo *output, const PadStrideInfo &conv_info,
                                                              const WeightsInfo &weights_info, const Size2D &dilation, const ActivationLayerInfo &act_info, bool enable_fast_math)
@@ -138,6 +271,15 @@ ConvolutionMethod NEConvolutionLayer::get_convolution_method(const ITensorInfo *
     ARM_COMPUTE_ERROR_ON_NULLPTR(input, output, weights);
     ARM_COMPUTE_UNUSED(weights_info);
 
+    // Use the method measured to be the fastest if the configuration has been tuned
+    const NEConvolutionMethodTuner *tuner        = conv_method_tuner.load();
+    ConvolutionMethod               tuned_method = ConvolutionMethod::GEMM;
+    if(tuner != nullptr && tuner->find_method(configuration_id(input, weights, conv_info, dilation, act_info, enable_fast_math), tuned_method)
+       && bool(validate_method(tuned_method, input, weights, nullptr, output, conv_info, weights_info, dilation, act_info, enable_fast_math, 1)))
+    {
+        return tuned_method;
+    }
+
     const size_t idx_w = get_data_layout_dimension_index(input->data_layout(), DataLayoutDimension::WIDTH);
     const size_t idx_h = get_data_layout_dimension_index(input->data_layout(), DataLayoutDimension::HEIGHT);
     const size_t idx_c = get_data_layout_dimension_index(input->data_layout(), DataLayoutDimension::CHANNEL);
@@ -236,7 +378,10 @@ ConvolutionMethod NEConvolutionLayer::get_convolution_method(const ITensorInfo *
             return ConvolutionMethod::GEMM;
         }
 
-        if(bool(NEWinogradConvolutionLayer::validate(input, weights, nullptr, output, conv_info, act_info, enable_fast_math)))
+        // Quantized Winograd replaces the int8 GEMM, which uses the dot product instructions when available, with an int16 one:
+        // only pick it when fast math is requested
+        const bool is_quantized_winograd_allowed = !is_data_type_quantized_asymmetric(input->data_type()) || enable_fast_math;
+        if(is_quantized_winograd_allowed && bool(NEWinogradConvolutionLayer::validate(input, weights, nullptr, output, conv_info, act_info, enable_fast_math)))
         {
             return ConvolutionMethod::WINOGRAD;
         }
@@ -248,6 +393,11 @@ ConvolutionMethod NEConvolutionLayer::get_convolution_method(const ITensorInfo *
     }
 }
 
+void NEConvolutionLayer::set_tuner(NEConvolutionMethodTuner *tuner)
+{
+    conv_method_tuner = tuner;
+}
+
 void NEConvolutionLayer::run()
 {
     prepare();
@@ -28,8 +28,10 @@
 #include "arm_compute/core/Validate.h"
 #include "arm_compute/core/utils/misc/ShapeCalculator.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
+#include "src/core/NEON/kernels/NEDeconvolutionCol2ImKernel.h"
 #include "src/core/NEON/kernels/NEWeightsReshapeKernel.h"
 #include "src/core/helpers/AutoConfiguration.h"
+#include "support/MemorySupport.h"
 
 using namespace arm_compute::misc::shape_calculator;
 
@@ -64,23 +66,85 @@ PadStrideInfo compute_upsample_info(const PadStrideInfo &info, uint32_t deconv_p
     return PadStrideInfo(stride_x, stride_y, deconv_pad_left, deconv_pad_right, deconv_pad_top, deconv_pad_bottom, DimensionRoundingType::FLOOR);
 }
 
+/** Permutation of the NHWC weights [IFM, kernel_x, kernel_y, OFM] to [OFM, kernel_x, kernel_y, IFM], which read as a [OFM * kernel_x * kernel_y, IFM] matrix
+ *  is the right-hand side of the GEMM of the deconvolution
+ */
+const PermutationVector gemm_weights_permutation(3U, 1U, 2U, 0U);
+
+TensorInfo get_permuted_weights_info(const ITensorInfo &weights)
+{
+    TensorShape permuted_weights_shape = weights.tensor_shape();
+    permute(permuted_weights_shape, gemm_weights_permutation);
+    return TensorInfo(weights.clone()->set_is_resizable(true).reset_padding().set_tensor_shape(permuted_weights_shape));
+}
+
+TensorInfo get_gemm_weights_info(const ITensorInfo &weights)
+{
+    const TensorShape gemm_weights_shape(weights.dimension(1) * weights.dimension(2) * weights.dimension(3), weights.dimension(0));
+    return TensorInfo(weights.clone()->set_is_resizable(true).reset_padding().set_tensor_shape(gemm_weights_shape));
+}
+
+TensorInfo get_gemm_output_info(const ITensorInfo &input, const ITensorInfo &weights)
+{
+    TensorShape gemm_output_shape = input.tensor_shape();
+    gemm_output_shape.set(0, weights.dimension(1) * weights.dimension(2) * weights.dimension(3));
+    return TensorInfo(input.clone()->set_is_resizable(true).reset_padding().set_tensor_shape(gemm_output_shape));
+}
+
+GEMMInfo get_gemm_info(const ITensorInfo &input)
+{
+    // The input is read as a [IFM, width * height] matrix per batch and the output written as [OFM * kernel_x * kernel_y, width, height]
+    return GEMMInfo(false, false, true /* Reshape weights only for the first run */, input.dimension(2), true /* Reinterpret the input as 3D */);
+}
+
+Status validate_gemm_deconvolution(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *bias, const ITensorInfo *output, const PadStrideInfo &info)
+{
+    const TensorInfo permuted_weights_info = get_permuted_weights_info(*weights);
+    const TensorInfo gemm_weights_info     = get_gemm_weights_info(*weights);
+    const TensorInfo gemm_output_info      = get_gemm_output_info(*input, *weights);
+
+    ARM_COMPUTE_RETURN_ON_ERROR(NEPermute::validate(weights, &permuted_weights_info, gemm_weights_permutation));
+    ARM_COMPUTE_RETURN_ON_ERROR(NEGEMM::validate(input, &gemm_weights_info, nullptr, &gemm_output_info, 1.f, 0.f, get_gemm_info(*input)));
+    ARM_COMPUTE_RETURN_ON_ERROR(NEDeconvolutionCol2ImKernel::validate(&gemm_output_info, bias, output, Size2D(weights->dimension(1), weights->dimension(2)), info));
+
+    return Status{};
+}
+
+/** Whether the deconvolution can be computed directly on the input with a GEMM followed by a col2im
+ *
+ * This avoids the zeroes inserted by the upsampling when the deconvolution is strided.
+ */
+bool use_gemm_deconvolution(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *bias, const ITensorInfo *output, const PadStrideInfo &info)
+{
+    return input->data_layout() == DataLayout::NHWC && is_data_type_float(input->data_type()) && (info.stride().first > 1 || info.stride().second > 1)
+           && bool(validate_gemm_deconvolution(input, weights, bias, output, info));
+}
 } // namespace
 
 NEDeconvolutionLayer::NEDeconvolutionLayer(std::shared_ptr<IMemoryManager> memory_manager) // NOLINT
-    : _memory_group(std::move(memory_manager)),
+    : _memory_group(memory_manager),
       _conv_f(),
       _upsample_f(),
       _flip_weights(),
+      _permute_weights(),
+      _gemm(std::move(memory_manager)),
+      _col2im_kernel(),
       _scaled_output(),
       _weights_flipped(),
       _flip_axis(),
+      _weights_permuted(),
+      _weights_gemm(),
+      _gemm_output(),
       _original_weights(nullptr),
       _input(nullptr),
       _info(),
+      _is_gemm_deconv(false),
       _is_prepared(false)
 {
 }
 
+NEDeconvolutionLayer::~NEDeconvolutionLayer() = default;
+
 Status NEDeconvolutionLayer::validate(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *bias, const ITensorInfo *output, const PadStrideInfo &info)
 {
     ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, weights, output);
@@ -118,6 +182,11 @@ Status NEDeconvolutionLayer::validate(const ITensorInfo *input, const ITensorInf
         ARM_COMPUTE_RETURN_ERROR_ON_MSG(output->dimension(Window::DimZ) != output_shape.z(), "Output's depth is invalid.");
     }
 
+    if(use_gemm_deconvolution(input, weights, bias, output, info))
+    {
+        return Status{};
+    }
+
     uint32_t            deconv_pad_x    = 0;
     uint32_t            deconv_pad_y    = 0;
     const unsigned int  stride_x        = info.stride().first;
@@ -161,6 +230,25 @@ void NEDeconvolutionLayer::configure(ITensor *input, const ITensor *weights, con
     // Output auto initialization if not yet initialized
     auto_init_if_empty(*output->info(), output_shape, 1, input->info()->data_type(), input->info()->quantization_info());
 
+    _is_gemm_deconv = use_gemm_deconvolution(input->info(), weights->info(), (bias == nullptr) ? nullptr : bias->info(), output->info(), info);
+    if(_is_gemm_deconv)
+    {
+        // The weights are permuted and reshaped once in prepare()
+        _weights_permuted.allocator()->init(get_permuted_weights_info(*weights->info()));
+        _permute_weights.configure(weights, &_weights_permuted, gemm_weights_permutation);
+        _weights_gemm.allocator()->init(get_gemm_weights_info(*weights->info()));
+
+        _gemm_output.allocator()->init(get_gemm_output_info(*input->info(), *weights->info()));
+        _memory_group.manage(&_gemm_output);
+        _gemm.configure(input, &_weights_gemm, nullptr, &_gemm_output, 1.f, 0.f, get_gemm_info(*input->info()));
+
+        _col2im_kernel = arm_compute::support::cpp14::make_unique<NEDeconvolutionCol2ImKernel>();
+        _col2im_kernel->configure(&_gemm_output, bias, output, Size2D(weights->info()->dimension(width_idx), weights->info()->dimension(height_idx)), info);
+
+        _gemm_output.allocator()->allocate();
+        return;
+    }
+
     _flip_axis.allocator()->init(TensorInfo(TensorShape(2U), 1, DataType::U32));
     _memory_group.manage(&_scaled_output);
 
@@ -201,6 +289,13 @@ void NEDeconvolutionLayer::run()
 
     MemoryGroupResourceScope scope_mg(_memory_group);
 
+    if(_is_gemm_deconv)
+    {
+        _gemm.run();
+        NEScheduler::get().schedule(_col2im_kernel.get(), Window::DimY);
+        return;
+    }
+
     _upsample_f.run();
     _conv_f.run();
 }
@@ -211,6 +306,28 @@ void NEDeconvolutionLayer::prepare()
     {
         ARM_COMPUTE_ERROR_ON(!_original_weights->is_used());
 
+        if(_is_gemm_deconv)
+        {
+            // Run weights permutation and mark original weights tensor as unused
+            _weights_permuted.allocator()->allocate();
+            _permute_weights.run();
+            _original_weights->mark_as_unused();
+
+            // The permuted weights are contiguous, so they can be read as a matrix
+            _weights_gemm.allocator()->import_memory(_weights_permuted.buffer());
+            _gemm.prepare();
+
+            // Free the permuted weights if the GEMM has made its own copy of them
+            if(!_weights_gemm.is_used())
+            {
+                _weights_gemm.allocator()->free();
+                _weights_permuted.allocator()->free();
+            }
+
+            _is_prepared = true;
+            return;
+        }
+
         // Run weights flipping and mark original weights tensor as unused
         _weights_flipped.allocator()->allocate();
         _flip_weights.run();
@@ -0,0 +1,222 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NEON/functions/NEDepthwiseSeparableConvolutionLayer.h"
+
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/utils/misc/ShapeCalculator.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+#include "src/core/NEON/kernels/NEDepthwiseConvolutionLayerNativeKernel.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "support/MemorySupport.h"
+
+namespace arm_compute
+{
+using namespace arm_compute::misc::shape_calculator;
+
+namespace
+{
+TensorInfo get_depthwise_output_info(const ITensorInfo &input, const ITensorInfo &depthwise_weights, const PadStrideInfo &depthwise_conv_info, const QuantizationInfo &depthwise_output_qinfo,
+                                     unsigned int depth_multiplier, const Size2D &dilation)
+{
+    const TensorShape depthwise_output_shape = compute_depthwise_convolution_shape(input, depthwise_weights, depthwise_conv_info, depth_multiplier, dilation);
+
+    TensorInfo depthwise_output(input.clone()->set_is_resizable(true).reset_padding().set_tensor_shape(depthwise_output_shape));
+    if(is_data_type_quantized_asymmetric(input.data_type()))
+    {
+        depthwise_output.set_quantization_info(depthwise_output_qinfo);
+    }
+    return depthwise_output;
+}
+
+/** Number of output rows processed by each block
+ *
+ * The block has to hold a few rows of the depthwise output and of the final output in the caches, and must divide
+ * the output height so that the same pointwise function can be used for every block.
+ */
+unsigned int get_block_rows(const TensorShape &depthwise_output_shape, const TensorShape &output_shape, size_t element_size)
+{
+    const unsigned int num_rows   = depthwise_output_shape[2];
+    const size_t       row_size   = (depthwise_output_shape[0] * depthwise_output_shape[1] + output_shape[0] * output_shape[1]) * element_size;
+    const size_t       cache_size = static_cast<size_t>(NEScheduler::get().cpu_info().get_L2_cache_size()) * NEScheduler::get().num_threads();
+    const unsigned int max_rows   = static_cast<unsigned int>(std::max<size_t>(1, std::min<size_t>(cache_size / row_size, num_rows)));
+
+    unsigned int block_rows = max_rows;
+    while(num_rows % block_rows != 0)
+    {
+        --block_rows;
+    }
+    return block_rows;
+}
+
+/** Check that a block of rows of the output can be written through a view sharing the strides of the output */
+Status validate_output_block(const ITensorInfo &output_block, const ITensorInfo &output)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(output_block.strides_in_bytes()[1] != output.strides_in_bytes()[1] || output_block.strides_in_bytes()[2] != output.strides_in_bytes()[2],
+                                    "The output block must have the same strides as the output");
+    return Status{};
+}
+} // namespace
+
+NEDepthwiseSeparableConvolutionLayer::~NEDepthwiseSeparableConvolutionLayer() = default;
+
+NEDepthwiseSeparableConvolutionLayer::NEDepthwiseSeparableConvolutionLayer(std::shared_ptr<IMemoryManager> memory_manager)
+    : _memory_group(memory_manager), _depthwise_kernel(), _depthwise_activation(), _pointwise_conv(memory_manager), _depthwise_block(), _depthwise_output(), _pointwise_output(), _output(nullptr),
+      _block_rows(0), _num_rows(0), _num_batches(0), _is_activationlayer_enabled(false), _is_prepared(false)
+{
+}
+
+void NEDepthwiseSeparableConvolutionLayer::configure(const ITensor *input, const ITensor *depthwise_weights, const ITensor *depthwise_biases, const ITensor *pointwise_weights,
+                                                     const ITensor *pointwise_biases, ITensor *output, const PadStrideInfo &depthwise_conv_info, const QuantizationInfo &depthwise_output_qinfo,
+                                                     unsigned int depth_multiplier, const ActivationLayerInfo &depthwise_act_info, const ActivationLayerInfo &pointwise_act_info, const Size2D &dilation)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, depthwise_weights, pointwise_weights, output);
+
+    const TensorInfo depthwise_output_info = get_depthwise_output_info(*input->info(), *depthwise_weights->info(), depthwise_conv_info, depthwise_output_qinfo, depth_multiplier, dilation);
+
+    // Auto-initialize the output if not initialized yet
+    TensorShape output_shape = depthwise_output_info.tensor_shape();
+    output_shape.set(0, pointwise_weights->info()->dimension(3));
+    auto_init_if_empty(*output->info(), input->info()->clone()->set_tensor_shape(output_shape).set_quantization_info(output->info()->quantization_info()));
+
+    ARM_COMPUTE_ERROR_THROW_ON(NEDepthwiseSeparableConvolutionLayer::validate(input->info(), depthwise_weights->info(), (depthwise_biases != nullptr) ? depthwise_biases->info() : nullptr,
+                                                                              pointwise_weights->info(), (pointwise_biases != nullptr) ? pointwise_biases->info() : nullptr, output->info(),
+                                                                              depthwise_conv_info, depthwise_output_qinfo, depth_multiplier, depthwise_act_info, pointwise_act_info, dilation));
+
+    _output                     = output;
+    _is_activationlayer_enabled = depthwise_act_info.enabled();
+    _is_prepared                = false;
+    _num_rows                   = depthwise_output_info.dimension(2);
+    _num_batches                = depthwise_output_info.dimension(3);
+    _block_rows                 = get_block_rows(depthwise_output_info.tensor_shape(), output->info()->tensor_shape(), input->info()->element_size());
+
+    // Buffer holding a single block of the depthwise output
+    TensorShape depthwise_block_shape = depthwise_output_info.tensor_shape();
+    depthwise_block_shape.set(2, _block_rows);
+    depthwise_block_shape.set(3, 1);
+    _depthwise_block.allocator()->init(depthwise_output_info.clone()->set_tensor_shape(depthwise_block_shape));
+    _memory_group.manage(&_depthwise_block);
+
+    // The depthwise kernel is configured on the whole output shape, but writes each block at the origin of the tensor,
+    // whose memory is imported from the block buffer at run time
+    _depthwise_output.allocator()->init(depthwise_output_info);
+    _depthwise_kernel = arm_compute::support::cpp14::make_unique<NEDepthwiseConvolutionLayerNativeKernel>();
+    _depthwise_kernel->configure(input, depthwise_weights, depthwise_biases, &_depthwise_output, depthwise_conv_info, depth_multiplier, dilation);
+
+    if(_is_activationlayer_enabled)
+    {
+        _depthwise_activation.configure(&_depthwise_block, nullptr, depthwise_act_info);
+    }
+
+    // View of the block of the output written by the pointwise convolution: it shares the strides of the output and is moved over it at run time
+    TensorShape output_block_shape = output->info()->tensor_shape();
+    output_block_shape.set(2, _block_rows);
+    output_block_shape.set(3, 1);
+    _pointwise_output.allocator()->init(output->info()->clone()->set_is_resizable(true).set_tensor_shape(output_block_shape));
+    _pointwise_conv.configure(&_depthwise_block, pointwise_weights, pointwise_biases, &_pointwise_output, PadStrideInfo(1, 1, 0, 0), WeightsInfo(), Size2D(1U, 1U), pointwise_act_info);
+
+    // Padding requested on the block view by the pointwise convolution must be reflected in the output
+    if(output->info()->is_resizable())
+    {
+        output->info()->extend_padding(_pointwise_output.info()->padding());
+    }
+    ARM_COMPUTE_ERROR_THROW_ON(validate_output_block(*_pointwise_output.info(), *output->info()));
+
+    _depthwise_block.allocator()->allocate();
+}
+
+Status NEDepthwiseSeparableConvolutionLayer::validate(const ITensorInfo *input, const ITensorInfo *depthwise_weights, const ITensorInfo *depthwise_biases, const ITensorInfo *pointwise_weights,
+                                                      const ITensorInfo *pointwise_biases, const ITensorInfo *output, const PadStrideInfo &depthwise_conv_info, const QuantizationInfo &depthwise_output_qinfo,
+                                                      unsigned int depth_multiplier, const ActivationLayerInfo &depthwise_act_info, const ActivationLayerInfo &pointwise_act_info, const Size2D &dilation)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, depthwise_weights, pointwise_weights, output);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_LAYOUT_NOT_IN(input, DataLayout::NHWC);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(pointwise_weights->dimension(1) != 1 || pointwise_weights->dimension(2) != 1, "The pointwise convolution must be 1x1");
+    ARM_COMPUTE_RETURN_ERROR_ON(input->num_dimensions() > 4);
+
+    const TensorInfo depthwise_output = get_depthwise_output_info(*input, *depthwise_weights, depthwise_conv_info, depthwise_output_qinfo, depth_multiplier, dilation);
+
+    ARM_COMPUTE_RETURN_ON_ERROR(NEDepthwiseConvolutionLayerNativeKernel::validate(input, depthwise_weights, depthwise_biases, &depthwise_output, depthwise_conv_info, depth_multiplier, dilation));
+    if(depthwise_act_info.enabled())
+    {
+        ARM_COMPUTE_RETURN_ON_ERROR(NEActivationLayer::validate(&depthwise_output, nullptr, depthwise_act_info));
+    }
+    ARM_COMPUTE_RETURN_ON_ERROR(NEGEMMConvolutionLayer::validate(&depthwise_output, pointwise_weights, pointwise_biases, output, PadStrideInfo(1, 1, 0, 0), WeightsInfo(), Size2D(1U, 1U),
+                                                                 pointwise_act_info));
+
+    if(output->total_size() != 0)
+    {
+        TensorShape output_block_shape = output->tensor_shape();
+        output_block_shape.set(2, 1);
+        output_block_shape.set(3, 1);
+        ARM_COMPUTE_RETURN_ON_ERROR(validate_output_block(output->clone()->set_tensor_shape(output_block_shape), *output));
+    }
+
+    return Status{};
+}
+
+void NEDepthwiseSeparableConvolutionLayer::run()
+{
+    prepare();
+
+    MemoryGroupResourceScope scope_mg(_memory_group);
+
+    // The block buffer can move between runs when it is managed
+    _depthwise_output.allocator()->import_memory(_depthwise_block.buffer()).throw_if_error();
+
+    const ITensorInfo &output_info = *_output->info();
+    uint8_t *const     output_base = _output->buffer() + output_info.offset_first_element_in_bytes() - _pointwise_output.info()->offset_first_element_in_bytes();
+
+    for(unsigned int batch = 0; batch < _num_batches; ++batch)
+    {
+        for(unsigned int first_row = 0; first_row < _num_rows; first_row += _block_rows)
+        {
+            _depthwise_kernel->set_output_block(batch, first_row, _block_rows);
+            NEScheduler::get().schedule(_depthwise_kernel.get(), Window::DimY);
+
+            if(_is_activationlayer_enabled)
+            {
+                _depthwise_activation.run();
+            }
+
+            // Consume the block while it is still in cache
+            _pointwise_output.allocator()->import_memory(output_base + first_row * output_info.strides_in_bytes()[2] + batch * output_info.strides_in_bytes()[3]).throw_if_error();
+            _pointwise_conv.run();
+        }
+    }
+}
+
+void NEDepthwiseSeparableConvolutionLayer::prepare()
+{
+    if(!_is_prepared)
+    {
+        // Padding requested on the output by the functions configured after this one must be reflected in the block view.
+        // The output already holds the padding of the view (see configure()), so both end up with the same strides.
+        _pointwise_output.info()->extend_padding(_output->info()->padding());
+
+        _pointwise_conv.prepare();
+        _is_prepared = true;
+    }
+}
+} // namespace arm_compute
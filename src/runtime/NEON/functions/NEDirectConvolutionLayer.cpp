@@ -28,25 +28,32 @@
 #include "arm_compute/core/Validate.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
 #include "src/core/NEON/kernels/NEDirectConvolutionLayerKernel.h"
+#include "src/core/NEON/kernels/NEDirectConvolutionLayerNHWCKernel.h"
 #include "src/core/NEON/kernels/NEDirectConvolutionLayerOutputStageKernel.h"
 #include "src/core/NEON/kernels/NEFillBorderKernel.h"
 #include "support/MemorySupport.h"
 
 namespace arm_compute
 {
+namespace
+{
+/** Permutation moving the output feature maps of NHWC weights to the innermost dimension, as expected by @ref NEDirectConvolutionLayerNHWCKernel */
+const PermutationVector nhwc_weights_permutation(3U, 0U, 1U, 2U);
+} // namespace
+
 NEDirectConvolutionLayer::~NEDirectConvolutionLayer() = default;
 
 NEDirectConvolutionLayer::NEDirectConvolutionLayer(std::shared_ptr<IMemoryManager> memory_manager)
-    : _memory_group(std::move(memory_manager)), _output_stage_kernel(), _conv_kernel(), _input_border_handler(), _activationlayer_function(), _accumulator(), _has_bias(false),
-      _is_activationlayer_enabled(false), _dim_split(Window::DimZ), _is_padding_required()
+    : _memory_group(std::move(memory_manager)), _output_stage_kernel(), _conv_kernel(), _conv_kernel_nhwc(), _permute_weights(), _permuted_weights(), _original_weights(nullptr), _input_border_handler(),
+      _activationlayer_function(), _accumulator(), _has_bias(false), _is_activationlayer_enabled(false), _dim_split(Window::DimZ), _is_padding_required(), _is_nhwc(false), _is_prepared(false)
 {
 }
 
-void NEDirectConvolutionLayer::configure(ITensor *input, const ITensor *weights, const ITensor *bias, ITensor *output, const PadStrideInfo &conv_info, const ActivationLayerInfo &act_info)
+void NEDirectConvolutionLayer::configure(ITensor *input, const ITensor *weights, const ITensor *bias, ITensor *output, const PadStrideInfo &conv_info, const ActivationLayerInfo &act_info,
+                                         const Size2D &dilation)
 {
     ARM_COMPUTE_ERROR_ON(input->info()->data_layout() == DataLayout::UNKNOWN);
     _output_stage_kernel  = arm_compute::support::cpp14::make_unique<NEDirectConvolutionLayerOutputStageKernel>();
-    _conv_kernel          = arm_compute::support::cpp14::make_unique<NEDirectConvolutionLayerKernel>();
     _input_border_handler = arm_compute::support::cpp14::make_unique<NEFillBorderKernel>();
 
     // Free accumulator
@@ -55,17 +62,34 @@ void NEDirectConvolutionLayer::configure(ITensor *input, const ITensor *weights,
         _accumulator.allocator()->free();
     }
 
-    _dim_split = input->info()->data_layout() == DataLayout::NCHW ? Window::DimZ : Window::DimY;
+    _is_nhwc          = input->info()->data_layout() == DataLayout::NHWC;
+    _is_prepared      = false;
+    _original_weights = weights;
+    _dim_split        = _is_nhwc ? Window::DimY : Window::DimZ;
 
     // Check if bias should be added in the convolution result
     _has_bias = (bias != nullptr);
 
-    _conv_kernel->configure(input, weights, output, conv_info);
+    if(_is_nhwc)
+    {
+        // Vectorise over the output feature maps: move them to the innermost dimension of the weights
+        _permute_weights.configure(weights, &_permuted_weights, nhwc_weights_permutation);
+        _conv_kernel_nhwc = arm_compute::support::cpp14::make_unique<NEDirectConvolutionLayerNHWCKernel>();
+        _conv_kernel_nhwc->configure(input, &_permuted_weights, output, conv_info, dilation);
+        _is_padding_required = false;
+    }
+    else
+    {
+        ARM_COMPUTE_ERROR_ON(dilation != Size2D(1U, 1U));
+        _conv_kernel = arm_compute::support::cpp14::make_unique<NEDirectConvolutionLayerKernel>();
+        _conv_kernel->configure(input, weights, output, conv_info);
+        _is_padding_required = !_conv_kernel->border_size().empty();
+    }
+
     if(_has_bias)
     {
         _output_stage_kernel->configure(output, bias);
     }
-    _is_padding_required = !_conv_kernel->border_size().empty();
 
     if(_is_padding_required)
     {
@@ -82,7 +106,7 @@ void NEDirectConvolutionLayer::configure(ITensor *input, const ITensor *weights,
 }
 
 Status NEDirectConvolutionLayer::validate(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *bias, const ITensorInfo *output, const PadStrideInfo &conv_info,
-                                          const ActivationLayerInfo &act_info)
+                                          const ActivationLayerInfo &act_info, const Size2D &dilation)
 {
     ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, weights, output);
 
@@ -91,7 +115,17 @@ Status NEDirectConvolutionLayer::validate(const ITensorInfo *input, const ITenso
     TensorInfo accumulator(output->clone()->set_is_resizable(true).reset_padding().set_data_type(data_type));
 
     // Validate Convolution kernel
-    ARM_COMPUTE_RETURN_ON_ERROR(NEDirectConvolutionLayerKernel::validate(input, weights, &accumulator, conv_info));
+    if(input->data_layout() == DataLayout::NHWC)
+    {
+        TensorInfo permuted_weights(weights->clone()->set_is_resizable(true).reset_padding());
+        ARM_COMPUTE_RETURN_ON_ERROR(NEPermute::validate(weights, &permuted_weights, nhwc_weights_permutation));
+        ARM_COMPUTE_RETURN_ON_ERROR(NEDirectConvolutionLayerNHWCKernel::validate(input, &permuted_weights, &accumulator, conv_info, dilation));
+    }
+    else
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(dilation != Size2D(1U, 1U), "Dilation is only supported in NHWC");
+        ARM_COMPUTE_RETURN_ON_ERROR(NEDirectConvolutionLayerKernel::validate(input, weights, &accumulator, conv_info));
+    }
 
     if(bias != nullptr)
     {
@@ -114,13 +148,22 @@ Status NEDirectConvolutionLayer::validate(const ITensorInfo *input, const ITenso
 
 void NEDirectConvolutionLayer::run()
 {
+    prepare();
+
     MemoryGroupResourceScope scope_mg(_memory_group);
 
     if(_is_padding_required)
     {
         NEScheduler::get().schedule(_input_border_handler.get(), Window::DimZ);
     }
-    NEScheduler::get().schedule(_conv_kernel.get(), _dim_split);
+    if(_is_nhwc)
+    {
+        NEScheduler::get().schedule(_conv_kernel_nhwc.get(), _dim_split);
+    }
+    else
+    {
+        NEScheduler::get().schedule(_conv_kernel.get(), _dim_split);
+    }
     if(_has_bias)
     {
         NEScheduler::get().schedule(_output_stage_kernel.get(), Window::DimY);
@@ -131,4 +174,20 @@ void NEDirectConvolutionLayer::run()
         _activationlayer_function.run();
     }
 }
+
+void NEDirectConvolutionLayer::prepare()
+{
+    if(!_is_prepared)
+    {
+        if(_is_nhwc)
+        {
+            ARM_COMPUTE_ERROR_ON(!_original_weights->is_used());
+
+            _permuted_weights.allocator()->allocate();
+            _permute_weights.run();
+            _original_weights->mark_as_unused();
+        }
+        _is_prepared = true;
+    }
+}
 } // namespace arm_compute
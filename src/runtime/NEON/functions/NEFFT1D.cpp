@@ -26,18 +26,67 @@
 #include "arm_compute/core/ITensor.h"
 #include "arm_compute/core/Validate.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
+#include "arm_compute/runtime/NEON/functions/NEPixelWiseMultiplication.h"
+#include "src/core/NEON/kernels/NEFFTChirpKernel.h"
 #include "src/core/NEON/kernels/NEFFTDigitReverseKernel.h"
 #include "src/core/NEON/kernels/NEFFTRadixStageKernel.h"
+#include "src/core/NEON/kernels/NEFFTRealTransformKernel.h"
 #include "src/core/NEON/kernels/NEFFTScaleKernel.h"
+#include "src/core/helpers/AutoConfiguration.h"
 #include "src/core/utils/helpers/fft.h"
 #include "support/MemorySupport.h"
 
+#include <cmath>
+
 namespace arm_compute
 {
+namespace
+{
+/** Check if a real FFT has an odd length, which is taken from the output for an inverse FFT */
+bool is_odd_real_fft(const ITensorInfo &input, const ITensorInfo *output, const FFT1DInfo &config)
+{
+    if(!config.is_real)
+    {
+        return false;
+    }
+    if(config.direction == FFTDirection::Forward)
+    {
+        return input.dimension(0) % 2 != 0;
+    }
+    return (output != nullptr) && (output->total_size() != 0) && (output->dimension(0) % 2 != 0);
+}
+
+/** Length of the complex FFT run by a real or complex FFT */
+unsigned int complex_fft_length(const ITensorInfo &input, const ITensorInfo *output, const FFT1DInfo &config)
+{
+    if(config.is_real)
+    {
+        const bool is_forward = config.direction == FFTDirection::Forward;
+        if(is_odd_real_fft(input, output, config))
+        {
+            // Real FFTs of odd length run a complex FFT of their full length
+            return is_forward ? input.dimension(0) : 2 * input.dimension(0) - 1;
+        }
+
+        // Real FFTs of even length run a complex FFT of half their length
+        return is_forward ? input.dimension(0) / 2 : input.dimension(0) - 1;
+    }
+    return input.tensor_shape()[config.axis];
+}
+
+/** Check if a complex FFT has to be computed with Bluestein's algorithm */
+bool use_bluestein(const ITensorInfo &input, const ITensorInfo *output, const FFT1DInfo &config)
+{
+    return !config.is_real && arm_compute::helpers::fft::decompose_stages(complex_fft_length(input, output, config), NEFFTRadixStageKernel::supported_radix()).empty();
+}
+} // namespace
+
 NEFFT1D::~NEFFT1D() = default;
 
 NEFFT1D::NEFFT1D(std::shared_ptr<IMemoryManager> memory_manager)
-    : _memory_group(std::move(memory_manager)), _digit_reverse_kernel(), _fft_kernels(), _scale_kernel(), _digit_reversed_input(), _digit_reverse_indices(), _num_ffts(0), _axis(0), _run_scale(false)
+    : _memory_manager(memory_manager), _memory_group(std::move(memory_manager)), _digit_reverse_kernel(), _fft_kernels(), _scale_kernel(), _real_transform_kernel(), _digit_reversed_input(),
+      _digit_reverse_indices(), _packed_spectrum(), _chirp_kernel(), _dechirp_kernel(), _chirped_fft(), _chirped_ifft(), _chirp_filter_fft(), _spectrum_product(), _chirped_input(), _chirped_spectrum(),
+      _chirp_filter(), _chirp_filter_spectrum(), _convolved(), _num_ffts(0), _axis(0), _run_scale(false), _is_real_forward(false), _is_real_inverse(false), _is_bluestein(false), _is_prepared(false)
 {
 }
 
@@ -46,32 +95,61 @@ void NEFFT1D::configure(const ITensor *input, ITensor *output, const FFT1DInfo &
     ARM_COMPUTE_ERROR_ON_NULLPTR(input, output);
     ARM_COMPUTE_ERROR_THROW_ON(NEFFT1D::validate(input->info(), output->info(), config));
 
+    _axis         = config.axis;
+    _is_prepared  = false;
+    _is_bluestein = use_bluestein(*input->info(), output->info(), config);
+    if(_is_bluestein)
+    {
+        configure_bluestein(input, output, config);
+        return;
+    }
+
     // Decompose size to radix factors
     const auto         supported_radix   = NEFFTRadixStageKernel::supported_radix();
-    const unsigned int N                 = input->info()->tensor_shape()[config.axis];
+    const unsigned int N                 = complex_fft_length(*input->info(), output->info(), config);
     const auto         decomposed_vector = arm_compute::helpers::fft::decompose_stages(N, supported_radix);
     ARM_COMPUTE_ERROR_ON(decomposed_vector.empty());
 
     // Flags
-    _run_scale = config.direction == FFTDirection::Inverse;
+    _run_scale       = config.direction == FFTDirection::Inverse;
+    _is_real_forward = config.is_real && config.direction == FFTDirection::Forward;
+    _is_real_inverse = config.is_real && config.direction == FFTDirection::Inverse;
 
-    const bool is_c2r = input->info()->num_channels() == 2 && output->info()->num_channels() == 1;
+    const bool is_odd = is_odd_real_fft(*input->info(), output->info(), config);
+    const bool is_c2r = (!config.is_real || is_odd) && input->info()->num_channels() == 2 && output->info()->num_channels() == 1;
+
+    // Rebuild the spectrum of the packed signal, or the full spectrum of a signal of odd length, from the non-redundant bins of the real signal
+    const ITensor *digit_reverse_input = input;
+    if(_is_real_inverse)
+    {
+        FFTRealTransformKernelInfo real_transform_config;
+        real_transform_config.inverse = true;
+        real_transform_config.is_odd  = is_odd;
+        _memory_group.manage(&_packed_spectrum);
+        _real_transform_kernel = arm_compute::support::cpp14::make_unique<NEFFTRealTransformKernel>();
+        _real_transform_kernel->configure(input, &_packed_spectrum, real_transform_config);
+        digit_reverse_input = &_packed_spectrum;
+    }
 
     // Configure digit reverse
     FFTDigitReverseKernelInfo digit_reverse_config;
-    digit_reverse_config.axis      = config.axis;
-    digit_reverse_config.conjugate = config.direction == FFTDirection::Inverse;
-    TensorInfo digit_reverse_indices_info(TensorShape(input->info()->tensor_shape()[config.axis]), 1, DataType::U32);
+    digit_reverse_config.axis              = config.axis;
+    digit_reverse_config.conjugate         = config.direction == FFTDirection::Inverse;
+    digit_reverse_config.packed_real_input = _is_real_forward && !is_odd;
+    TensorInfo digit_reverse_indices_info(TensorShape(N), 1, DataType::U32);
     _digit_reverse_indices.allocator()->init(digit_reverse_indices_info);
     _memory_group.manage(&_digit_reversed_input);
     _digit_reverse_kernel = arm_compute::support::cpp14::make_unique<NEFFTDigitReverseKernel>();
-    _digit_reverse_kernel->configure(input, &_digit_reversed_input, &_digit_reverse_indices, digit_reverse_config);
+    _digit_reverse_kernel->configure(digit_reverse_input, &_digit_reversed_input, &_digit_reverse_indices, digit_reverse_config);
+    if(_is_real_inverse)
+    {
+        _packed_spectrum.allocator()->allocate();
+    }
 
     // Create and configure FFT kernels
     unsigned int Nx = 1;
     _num_ffts       = decomposed_vector.size();
     _fft_kernels.resize(_num_ffts);
-    _axis = config.axis;
 
     for(unsigned int i = 0; i < _num_ffts; ++i)
     {
@@ -83,19 +161,29 @@ void NEFFT1D::configure(const ITensor *input, ITensor *output, const FFT1DInfo &
         fft_kernel_info.Nx             = Nx;
         fft_kernel_info.is_first_stage = (i == 0);
         _fft_kernels[i]                = arm_compute::support::cpp14::make_unique<NEFFTRadixStageKernel>();
-        _fft_kernels[i]->configure(&_digit_reversed_input, ((i == (_num_ffts - 1)) && !is_c2r) ? output : nullptr, fft_kernel_info);
+        _fft_kernels[i]->configure(&_digit_reversed_input, ((i == (_num_ffts - 1)) && !is_c2r && !config.is_real) ? output : nullptr, fft_kernel_info);
 
         Nx *= radix_for_stage;
     }
 
+    // Split the spectrum of the packed signal, or keep the one of a signal of odd length, into the non-redundant bins of the real signal
+    if(_is_real_forward)
+    {
+        FFTRealTransformKernelInfo real_transform_config;
+        real_transform_config.is_odd = is_odd;
+        _real_transform_kernel       = arm_compute::support::cpp14::make_unique<NEFFTRealTransformKernel>();
+        _real_transform_kernel->configure(&_digit_reversed_input, output, real_transform_config);
+    }
+
     // Configure scale kernel
     if(_run_scale)
     {
         FFTScaleKernelInfo scale_config;
-        scale_config.scale     = static_cast<float>(N);
-        scale_config.conjugate = config.direction == FFTDirection::Inverse;
-        _scale_kernel          = arm_compute::support::cpp14::make_unique<NEFFTScaleKernel>();
-        is_c2r ? _scale_kernel->configure(&_digit_reversed_input, output, scale_config) : _scale_kernel->configure(output, nullptr, scale_config);
+        scale_config.scale              = static_cast<float>(N);
+        scale_config.conjugate          = config.direction == FFTDirection::Inverse;
+        scale_config.packed_real_output = _is_real_inverse && !is_odd;
+        _scale_kernel                   = arm_compute::support::cpp14::make_unique<NEFFTScaleKernel>();
+        (is_c2r || _is_real_inverse) ? _scale_kernel->configure(&_digit_reversed_input, output, scale_config) : _scale_kernel->configure(output, nullptr, scale_config);
     }
 
     // Allocate tensors
@@ -107,6 +195,77 @@ void NEFFT1D::configure(const ITensor *input, ITensor *output, const FFT1DInfo &
     std::copy_n(digit_reverse_cpu.data(), N, reinterpret_cast<unsigned int *>(_digit_reverse_indices.buffer()));
 }
 
+void NEFFT1D::configure_bluestein(const ITensor *input, ITensor *output, const FFT1DInfo &config)
+{
+    const unsigned int N       = input->info()->dimension(config.axis);
+    const unsigned int L       = arm_compute::helpers::fft::bluestein_length(N, NEFFTRadixStageKernel::supported_radix());
+    const bool         inverse = config.direction == FFTDirection::Inverse;
+
+    auto_init_if_empty(*output->info(), *input->info()->clone());
+
+    // Multiply the input by the chirp and zero pad it to the length of the convolution
+    TensorShape padded_shape = input->info()->tensor_shape();
+    padded_shape.set(config.axis, L);
+    _chirped_input.allocator()->init(input->info()->clone()->set_is_resizable(true).reset_padding().set_tensor_shape(padded_shape));
+    _memory_group.manage(&_chirped_input);
+
+    FFTChirpKernelInfo chirp_config;
+    chirp_config.axis      = config.axis;
+    chirp_config.length    = N;
+    chirp_config.conjugate = inverse;
+    _chirp_kernel          = arm_compute::support::cpp14::make_unique<NEFFTChirpKernel>();
+    _chirp_kernel->configure(input, &_chirped_input, chirp_config);
+
+    // Convolve with the chirp filter in the frequency domain. The spectrum of the filter is computed once in prepare()
+    FFT1DInfo padded_config;
+    padded_config.axis = config.axis;
+    _memory_group.manage(&_chirped_spectrum);
+    _chirped_fft = arm_compute::support::cpp14::make_unique<NEFFT1D>(_memory_manager);
+    _chirped_fft->configure(&_chirped_input, &_chirped_spectrum, padded_config);
+    _chirped_input.allocator()->allocate();
+
+    TensorShape filter_shape(1U, 1U);
+    filter_shape.set(config.axis, L);
+    _chirp_filter.allocator()->init(TensorInfo(filter_shape, 2, DataType::F32));
+    _chirp_filter_fft = arm_compute::support::cpp14::make_unique<NEFFT1D>();
+    _chirp_filter_fft->configure(&_chirp_filter, &_chirp_filter_spectrum, padded_config);
+    _chirp_filter.allocator()->allocate();
+    _chirp_filter_spectrum.allocator()->allocate();
+
+    // Chirp filter e^(i * pi * m^2 / N) (conjugated for an inverse FFT), wrapped around to hold the negative m as well
+    const size_t   filter_stride = _chirp_filter.info()->strides_in_bytes()[config.axis];
+    uint8_t *const filter_ptr    = _chirp_filter.buffer() + _chirp_filter.info()->offset_first_element_in_bytes();
+    const double   sign          = inverse ? -1.0 : 1.0;
+    std::fill_n(reinterpret_cast<float *>(filter_ptr), 2 * L, 0.f);
+    for(unsigned int m = 0; m < N; ++m)
+    {
+        const double phase = sign * M_PI * static_cast<double>((static_cast<uint64_t>(m) * m) % (2 * static_cast<uint64_t>(N))) / static_cast<double>(N);
+        const float  re    = static_cast<float>(std::cos(phase));
+        const float  im    = static_cast<float>(std::sin(phase));
+        for(const unsigned int idx : { m, (L - m) % L })
+        {
+            auto dst = reinterpret_cast<float *>(filter_ptr + idx * filter_stride);
+            dst[0]   = re;
+            dst[1]   = im;
+        }
+    }
+
+    _spectrum_product = arm_compute::support::cpp14::make_unique<NEComplexPixelWiseMultiplication>();
+    _spectrum_product->configure(&_chirped_spectrum, &_chirp_filter_spectrum, &_chirped_spectrum);
+
+    padded_config.direction = FFTDirection::Inverse;
+    _memory_group.manage(&_convolved);
+    _chirped_ifft = arm_compute::support::cpp14::make_unique<NEFFT1D>(_memory_manager);
+    _chirped_ifft->configure(&_chirped_spectrum, &_convolved, padded_config);
+    _chirped_spectrum.allocator()->allocate();
+
+    // Multiply the first N elements of the convolution by the chirp, scaling them in case of an inverse FFT
+    chirp_config.scale = inverse ? static_cast<float>(N) : 1.f;
+    _dechirp_kernel    = arm_compute::support::cpp14::make_unique<NEFFTChirpKernel>();
+    _dechirp_kernel->configure(&_convolved, output, chirp_config);
+    _convolved.allocator()->allocate();
+}
+
 Status NEFFT1D::validate(const ITensorInfo *input, const ITensorInfo *output, const FFT1DInfo &config)
 {
     ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, output);
@@ -114,11 +273,40 @@ Status NEFFT1D::validate(const ITensorInfo *input, const ITensorInfo *output, co
     ARM_COMPUTE_RETURN_ERROR_ON(input->num_channels() > 2);
     ARM_COMPUTE_RETURN_ERROR_ON(std::set<unsigned int>({ 0, 1 }).count(config.axis) == 0);
 
-    // Check if FFT is decomposable
-    const auto         supported_radix   = NEFFTRadixStageKernel::supported_radix();
-    const unsigned int N                 = input->tensor_shape()[config.axis];
-    const auto         decomposed_vector = arm_compute::helpers::fft::decompose_stages(N, supported_radix);
-    ARM_COMPUTE_RETURN_ERROR_ON(decomposed_vector.empty());
+    if(config.is_real)
+    {
+        const bool is_forward = config.direction == FFTDirection::Forward;
+        ARM_COMPUTE_RETURN_ERROR_ON(config.axis != 0);
+        ARM_COMPUTE_RETURN_ERROR_ON(input->num_channels() != (is_forward ? 1 : 2));
+        ARM_COMPUTE_RETURN_ERROR_ON(input->dimension(0) < 2);
+
+        // Check if the FFT of the packed signal, or of the full signal for an odd length, is decomposable
+        const bool         is_odd = is_odd_real_fft(*input, output, config);
+        const unsigned int M      = complex_fft_length(*input, output, config);
+        ARM_COMPUTE_RETURN_ERROR_ON(M == 0);
+        ARM_COMPUTE_RETURN_ERROR_ON(arm_compute::helpers::fft::decompose_stages(M, NEFFTRadixStageKernel::supported_radix()).empty());
+
+        // Checks performed when output is configured
+        if((output != nullptr) && (output->total_size() != 0))
+        {
+            const unsigned int num_bins = is_odd ? M / 2 + 1 : M + 1;
+            const unsigned int length   = is_odd ? M : 2 * M;
+            ARM_COMPUTE_RETURN_ERROR_ON(output->num_channels() != (is_forward ? 2 : 1));
+            ARM_COMPUTE_RETURN_ERROR_ON(output->dimension(0) != (is_forward ? num_bins : length));
+            ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(1U, input, output);
+            ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
+        }
+
+        return Status{};
+    }
+
+    // FFTs that cannot be decomposed are computed with Bluestein's algorithm, which only supports complex tensors
+    if(use_bluestein(*input, output, config))
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON(input->dimension(config.axis) == 0);
+        ARM_COMPUTE_RETURN_ERROR_ON(input->num_channels() != 2);
+        ARM_COMPUTE_RETURN_ERROR_ON((output != nullptr) && (output->total_size() != 0) && (output->num_channels() != 2));
+    }
 
     // Checks performed when output is configured
     if((output != nullptr) && (output->total_size() != 0))
@@ -135,8 +323,26 @@ Status NEFFT1D::validate(const ITensorInfo *input, const ITensorInfo *output, co
 
 void NEFFT1D::run()
 {
+    prepare();
+
     MemoryGroupResourceScope scope_mg(_memory_group);
 
+    if(_is_bluestein)
+    {
+        const unsigned int split_dimension = (_axis == 0) ? Window::DimY : Window::DimX;
+        NEScheduler::get().schedule(_chirp_kernel.get(), split_dimension);
+        _chirped_fft->run();
+        _spectrum_product->run();
+        _chirped_ifft->run();
+        NEScheduler::get().schedule(_dechirp_kernel.get(), split_dimension);
+        return;
+    }
+
+    if(_is_real_inverse)
+    {
+        NEScheduler::get().schedule(_real_transform_kernel.get(), Window::DimY);
+    }
+
     NEScheduler::get().schedule(_digit_reverse_kernel.get(), (_axis == 0 ? Window::DimY : Window::DimZ));
 
     for(unsigned int i = 0; i < _num_ffts; ++i)
@@ -144,10 +350,29 @@ void NEFFT1D::run()
         NEScheduler::get().schedule(_fft_kernels[i].get(), (_axis == 0 ? Window::DimY : Window::DimX));
     }
 
+    if(_is_real_forward)
+    {
+        NEScheduler::get().schedule(_real_transform_kernel.get(), Window::DimY);
+    }
+
     // Run output scaling
     if(_run_scale)
     {
         NEScheduler::get().schedule(_scale_kernel.get(), Window::DimY);
     }
 }
+
+void NEFFT1D::prepare()
+{
+    if(!_is_prepared)
+    {
+        if(_is_bluestein)
+        {
+            _chirp_filter_fft->run();
+            _chirp_filter_fft.reset();
+            _chirp_filter.allocator()->free();
+        }
+        _is_prepared = true;
+    }
+}
 } // namespace arm_compute
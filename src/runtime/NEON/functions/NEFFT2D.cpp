@@ -32,6 +32,31 @@
 
 namespace arm_compute
 {
+namespace
+{
+/** Configurations of the two passes
+ *
+ * A real inverse FFT has to run its complex pass first, as the real pass produces the real output.
+ */
+std::pair<FFT1DInfo, FFT1DInfo> get_pass_configs(const FFT2DInfo &config)
+{
+    FFT1DInfo real_axis_config;
+    real_axis_config.axis      = config.axis0;
+    real_axis_config.direction = config.direction;
+    real_axis_config.is_real   = config.is_real;
+
+    FFT1DInfo other_axis_config;
+    other_axis_config.axis      = config.axis1;
+    other_axis_config.direction = config.direction;
+
+    if(config.is_real && config.direction == FFTDirection::Inverse)
+    {
+        return std::make_pair(other_axis_config, real_axis_config);
+    }
+    return std::make_pair(real_axis_config, other_axis_config);
+}
+} // namespace
+
 NEFFT2D::~NEFFT2D() = default;
 
 NEFFT2D::NEFFT2D(std::shared_ptr<IMemoryManager> memory_manager)
@@ -44,44 +69,44 @@ void NEFFT2D::configure(const ITensor *input, ITensor *output, const FFT2DInfo &
     ARM_COMPUTE_ERROR_ON_NULLPTR(input, output);
     ARM_COMPUTE_ERROR_THROW_ON(NEFFT2D::validate(input->info(), output->info(), config));
 
+    const auto pass_configs = get_pass_configs(config);
+
     // Setup first pass
-    FFT1DInfo first_pass_config;
-    first_pass_config.axis      = config.axis0;
-    first_pass_config.direction = config.direction;
     _memory_group.manage(&_first_pass_tensor);
-    _first_pass_func.configure(input, &_first_pass_tensor, first_pass_config);
+    _first_pass_func.configure(input, &_first_pass_tensor, pass_configs.first);
 
     // Setup second pass
-    FFT1DInfo second_pass_config;
-    second_pass_config.axis      = config.axis1;
-    second_pass_config.direction = config.direction;
-    _second_pass_func.configure(&_first_pass_tensor, output, second_pass_config);
+    _second_pass_func.configure(&_first_pass_tensor, output, pass_configs.second);
     _first_pass_tensor.allocator()->allocate();
 }
 
 Status NEFFT2D::validate(const ITensorInfo *input, const ITensorInfo *output, const FFT2DInfo &config)
 {
     ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, output);
+    ARM_COMPUTE_RETURN_ERROR_ON(config.is_real && config.axis0 != 0);
+
+    const auto pass_configs = get_pass_configs(config);
 
     // Create intermediate tensor info
     TensorInfo first_pass_tensor(input->clone()->set_is_resizable(true).reset_padding().set_num_channels(2));
+    if(config.is_real && config.direction == FFTDirection::Forward)
+    {
+        // Only the non-redundant bins of the real pass are kept
+        TensorShape first_pass_shape = input->tensor_shape();
+        first_pass_shape.set(0, input->dimension(0) / 2 + 1);
+        first_pass_tensor.set_tensor_shape(first_pass_shape);
+    }
 
     // Validate first pass
-    FFT1DInfo first_pass_config;
-    first_pass_config.axis      = config.axis0;
-    first_pass_config.direction = config.direction;
-    ARM_COMPUTE_RETURN_ON_ERROR(NEFFT1D::validate(input, &first_pass_tensor, first_pass_config));
+    ARM_COMPUTE_RETURN_ON_ERROR(NEFFT1D::validate(input, &first_pass_tensor, pass_configs.first));
 
     // Validate second pass
-    FFT1DInfo second_pass_config;
-    second_pass_config.axis      = config.axis1;
-    second_pass_config.direction = config.direction;
-    ARM_COMPUTE_RETURN_ON_ERROR(NEFFT1D::validate(&first_pass_tensor, output, second_pass_config));
+    ARM_COMPUTE_RETURN_ON_ERROR(NEFFT1D::validate(&first_pass_tensor, output, pass_configs.second));
 
     // Checks performed when output is configured
     if((output != nullptr) && (output->total_size() != 0))
     {
-        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(input, output);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(config.is_real ? 1U : 0U, input, output);
         ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
     }
 
@@ -42,22 +42,17 @@ namespace arm_compute
 {
 namespace
 {
+/** Padding needed along the axis transformed with a complex FFT, chosen by comparing the cost of the padded and exact lengths */
 int pad_decomposable(int N)
 {
-    const auto supported_radix = NEFFTRadixStageKernel::supported_radix();
+    return static_cast<int>(arm_compute::helpers::fft::plan_padded_length(N, NEFFTRadixStageKernel::supported_radix())) - N;
+}
 
-    int  pad           = 0;
-    bool is_decomposed = false;
-    while(!is_decomposed)
-    {
-        const auto decomposed_vector = arm_compute::helpers::fft::decompose_stages(N++, supported_radix);
-        is_decomposed                = !decomposed_vector.empty();
-        if(!is_decomposed)
-        {
-            ++pad;
-        }
-    }
-    return pad;
+/** Padding needed along the axis transformed with a real FFT, which runs a complex FFT of half its even length that has to be decomposable */
+int pad_decomposable_real(int N)
+{
+    const unsigned int half_N = (N + 1) / 2;
+    return 2 * static_cast<int>(arm_compute::helpers::fft::plan_padded_length(half_N, NEFFTRadixStageKernel::supported_radix(), false)) - N;
 }
 } // namespace
 
@@ -120,7 +115,7 @@ void NEFFTConvolutionLayer::configure(ITensor *input, const ITensor *weights, co
     // Input shape, kernel size and output tile
     const Size2D input_dims  = Size2D(input->info()->tensor_shape()[idx_width], input->info()->tensor_shape()[idx_height]);
     const Size2D kernel_size = Size2D(weights->info()->tensor_shape()[idx_width], weights->info()->tensor_shape()[idx_height]);
-    const Size2D pad_valid   = Size2D(pad_decomposable(input_dims.x() + kernel_size.x() - 1),
+    const Size2D pad_valid   = Size2D(pad_decomposable_real(input_dims.x() + kernel_size.x() - 1),
                                       pad_decomposable(input_dims.y() + kernel_size.y() - 1));
     // Tensors to use
     ITensor       *input_to_use   = input;
@@ -160,9 +155,11 @@ void NEFFTConvolutionLayer::configure(ITensor *input, const ITensor *weights, co
     const PaddingList padding_w = { { 0, input_dims.x() + pad_valid.x() - 1 }, { 0, input_dims.y() + pad_valid.y() - 1 } };
     _pad_weights_func.configure(&_flipped_weights, &_padded_weights, padding_w);
 
-    // Transform weights
+    // Transform weights: the inputs are real, so only the non-redundant half of the spectrum is computed
+    FFT2DInfo transform_info;
+    transform_info.is_real  = true;
     _transform_weights_func = support::cpp14::make_unique<NEFFT2D>();
-    _transform_weights_func->configure(&_padded_weights, &_transformed_weights, FFT2DInfo());
+    _transform_weights_func->configure(&_padded_weights, &_transformed_weights, transform_info);
 
     // Pad input
     const PaddingList padding_in = { { 0, kernel_size.x() + pad_valid.x() - 1 }, { 0, kernel_size.y() + pad_valid.y() - 1 } };
@@ -175,7 +172,7 @@ void NEFFTConvolutionLayer::configure(ITensor *input, const ITensor *weights, co
 
     // Transform input
     _memory_group.manage(&_transformed_input);
-    _transform_input_func.configure(&_padded_input, &_transformed_input, FFT2DInfo());
+    _transform_input_func.configure(&_padded_input, &_transformed_input, transform_info);
     _padded_input.allocator()->allocate();
 
     // Perform product
@@ -192,7 +189,11 @@ void NEFFTConvolutionLayer::configure(ITensor *input, const ITensor *weights, co
     _memory_group.manage(&_itransformed_output);
     FFT2DInfo itranform_info;
     itranform_info.direction = FFTDirection::Inverse;
-    _itransformed_output.allocator()->init(_output_reduced.info()->clone()->set_is_resizable(true).set_num_channels(1).reset_padding());
+    itranform_info.is_real   = true;
+
+    TensorShape itransformed_shape = _output_reduced.info()->tensor_shape();
+    itransformed_shape.set(0, input_dims.x() + kernel_size.x() - 1 + pad_valid.x());
+    _itransformed_output.allocator()->init(_output_reduced.info()->clone()->set_is_resizable(true).set_num_channels(1).set_tensor_shape(itransformed_shape).reset_padding());
     _itransform_output_func.configure(&_output_reduced, &_itransformed_output, itranform_info);
     _output_reduced.allocator()->allocate();
 
@@ -27,6 +27,7 @@
 #include "arm_compute/core/Size2D.h"
 #include "arm_compute/core/Validate.h"
 #include "arm_compute/core/utils/misc/ShapeCalculator.h"
+#include "arm_compute/core/utils/misc/Utility.h"
 #include "arm_compute/core/utils/quantization/AsymmHelpers.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
 #include "src/core/NEON/kernels/NEConvertFullyConnectedWeightsKernel.h"
@@ -34,6 +35,7 @@
 #include "src/core/NEON/kernels/NEFlattenLayerKernel.h"
 #include "src/core/NEON/kernels/NEFlattenLayerKernel.h"
 #include "src/core/NEON/kernels/NEGEMMInterleave4x4Kernel.h"
+#include "src/core/NEON/kernels/NEGEMMLowpDequantizeInt32ToFloatKernel.h"
 #include "src/core/NEON/kernels/NEGEMMLowpMatrixMultiplyKernel.h"
 #include "src/core/NEON/kernels/NEGEMMLowpOffsetContributionKernel.h"
 #include "src/core/NEON/kernels/NEGEMMLowpOffsetContributionOutputStageKernel.h"
@@ -41,12 +43,17 @@
 #include "src/core/NEON/kernels/NEGEMMMatrixAdditionKernel.h"
 #include "src/core/NEON/kernels/NEGEMMMatrixMultiplyKernel.h"
 #include "src/core/NEON/kernels/NEGEMMTranspose1xWKernel.h"
+#include "src/core/NEON/kernels/NEMinMaxRangeKernel.h"
+#include "src/core/NEON/kernels/NEQuantizationLayerKernel.h"
 #include "src/core/NEON/kernels/NETransposeKernel.h"
 
 #include "support/MemorySupport.h"
+#include "support/ToolchainSupport.h"
 
 #include <algorithm>
 #include <cmath>
+#include <limits>
+#include <vector>
 
 namespace arm_compute
 {
@@ -144,6 +151,103 @@ Status validate_mm(const ITensorInfo *input, const ITensorInfo *weights, const I
 
     return Status{};
 }
+
+// Quantization info of the dynamically quantized input. The input is quantized asymmetrically to QASYMM8_SIGNED
+// and the offset is removed after the matrix multiplication, so the info can change on every run.
+QuantizationInfo get_dynamic_quantization_info(float min, float max)
+{
+    // The quantized range must contain zero
+    min = std::min(min, 0.f);
+    max = std::max(max, 0.f);
+
+    constexpr float qmin = static_cast<float>(std::numeric_limits<int8_t>::lowest());
+    constexpr float qmax = static_cast<float>(std::numeric_limits<int8_t>::max());
+
+    const float scale = (max - min) / (qmax - qmin);
+    if(scale == 0.f)
+    {
+        return QuantizationInfo(1.f, 0);
+    }
+
+    const int offset = utility::clamp<int>(static_cast<int>(support::cpp11::round(qmin - min / scale)), static_cast<int>(qmin), static_cast<int>(qmax));
+    return QuantizationInfo(scale, offset);
+}
+
+// Weights are quantized symmetrically per output channel, so the matrix multiplication only needs the sum of each column
+// to remove the contribution of the input offset
+void quantize_weights_per_channel(const ITensor *weights, ITensor *quantized_weights, ITensor *quantized_weights_sums)
+{
+    const size_t num_channels = weights->info()->dimension(0);
+
+    Window win;
+    win.use_tensor_dimensions(weights->info()->tensor_shape());
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    // Find the absolute maximum of each output channel
+    std::vector<float> max_abs(num_channels, 0.f);
+
+    Iterator in(weights, win);
+    execute_window_loop(win, [&](const Coordinates &)
+    {
+        const auto in_ptr = reinterpret_cast<const float *>(in.ptr());
+        for(size_t x = 0; x < num_channels; ++x)
+        {
+            max_abs[x] = std::max(max_abs[x], std::abs(in_ptr[x]));
+        }
+    },
+    in);
+
+    constexpr int32_t  qmax = std::numeric_limits<int8_t>::max();
+    std::vector<float> scales(num_channels);
+    std::transform(max_abs.begin(), max_abs.end(), scales.begin(), [](float v)
+    {
+        return v > 0.f ? v / static_cast<float>(qmax) : 1.f;
+    });
+
+    // Quantize and accumulate the column sums
+    const auto sums_ptr = reinterpret_cast<int32_t *>(quantized_weights_sums->buffer() + quantized_weights_sums->info()->offset_first_element_in_bytes());
+    std::fill_n(sums_ptr, num_channels, 0);
+
+    Iterator in_q(weights, win);
+    Iterator out_q(quantized_weights, win);
+    execute_window_loop(win, [&](const Coordinates &)
+    {
+        const auto in_ptr  = reinterpret_cast<const float *>(in_q.ptr());
+        const auto out_ptr = reinterpret_cast<int8_t *>(out_q.ptr());
+        for(size_t x = 0; x < num_channels; ++x)
+        {
+            const int32_t q = utility::clamp<int32_t>(static_cast<int32_t>(support::cpp11::round(in_ptr[x] / scales[x])), -qmax, qmax);
+            out_ptr[x]      = static_cast<int8_t>(q);
+            sums_ptr[x] += q;
+        }
+    },
+    in_q, out_q);
+
+    quantized_weights->info()->set_quantization_info(QuantizationInfo(scales));
+}
+
+Status validate_dynamic_quantization_mm(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *biases, const ITensorInfo *output, const ActivationLayerInfo &act)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(input->data_type() != DataType::F32, "Dynamic quantization is only supported for F32 input");
+
+    const size_t     num_channels = weights->dimension(0);
+    const TensorInfo quantized_input(input->clone()->set_is_resizable(true).reset_padding().set_data_type(DataType::QASYMM8_SIGNED).set_quantization_info(QuantizationInfo(1.f, 0)));
+    const TensorInfo quantized_weights(weights->clone()->set_is_resizable(true).reset_padding().set_data_type(DataType::QSYMM8_PER_CHANNEL).set_quantization_info(
+                                           QuantizationInfo(std::vector<float>(num_channels, 1.f))));
+    const TensorInfo quantized_weights_sums(TensorShape(num_channels), 1, DataType::S32);
+    const TensorInfo mm_result_s32(output->tensor_shape(), 1, DataType::S32);
+
+    ARM_COMPUTE_RETURN_ON_ERROR(NEMinMaxRangeKernel::validate(input));
+    ARM_COMPUTE_RETURN_ON_ERROR(NEQuantizationLayerKernel::validate(input, &quantized_input));
+    ARM_COMPUTE_RETURN_ON_ERROR(NEGEMMLowpMatrixMultiplyCore::validate(&quantized_input, &quantized_weights, nullptr, &mm_result_s32, GEMMInfo(false, false, true)));
+    ARM_COMPUTE_RETURN_ON_ERROR(NEGEMMLowpDequantizeInt32ToFloatKernel::validate(&mm_result_s32, &quantized_input, &quantized_weights, &quantized_weights_sums, biases, output));
+    if(act.enabled())
+    {
+        ARM_COMPUTE_RETURN_ON_ERROR(NEActivationLayer::validate(output, nullptr, act));
+    }
+
+    return Status{};
+}
 } // namespace
 
 void NEFullyConnectedLayerReshapeWeights::configure(const ITensor *input, ITensor *output)
@@ -162,14 +266,61 @@ NEFullyConnectedLayer::~NEFullyConnectedLayer() = default;
 
 NEFullyConnectedLayer::NEFullyConnectedLayer(std::shared_ptr<IMemoryManager> memory_manager, IWeightsManager *weights_manager)
     : _memory_group(std::move(memory_manager)), _weights_manager(weights_manager), _flatten_kernel(), _convert_weights(), _convert_weights_managed(), _reshape_weights_function(),
-      _reshape_weights_managed_function(), _mm_gemm(nullptr, weights_manager), _mm_gemmlowp(nullptr, weights_manager), _flatten_output(), _converted_weights_output(), _reshape_weights_output(),
-      _original_weights(nullptr), _are_weights_converted(true), _are_weights_reshaped(false), _is_fc_after_conv(false), _is_quantized_asymmetric(false), _is_prepared(false)
+      _reshape_weights_managed_function(), _mm_gemm(nullptr, weights_manager), _mm_gemmlowp(nullptr, weights_manager), _min_max_range_kernel(), _quantize_input_kernel(), _dequantize_output_kernel(),
+      _activation_func(), _flatten_output(), _converted_weights_output(), _reshape_weights_output(), _quantized_input(), _quantized_weights(), _quantized_weights_sums(), _mm_result_s32(),
+      _original_weights(nullptr), _weights_to_quantize(nullptr), _are_weights_converted(true), _are_weights_reshaped(false), _is_fc_after_conv(false), _is_quantized_asymmetric(false),
+      _is_dynamically_quantized(false), _sparse_weights(false), _run_activation(false), _is_prepared(false)
+{
+}
+
+void NEFullyConnectedLayer::configure_dynamic_quantization_mm(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const ActivationLayerInfo &act)
 {
+    const size_t num_channels = weights->info()->dimension(0);
+
+    _weights_to_quantize = weights;
+
+    // The quantization info of the input is computed from its range on every run
+    _quantized_input.allocator()->init(input->info()->clone()->set_is_resizable(true).reset_padding().set_data_type(DataType::QASYMM8_SIGNED).set_quantization_info(QuantizationInfo(1.f, 0)));
+    _memory_group.manage(&_quantized_input);
+
+    _min_max_range_kernel = arm_compute::support::cpp14::make_unique<NEMinMaxRangeKernel>();
+    _min_max_range_kernel->configure(input);
+
+    _quantize_input_kernel = arm_compute::support::cpp14::make_unique<NEQuantizationLayerKernel>();
+    _quantize_input_kernel->configure(input, &_quantized_input);
+
+    // The weights are quantized per output channel in prepare()
+    _quantized_weights.allocator()->init(weights->info()->clone()->set_is_resizable(true).reset_padding().set_data_type(DataType::QSYMM8_PER_CHANNEL).set_quantization_info(
+                                             QuantizationInfo(std::vector<float>(num_channels, 1.f))));
+    _quantized_weights_sums.allocator()->init(TensorInfo(TensorShape(num_channels), 1, DataType::S32));
+
+    // Configure gemmlowp function without offset contribution: the input offset is removed when dequantizing the result
+    _mm_result_s32.allocator()->init(TensorInfo(output->info()->tensor_shape(), 1, DataType::S32));
+    _memory_group.manage(&_mm_result_s32);
+    GEMMInfo gemm_info(false, false, true /* Reshape weights only for the first run */);
+    gemm_info.set_sparse_weights(_sparse_weights);
+    _mm_gemmlowp.configure(&_quantized_input, &_quantized_weights, nullptr, &_mm_result_s32, gemm_info);
+
+    _dequantize_output_kernel = arm_compute::support::cpp14::make_unique<NEGEMMLowpDequantizeInt32ToFloatKernel>();
+    _dequantize_output_kernel->configure(&_mm_result_s32, &_quantized_input, &_quantized_weights, &_quantized_weights_sums, biases, output);
+
+    _run_activation = act.enabled();
+    if(_run_activation)
+    {
+        _activation_func.configure(output, nullptr, act);
+    }
+
+    _quantized_input.allocator()->allocate();
+    _mm_result_s32.allocator()->allocate();
 }
 
 void NEFullyConnectedLayer::configure_mm(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const ActivationLayerInfo &act)
 {
-    if(_is_quantized_asymmetric)
+    if(_is_dynamically_quantized)
+    {
+        configure_dynamic_quantization_mm(input, weights, biases, output, act);
+    }
+    else if(_is_quantized_asymmetric)
     {
         // Since we need negative offsets for computing convolution, we need to change QuantizationInfo()
         // Extract and negate input and weights offset
@@ -198,6 +349,7 @@ void NEFullyConnectedLayer::configure_mm(const ITensor *input, const ITensor *we
         // Configure matrix multiply kernel
         GEMMInfo gemm_info(false, false, true /* Reshape weights only for the first run */);
         gemm_info.set_activation_info(act);
+        gemm_info.set_sparse_weights(_sparse_weights);
         _mm_gemm.configure(input, weights, biases, output, 1.f, 1.0f, gemm_info);
     }
 }
@@ -244,11 +396,13 @@ void NEFullyConnectedLayer::configure(const ITensor *input, const ITensor *weigh
                                                                output->info(),
                                                                fc_info));
 
-    _are_weights_converted   = true;
-    _are_weights_reshaped    = fc_info.transpose_weights ? fc_info.are_weights_reshaped : true;
-    _is_fc_after_conv        = true;
-    _is_quantized_asymmetric = is_data_type_quantized_asymmetric(input->info()->data_type());
-    _original_weights        = weights;
+    _are_weights_converted    = true;
+    _are_weights_reshaped     = fc_info.transpose_weights ? fc_info.are_weights_reshaped : true;
+    _is_fc_after_conv         = true;
+    _is_quantized_asymmetric  = is_data_type_quantized_asymmetric(input->info()->data_type());
+    _is_dynamically_quantized = fc_info.enable_dynamic_quantization;
+    _sparse_weights           = fc_info.sparse_weights;
+    _original_weights         = weights;
 
     if(_weights_manager)
     {
@@ -401,7 +555,14 @@ Status NEFullyConnectedLayer::validate(const ITensorInfo *input, const ITensorIn
         ARM_COMPUTE_RETURN_ERROR_ON(input->dimension(0) != weights_to_use->dimension(1));
     }
     // Validate matrix multiply kernel
-    ARM_COMPUTE_RETURN_ON_ERROR(validate_mm(input_to_use, weights_to_use, biases, output, fc_info.activation_info));
+    if(fc_info.enable_dynamic_quantization)
+    {
+        ARM_COMPUTE_RETURN_ON_ERROR(validate_dynamic_quantization_mm(input_to_use, weights_to_use, biases, output, fc_info.activation_info));
+    }
+    else
+    {
+        ARM_COMPUTE_RETURN_ON_ERROR(validate_mm(input_to_use, weights_to_use, biases, output, fc_info.activation_info));
+    }
 
     return Status{};
 }
@@ -419,7 +580,24 @@ void NEFullyConnectedLayer::run()
     }
 
     // Run matrix multiply
-    if(_is_quantized_asymmetric)
+    if(_is_dynamically_quantized)
+    {
+        // Quantize the input with the range found in this run
+        _min_max_range_kernel->reset();
+        NEScheduler::get().schedule(_min_max_range_kernel.get(), Window::DimY);
+        _quantized_input.info()->set_quantization_info(get_dynamic_quantization_info(_min_max_range_kernel->min(), _min_max_range_kernel->max()));
+        NEScheduler::get().schedule(_quantize_input_kernel.get(), Window::DimY);
+
+        _mm_gemmlowp.run();
+
+        // Dequantize the result and add the biases
+        NEScheduler::get().schedule(_dequantize_output_kernel.get(), Window::DimY);
+        if(_run_activation)
+        {
+            _activation_func.run();
+        }
+    }
+    else if(_is_quantized_asymmetric)
     {
         _mm_gemmlowp.run();
     }
@@ -488,11 +666,27 @@ void NEFullyConnectedLayer::prepare()
             _are_weights_converted = true;
         }
 
+        // Quantize the weights per output channel (happens only once)
+        if(_is_dynamically_quantized)
+        {
+            _quantized_weights.allocator()->allocate();
+            _quantized_weights_sums.allocator()->allocate();
+            quantize_weights_per_channel(_weights_to_quantize, &_quantized_weights, &_quantized_weights_sums);
+            if(!_weights_manager)
+            {
+                _weights_to_quantize->mark_as_unused();
+            }
+
+            // Reshape the quantized weights and release them if unused
+            _mm_gemmlowp.prepare();
+            release_unused(&_quantized_weights);
+        }
+
         // Release reshaped weights if unused
         release_unused(&_reshape_weights_output);
 
         // Prepare GEMM prepare and release unused weights
-        if(!_is_quantized_asymmetric)
+        if(!_is_quantized_asymmetric && !_is_dynamically_quantized)
         {
             _mm_gemm.prepare();
         }
@@ -140,6 +140,11 @@ IScheduler::Hints scheduling_hint_heuristic(arm_gemm::GemmMethod method, DataTyp
         //special case for QASYMM8 to support 2D parallelism, scheduler here may be tweaked differently compared to FP32 case
         scheduling_hint = IScheduler::Hints(IScheduler::split_dimensions_all, IScheduler::StrategyHint::STATIC, granule_threshold);
     }
+    else if(method == arm_gemm::GemmMethod::GEMM_SPARSE)
+    {
+        // The amount of work per window item depends on the number of non-zero blocks in B
+        scheduling_hint = IScheduler::Hints(Window::DimX, IScheduler::StrategyHint::DYNAMIC, granule_threshold);
+    }
 
     return scheduling_hint;
 }
@@ -380,8 +385,8 @@ void Fallback<TypeInput, TypeOutput, OutputStage>::prepare_indirect_buffer()
                     {
                         for(int64_t kernel_x = 0; kernel_x < _cp.kernel_width; kernel_x++)
                         {
-                            int64_t input_x   = (output_x * _cp.output_stride_w) + kernel_x - _cp.padding_left;
-                            int64_t input_y   = (output_y * _cp.output_stride_h) + kernel_y - _cp.padding_top;
+                            int64_t input_x   = (output_x * _cp.output_stride_w) + (kernel_x * _cp.dilation_w) - _cp.padding_left;
+                            int64_t input_y   = (output_y * _cp.output_stride_h) + (kernel_y * _cp.dilation_h) - _cp.padding_top;
                             int64_t kernel_xy = (kernel_y * _cp.kernel_width) + kernel_x;
                             int64_t input_xy  = (input_y * _cp.input_width) + input_x;
 
@@ -422,7 +427,8 @@ void Fallback<TypeInput, TypeOutput, OutputStage>::configure_indirect(const ITen
     const int64_t output_height  = static_cast<int64_t>(d->tensor_shape()[2]);
 
     _cp = { input_width, input_height, input_channels, kernel_width, kernel_height, output_width, output_height,
-            info.ps_info.stride().first, info.ps_info.stride().second, info.padding_top, info.padding_left, zeropad
+            info.ps_info.stride().first, info.ps_info.stride().second, info.padding_top, info.padding_left, zeropad,
+            static_cast<int64_t>(info.dilation.x()), static_cast<int64_t>(info.dilation.y())
           };
 
     if(info.method == AsmConvMethod::Conv)
@@ -689,6 +695,8 @@ void create_arm_gemm(std::unique_ptr<NEGEMMAssemblyDispatch::IFallback> &arm_gem
     unsigned int   num_threads = NEScheduler::get().num_threads();
 
     arm_gemm::GemmArgs args(&ci, p.M, p.N, p.K, p.sections, p.batches, p.multis, p.indirect, activation, num_threads);
+    args._sparse_weights = info.sparse_weights;
+    args._fast_mode      = info.fast_mode;
 
     // Create arm_gemm fallback
     auto fallback = support::cpp14::make_unique<Fallback<TypeInput, TypeOutput>>();
@@ -757,10 +765,11 @@ Status NEGEMMAssemblyDispatch::validate(const ITensorInfo *a, const ITensorInfo
 
 #ifndef __aarch64__
     ARM_COMPUTE_RETURN_ERROR_ON_MSG(a->element_size() == 1, "8bit integer types only supported for aarch64");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(a->data_type() == DataType::S16, "16bit integer types only supported for aarch64");
 #endif /* __aarch64__ */
-    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(a, 1, DataType::U8, DataType::QASYMM8, DataType::QASYMM8_SIGNED, DataType::S8,
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(a, 1, DataType::U8, DataType::QASYMM8, DataType::QASYMM8_SIGNED, DataType::S8, DataType::S16,
                                                          DataType::BFLOAT16, DataType::F16, DataType::F32);
-    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(b, 1, DataType::U8, DataType::QASYMM8, DataType::QASYMM8_SIGNED, DataType::QSYMM8_PER_CHANNEL, DataType::S8,
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(b, 1, DataType::U8, DataType::QASYMM8, DataType::QASYMM8_SIGNED, DataType::QSYMM8_PER_CHANNEL, DataType::S8, DataType::S16,
                                                          DataType::BFLOAT16, DataType::F16, DataType::F32);
     if(is_data_type_quantized_per_channel(b->data_type()))
     {
@@ -775,6 +784,7 @@ Status NEGEMMAssemblyDispatch::validate(const ITensorInfo *a, const ITensorInfo
     ARM_COMPUTE_RETURN_ERROR_ON_MSG(a->data_type() == DataType::BFLOAT16 && d->data_type() != DataType::F32, "Only F32 output supported for BFLOAT16 input");
     ARM_COMPUTE_RETURN_ERROR_ON_MSG(a->data_type() == DataType::U8 && d->data_type() != DataType::U32, "Only U32 output supported for U8 input");
     ARM_COMPUTE_RETURN_ERROR_ON_MSG(a->data_type() == DataType::S8 && d->data_type() != DataType::S32, "Only S32 output supported for S8 input");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(a->data_type() == DataType::S16 && d->data_type() != DataType::S32, "Only S32 output supported for S16 input");
     ARM_COMPUTE_RETURN_ERROR_ON_MSG(a->data_type() == DataType::QASYMM8 && d->data_type() != DataType::QASYMM8, "Only QASYMM8 output supported for QASYMM8 input");
     return Status{};
 }
@@ -824,6 +834,9 @@ void NEGEMMAssemblyDispatch::configure(const ITensor *a, const ITensor *b, const
                 create_arm_gemm_quant<int8_t, int8_t>(_arm_gemm, _memory_group, a, b, c, d, act, info, _weights_manager);
             }
             break;
+        case DataType::S16:
+            create_arm_gemm<int16_t, int32_t>(_arm_gemm, _memory_group, a, b, c, d, act, info, _weights_manager);
+            break;
 #endif /* __aarch64__ */
 #if defined(__ARM_FEATURE_BF16_VECTOR_ARITHMETIC) || defined(ARM_COMPUTE_FORCE_BF16)
         case DataType::BFLOAT16:
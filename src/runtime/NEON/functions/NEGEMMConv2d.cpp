@@ -67,6 +67,7 @@ AsmGemmInfo init_assembly_metadata(const Conv2dInfo &info, bool is_indirect)
     AsmGemmInfo asm_info;
     asm_info.method                  = is_indirect ? AsmConvMethod::Indirect : AsmConvMethod::Conv;
     asm_info.ps_info                 = info.conv_info;
+    asm_info.dilation                = info.dilation;
     asm_info.activation_info         = info.act_info;
     asm_info.depth_output_gemm3d     = true;
     asm_info.reinterpret_input_as_3d = true;
@@ -74,15 +75,17 @@ AsmGemmInfo init_assembly_metadata(const Conv2dInfo &info, bool is_indirect)
     asm_info.padding_left            = info.conv_info.pad_left();
     asm_info.padding_value           = 0.f;
     asm_info.negated_offsets         = false;
+    asm_info.fast_mode               = info.enable_fast_math;
     return asm_info;
 }
 } // namespace
 
-NEGEMMConv2d::NEGEMMConv2d(const std::shared_ptr<IMemoryManager> &memory_manager)
-    : _gemm_asm_func(memory_manager), _activation_func(), _weights_permute_func(), _original_weights(nullptr), _permuted_weights(), _is_prepared(false), _run_activation(false)
+NEGEMMConv2d::NEGEMMConv2d(const std::shared_ptr<IMemoryManager> &memory_manager, IWeightsManager *weights_manager)
+    : _weights_manager(weights_manager), _gemm_asm_func(memory_manager, weights_manager), _activation_func(), _weights_permute_func(), _weights_permute_managed(), _original_weights(nullptr),
+      _permuted_weights(), _is_prepared(false), _run_activation(false)
 {
 }
-void NEGEMMConv2d::configure(ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const Conv2dInfo &info)
+void NEGEMMConv2d::configure(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const Conv2dInfo &info)
 {
     ARM_COMPUTE_ERROR_ON_NULLPTR(input, weights, output);
     ARM_COMPUTE_ERROR_THROW_ON(NEGEMMConv2d::validate(input->info(),
@@ -91,7 +94,17 @@ void NEGEMMConv2d::configure(ITensor *input, const ITensor *weights, const ITens
                                                       output->info(),
                                                       info));
     _original_weights = weights;
-    _weights_permute_func.configure(weights, &_permuted_weights, PermutationVector{ 3, 0, 1, 2 });
+
+    const ITensor *weights_to_use = &_permuted_weights;
+    if(_weights_manager && _weights_manager->are_weights_managed(weights))
+    {
+        _weights_permute_managed.configure(weights, PermutationVector{ 3, 0, 1, 2 });
+        weights_to_use = _weights_manager->acquire(weights, &_weights_permute_managed);
+    }
+    else
+    {
+        _weights_permute_func.configure(weights, &_permuted_weights, PermutationVector{ 3, 0, 1, 2 });
+    }
 
     // Configure assembly dispatch
     AsmGemmInfo asm_info = init_assembly_metadata(info, false);
@@ -99,7 +112,7 @@ void NEGEMMConv2d::configure(ITensor *input, const ITensor *weights, const ITens
     {
         asm_info.output_stage = calculate_output_stage_metadata(input->info(), weights->info(), output->info(), info.act_info);
     }
-    _gemm_asm_func.configure(input, &_permuted_weights, biases, output, asm_info);
+    _gemm_asm_func.configure(input, weights_to_use, biases, output, asm_info);
 
     // Configure activation
     if(info.act_info.enabled() && !_gemm_asm_func.is_activation_supported(info.act_info))
@@ -158,9 +171,16 @@ void NEGEMMConv2d::prepare()
 {
     if(!_is_prepared)
     {
-        _permuted_weights.allocator()->allocate();
-        _weights_permute_func.run();
-        _original_weights->mark_as_unused();
+        if(_weights_manager && _weights_manager->are_weights_managed(_original_weights))
+        {
+            _weights_manager->run(_original_weights, &_weights_permute_managed);
+        }
+        else
+        {
+            _permuted_weights.allocator()->allocate();
+            _weights_permute_func.run();
+            _original_weights->mark_as_unused();
+        }
         _is_prepared = true;
     }
 }
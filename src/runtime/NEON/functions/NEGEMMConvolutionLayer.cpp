@@ -29,6 +29,7 @@
 #include "arm_compute/core/utils/misc/ShapeCalculator.h"
 #include "arm_compute/core/utils/quantization/AsymmHelpers.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
+#include "arm_compute/runtime/NEON/functions/NEGEMMAssemblyDispatch.h"
 
 #include "src/core/NEON/kernels/NECol2ImKernel.h"
 #include "src/core/NEON/kernels/NEConvertQuantizedSignednessKernel.h"
@@ -58,23 +59,24 @@ NEConvolutionLayerReshapeWeights::NEConvolutionLayerReshapeWeights()
 {
 }
 
-void NEConvolutionLayerReshapeWeights::configure(const ITensor *weights, const ITensor *biases, ITensor *output)
+void NEConvolutionLayerReshapeWeights::configure(const ITensor *weights, const ITensor *biases, ITensor *output, unsigned int num_groups)
 {
     // Perform validation step
     ARM_COMPUTE_ERROR_ON_NULLPTR(weights, output);
     ARM_COMPUTE_ERROR_THROW_ON(NEConvolutionLayerReshapeWeights::validate(weights->info(),
                                                                           (biases != nullptr) ? biases->info() : nullptr,
-                                                                          output->info()));
+                                                                          output->info(),
+                                                                          num_groups));
     const bool     append_biases = (biases != nullptr) && !is_data_type_quantized_asymmetric(weights->info()->data_type());
     const ITensor *biases_to_use = (append_biases) ? biases : nullptr;
 
     _weights_reshape_kernel = arm_compute::support::cpp14::make_unique<NEWeightsReshapeKernel>();
-    _weights_reshape_kernel->configure(weights, biases_to_use, output);
+    _weights_reshape_kernel->configure(weights, biases_to_use, output, num_groups);
 
     output->info()->set_quantization_info(weights->info()->quantization_info());
 }
 
-Status NEConvolutionLayerReshapeWeights::validate(const ITensorInfo *weights, const ITensorInfo *biases, const ITensorInfo *output)
+Status NEConvolutionLayerReshapeWeights::validate(const ITensorInfo *weights, const ITensorInfo *biases, const ITensorInfo *output, unsigned int num_groups)
 {
     ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(weights);
     ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(weights, 1,
@@ -95,7 +97,7 @@ Status NEConvolutionLayerReshapeWeights::validate(const ITensorInfo *weights, co
     {
         ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(weights, output);
 
-        NEWeightsReshapeKernel::validate(weights, biases, output);
+        ARM_COMPUTE_RETURN_ON_ERROR(NEWeightsReshapeKernel::validate(weights, biases, output, num_groups));
     }
 
     return Status{};
@@ -110,8 +112,10 @@ NEGEMMConvolutionLayer::~NEGEMMConvolutionLayer() = default;
 
 NEGEMMConvolutionLayer::NEGEMMConvolutionLayer(const std::shared_ptr<IMemoryManager> &memory_manager, IWeightsManager *weights_manager)
     : _memory_group(memory_manager), _weights_manager(weights_manager), _reshape_weights(), _reshape_weights_managed(), _im2col_kernel(), _mm_gemm(memory_manager), _mm_gemmlowp(memory_manager),
-      _col2im_kernel(), _reshape_layer(), _original_weights(nullptr), _im2col_output(), _weights_reshaped(), _gemm_output(), _tmp_output(), _data_layout(DataLayout::NCHW), _skip_im2col(false),
-      _skip_col2im(false), _is_quantized(false), _is_prepared(false)
+      _col2im_kernel(), _reshape_layer(), _conv2d(memory_manager, weights_manager), _permute_input(), _permute_weights(),
+      _permute_weights_managed(), _permute_output(), _original_weights(nullptr), _im2col_output(), _weights_reshaped(),
+      _gemm_output(), _tmp_output(), _input_nhwc(), _weights_nhwc(), _output_nhwc(), _data_layout(DataLayout::NCHW), _skip_im2col(false), _skip_col2im(false), _is_quantized(false),
+      _sparse_weights(false), _fast_math(false), _use_conv2d(false), _is_prepared(false)
 {
 }
 
@@ -119,12 +123,14 @@ void NEGEMMConvolutionLayer::configure_mm(const ITensor *input, const ITensor *w
 {
     ARM_COMPUTE_ERROR_ON_NULLPTR(input, weights);
     ARM_COMPUTE_ERROR_THROW_ON(validate_mm(input->info(), weights->info(), biases == nullptr ? nullptr : biases->info(), output == nullptr ? nullptr : output->info(),
-                                           act_info, gemm_3d_depth, _skip_im2col));
+                                           act_info, gemm_3d_depth, _skip_im2col, _fast_math));
 
     // Create GEMMInfo structure
-    const GEMMInfo &gemm_info = GEMMInfo(false, false, true /* Reshape weights only for the first run */,
-                                         gemm_3d_depth, _skip_im2col /* Reinterpret the input as 3D if im2col is skipped */,
-                                         false, GEMMLowpOutputStageInfo(), false, false, act_info);
+    GEMMInfo gemm_info = GEMMInfo(false, false, true /* Reshape weights only for the first run */,
+                                  gemm_3d_depth, _skip_im2col /* Reinterpret the input as 3D if im2col is skipped */,
+                                  false, GEMMLowpOutputStageInfo(), false, false, act_info);
+    gemm_info.set_sparse_weights(_sparse_weights);
+    gemm_info.set_fast_math(_fast_math);
 
     // Supported activations in GEMM
     const std::set<ActivationLayerInfo::ActivationFunction> supported_acts = { ActivationLayerInfo::ActivationFunction::RELU,
@@ -170,7 +176,9 @@ void NEGEMMConvolutionLayer::configure_mm(const ITensor *input, const ITensor *w
         output_info.is_quantized_per_channel = (weights->info()->data_type() == DataType::QSYMM8_PER_CHANNEL);
         quantization::calculate_quantized_multipliers(iqinfo, wqinfo, oqinfo, output_info);
 
-        _mm_gemmlowp.configure(input, weights, biases, output, GEMMInfo(false, false, true, gemm_3d_depth, _skip_im2col, false, output_info));
+        GEMMInfo gemmlowp_info(false, false, true, gemm_3d_depth, _skip_im2col, false, output_info);
+        gemmlowp_info.set_sparse_weights(_sparse_weights);
+        _mm_gemmlowp.configure(input, weights, biases, output, gemmlowp_info);
 
         // Revert back QuantizatioInfo as input and weights could be used in other convolution layers
         input->info()->set_quantization_info(iqinfo);
@@ -184,16 +192,17 @@ void NEGEMMConvolutionLayer::configure_mm(const ITensor *input, const ITensor *w
 }
 
 Status NEGEMMConvolutionLayer::validate_mm(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *biases, const ITensorInfo *output,
-                                           const ActivationLayerInfo &act_info, int gemm_3d_depth, bool skip_im2col)
+                                           const ActivationLayerInfo &act_info, int gemm_3d_depth, bool skip_im2col, bool fast_math)
 {
     const DataType data_type             = input->data_type();
     const bool     is_quantized          = is_data_type_quantized_asymmetric(data_type);
     const bool     is_activation_enabled = act_info.enabled();
 
     // Create GEMMInfo structure
-    const GEMMInfo gemm_info = GEMMInfo(false, false, true /* Reshape weights only for the first run */,
-                                        gemm_3d_depth, skip_im2col /* Reinterpret the input as 3D if im2col is skipped */,
-                                        false, GEMMLowpOutputStageInfo(), false, false, act_info);
+    GEMMInfo gemm_info = GEMMInfo(false, false, true /* Reshape weights only for the first run */,
+                                  gemm_3d_depth, skip_im2col /* Reinterpret the input as 3D if im2col is skipped */,
+                                  false, GEMMLowpOutputStageInfo(), false, false, act_info);
+    gemm_info.set_fast_math(fast_math);
 
     if(is_quantized)
     {
@@ -256,11 +265,91 @@ Status NEGEMMConvolutionLayer::validate_gemm3d(const ITensorInfo *input_info, co
     return validate_mm(&dummy_input_info, &dummy_weights_info, nullptr, &dummy_output_info, act_info, gemm_3d_depth, skip_im2col);
 }
 
+void NEGEMMConvolutionLayer::configure_conv2d(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const PadStrideInfo &conv_info, const Size2D &dilation,
+                                              const ActivationLayerInfo &act_info, bool enable_fast_math)
+{
+    const Conv2dInfo info(conv_info, dilation, act_info, enable_fast_math, 1);
+
+    if(_data_layout == DataLayout::NHWC)
+    {
+        _conv2d.configure(input, weights, biases, output, info);
+        return;
+    }
+
+    // The assembly convolution reads NHWC tensors: permute input and weights on the way in and the result on the way out
+    _memory_group.manage(&_input_nhwc);
+    _permute_input.configure(input, &_input_nhwc, PermutationVector(2U, 0U, 1U));
+    _input_nhwc.info()->set_data_layout(DataLayout::NHWC);
+
+    // Managed weights are permuted through the weights manager, so that NEGEMMConv2d can chain its own transform to them
+    ITensor *weights_nhwc = &_weights_nhwc;
+    if(_weights_manager && _weights_manager->are_weights_managed(weights))
+    {
+        _permute_weights_managed.configure(weights, PermutationVector(2U, 0U, 1U));
+        weights_nhwc = _weights_manager->acquire(weights, &_permute_weights_managed);
+    }
+    else
+    {
+        _permute_weights.configure(weights, &_weights_nhwc, PermutationVector(2U, 0U, 1U));
+    }
+    weights_nhwc->info()->set_data_layout(DataLayout::NHWC);
+
+    TensorInfo output_nhwc_info(compute_permutation_output_shape(*output->info(), PermutationVector(2U, 0U, 1U)), 1, output->info()->data_type(), output->info()->quantization_info());
+    output_nhwc_info.set_data_layout(DataLayout::NHWC);
+    _output_nhwc.allocator()->init(output_nhwc_info);
+    _memory_group.manage(&_output_nhwc);
+
+    _conv2d.configure(&_input_nhwc, weights_nhwc, biases, &_output_nhwc, info);
+    _input_nhwc.allocator()->allocate();
+
+    _permute_output.configure(&_output_nhwc, output, PermutationVector(1U, 2U, 0U));
+    _output_nhwc.allocator()->allocate();
+}
+
+Status NEGEMMConvolutionLayer::validate_conv2d(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *biases, const ITensorInfo *output, const PadStrideInfo &conv_info,
+                                               const Size2D &dilation, const ActivationLayerInfo &act_info, bool enable_fast_math)
+{
+    const Conv2dInfo info(conv_info, dilation, act_info, enable_fast_math, 1);
+
+    if(input->data_layout() == DataLayout::NHWC)
+    {
+        return NEGEMMConv2d::validate(input, weights, biases, output, info);
+    }
+
+    ARM_COMPUTE_RETURN_ERROR_ON(output->total_size() == 0);
+
+    const PermutationVector to_nhwc(2U, 0U, 1U);
+
+    std::unique_ptr<ITensorInfo> input_nhwc = input->clone();
+    input_nhwc->set_is_resizable(true).set_tensor_shape(compute_permutation_output_shape(*input, to_nhwc)).set_data_layout(DataLayout::NHWC);
+    std::unique_ptr<ITensorInfo> weights_nhwc = weights->clone();
+    weights_nhwc->set_is_resizable(true).set_tensor_shape(compute_permutation_output_shape(*weights, to_nhwc)).set_data_layout(DataLayout::NHWC);
+    std::unique_ptr<ITensorInfo> output_nhwc = output->clone();
+    output_nhwc->set_is_resizable(true).set_tensor_shape(compute_permutation_output_shape(*output, to_nhwc)).set_data_layout(DataLayout::NHWC);
+
+    return NEGEMMConv2d::validate(input_nhwc.get(), weights_nhwc.get(), biases, output_nhwc.get(), info);
+}
+
+bool NEGEMMConvolutionLayer::uses_conv2d(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *biases, const ITensorInfo *output, const PadStrideInfo &conv_info,
+                                         const WeightsInfo &weights_info, const Size2D &dilation, const ActivationLayerInfo &act_info, unsigned int num_groups, bool enable_fast_math)
+{
+    const DataLayout data_layout = input->data_layout();
+    const int        idx_width   = get_data_layout_dimension_index(data_layout, DataLayoutDimension::WIDTH);
+    const int        idx_height  = get_data_layout_dimension_index(data_layout, DataLayoutDimension::HEIGHT);
+    const bool       skip_im2col = (data_layout == DataLayout::NHWC && weights->dimension(idx_width) == 1 && weights->dimension(idx_height) == 1 && conv_info.stride().first == 1
+                                    && conv_info.stride().second == 1 && num_groups == 1);
+
+    // Prefer the im2col-free assembly convolution: it gathers the kernel points on the fly instead of materialising the im2col matrix.
+    // Sparse weights, grouped convolutions and weights retained from another function need the reshaped weights matrix, so they keep using im2col.
+    return !skip_im2col && !weights_info.sparse_weights() && (num_groups == 1) && !weights_info.retain_internal_weights()
+           && bool(validate_conv2d(input, weights, biases, output, conv_info, dilation, act_info, enable_fast_math));
+}
+
 void NEGEMMConvolutionLayer::configure(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const PadStrideInfo &conv_info, const WeightsInfo &weights_info,
-                                       const Size2D &dilation, const ActivationLayerInfo &act_info, unsigned int num_groups)
+                                       const Size2D &dilation, const ActivationLayerInfo &act_info, unsigned int num_groups, bool enable_fast_math)
 {
     ARM_COMPUTE_ERROR_ON_NULLPTR(input, weights, output);
-    ARM_COMPUTE_UNUSED(num_groups, weights_info);
+    ARM_COMPUTE_UNUSED(weights_info);
     ARM_COMPUTE_ERROR_THROW_ON(NEGEMMConvolutionLayer::validate(input->info(),
                                                                 weights->info(),
                                                                 biases != nullptr ? biases->info() : nullptr,
@@ -269,7 +358,8 @@ void NEGEMMConvolutionLayer::configure(const ITensor *input, const ITensor *weig
                                                                 weights_info,
                                                                 dilation,
                                                                 act_info,
-                                                                num_groups));
+                                                                num_groups,
+                                                                enable_fast_math));
 
     const DataType   data_type   = input->info()->data_type();
     const DataLayout data_layout = input->info()->data_layout();
@@ -283,8 +373,18 @@ void NEGEMMConvolutionLayer::configure(const ITensor *input, const ITensor *weig
     _is_prepared      = weights_info.retain_internal_weights();
     _original_weights = weights;
     _is_quantized     = is_data_type_quantized_asymmetric(input->info()->data_type());
+    _sparse_weights   = weights_info.sparse_weights();
+    _fast_math        = enable_fast_math;
     _data_layout      = data_layout;
-    _skip_im2col      = (data_layout == DataLayout::NHWC && kernel_width == 1 && kernel_height == 1 && conv_info.stride().first == 1 && conv_info.stride().second == 1);
+    _skip_im2col      = (data_layout == DataLayout::NHWC && kernel_width == 1 && kernel_height == 1 && conv_info.stride().first == 1 && conv_info.stride().second == 1 && num_groups == 1);
+
+    _use_conv2d = uses_conv2d(input->info(), weights->info(), biases != nullptr ? biases->info() : nullptr, output->info(), conv_info, weights_info, dilation, act_info, num_groups,
+                              enable_fast_math);
+    if(_use_conv2d)
+    {
+        configure_conv2d(input, weights, biases, output, conv_info, dilation, act_info, enable_fast_math);
+        return;
+    }
 
     const ITensor *gemm_input_to_use  = input;
     ITensor       *gemm_output_to_use = output;
@@ -299,10 +399,10 @@ void NEGEMMConvolutionLayer::configure(const ITensor *input, const ITensor *weig
                                                  conv_info,
                                                  dilation);
 
-    // Check if GEMM3D is supported
+    // Check if GEMM3D is supported. Grouped convolutions need col2im to interleave the groups back into the output channels
     if(data_layout == DataLayout::NHWC)
     {
-        _skip_col2im = bool(validate_gemm3d(input->info(), weights->info(), act_info, conv_h, true));
+        _skip_col2im = (num_groups == 1) && bool(validate_gemm3d(input->info(), weights->info(), act_info, conv_h, true));
         // If not supported, we need to perform im2col and col2im (or reshape layer)
         if(!_skip_col2im)
         {
@@ -319,7 +419,13 @@ void NEGEMMConvolutionLayer::configure(const ITensor *input, const ITensor *weig
     unsigned int stride_y = 0;
     std::tie(stride_x, stride_y) = conv_info.stride();
 
-    unsigned int mat_weights_cols = weights->info()->dimension(idx_kernels);
+    unsigned int mat_weights_cols = weights->info()->dimension(idx_kernels) / num_groups;
+
+    // Grouped convolutions run all the groups in a single GEMM with one multi per group. The biases are appended
+    // to each group of the reshaped weights matrix, as the GEMM bias can only be shared across the multis.
+    const bool     append_bias   = (num_groups > 1) && (biases != nullptr);
+    const ITensor *biases_to_use = append_bias ? biases : nullptr;
+    const ITensor *gemm_biases   = (num_groups > 1) ? nullptr : biases;
 
     // _weights_reshaped will be auto configured in the kernel.
     // Just append biases and do not transpose 1xW as it will be reshaped in NEGEMM
@@ -327,12 +433,12 @@ void NEGEMMConvolutionLayer::configure(const ITensor *input, const ITensor *weig
 
     if(_weights_manager && _weights_manager->are_weights_managed(weights))
     {
-        _reshape_weights_managed.configure(weights, nullptr);
+        _reshape_weights_managed.configure(weights, biases_to_use, num_groups);
         weights_to_use = _weights_manager->acquire(weights, &_reshape_weights_managed);
     }
     else
     {
-        _reshape_weights.configure(weights, nullptr, &_weights_reshaped);
+        _reshape_weights.configure(weights, biases_to_use, &_weights_reshaped, num_groups);
         weights_to_use = &_weights_reshaped;
     }
 
@@ -343,7 +449,7 @@ void NEGEMMConvolutionLayer::configure(const ITensor *input, const ITensor *weig
 
         // Configure
         _im2col_kernel = arm_compute::support::cpp14::make_unique<NEIm2ColKernel>();
-        _im2col_kernel->configure(input, &_im2col_output, Size2D(kernel_width, kernel_height), conv_info, false, dilation);
+        _im2col_kernel->configure(input, &_im2col_output, Size2D(kernel_width, kernel_height), conv_info, append_bias, dilation, num_groups);
 
         // Update GEMM input
         gemm_input_to_use = &_im2col_output;
@@ -373,7 +479,7 @@ void NEGEMMConvolutionLayer::configure(const ITensor *input, const ITensor *weig
     // Configure GEMM
     // In case we need to skip col2im, GEMM3D (gemm_3d_depth != 0) must be called in order to avoid reshaping the output matrix
     const unsigned int gemm_3d_depth = _skip_col2im ? conv_h : 0;
-    configure_mm(gemm_input_to_use, weights_to_use, biases, gemm_output_to_use, act_info, gemm_3d_depth);
+    configure_mm(gemm_input_to_use, weights_to_use, gemm_biases, gemm_output_to_use, act_info, gemm_3d_depth);
 
     if(!_skip_im2col)
     {
@@ -382,11 +488,11 @@ void NEGEMMConvolutionLayer::configure(const ITensor *input, const ITensor *weig
 
     if(!_skip_col2im)
     {
-        if(_data_layout == DataLayout::NCHW)
+        if(_data_layout == DataLayout::NCHW || num_groups > 1)
         {
             // Configure col2im
             _col2im_kernel = arm_compute::support::cpp14::make_unique<NECol2ImKernel>();
-            _col2im_kernel->configure(gemm_output_to_use, output, Size2D(conv_w, conv_h));
+            _col2im_kernel->configure(gemm_output_to_use, output, Size2D(conv_w, conv_h), num_groups);
         }
         else
         {
@@ -410,14 +516,14 @@ void NEGEMMConvolutionLayer::configure(const ITensor *input, const ITensor *weig
 }
 
 Status NEGEMMConvolutionLayer::validate(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *biases, const ITensorInfo *output, const PadStrideInfo &conv_info,
-                                        const WeightsInfo &weights_info, const Size2D &dilation, const ActivationLayerInfo &act_info, unsigned int num_groups)
+                                        const WeightsInfo &weights_info, const Size2D &dilation, const ActivationLayerInfo &act_info, unsigned int num_groups, bool enable_fast_math)
 {
     ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, weights, output);
     ARM_COMPUTE_RETURN_ERROR_ON_MSG(weights_info.are_reshaped(), "Weights already reshaped are not supported!");
     ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::QASYMM8, DataType::QASYMM8_SIGNED, DataType::BFLOAT16, DataType::F16, DataType::F32);
     ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(weights, 1, DataType::QASYMM8, DataType::QASYMM8_SIGNED, DataType::QSYMM8_PER_CHANNEL, DataType::BFLOAT16, DataType::F16, DataType::F32);
     ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_LAYOUT(input, weights);
-    ARM_COMPUTE_RETURN_ERROR_ON_MSG(num_groups > 1, "Grouping (num_groups != 1) is not supported on NEON");
+    ARM_COMPUTE_RETURN_ERROR_ON(num_groups == 0);
 
     const DataLayout data_layout = input->data_layout();
     const DataType   data_type   = input->data_type();
@@ -437,10 +543,13 @@ Status NEGEMMConvolutionLayer::validate(const ITensorInfo *input, const ITensorI
     const ITensorInfo *gemm_output_to_use = output;
     const ITensorInfo *weights_to_use     = weights;
 
-    const bool append_bias  = false;
     const bool is_quantized = is_data_type_quantized_asymmetric(data_type);
     const bool is_bf16      = data_type == DataType::BFLOAT16;
-    bool       skip_im2col  = (data_layout == DataLayout::NHWC && kernel_width == 1 && kernel_height == 1 && conv_info.stride().first == 1 && conv_info.stride().second == 1);
+    const bool is_grouped   = num_groups > 1;
+    const bool append_bias  = is_grouped && (biases != nullptr);
+
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(is_grouped && (data_type != DataType::F16) && (data_type != DataType::F32), "Grouping (num_groups != 1) is only supported for F16/F32");
+    bool       skip_im2col  = (data_layout == DataLayout::NHWC && kernel_width == 1 && kernel_height == 1 && conv_info.stride().first == 1 && conv_info.stride().second == 1 && !is_grouped);
 
     // Get convolved dimensions
     unsigned int conv_w = 0;
@@ -457,7 +566,7 @@ Status NEGEMMConvolutionLayer::validate(const ITensorInfo *input, const ITensorI
     bool skip_col2im = false;
     if(data_layout == DataLayout::NHWC)
     {
-        skip_col2im = bool(validate_gemm3d(input, weights, act_info, conv_h, true));
+        skip_col2im = !is_grouped && bool(validate_gemm3d(input, weights, act_info, conv_h, true));
         // If not supported, we need to perform im2col and col2im (or reshape layer)
         if(!skip_col2im)
         {
@@ -475,7 +584,8 @@ Status NEGEMMConvolutionLayer::validate(const ITensorInfo *input, const ITensorI
         }
     }
 
-    ARM_COMPUTE_RETURN_ERROR_ON(weights->dimension(idx_channel) != input->dimension(idx_channel));
+    ARM_COMPUTE_RETURN_ERROR_ON(weights->dimension(idx_channel) * num_groups != input->dimension(idx_channel));
+    ARM_COMPUTE_RETURN_ERROR_ON((weights->dimension(idx_kernels) % num_groups) != 0);
     ARM_COMPUTE_RETURN_ERROR_ON(weights->num_dimensions() > 4);
 
     // Validate biases
@@ -497,12 +607,12 @@ Status NEGEMMConvolutionLayer::validate(const ITensorInfo *input, const ITensorI
         ARM_COMPUTE_RETURN_ERROR_ON(biases->num_dimensions() > 1);
     }
 
-    unsigned int mat_weights_cols = weights->dimension(idx_kernels);
-    unsigned int mat_weights_rows = weights->dimension(idx_width) * weights->dimension(idx_height) * weights->dimension(idx_channel);
+    unsigned int mat_weights_cols = weights->dimension(idx_kernels) / num_groups;
+    unsigned int mat_weights_rows = weights->dimension(idx_width) * weights->dimension(idx_height) * weights->dimension(idx_channel) + (append_bias ? 1 : 0);
 
     // Output tensor auto inizialization if not yet initialized
-    ARM_COMPUTE_RETURN_ON_ERROR(NEConvolutionLayerReshapeWeights::validate(weights, nullptr, nullptr));
-    weights_reshaped_info = TensorInfo(compute_weights_reshaped_shape(*weights, append_bias), 1, data_type);
+    ARM_COMPUTE_RETURN_ON_ERROR(NEConvolutionLayerReshapeWeights::validate(weights, append_bias ? biases : nullptr, nullptr, num_groups));
+    weights_reshaped_info = TensorInfo(compute_weights_reshaped_shape(*weights, append_bias, num_groups), 1, data_type);
     weights_reshaped_info.set_quantization_info(weights->quantization_info());
     weights_to_use = &weights_reshaped_info;
 
@@ -515,11 +625,17 @@ Status NEGEMMConvolutionLayer::validate(const ITensorInfo *input, const ITensorI
         shape_im2col.set(0, mat_weights_rows);
         shape_im2col.set(1, conv_w * conv_h);
         shape_im2col.set(2, 1);
+        if(is_grouped)
+        {
+            // Grouped im2col output is [K / num_groups, M, batches, num_groups]
+            shape_im2col.set(2, input->dimension(3));
+            shape_im2col.set(3, num_groups);
+        }
 
         im2col_reshaped_info = TensorInfo(shape_im2col, 1, data_type);
         im2col_reshaped_info.set_quantization_info(input->quantization_info());
 
-        ARM_COMPUTE_RETURN_ON_ERROR(NEIm2ColKernel::validate(input, &im2col_reshaped_info, Size2D(kernel_width, kernel_height), conv_info, append_bias, dilation));
+        ARM_COMPUTE_RETURN_ON_ERROR(NEIm2ColKernel::validate(input, &im2col_reshaped_info, Size2D(kernel_width, kernel_height), conv_info, append_bias, dilation, num_groups));
         gemm_input_to_use = &im2col_reshaped_info;
     }
 
@@ -538,12 +654,20 @@ Status NEGEMMConvolutionLayer::validate(const ITensorInfo *input, const ITensorI
     }
     info_gemm.set_quantization_info(output->quantization_info()).set_data_layout(input->data_layout());
     gemm_output_to_use = &info_gemm;
-    ARM_COMPUTE_RETURN_ON_ERROR(validate_mm(gemm_input_to_use, weights_to_use, biases, gemm_output_to_use, act_info, skip_col2im ? conv_h : 0, skip_im2col));
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_mm(gemm_input_to_use, weights_to_use, is_grouped ? nullptr : biases, gemm_output_to_use, act_info, skip_col2im ? conv_h : 0, skip_im2col,
+                                            enable_fast_math));
+
+    // Only the assembly GEMM can compute one multi per group
+    if(is_grouped)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(!bool(NEGEMMAssemblyDispatch::validate(gemm_input_to_use, weights_to_use, nullptr, gemm_output_to_use, AsmGemmInfo())),
+                                        "Grouping (num_groups != 1) requires an assembly GEMM");
+    }
 
     // Validate Col2Im/ReshapeLayer
-    if(!skip_col2im && (data_layout == DataLayout::NCHW))
+    if(!skip_col2im && (data_layout == DataLayout::NCHW || is_grouped))
     {
-        ARM_COMPUTE_RETURN_ON_ERROR(NECol2ImKernel::validate(gemm_output_to_use, output, Size2D(conv_w, conv_h)));
+        ARM_COMPUTE_RETURN_ON_ERROR(NECol2ImKernel::validate(gemm_output_to_use, output, Size2D(conv_w, conv_h), num_groups));
     }
 
     return Status{};
@@ -555,6 +679,21 @@ void NEGEMMConvolutionLayer::run()
 
     MemoryGroupResourceScope scope_mg(_memory_group);
 
+    if(_use_conv2d)
+    {
+        if(_data_layout == DataLayout::NCHW)
+        {
+            _permute_input.run();
+            _conv2d.run();
+            _permute_output.run();
+        }
+        else
+        {
+            _conv2d.run();
+        }
+        return;
+    }
+
     if(!_skip_im2col)
     {
         // Run input reshaping
@@ -577,7 +716,7 @@ void NEGEMMConvolutionLayer::run()
     // Reshape output matrix
     if(!_skip_col2im)
     {
-        if(_data_layout == DataLayout::NCHW)
+        if(_col2im_kernel != nullptr)
         {
             NEScheduler::get().schedule(_col2im_kernel.get(), Window::DimY);
         }
@@ -592,6 +731,31 @@ void NEGEMMConvolutionLayer::prepare()
 {
     if(!_is_prepared)
     {
+        if(_use_conv2d)
+        {
+            if(_data_layout == DataLayout::NCHW)
+            {
+                if(_weights_manager && _weights_manager->are_weights_managed(_original_weights))
+                {
+                    _weights_manager->run(_original_weights, &_permute_weights_managed);
+                }
+                else
+                {
+                    _weights_nhwc.allocator()->allocate();
+                    _permute_weights.run();
+                    _original_weights->mark_as_unused();
+                }
+            }
+            _conv2d.prepare();
+            if(!_weights_nhwc.is_used())
+            {
+                _weights_nhwc.allocator()->free();
+            }
+
+            _is_prepared = true;
+            return;
+        }
+
         if(_weights_manager && _weights_manager->are_weights_managed(_original_weights))
         {
             _weights_manager->run(_original_weights, &_reshape_weights_managed);
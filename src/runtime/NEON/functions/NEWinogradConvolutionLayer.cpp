@@ -27,10 +27,12 @@
 #include "arm_compute/core/Utils.h"
 #include "arm_compute/core/Validate.h"
 #include "arm_compute/core/utils/misc/ShapeCalculator.h"
+#include "arm_compute/core/utils/quantization/AsymmHelpers.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
 #include "arm_compute/runtime/NEON/functions/NEGEMMAssemblyDispatch.h"
 #include "src/core/CPP/Validate.h"
 #include "src/core/NEON/kernels/NEGEMMInterleave4x4Kernel.h"
+#include "src/core/NEON/kernels/NEGEMMLowpOffsetContributionOutputStageKernel.h"
 #include "src/core/NEON/kernels/NEGEMMMatrixAdditionKernel.h"
 #include "src/core/NEON/kernels/NEGEMMMatrixMultiplyKernel.h"
 #include "src/core/NEON/kernels/NEGEMMTranspose1xWKernel.h"
@@ -40,10 +42,16 @@
 #include "src/core/NEON/kernels/convolution/common/utils.hpp"
 #include "src/core/NEON/kernels/convolution/winograd/winograd.hpp"
 
+#include <limits>
+
 namespace arm_compute
 {
 namespace
 {
+// Quantized inputs and weights are re-centred to [-255, 255] before F(2x2, 3x3) so every transform-domain product
+// is at most 4 * 9 * 255 * 255 in magnitude (A^T, G and B^T scaled to integers): bound K so the S32 accumulators cannot overflow.
+constexpr int max_quantized_winograd_channels = std::numeric_limits<int32_t>::max() / (4 * 9 * 255 * 255);
+
 inline Status validate_kernel_3x3(const Size2D input_dims, const ITensorInfo *input, const TensorInfo *input0, const TensorInfo *input1, const TensorInfo *batched_mm_output,
                                   const ITensorInfo *weights, const ITensorInfo *biases, const ITensorInfo *output, const WinogradInfo &winograd_info, const ActivationLayerInfo &act_info)
 {
@@ -196,6 +204,33 @@ Status validate_arguments(const ITensorInfo *input, const ITensorInfo *weights,
     ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(input);
 
     ARM_COMPUTE_RETURN_ERROR_ON_MSG(conv_info.stride().first != 1 || conv_info.stride().second != 1, "Winograd layer only supports unit strides.");
+
+    if(is_data_type_quantized_asymmetric(input->data_type()))
+    {
+        const size_t idx_width   = get_data_layout_dimension_index(input->data_layout(), DataLayoutDimension::WIDTH);
+        const size_t idx_height  = get_data_layout_dimension_index(input->data_layout(), DataLayoutDimension::HEIGHT);
+        const size_t idx_channel = get_data_layout_dimension_index(input->data_layout(), DataLayoutDimension::CHANNEL);
+
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(weights, 1, DataType::QASYMM8, DataType::QASYMM8_SIGNED, DataType::QSYMM8_PER_CHANNEL);
+        if(is_data_type_quantized_per_channel(weights->data_type()))
+        {
+            ARM_COMPUTE_RETURN_ERROR_ON_MSG(input->data_type() != DataType::QASYMM8_SIGNED, "Per-channel quantized weights are only supported with QASYMM8_SIGNED input");
+        }
+        else
+        {
+            ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, weights);
+        }
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(weights->dimension(idx_width) != 3 || weights->dimension(idx_height) != 3, "Only 3x3 kernels are supported for quantized data types");
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(weights->dimension(idx_channel) > static_cast<size_t>(max_quantized_winograd_channels),
+                                        "Too many input channels for the quantized Winograd accumulators");
+        if(biases != nullptr)
+        {
+            ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(biases, 1, DataType::S32);
+            ARM_COMPUTE_RETURN_ERROR_ON(biases->num_dimensions() > 1);
+        }
+        return Status{};
+    }
+
     if(biases != nullptr)
     {
         ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, biases);
@@ -214,6 +249,10 @@ Size2D winograd_output_tile(const Size2D &input_dims, const Size2D &kernel_dims,
         {
             output_tile = Size2D(4U, 4U);
         }
+        else if(is_data_type_quantized_asymmetric(data_type))
+        {
+            output_tile = Size2D(2U, 2U);
+        }
     }
     else if(kernel_dims == Size2D(5U, 5U))
     {
@@ -276,9 +315,11 @@ bool check_support_fast_math(const Size2D &output_tile, const Size2D &kernel_siz
     }
 }
 
-inline bool fuse_function_supported(const ActivationLayerInfo &act_info)
+inline bool fuse_function_supported(const ActivationLayerInfo &act_info, bool is_quantized = false)
 {
-    return act_info.activation() == ActivationLayerInfo::ActivationFunction::RELU || act_info.activation() == ActivationLayerInfo::ActivationFunction::BOUNDED_RELU;
+    // The quantized output stage clamps to arbitrary bounds, so it can also absorb LU_BOUNDED_RELU
+    return act_info.activation() == ActivationLayerInfo::ActivationFunction::RELU || act_info.activation() == ActivationLayerInfo::ActivationFunction::BOUNDED_RELU
+           || (is_quantized && act_info.activation() == ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU);
 }
 
 arm_gemm::Activation arm_gemm_activation_from_acl_activation(const ActivationLayerInfo &act_info)
@@ -299,13 +340,83 @@ arm_gemm::Activation arm_gemm_activation_from_acl_activation(const ActivationLay
         }
     }
 }
+
+Status get_quantized_output_stage_info(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *output, const ActivationLayerInfo &act_info,
+                                       GEMMLowpOutputStageInfo &output_stage_info)
+{
+    const QuantizationInfo        iqinfo    = input->quantization_info();
+    const QuantizationInfo        wqinfo    = weights->quantization_info();
+    const QuantizationInfo        oqinfo    = (output->total_size() == 0) ? iqinfo : output->quantization_info();
+    const UniformQuantizationInfo uoqinfo   = oqinfo.uniform();
+    const DataType                data_type = input->data_type();
+
+    // Merge activation with output stage
+    PixelValue type_min{};
+    PixelValue type_max{};
+    std::tie(type_min, type_max) = get_min_max(data_type);
+    int32_t min_activation = type_min.get<int32_t>();
+    int32_t max_activation = type_max.get<int32_t>();
+
+    if(act_info.enabled() && fuse_function_supported(act_info, true))
+    {
+        std::tie(min_activation, max_activation) = get_quantized_activation_min_max(act_info, data_type, uoqinfo);
+    }
+
+    output_stage_info.type                     = GEMMLowpOutputStageType::QUANTIZE_DOWN_FIXEDPOINT;
+    output_stage_info.gemmlowp_offset          = uoqinfo.offset;
+    output_stage_info.gemmlowp_min_bound       = min_activation;
+    output_stage_info.gemmlowp_max_bound       = max_activation;
+    output_stage_info.is_quantized_per_channel = is_data_type_quantized_per_channel(weights->data_type());
+    output_stage_info.output_data_type         = data_type;
+
+    return quantization::calculate_quantized_multipliers(iqinfo, wqinfo, oqinfo, output_stage_info);
+}
+
+inline Status validate_kernel_3x3_quantized(const ITensorInfo *input, const TensorInfo *input0, const TensorInfo *input1, const TensorInfo *batched_mm_output,
+                                            const ITensorInfo *weights, const ITensorInfo *biases, const ITensorInfo *output, const WinogradInfo &winograd_info, const ActivationLayerInfo &act_info)
+{
+    // Offsets are removed on the way in and the transforms run on S16 values, accumulating in S32
+    const TensorInfo input_s16             = input->clone()->set_data_type(DataType::S16).set_quantization_info(QuantizationInfo());
+    const TensorInfo weights_s16           = weights->clone()->set_data_type(DataType::S16).set_quantization_info(QuantizationInfo());
+    const TensorInfo input0_s16            = input0->clone()->set_data_type(DataType::S16).set_quantization_info(QuantizationInfo());
+    const TensorInfo input1_s16            = input1->clone()->set_data_type(DataType::S16).set_quantization_info(QuantizationInfo());
+    const TensorInfo batched_mm_output_s32 = batched_mm_output->clone()->set_data_type(DataType::S32).set_quantization_info(QuantizationInfo());
+    const TensorInfo output_s32            = output->clone()->set_data_type(DataType::S32).set_quantization_info(QuantizationInfo());
+
+    ARM_COMPUTE_RETURN_ON_ERROR(NEWinogradLayerRemoveOffsetKernel::validate(input, &input_s16));
+    ARM_COMPUTE_RETURN_ON_ERROR(NEWinogradLayerRemoveOffsetKernel::validate(weights, &weights_s16));
+    ARM_COMPUTE_RETURN_ON_ERROR((NEWinogradLayerTransformInputKernel<int16_t, 2, 2, 3, 3>::validate(&input_s16, &input0_s16, winograd_info)));
+    ARM_COMPUTE_RETURN_ON_ERROR((NEWinogradLayerTransformWeightsKernel<int16_t, 2, 2, 3, 3>::validate(&weights_s16, &input1_s16, winograd_info)));
+    ARM_COMPUTE_RETURN_ON_ERROR(NEGEMMAssemblyDispatch::validate(&input0_s16, &input1_s16, nullptr, &batched_mm_output_s32, AsmGemmInfo()));
+    ARM_COMPUTE_RETURN_ON_ERROR((NEWinogradLayerTransformOutputKernel<int32_t, 2, 2, 3, 3>::validate(&batched_mm_output_s32, nullptr, &output_s32, winograd_info)));
+
+    GEMMLowpOutputStageInfo output_stage_info;
+    ARM_COMPUTE_RETURN_ON_ERROR(get_quantized_output_stage_info(input, weights, output, act_info, output_stage_info));
+    if(output->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ON_ERROR(NEGEMMLowpOffsetContributionOutputStageKernel::validate(&output_s32, nullptr, nullptr, biases, output, 0, 0, output_stage_info));
+    }
+
+    if(act_info.enabled() && !fuse_function_supported(act_info, true))
+    {
+        ARM_COMPUTE_RETURN_ON_ERROR(NEActivationLayer::validate(output, nullptr, act_info));
+    }
+    return Status{};
+}
 } //namespace
 
 NEWinogradConvolutionLayer::NEWinogradConvolutionLayer(const std::shared_ptr<IMemoryManager> &memory_manager)
-    : _memory_group(memory_manager), _gemm_function(memory_manager), _transform_input_kernel(nullptr), _transform_output_kernel(nullptr), _transform_weights_kernel(nullptr), _activationlayer_function(),
-      _permute_input(), _permute_weights(), _permute_output(), _input_transformed(), _output_transformed(), _input_workspace(), _output_workspace(), _kernel_storage(), _input_nhwc(), _output_nhwc(),
-      _weights_hwio(), _input(), _weights(), _output(), _is_prepared(false), _is_activationlayer_enabled(false)
+    : _memory_group(memory_manager), _gemm_function(memory_manager), _asm_glue(memory_manager), _transform_input_kernel(nullptr), _transform_output_kernel(nullptr), _transform_weights_kernel(nullptr),
+      _remove_input_offset_kernel(nullptr), _remove_weights_offset_kernel(nullptr), _output_stage_kernel(nullptr), _activationlayer_function(), _permute_input(), _permute_weights(), _permute_output(),
+      _input_transformed(), _output_transformed(), _input_workspace(), _output_workspace(), _kernel_storage(), _input_nhwc(), _output_nhwc(), _weights_hwio(), _input_s16(), _weights_hwio_s16(),
+      _output_s32(), _input(), _weights(), _output(), _is_prepared(false), _is_activationlayer_enabled(false), _is_quantized(false),
+      _num_tile_rows(0), _tile_rows_per_block(0), _forced_tile_rows_per_block(0)
+{
+}
+
+void NEWinogradConvolutionLayer::set_tile_rows_per_block(unsigned int tile_rows_per_block)
 {
+    _forced_tile_rows_per_block = tile_rows_per_block;
 }
 
 void NEWinogradConvolutionLayer::configure(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const PadStrideInfo &conv_info, const ActivationLayerInfo &act_info,
@@ -332,10 +443,11 @@ void NEWinogradConvolutionLayer::configure(const ITensor *input, const ITensor *
                                  "This Winograd configuration requires enable_fast_math=true");
     }
 
-    _weights     = weights;
-    _input       = input;
-    _output      = output;
-    _is_prepared = false;
+    _weights      = weights;
+    _input        = input;
+    _output       = output;
+    _is_prepared  = false;
+    _is_quantized = is_data_type_quantized_asymmetric(data_type);
 
     int n_gemms = 0;
     int N_BLOCK = 0; // Size of block used by GEMM.
@@ -435,6 +547,22 @@ void NEWinogradConvolutionLayer::configure(const ITensor *input, const ITensor *
             ARM_COMPUTE_ERROR("Not supported.");
         }
     }
+    else if(_is_quantized)
+    {
+        if(kernel_size == Size2D(3, 3))
+        {
+            using config             = NEWinogradLayerConfiguration<int16_t, int32_t, 2, 2, 3, 3>;
+            transform_input_kernel   = support::cpp14::make_unique<config::TransformInputKernel>();
+            transform_weights_kernel = support::cpp14::make_unique<config::TransformWeightsKernel>();
+            transform_output_kernel  = support::cpp14::make_unique<config::TransformOutputKernel>();
+            n_gemms                  = config::WinogradBase::N_GEMMS;
+            N_BLOCK                  = config::WinogradConv::N_BLOCK;
+        }
+        else
+        {
+            ARM_COMPUTE_ERROR("Not supported.");
+        }
+    }
 #ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
     else if(data_type == DataType::F16)
     {
@@ -461,34 +589,53 @@ void NEWinogradConvolutionLayer::configure(const ITensor *input, const ITensor *
     const int in_channels  = input->info()->dimension(channel_idx);
     const int out_channels = output->info()->dimension(channel_idx);
 
+    // Quantized convolutions run the transforms and the batched GEMM on S16 values accumulating in S32
+    const DataType gemm_input_data_type  = _is_quantized ? DataType::S16 : data_type;
+    const DataType gemm_output_data_type = _is_quantized ? DataType::S32 : data_type;
+
     const Tensor4DShape in_shape(internal_get_input_shape(input));
-    const size_t        data_type_size = input->info()->element_size();
+    const size_t        data_type_size        = data_size_from_type(gemm_input_data_type);
+    const size_t        output_data_type_size = data_size_from_type(gemm_output_data_type);
     // Get the memory required to instantiate a new Winograd operator.
     constexpr size_t storage_alignment = 64;
 
+    const auto         output_shape    = transform_output_kernel->get_output_shape(in_shape.n_rows, in_shape.n_cols, use_padding_type == PADDING_SAME);
+    const int          tile_rows       = iceildiv(output_shape.first, output_tile.height);
+    const int          tile_cols       = iceildiv(output_shape.second, output_tile.width);
+    const int          k               = in_shape.n_channels;
+    const int          n               = out_channels;
+    const unsigned int max_num_threads = NEScheduler::get().num_threads();
+
+    // When the transformed input and output of the whole tensor do not fit in the caches, the convolution is run in blocks of rows of tiles:
+    // each block goes through the input transform, the batched GEMM and the output transform before the next one starts,
+    // so the Winograd domain tensors only need to hold a single block.
+    const size_t tile_row_size = static_cast<size_t>(n_gemms) * in_shape.n_batches * tile_cols * (k * data_type_size + roundup(n, N_BLOCK) * output_data_type_size);
+    const size_t cache_size    = static_cast<size_t>(NEScheduler::get().cpu_info().get_L2_cache_size()) * max_num_threads;
+    const size_t block_size    = (_forced_tile_rows_per_block != 0) ? _forced_tile_rows_per_block : cache_size / tile_row_size;
+    _num_tile_rows             = tile_rows;
+    _tile_rows_per_block       = static_cast<unsigned int>(std::max<size_t>(1, std::min<size_t>(block_size, tile_rows)));
+
+    // Number of input rows needed by a block, used to size the Winograd domain tensors
+    const int block_rows = (_tile_rows_per_block == _num_tile_rows) ? in_shape.n_rows : static_cast<int>(_tile_rows_per_block * output_tile.height + (use_same_padding ? 0 : kernel_size.height - 1));
+
     // Kernel Storage
     const size_t kernel_storage_size = transform_weights_kernel->get_weight_storage_size(out_channels,
                                                                                          in_channels)
                                        * data_type_size;
 
     // Input storage
-    const size_t input_storage_size = transform_input_kernel->get_input_storage_size(in_shape.n_batches, in_shape.n_channels, in_shape.n_rows, in_shape.n_cols,
+    const size_t input_storage_size = transform_input_kernel->get_input_storage_size(in_shape.n_batches, in_shape.n_channels, block_rows, in_shape.n_cols,
                                                                                      use_same_padding)
                                       * data_type_size;
 
     // Output storage
-    const size_t output_storage_size  = transform_output_kernel->get_output_storage_size(in_shape.n_batches, in_shape.n_rows, in_shape.n_cols, out_channels) * data_type_size;
+    const size_t output_storage_size  = transform_output_kernel->get_output_storage_size(in_shape.n_batches, block_rows, in_shape.n_cols, out_channels) * output_data_type_size;
     const int    kernel_matrix_stride = transform_weights_kernel->get_matrix_stride(out_channels, in_channels);
-    const int    output_matrix_stride = transform_output_kernel->get_matrix_stride(in_shape.n_batches, in_shape.n_rows, in_shape.n_cols, out_channels);
-    const auto   output_shape         = transform_output_kernel->get_output_shape(in_shape.n_rows, in_shape.n_cols, use_padding_type == PADDING_SAME);
-    const int    input_matrix_stride  = transform_input_kernel->get_matrix_stride(in_shape.n_batches, in_channels, in_shape.n_rows, in_shape.n_cols, use_padding_type == PADDING_SAME);
+    const int    output_matrix_stride = transform_output_kernel->get_matrix_stride(in_shape.n_batches, block_rows, in_shape.n_cols, out_channels);
+    const int    input_matrix_stride  = transform_input_kernel->get_matrix_stride(in_shape.n_batches, in_channels, block_rows, in_shape.n_cols, use_padding_type == PADDING_SAME);
 
     // Configure GEMM
-    const int tile_rows                = iceildiv(output_shape.first, output_tile.height);
-    const int tile_cols                = iceildiv(output_shape.second, output_tile.width);
-    const int m                        = in_shape.n_batches * tile_rows * tile_cols;
-    const int k                        = in_shape.n_channels;
-    const int n                        = out_channels;
+    const int m                        = in_shape.n_batches * _tile_rows_per_block * tile_cols;
     const int kernel_matrix_row_stride = roundup(out_channels, N_BLOCK);
     const int output_matrix_row_stride = kernel_matrix_row_stride;
 
@@ -505,18 +652,18 @@ void NEWinogradConvolutionLayer::configure(const ITensor *input, const ITensor *
     b_strides.set(2, data_type_size * kernel_matrix_stride);
 
     TensorShape d_shape(n, m, 1, n_gemms);
-    Strides     d_strides(data_type_size);
-    d_strides.set(1, data_type_size * output_matrix_row_stride);
-    //d_strides.set(2, data_type_size * output_matrix_stride / n_gemms); FIXME: This is the real batch size, but RSH's code crashes if it's not 0.
+    Strides     d_strides(output_data_type_size);
+    d_strides.set(1, output_data_type_size * output_matrix_row_stride);
+    //d_strides.set(2, output_data_type_size * output_matrix_stride / n_gemms); FIXME: This is the real batch size, but RSH's code crashes if it's not 0.
     d_strides.set(2, 0);
-    d_strides.set(3, data_type_size * output_matrix_stride);
+    d_strides.set(3, output_data_type_size * output_matrix_stride);
 
     TensorInfo a_info{};
     TensorInfo b_info{};
     TensorInfo d_info{};
-    a_info.init(a_shape, 1, data_type, a_strides, 0, input_storage_size);
-    b_info.init(b_shape, 1, data_type, b_strides, 0, kernel_storage_size);
-    d_info.init(d_shape, 1, data_type, d_strides, 0, output_storage_size);
+    a_info.init(a_shape, 1, gemm_input_data_type, a_strides, 0, input_storage_size);
+    b_info.init(b_shape, 1, gemm_input_data_type, b_strides, 0, kernel_storage_size);
+    d_info.init(d_shape, 1, gemm_output_data_type, d_strides, 0, output_storage_size);
 
     _input_transformed.allocator()->init(a_info, storage_alignment);
     _kernel_storage.allocator()->init(b_info, storage_alignment);
@@ -525,13 +672,12 @@ void NEWinogradConvolutionLayer::configure(const ITensor *input, const ITensor *
     // configure and allocate dst tensor to be used to convert from winograd domain to spatial domain when calling to reshape_output()
     TensorInfo info(TensorShape(_output->info()->dimension(2), _output->info()->dimension(0),
                                 _output->info()->dimension(1), _output->info()->dimension(3)),
-                    1, _output->info()->data_type());
+                    1, _output->info()->data_type(), _output->info()->quantization_info());
     _output_nhwc.allocator()->init(info);
 
     const ITensor     *input_to_use  = _input;
     ITensor           *output_to_use = _output;
     PermutationVector  weights_permutation_vector(3U, 0U, 1U, 2U);
-    const unsigned int max_num_threads = NEScheduler::get().num_threads();
 
     // Configure the kernel to transform the input tensor from NCHW -> NHWC
     if(data_layout == DataLayout::NCHW)
@@ -542,27 +688,62 @@ void NEWinogradConvolutionLayer::configure(const ITensor *input, const ITensor *
         weights_permutation_vector = PermutationVector(3U, 2U, 0U, 1U);
     }
 
+    // Remove the input offset so that the input transform works on exact S16 values
+    if(_is_quantized)
+    {
+        _memory_group.manage(&_input_s16);
+        auto k = arm_compute::support::cpp14::make_unique<NEWinogradLayerRemoveOffsetKernel>();
+        k->configure(input_to_use, &_input_s16, input->info()->quantization_info().uniform().offset);
+        _remove_input_offset_kernel = std::move(k);
+        if(data_layout == DataLayout::NCHW)
+        {
+            _input_nhwc.allocator()->allocate();
+        }
+        input_to_use = &_input_s16;
+    }
+
     // Configure input transform kernel
     _memory_group.manage(&_input_transformed);
     _memory_group.manage(&_input_workspace);
     transform_input_kernel->configure(input_to_use, in_shape.n_batches, in_shape.n_rows, in_shape.n_cols, in_shape.n_channels, use_padding_type,
                                       &_input_transformed, input_matrix_stride, &_input_workspace);
     const size_t input_workspace_size = transform_input_kernel->get_working_space_size(max_num_threads);
-    TensorInfo   input_workspace_info(TensorShape(input_workspace_size), 1, _input->info()->data_type());
+    TensorInfo   input_workspace_info(TensorShape(input_workspace_size), 1, gemm_input_data_type);
     _input_workspace.allocator()->init(input_workspace_info);
     _input_workspace.allocator()->allocate();
-    if(data_layout == DataLayout::NCHW)
+    if(_is_quantized)
+    {
+        _input_s16.allocator()->allocate();
+    }
+    else if(data_layout == DataLayout::NCHW)
     {
         _input_nhwc.allocator()->allocate();
     }
 
     // Re-order a weight tensor from [Output feature map x Input feature map x Height x Width] to [Height x Width x Input feature map x Output feature map]
     _permute_weights.configure(weights, &_weights_hwio, weights_permutation_vector);
-    transform_weights_kernel->configure(&_weights_hwio, &_kernel_storage, kernel_matrix_stride, out_channels, in_channels);
+    const ITensor *weights_to_use = &_weights_hwio;
+    if(_is_quantized)
+    {
+        // Per-channel quantized weights are symmetric, so their offset is zero
+        auto k = arm_compute::support::cpp14::make_unique<NEWinogradLayerRemoveOffsetKernel>();
+        k->configure(&_weights_hwio, &_weights_hwio_s16, weights->info()->quantization_info().uniform().offset);
+        _remove_weights_offset_kernel = std::move(k);
+        weights_to_use                = &_weights_hwio_s16;
+    }
+    transform_weights_kernel->configure(weights_to_use, &_kernel_storage, kernel_matrix_stride, out_channels, in_channels);
 
     // Configure GEMM function
     _memory_group.manage(&_output_transformed);
-    _gemm_function.configure(&_input_transformed, &_kernel_storage, nullptr, &_output_transformed, 1.0f, 0.f);
+    if(_is_quantized)
+    {
+        _asm_glue.configure(&_input_transformed, &_kernel_storage, nullptr, &_output_transformed, AsmGemmInfo());
+        ARM_COMPUTE_ERROR_ON_MSG(!_asm_glue.is_configured(), "No 16-bit integer GEMM available for the quantized Winograd convolution");
+    }
+    else
+    {
+        _gemm_function.configure(&_input_transformed, &_kernel_storage, nullptr, &_output_transformed, 1.0f, 0.f);
+    }
     _input_transformed.allocator()->allocate();
 
     // Configure output transform function
@@ -572,12 +753,21 @@ void NEWinogradConvolutionLayer::configure(const ITensor *input, const ITensor *
         _memory_group.manage(&_output_nhwc);
         output_to_use = &_output_nhwc;
     }
-    const arm_gemm::Activation activation = arm_gemm_activation_from_acl_activation(act_info);
 
-    transform_output_kernel->configure(biases,
+    // Quantized outputs are produced in S32 and requantized, with the biases and the activation, by the output stage
+    ITensor *transform_output_to_use = output_to_use;
+    if(_is_quantized)
+    {
+        _memory_group.manage(&_output_s32);
+        _output_s32.allocator()->init(TensorInfo(output_to_use->info()->tensor_shape(), 1, DataType::S32));
+        transform_output_to_use = &_output_s32;
+    }
+    const arm_gemm::Activation activation = _is_quantized ? arm_gemm::Activation(arm_gemm::Activation::Type::None) : arm_gemm_activation_from_acl_activation(act_info);
+
+    transform_output_kernel->configure(_is_quantized ? nullptr : biases,
                                        &_output_transformed,
                                        output_matrix_stride,
-                                       output_to_use,
+                                       transform_output_to_use,
                                        in_shape.n_batches,
                                        output_shape.first,
                                        output_shape.second,
@@ -586,11 +776,28 @@ void NEWinogradConvolutionLayer::configure(const ITensor *input, const ITensor *
                                        activation);
 
     const size_t output_workspace_size = transform_output_kernel->get_working_space_size(max_num_threads);
-    TensorInfo   output_workspace_info(TensorShape(output_workspace_size), 1, _output->info()->data_type());
+    TensorInfo   output_workspace_info(TensorShape(output_workspace_size), 1, gemm_output_data_type);
     _output_workspace.allocator()->init(output_workspace_info);
     _output_workspace.allocator()->allocate();
     _output_transformed.allocator()->allocate();
 
+    if(_tile_rows_per_block < _num_tile_rows)
+    {
+        transform_input_kernel->configure_tile_row_blocks(_tile_rows_per_block);
+        transform_output_kernel->configure_tile_row_blocks(_tile_rows_per_block);
+    }
+
+    if(_is_quantized)
+    {
+        GEMMLowpOutputStageInfo output_stage_info;
+        ARM_COMPUTE_ERROR_THROW_ON(get_quantized_output_stage_info(input->info(), weights->info(), output->info(), act_info, output_stage_info));
+
+        auto k = arm_compute::support::cpp14::make_unique<NEGEMMLowpOffsetContributionOutputStageKernel>();
+        k->configure(&_output_s32, nullptr, nullptr, biases, output_to_use, in_channels, 0, 0, output_stage_info);
+        _output_stage_kernel = std::move(k);
+        _output_s32.allocator()->allocate();
+    }
+
     // Reorder the convoluted output to ACL's ordering NCHW
     if(data_layout == DataLayout::NCHW)
     {
@@ -603,7 +810,7 @@ void NEWinogradConvolutionLayer::configure(const ITensor *input, const ITensor *
     _transform_output_kernel  = std::move(transform_output_kernel);
 
     //Configure Activation Layer
-    _is_activationlayer_enabled = act_info.enabled() && !fuse_function_supported(act_info);
+    _is_activationlayer_enabled = act_info.enabled() && !fuse_function_supported(act_info, _is_quantized);
     if(_is_activationlayer_enabled)
     {
         _activationlayer_function.configure(_output, nullptr, act_info);
@@ -624,14 +831,42 @@ void NEWinogradConvolutionLayer::run()
         _permute_input.run();
     }
 
-    // Transform input tensor to the winograd domain
-    NEScheduler::get().schedule(_transform_input_kernel.get(), Window::DimX);
+    if(_is_quantized)
+    {
+        NEScheduler::get().schedule(_remove_input_offset_kernel.get(), Window::DimY);
+    }
+
+    const unsigned int num_blocks = iceildiv(_num_tile_rows, _tile_rows_per_block);
+    for(unsigned int block = 0; block < num_blocks; ++block)
+    {
+        if(num_blocks > 1)
+        {
+            static_cast<INEWinogradLayerTransformInputKernel *>(_transform_input_kernel.get())->set_tile_row_block(block);
+            static_cast<INEWinogradLayerTransformOutputKernel *>(_transform_output_kernel.get())->set_tile_row_block(block);
+        }
+
+        // Transform input tensor to the winograd domain
+        NEScheduler::get().schedule(_transform_input_kernel.get(), Window::DimX);
+
+        //Run 16 GEMMs in multiple threads, each kernel runs one or more GEMMs
+        if(_is_quantized)
+        {
+            _asm_glue.run();
+        }
+        else
+        {
+            _gemm_function.run();
+        }
 
-    //Run 16 GEMMs in multiple threads, each kernel runs one or more GEMMs
-    _gemm_function.run();
+        // Transform output tensor to the spatial domain
+        NEScheduler::get().schedule(_transform_output_kernel.get(), Window::DimX);
+    }
 
-    // Transform output tensor to the spatial domain
-    NEScheduler::get().schedule(_transform_output_kernel.get(), Window::DimX);
+    if(_is_quantized)
+    {
+        // Add the biases and requantize to the output data type
+        NEScheduler::get().schedule(_output_stage_kernel.get(), Window::DimY);
+    }
 
     if(data_layout == DataLayout::NCHW)
     {
@@ -694,6 +929,10 @@ Status NEWinogradConvolutionLayer::validate(const ITensorInfo *input, const ITen
         ARM_COMPUTE_RETURN_ERROR_ON_MSG(conv_info.pad_right() != conv_info.pad_left(), "Only SAME or VALID padding supported");
         ARM_COMPUTE_RETURN_ERROR_ON_MSG(conv_info.pad_top() != conv_info.pad_bottom(), "Only SAME or VALID padding supported");
         ARM_COMPUTE_RETURN_ERROR_ON_MSG(conv_info.pad_top() != conv_info.pad_left(), "Only SAME or VALID padding supported");
+        if(is_data_type_quantized_asymmetric(data_type))
+        {
+            return validate_kernel_3x3_quantized(input, &input0, &input1, &batched_mm_output, weights, biases, output, winograd_info, act_info);
+        }
         return validate_kernel_3x3(input_dims, input, &input0, &input1, &batched_mm_output, weights, biases, output, winograd_info, act_info);
     }
     else if(kernel_size == Size2D(5, 5))
@@ -764,11 +1003,18 @@ void NEWinogradConvolutionLayer::prepare()
         _permute_weights.run();
         _weights->mark_as_unused();
 
+        if(_is_quantized)
+        {
+            _weights_hwio_s16.allocator()->allocate();
+            NEScheduler::get().schedule(_remove_weights_offset_kernel.get(), Window::DimY);
+        }
+
         // Transform weights
         _kernel_storage.allocator()->allocate();
         NEScheduler::get().schedule(_transform_weights_kernel.get(), Window::DimX);
 
         _weights_hwio.allocator()->free();
+        _weights_hwio_s16.allocator()->free();
         _is_prepared = true;
     }
 }
@@ -52,6 +52,10 @@ std::shared_ptr<IScheduler> Scheduler::_custom_scheduler = nullptr;
 
 namespace
 {
+#ifndef NO_MULTI_THREADING
+thread_local IScheduler *thread_scheduler = nullptr;
+#endif /* NO_MULTI_THREADING */
+
 std::map<Scheduler::Type, std::unique_ptr<IScheduler>> init()
 {
     std::map<Scheduler::Type, std::unique_ptr<IScheduler>> m;
@@ -94,6 +98,13 @@ Scheduler::Type Scheduler::get_type()
 
 IScheduler &Scheduler::get()
 {
+#ifndef NO_MULTI_THREADING
+    if(thread_scheduler != nullptr)
+    {
+        return *thread_scheduler;
+    }
+#endif /* NO_MULTI_THREADING */
+
     if(_scheduler_type == Type::CUSTOM)
     {
         if(_custom_scheduler == nullptr)
@@ -129,3 +140,12 @@ void Scheduler::set(std::shared_ptr<IScheduler> scheduler)
     _custom_scheduler = std::move(scheduler);
     set(Type::CUSTOM);
 }
+
+void Scheduler::set_thread_scheduler(IScheduler *scheduler)
+{
+#ifndef NO_MULTI_THREADING
+    thread_scheduler = scheduler;
+#else  /* NO_MULTI_THREADING */
+    ARM_COMPUTE_UNUSED(scheduler);
+#endif /* NO_MULTI_THREADING */
+}
@@ -48,6 +48,23 @@ public:
         add_config(TensorShape(8U, 2U), TensorShape(16U, 8U), TensorShape(16U, 2U), TensorShape(16U, 2U), 1.0f, 0.0f);
         add_config(TensorShape(38U, 12U), TensorShape(21U, 38U), TensorShape(21U, 12U), TensorShape(21U, 12U), 0.2f, 1.2f);
         add_config(TensorShape(32U, 1U), TensorShape(17U, 32U), TensorShape(17U, 1U), TensorShape(17U, 1U), 0.4f, 0.7f);
+        add_config(TensorShape(37U, 5U), TensorShape(29U, 37U), TensorShape(29U, 5U), TensorShape(29U, 5U), 1.0f, 0.0f);
+        add_config(TensorShape(64U, 8U), TensorShape(41U, 64U), TensorShape(41U, 8U), TensorShape(41U, 8U), 1.0f, 0.0f);
+    }
+};
+class SmallMGEMMDataset final : public GEMMDataset
+{
+public:
+    SmallMGEMMDataset()
+    {
+        add_config(TensorShape(33U, 1U), TensorShape(27U, 33U), TensorShape(27U, 1U), TensorShape(27U, 1U), 1.0f, 0.0f);
+        add_config(TensorShape(33U, 2U), TensorShape(27U, 33U), TensorShape(27U, 2U), TensorShape(27U, 2U), 1.0f, 0.0f);
+        add_config(TensorShape(17U, 3U), TensorShape(40U, 17U), TensorShape(40U, 3U), TensorShape(40U, 3U), 1.0f, 0.0f);
+        add_config(TensorShape(64U, 4U), TensorShape(16U, 64U), TensorShape(16U, 4U), TensorShape(16U, 4U), 0.4f, 0.7f);
+        add_config(TensorShape(37U, 5U), TensorShape(29U, 37U), TensorShape(29U, 5U), TensorShape(29U, 5U), 1.0f, 0.0f);
+        add_config(TensorShape(9U, 6U), TensorShape(35U, 9U), TensorShape(35U, 6U), TensorShape(35U, 6U), 1.0f, 1.0f);
+        add_config(TensorShape(48U, 7U), TensorShape(19U, 48U), TensorShape(19U, 7U), TensorShape(19U, 7U), 1.0f, 0.0f);
+        add_config(TensorShape(64U, 8U), TensorShape(41U, 64U), TensorShape(41U, 8U), TensorShape(41U, 8U), 0.2f, 1.2f);
     }
 };
 class SmallGEMMOutput3DDataset final : public GEMMDataset
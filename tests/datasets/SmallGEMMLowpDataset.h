@@ -52,6 +52,21 @@ public:
         add_config(TensorShape(32U, 72U), TensorShape(17U, 32U), TensorShape(17U, 72U), -9, 1);
     }
 };
+class SmallMGEMMLowpDataset final : public GEMMLowpDataset
+{
+public:
+    SmallMGEMMLowpDataset()
+    {
+        add_config(TensorShape(33U, 1U), TensorShape(27U, 33U), TensorShape(27U, 1U), 0, 0);
+        add_config(TensorShape(33U, 2U), TensorShape(27U, 33U), TensorShape(27U, 2U), -2, 13);
+        add_config(TensorShape(17U, 3U), TensorShape(40U, 17U), TensorShape(40U, 3U), 0, 4);
+        add_config(TensorShape(64U, 4U), TensorShape(16U, 64U), TensorShape(16U, 4U), 5, 0);
+        add_config(TensorShape(37U, 5U), TensorShape(29U, 37U), TensorShape(29U, 5U), 0, 0);
+        add_config(TensorShape(9U, 6U), TensorShape(35U, 9U), TensorShape(35U, 6U), -3, -2);
+        add_config(TensorShape(48U, 7U), TensorShape(19U, 48U), TensorShape(19U, 7U), 0, 0);
+        add_config(TensorShape(64U, 8U), TensorShape(41U, 64U), TensorShape(41U, 8U), -9, 1);
+    }
+};
 class SmallGEMMLowpOutput3DDataset final : public GEMMLowpDataset
 {
 public:
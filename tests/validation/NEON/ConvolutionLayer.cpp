@@ -22,6 +22,7 @@
  * SOFTWARE.
  */
 #include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/NEConvolutionMethodTuner.h"
 #include "arm_compute/runtime/NEON/functions/NEConvolutionLayer.h"
 #include "arm_compute/runtime/NEON/functions/NEGEMMConv2d.h"
 #include "arm_compute/runtime/NEON/functions/NEGEMMConvolutionLayer.h"
@@ -40,6 +41,10 @@
 #include "tests/validation/fixtures/ConvolutionLayerFixture.h"
 #include "tests/validation/fixtures/WinogradConvolutionLayerFixture.h"
 
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
 namespace arm_compute
 {
 namespace test
@@ -59,6 +64,17 @@ void configure_conv_function<NEGEMMConv2d, Tensor>(NEGEMMConv2d &func,
     Conv2dInfo conv_info(info, dilation, act_info, false, num_groups);
     func.configure(src, weights, bias, dst, conv_info);
 }
+
+template <>
+void configure_conv_function<NEWinogradConvolutionLayer, Tensor>(NEWinogradConvolutionLayer &func,
+                                                                 Tensor *src, const Tensor *weights, const Tensor *bias, Tensor *dst,
+                                                                 const PadStrideInfo &info, const WeightsInfo &weights_info,
+                                                                 const Size2D &dilation, const ActivationLayerInfo &act_info, unsigned int num_groups)
+{
+    ARM_COMPUTE_UNUSED(weights_info, dilation, num_groups);
+
+    func.configure(src, weights, bias, dst, info, act_info);
+}
 } // namespace detail
 namespace
 {
@@ -66,6 +82,10 @@ const RelativeTolerance<float> rel_tolerance_f32(0.01f);              /**< Relat
 const RelativeTolerance<float> rel_tolerance_winograd_3x3_f32(0.05f); /**< Relative tolerance for FP32 types */
 const AbsoluteTolerance<float> abs_tolerance_f32(0.002f);             /**< Absolute tolerance for FP32 types */
 const AbsoluteTolerance<float> abs_tolerance_1xN_f32(0.0041f);        /**< Absolute tolerance for FP32 types */
+#ifdef V8P6_BF
+const RelativeTolerance<float> rel_tolerance_bf16_f32(0.05f);  /**< Relative tolerance for FP32 types computed with bfloat16 fast math */
+constexpr float                abs_tolerance_bf16_f32 = 0.05f; /**< Absolute tolerance for FP32 types computed with bfloat16 fast math */
+#endif                                                          /* V8P6_BF */
 
 #ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
 const AbsoluteTolerance<half> tolerance_convolution_layer_f16(half(0.4f));
@@ -102,6 +122,49 @@ const auto QuantizationData = framework::dataset::make("QuantizationInfo",
     QuantizationInfo(1.f, 10),
     QuantizationInfo(1.1f, 10),
 });
+
+/** File in the temporary directory, removed when the object goes out of scope */
+class TemporaryFile
+{
+public:
+    explicit TemporaryFile(const std::string &name)
+        : _path()
+    {
+        const char *tmp_dir = std::getenv("TMPDIR");
+#ifdef __ANDROID__
+        _path = std::string(tmp_dir != nullptr ? tmp_dir : "/data/local/tmp") + "/" + name;
+#else  /* __ANDROID__ */
+        _path = std::string(tmp_dir != nullptr ? tmp_dir : "/tmp") + "/" + name;
+#endif /* __ANDROID__ */
+    }
+    ~TemporaryFile()
+    {
+        std::remove(_path.c_str());
+    }
+    const std::string &path() const
+    {
+        return _path;
+    }
+
+private:
+    std::string _path;
+};
+
+/** Install a convolution method tuner in @ref NEConvolutionLayer for the lifetime of the object */
+class ConvolutionMethodTunerScope
+{
+public:
+    explicit ConvolutionMethodTunerScope(NEConvolutionMethodTuner *tuner)
+    {
+        NEConvolutionLayer::set_tuner(tuner);
+    }
+    ConvolutionMethodTunerScope(const ConvolutionMethodTunerScope &) = delete;
+    ConvolutionMethodTunerScope &operator=(const ConvolutionMethodTunerScope &) = delete;
+    ~ConvolutionMethodTunerScope()
+    {
+        NEConvolutionLayer::set_tuner(nullptr);
+    }
+};
 } // namespace
 
 TEST_SUITE(NEON)
@@ -113,29 +176,40 @@ DATA_TEST_CASE(ValidateConvolutionMethod, framework::DatasetMode::ALL, zip(zip(z
                                           framework::dataset::make("InputInfo", { TensorInfo(TensorShape(18U, 18U, 32U), 1, DataType::F32),
                                                                                   TensorInfo(TensorShape(23U, 27U, 32U, 4U), 1, DataType::F32),
                                                                                   TensorInfo(TensorShape(3U, 3U, 2U, 1U), 1, DataType::F32),
-                                                                                  TensorInfo(TensorShape(33U, 27U, 7U, 4U), 1, DataType::F32)
+                                                                                  TensorInfo(TensorShape(33U, 27U, 7U, 4U), 1, DataType::F32),
+                                                                                  TensorInfo(TensorShape(18U, 18U, 32U), 1, DataType::QASYMM8, QuantizationInfo(0.5f, 10)),
+                                                                                  TensorInfo(TensorShape(18U, 18U, 32U), 1, DataType::QASYMM8, QuantizationInfo(0.5f, 10))
                                           }),
                                           framework::dataset::make("WeightsInfo", { TensorInfo(TensorShape(3U, 3U, 32U, 21U), 1, DataType::F32),
                                                                                     TensorInfo(TensorShape(5U, 5U, 32U, 21U), 1, DataType::F32),
                                                                                     TensorInfo(TensorShape(3U, 3U, 5U, 21U), 1, DataType::F32),
-                                                                                    TensorInfo(TensorShape(5U, 5U, 7U, 16U), 1, DataType::F16)
+                                                                                    TensorInfo(TensorShape(5U, 5U, 7U, 16U), 1, DataType::F16),
+                                                                                    TensorInfo(TensorShape(3U, 3U, 32U, 21U), 1, DataType::QASYMM8, QuantizationInfo(0.25f, 3)),
+                                                                                    TensorInfo(TensorShape(3U, 3U, 32U, 21U), 1, DataType::QASYMM8, QuantizationInfo(0.25f, 3))
                                           })),
                                           framework::dataset::make("OutputInfo", { TensorInfo(TensorShape(16U, 16U, 21U), 1, DataType::F32),
                                                                                    TensorInfo(TensorShape(19U, 23U, 21U, 4U), 1, DataType::F32),
                                                                                    TensorInfo(TensorShape(11U, 25U, 21U), 1, DataType::F32),
-                                                                                   TensorInfo(TensorShape(11U, 12U, 16U, 4U), 1, DataType::F32)
+                                                                                   TensorInfo(TensorShape(11U, 12U, 16U, 4U), 1, DataType::F32),
+                                                                                   TensorInfo(TensorShape(16U, 16U, 21U), 1, DataType::QASYMM8, QuantizationInfo(1.f, 5)),
+                                                                                   TensorInfo(TensorShape(16U, 16U, 21U), 1, DataType::QASYMM8, QuantizationInfo(1.f, 5))
                                           })),
                                           framework::dataset::make("ConvInfo", { PadStrideInfo(1, 1, 0, 0),
                                                                                  PadStrideInfo(1, 1, 0, 0),
                                                                                  PadStrideInfo(2, 1, 0, 0),
-                                                                                 PadStrideInfo(3, 2, 1, 0)
+                                                                                 PadStrideInfo(3, 2, 1, 0),
+                                                                                 PadStrideInfo(1, 1, 0, 0),
+                                                                                 PadStrideInfo(1, 1, 0, 0)
                                           })),
                                           framework::dataset::make("FastMath", { true,
                                                                                  true,
                                                                                  false,
-                                                                                 false
+                                                                                 false,
+                                                                                 false,
+                                                                                 true
                                           })),
-                                                                           framework::dataset::make("Expected", { ConvolutionMethod::WINOGRAD, ConvolutionMethod::WINOGRAD, ConvolutionMethod::GEMM, ConvolutionMethod::GEMM })),
+                                                                           framework::dataset::make("Expected", { ConvolutionMethod::WINOGRAD, ConvolutionMethod::WINOGRAD, ConvolutionMethod::GEMM, ConvolutionMethod::GEMM,
+                                                                                                                  ConvolutionMethod::GEMM, ConvolutionMethod::WINOGRAD })),
                input_info, weights_info, output_info, conv_info, fast_math, expected)
 {
     ConvolutionMethod is_valid = NEConvolutionLayer::get_convolution_method(&input_info.clone()->set_is_resizable(true),
@@ -145,6 +219,56 @@ DATA_TEST_CASE(ValidateConvolutionMethod, framework::DatasetMode::ALL, zip(zip(z
 }
 // clang-format on
 // *INDENT-ON*
+
+TEST_SUITE(Tuner)
+TEST_CASE(SaveLoad, framework::DatasetMode::ALL)
+{
+    const TemporaryFile file("acl_test_conv_method_tuner.csv");
+
+    NEConvolutionMethodTuner tuner;
+    tuner.add_method_to_table("F32_NHWC_32x18x18_3x3x32x21_s1x1_p0x0x0x0_d1x1_a-1_f1_t1", ConvolutionMethod::WINOGRAD);
+    tuner.add_method_to_table("F16_NCHW_7x33x27x4_5x5x7x16_s3x2_p1x0x0x0_d1x1_a-1_f0_t4", ConvolutionMethod::DIRECT);
+    tuner.save_to_file(file.path());
+
+    NEConvolutionMethodTuner loaded_tuner;
+    loaded_tuner.load_from_file(file.path());
+
+    ARM_COMPUTE_EXPECT(loaded_tuner.methods_table() == tuner.methods_table(), framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(TunedMethodOverridesHeuristic, framework::DatasetMode::ALL)
+{
+    // The heuristic selects Winograd for this configuration
+    TensorInfo          input_info(TensorShape(18U, 18U, 32U), 1, DataType::F32);
+    TensorInfo          weights_info(TensorShape(3U, 3U, 32U, 21U), 1, DataType::F32);
+    TensorInfo          output_info(TensorShape(16U, 16U, 21U), 1, DataType::F32);
+    const PadStrideInfo conv_info(1, 1, 0, 0);
+    ARM_COMPUTE_EXPECT(NEConvolutionLayer::get_convolution_method(&input_info, &weights_info, &output_info, conv_info, WeightsInfo(), Size2D(1U, 1U), ActivationLayerInfo(), true)
+                       == ConvolutionMethod::WINOGRAD,
+                       framework::LogLevel::ERRORS);
+
+    // Configuring a layer with a tuner records the fastest method of the configuration
+    Tensor src = create_tensor<Tensor>(input_info.tensor_shape(), input_info.data_type());
+    Tensor wei = create_tensor<Tensor>(weights_info.tensor_shape(), weights_info.data_type());
+    Tensor dst = create_tensor<Tensor>(output_info.tensor_shape(), output_info.data_type());
+
+    NEConvolutionMethodTuner          tuner;
+    const ConvolutionMethodTunerScope tuner_scope(&tuner);
+    NEConvolutionLayer                conv;
+    conv.configure(&src, &wei, nullptr, &dst, conv_info, WeightsInfo(), Size2D(1U, 1U), ActivationLayerInfo(), true);
+    auto methods_table = tuner.methods_table();
+    ARM_COMPUTE_EXPECT(methods_table.size() == 1, framework::LogLevel::ERRORS);
+
+    // Replacing the tuned method changes the selected one
+    for(auto &method : methods_table)
+    {
+        tuner.add_method_to_table(method.first, ConvolutionMethod::GEMM);
+    }
+    const ConvolutionMethod tuned_method = NEConvolutionLayer::get_convolution_method(&input_info, &weights_info, &output_info, conv_info, WeightsInfo(), Size2D(1U, 1U), ActivationLayerInfo(),
+                                                                                      true);
+    ARM_COMPUTE_EXPECT(tuned_method == ConvolutionMethod::GEMM, framework::LogLevel::ERRORS);
+}
+TEST_SUITE_END() // Tuner
 TEST_SUITE_END() // ConvolutionLayer
 
 TEST_SUITE(WinogradLayer)
@@ -154,6 +278,19 @@ using NEWinogradConvolutionLayerFixture = WinogradConvolutionLayerFastMathValida
 template <typename T>
 using NEWinogradConvolutionLayerNoBiasFixture = WinogradConvolutionLayerFastMathValidationFixture<Tensor, Accessor, NEWinogradConvolutionLayer, T, T, false>;
 
+/** Winograd convolution run one row of tiles at a time, whatever the size of the caches */
+class NEWinogradConvolutionLayerBlocked : public NEWinogradConvolutionLayer
+{
+public:
+    NEWinogradConvolutionLayerBlocked()
+    {
+        set_tile_rows_per_block(1U);
+    }
+};
+
+template <typename T>
+using NEWinogradConvolutionLayerBlockedFixture = WinogradConvolutionLayerFastMathValidationFixture<Tensor, Accessor, NEWinogradConvolutionLayerBlocked, T>;
+
 TEST_SUITE(FP32)
 
 TEST_SUITE(Conv1x3)
@@ -295,6 +432,16 @@ FIXTURE_DATA_TEST_CASE(RunSmall, NEWinogradConvolutionLayerFixture<float>, frame
                                        ActivationFunctionsDataset),
                                framework::dataset::make("DataLayout", { DataLayout::NCHW, DataLayout::NHWC })))
 
+{
+    // Validate output
+    validate(Accessor(_target), _reference, abs_tolerance_f32);
+}
+FIXTURE_DATA_TEST_CASE(RunBlocked, NEWinogradConvolutionLayerBlockedFixture<float>, framework::DatasetMode::PRECOMMIT,
+                       combine(combine(combine(datasets::SmallWinogradConvolutionLayer3x3Dataset(),
+                                               framework::dataset::make("DataType", { DataType::F32 })),
+                                       ActivationFunctionsDataset),
+                               framework::dataset::make("DataLayout", { DataLayout::NCHW, DataLayout::NHWC })))
+
 {
     // Validate output
     validate(Accessor(_target), _reference, abs_tolerance_f32);
@@ -379,12 +526,152 @@ FIXTURE_DATA_TEST_CASE(RunLarge, CLWinogradConvolutionLayerFastMathFixture16, fr
 TEST_SUITE_END() // Conv3x3
 TEST_SUITE_END() // FP16
 #endif           /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
+
+#ifdef __aarch64__
+template <typename T>
+using NEWinogradConvolutionLayerQuantizedFixture = ConvolutionValidationQuantizedFixture<Tensor, Accessor, NEWinogradConvolutionLayer, T>;
+
+template <typename T>
+using NEWinogradConvolutionLayerQuantizedPerChannelFixture = ConvolutionValidationQuantizedPerChannelFixture<Tensor, Accessor, NEWinogradConvolutionLayer, T, int8_t>;
+
+const auto WinogradQuantizedActivationFunctionsDataset = framework::dataset::make("ActivationInfo",
+{
+    ActivationLayerInfo(),
+    ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU),
+    ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU, 6.f)
+});
+
+TEST_SUITE(Quantized)
+TEST_SUITE(QASYMM8)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEWinogradConvolutionLayerQuantizedFixture<uint8_t>, framework::DatasetMode::ALL,
+                       combine(combine(combine(combine(combine(datasets::SmallWinogradConvolutionLayer3x3Dataset(),
+                                                               framework::dataset::make("ReshapeWeights", { true })),
+                                                       framework::dataset::make("DataType", DataType::QASYMM8)),
+                                               framework::dataset::make("DataLayout", { DataLayout::NCHW, DataLayout::NHWC })),
+                                       framework::dataset::make("QuantizationInfo", { QuantizationInfo(2.f / 255.f, 10) })),
+                               WinogradQuantizedActivationFunctionsDataset))
+{
+    // The integer transforms are exact, so the output must match the reference bit for bit
+    validate(Accessor(_target), _reference, tolerance_qasymm8);
+}
+TEST_SUITE_END() // QASYMM8
+
+TEST_SUITE(QASYMM8_SIGNED)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEWinogradConvolutionLayerQuantizedFixture<int8_t>, framework::DatasetMode::ALL,
+                       combine(combine(combine(combine(combine(datasets::SmallWinogradConvolutionLayer3x3Dataset(),
+                                                               framework::dataset::make("ReshapeWeights", { true })),
+                                                       framework::dataset::make("DataType", DataType::QASYMM8_SIGNED)),
+                                               framework::dataset::make("DataLayout", { DataLayout::NCHW, DataLayout::NHWC })),
+                                       framework::dataset::make("QuantizationInfo", { QuantizationInfo(0.01f, -10) })),
+                               WinogradQuantizedActivationFunctionsDataset))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_qasymm8);
+}
+TEST_SUITE_END() // QASYMM8_SIGNED
+
+TEST_SUITE(QSYMM8_PER_CHANNEL)
+FIXTURE_DATA_TEST_CASE(RunSmallSigned, NEWinogradConvolutionLayerQuantizedPerChannelFixture<int8_t>, framework::DatasetMode::ALL,
+                       combine(combine(combine(combine(combine(combine(datasets::SmallWinogradConvolutionLayer3x3Dataset(),
+                                                                       framework::dataset::make("ReshapeWeights", { true })),
+                                                               framework::dataset::make("DataType", { DataType::QASYMM8_SIGNED })),
+                                                       framework::dataset::make("DataLayout", { DataLayout::NCHW, DataLayout::NHWC })),
+                                               QuantizationData),
+                                       WinogradQuantizedActivationFunctionsDataset),
+                               framework::dataset::make("WeightsDataType", { DataType::QSYMM8_PER_CHANNEL })))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_qasymm8);
+}
+TEST_SUITE_END() // QSYMM8_PER_CHANNEL
+TEST_SUITE_END() // Quantized
+#endif           // __aarch64__
 TEST_SUITE_END() // WinogradLayer
 
 TEST_SUITE(GEMMConvolutionLayer)
 template <typename T>
 using NEGEMMConvolutionLayerFixture = ConvolutionValidationFixture<Tensor, Accessor, NEConvolutionLayer, T>;
 
+template <typename T>
+using NEGEMMConvolutionLayerSparseWeightsFixture = ConvolutionValidationFixture<Tensor, Accessor, NEGEMMConvolutionLayer, T, true>;
+
+/** GEMM convolution whose weights are handled by a weights manager */
+class NEGEMMConvolutionLayerWeightsManaged : public IFunction
+{
+public:
+    void configure(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const PadStrideInfo &conv_info, const WeightsInfo &weights_info,
+                   const Size2D &dilation, const ActivationLayerInfo &act_info, unsigned int num_groups)
+    {
+        _weights_manager.manage(weights);
+        _conv.configure(input, weights, biases, output, conv_info, weights_info, dilation, act_info, num_groups);
+    }
+
+    void run() override
+    {
+        _conv.run();
+    }
+
+private:
+    IWeightsManager        _weights_manager{};
+    NEGEMMConvolutionLayer _conv{ nullptr, &_weights_manager };
+};
+
+template <typename T>
+using NEGEMMConvolutionLayerWeightsManagedFixture = ConvolutionValidationFixture<Tensor, Accessor, NEGEMMConvolutionLayerWeightsManaged, T>;
+
+// *INDENT-OFF*
+// clang-format off
+DATA_TEST_CASE(UsesConv2d, framework::DatasetMode::ALL, zip(zip(zip(zip(zip(
+               framework::dataset::make("InputInfo", { TensorInfo(TensorShape(8U, 8U, 4U), 1, DataType::F32, DataLayout::NCHW),
+                                                       TensorInfo(TensorShape(4U, 8U, 8U), 1, DataType::F32, DataLayout::NHWC),
+                                                       TensorInfo(TensorShape(4U, 8U, 8U), 1, DataType::F32, DataLayout::NHWC),    // 1x1 NHWC convolutions skip im2col
+                                                       TensorInfo(TensorShape(4U, 8U, 8U), 1, DataType::F32, DataLayout::NHWC),    // Grouped convolution
+                                                       TensorInfo(TensorShape(4U, 8U, 8U), 1, DataType::F32, DataLayout::NHWC),    // Sparse weights
+                                                     }),
+               framework::dataset::make("WeightsInfo", { TensorInfo(TensorShape(3U, 3U, 4U, 6U), 1, DataType::F32, DataLayout::NCHW),
+                                                         TensorInfo(TensorShape(4U, 3U, 3U, 6U), 1, DataType::F32, DataLayout::NHWC),
+                                                         TensorInfo(TensorShape(4U, 1U, 1U, 6U), 1, DataType::F32, DataLayout::NHWC),
+                                                         TensorInfo(TensorShape(2U, 3U, 3U, 6U), 1, DataType::F32, DataLayout::NHWC),
+                                                         TensorInfo(TensorShape(4U, 3U, 3U, 6U), 1, DataType::F32, DataLayout::NHWC),
+                                                       })),
+               framework::dataset::make("OutputInfo", { TensorInfo(TensorShape(6U, 6U, 6U), 1, DataType::F32, DataLayout::NCHW),
+                                                        TensorInfo(TensorShape(6U, 6U, 6U), 1, DataType::F32, DataLayout::NHWC),
+                                                        TensorInfo(TensorShape(6U, 8U, 8U), 1, DataType::F32, DataLayout::NHWC),
+                                                        TensorInfo(TensorShape(6U, 6U, 6U), 1, DataType::F32, DataLayout::NHWC),
+                                                        TensorInfo(TensorShape(6U, 6U, 6U), 1, DataType::F32, DataLayout::NHWC),
+                                                      })),
+               framework::dataset::make("NumGroups", { 1U, 1U, 1U, 2U, 1U })),
+               framework::dataset::make("SparseWeights", { false, false, false, false, true })),
+               framework::dataset::make("Expected", { true, true, false, false, false })),
+               input_info, weights_info, output_info, num_groups, sparse_weights, expected)
+{
+    const WeightsInfo weights_meta(false, 0, 0, 0, false, sparse_weights);
+    const bool        uses_conv2d = NEGEMMConvolutionLayer::uses_conv2d(&input_info.clone()->set_is_resizable(true),
+                                                                        &weights_info.clone()->set_is_resizable(true),
+                                                                        nullptr,
+                                                                        &output_info.clone()->set_is_resizable(true),
+                                                                        PadStrideInfo(1, 1, 0, 0), weights_meta, Size2D(1U, 1U), ActivationLayerInfo(), num_groups, false);
+    ARM_COMPUTE_EXPECT(uses_conv2d == expected, framework::LogLevel::ERRORS);
+}
+// clang-format on
+// *INDENT-ON*
+
+#ifdef V8P6_BF
+/** GEMM convolution allowed to round its F32 operands to bfloat16 */
+class NEGEMMConvolutionLayerFastMath : public NEGEMMConvolutionLayer
+{
+public:
+    void configure(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const PadStrideInfo &conv_info, const WeightsInfo &weights_info,
+                   const Size2D &dilation, const ActivationLayerInfo &act_info, unsigned int num_groups)
+    {
+        NEGEMMConvolutionLayer::configure(input, weights, biases, output, conv_info, weights_info, dilation, act_info, num_groups, true);
+    }
+};
+
+template <typename T>
+using NEGEMMConvolutionLayerFastMathFixture = ConvolutionValidationFixture<Tensor, Accessor, NEGEMMConvolutionLayerFastMath, T>;
+#endif /* V8P6_BF */
+
 TEST_SUITE(Float)
 #if defined(__ARM_FEATURE_BF16_VECTOR_ARITHMETIC) || defined(ARM_COMPUTE_FORCE_BF16)
 TEST_SUITE(BFLOAT16)
@@ -424,6 +711,41 @@ FIXTURE_DATA_TEST_CASE(RunSmall, NEGEMMConvolutionLayerFixture<float>, framework
     // Validate output
     validate(Accessor(_target), _reference, rel_tolerance_f32, 0.f, float(abs_tolerance_f32));
 }
+#ifdef V8P6_BF
+TEST_SUITE(FastMath)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEGEMMConvolutionLayerFastMathFixture<float>, framework::DatasetMode::PRECOMMIT, combine(combine(combine(combine(datasets::SmallConvolutionLayerDataset(),
+                                                                                                                          framework::dataset::make("ReshapeWeights", { true })),
+                                                                                                                          framework::dataset::make("DataType", DataType::F32)),
+                                                                                                                          framework::dataset::make("DataLayout", { DataLayout::NCHW, DataLayout::NHWC })),
+                                                                                                                  ActivationFunctionsDataset))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_bf16_f32, 0.f, abs_tolerance_bf16_f32);
+}
+TEST_SUITE_END() // FastMath
+#endif           /* V8P6_BF */
+TEST_SUITE(SparseWeights)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEGEMMConvolutionLayerSparseWeightsFixture<float>, framework::DatasetMode::ALL, combine(combine(combine(combine(datasets::SmallConvolutionLayerDataset(),
+                                                                                                                        framework::dataset::make("ReshapeWeights", { true })),
+                                                                                                                        framework::dataset::make("DataType", DataType::F32)),
+                                                                                                                        framework::dataset::make("DataLayout", { DataLayout::NCHW, DataLayout::NHWC })),
+                                                                                                                ActivationFunctionsDataset))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_f32, 0.f, float(abs_tolerance_f32));
+}
+TEST_SUITE_END() // SparseWeights
+TEST_SUITE(WeightsManaged)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEGEMMConvolutionLayerWeightsManagedFixture<float>, framework::DatasetMode::ALL, combine(combine(combine(combine(datasets::SmallConvolutionLayerDataset(),
+                                                                                                                         framework::dataset::make("ReshapeWeights", { true })),
+                                                                                                                         framework::dataset::make("DataType", DataType::F32)),
+                                                                                                                         framework::dataset::make("DataLayout", { DataLayout::NCHW, DataLayout::NHWC })),
+                                                                                                                 ActivationFunctionsDataset))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_f32, 0.f, float(abs_tolerance_f32));
+}
+TEST_SUITE_END() // WeightsManaged
 TEST_SUITE_END() // FP32
 TEST_SUITE_END() // Float
 
@@ -433,6 +755,9 @@ using NEGEMMConvolutionLayerQuantizedFixture = ConvolutionValidationQuantizedFix
 template <typename T>
 using NEGEMMConvolutionLayerQuantizedPerChannelFixture = ConvolutionValidationQuantizedPerChannelFixture<Tensor, Accessor, NEConvolutionLayer, T, int8_t>;
 
+template <typename T>
+using NEGEMMConvolutionLayerQuantizedSparseWeightsFixture = ConvolutionValidationQuantizedFixture<Tensor, Accessor, NEGEMMConvolutionLayer, T, true>;
+
 const auto QuantizedActivationFunctionsDataset = framework::dataset::make("ActivationInfo",
 {
     ActivationLayerInfo(),
@@ -451,6 +776,19 @@ FIXTURE_DATA_TEST_CASE(RunSmall, NEGEMMConvolutionLayerQuantizedFixture<uint8_t>
     // Validate output
     validate(Accessor(_target), _reference, tolerance_qasymm8);
 }
+TEST_SUITE(SparseWeights)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEGEMMConvolutionLayerQuantizedSparseWeightsFixture<uint8_t>, framework::DatasetMode::ALL,
+                       combine(combine(combine(combine(combine(datasets::SmallConvolutionLayerDataset(),
+                                                               framework::dataset::make("ReshapeWeights", { true })),
+                                                       framework::dataset::make("DataType", DataType::QASYMM8)),
+                                               framework::dataset::make("DataLayout", { DataLayout::NCHW, DataLayout::NHWC })),
+                                       framework::dataset::make("QuantizationInfo", { QuantizationInfo(2.f / 255.f, 10) })),
+                               QuantizedActivationFunctionsDataset))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_qasymm8);
+}
+TEST_SUITE_END() // SparseWeights
 TEST_SUITE_END() // QASYMM8
 
 TEST_SUITE(QASYMM8_SIGNED)
@@ -496,6 +834,76 @@ TEST_SUITE_END() // Quantized
 
 TEST_SUITE_END() // GEMMConvolutionLayer
 
+template <typename T>
+using NEGEMMGroupedConvolutionLayerFixture = ConvolutionValidationFixture<Tensor, Accessor, NEGEMMConvolutionLayer, T>;
+
+TEST_SUITE(GroupedGEMMConvolutionLayer)
+
+// *INDENT-OFF*
+// clang-format off
+DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(zip(zip(zip(
+               framework::dataset::make("InputInfo", { TensorInfo(TensorShape(8U, 8U, 4U), 1, DataType::F32, DataLayout::NCHW),
+                                                       TensorInfo(TensorShape(4U, 8U, 8U), 1, DataType::F32, DataLayout::NHWC),
+                                                       TensorInfo(TensorShape(4U, 8U, 8U), 1, DataType::QASYMM8, DataLayout::NHWC), // Quantized grouped convolutions are not supported
+                                                       TensorInfo(TensorShape(3U, 8U, 8U), 1, DataType::F32, DataLayout::NHWC),     // Channels not a multiple of the groups
+                                                     }),
+               framework::dataset::make("WeightsInfo", { TensorInfo(TensorShape(3U, 3U, 2U, 4U), 1, DataType::F32, DataLayout::NCHW),
+                                                         TensorInfo(TensorShape(2U, 3U, 3U, 4U), 1, DataType::F32, DataLayout::NHWC),
+                                                         TensorInfo(TensorShape(2U, 3U, 3U, 4U), 1, DataType::QASYMM8, DataLayout::NHWC),
+                                                         TensorInfo(TensorShape(2U, 3U, 3U, 4U), 1, DataType::F32, DataLayout::NHWC),
+                                                       })),
+               framework::dataset::make("BiasInfo", { TensorInfo(TensorShape(4U), 1, DataType::F32),
+                                                      TensorInfo(TensorShape(4U), 1, DataType::F32),
+                                                      TensorInfo(TensorShape(4U), 1, DataType::S32),
+                                                      TensorInfo(TensorShape(4U), 1, DataType::F32),
+                                                    })),
+               framework::dataset::make("OutputInfo", { TensorInfo(TensorShape(6U, 6U, 4U), 1, DataType::F32, DataLayout::NCHW),
+                                                        TensorInfo(TensorShape(4U, 6U, 6U), 1, DataType::F32, DataLayout::NHWC),
+                                                        TensorInfo(TensorShape(4U, 6U, 6U), 1, DataType::QASYMM8, DataLayout::NHWC),
+                                                        TensorInfo(TensorShape(4U, 6U, 6U), 1, DataType::F32, DataLayout::NHWC),
+                                                      })),
+               framework::dataset::make("Expected", { true, true, false, false })),
+               input_info, weights_info, bias_info, output_info, expected)
+{
+    const bool is_valid = bool(NEGEMMConvolutionLayer::validate(&input_info.clone()->set_is_resizable(true),
+                                                                &weights_info.clone()->set_is_resizable(true),
+                                                                &bias_info.clone()->set_is_resizable(true),
+                                                                &output_info.clone()->set_is_resizable(true),
+                                                                PadStrideInfo(1, 1, 0, 0), WeightsInfo(), Size2D(1U, 1U), ActivationLayerInfo(), 2));
+    ARM_COMPUTE_EXPECT(is_valid == expected, framework::LogLevel::ERRORS);
+}
+// clang-format on
+// *INDENT-ON*
+
+TEST_SUITE(Float)
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+TEST_SUITE(FP16)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEGEMMGroupedConvolutionLayerFixture<half>, framework::DatasetMode::ALL, combine(combine(combine(combine(datasets::SmallGroupedConvolutionLayerDataset(),
+                                                                                                                  framework::dataset::make("ReshapeWeights", { true })),
+                                                                                                                  framework::dataset::make("DataType", DataType::F16)),
+                                                                                                                  framework::dataset::make("DataLayout", { DataLayout::NCHW, DataLayout::NHWC })),
+                                                                                                                  ActivationFunctionsDataset))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_f16, tolerance_num, abs_tolerance_f16);
+}
+TEST_SUITE_END() // FP16
+#endif           /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
+
+TEST_SUITE(FP32)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEGEMMGroupedConvolutionLayerFixture<float>, framework::DatasetMode::ALL, combine(combine(combine(combine(datasets::SmallGroupedConvolutionLayerDataset(),
+                                                                                                                   framework::dataset::make("ReshapeWeights", { true })),
+                                                                                                                   framework::dataset::make("DataType", DataType::F32)),
+                                                                                                                   framework::dataset::make("DataLayout", { DataLayout::NCHW, DataLayout::NHWC })),
+                                                                                                                   ActivationFunctionsDataset))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_f32, 0.f, float(abs_tolerance_f32));
+}
+TEST_SUITE_END() // FP32
+TEST_SUITE_END() // Float
+TEST_SUITE_END() // GroupedGEMMConvolutionLayer
+
 TEST_SUITE(DirectGEMMConv2d)
 template <typename T>
 using NEDirectGEMMConv2dLayerFixture = ConvolutionValidationFixture<Tensor, Accessor, NEGEMMConv2d, T>;
@@ -44,12 +44,19 @@ using NEDepthwiseConvolutionLayerNative = NESynthetizeFunctionWithZeroConstantKe
 template <typename T>
 using NEDepthwiseConvolutionLayerNativeFixture = DepthwiseConvolutionLayerNativeValidationFixture<Tensor, Accessor, NEDepthwiseConvolutionLayerNative, T>;
 
+template <typename T>
+using NEDepthwiseConvolutionLayerNativeQuantizedFixture = DepthwiseConvolutionLayerNativeQuantizedValidationFixture<Tensor, Accessor, NEDepthwiseConvolutionLayerNative, T, T>;
+
+template <typename T>
+using NEDepthwiseConvolutionLayerNativeQuantizedPerChannelFixture = DepthwiseConvolutionLayerNativeQuantizedValidationFixture<Tensor, Accessor, NEDepthwiseConvolutionLayerNative, T, int8_t>;
+
 namespace
 {
 // *INDENT-OFF*
 // clang-format off
-RelativeTolerance<float> rel_tolerance_f32(0.001f);
-constexpr float          abs_tolerance_f32(0.0001f);
+RelativeTolerance<float>             rel_tolerance_f32(0.001f);
+constexpr float                      abs_tolerance_f32(0.0001f);
+constexpr AbsoluteTolerance<uint8_t> tolerance_qasymm8(1);
 
 /** Width values to test - Precommit */
 const auto width_values_precommit = framework::dataset::make("width", { 17U } );
@@ -93,6 +100,18 @@ const auto stride_values = framework::dataset::make("stride", { Size2D(1U, 1U),
 /** Padding values to test - All */
 const auto padding_valid_values = framework::dataset::make("padding_valid", { true, false });
 
+/** Channel values to test the register-tiled path: tiles of 4 vectors, single vectors and left-overs */
+const auto channel_values_tiled = framework::dataset::make("channels", { 37U });
+
+/** Kernel size values to test the register-tiled path */
+const auto kernel_sz_values_tiled = framework::dataset::make("kernel_size", { Size2D(7U, 7U) });
+
+/** Depth multiplier values to test the vectorised multiplier path */
+const auto depth_multiplier_values_tiled = framework::dataset::make("depth_multiplier", { 1U, 5U });
+
+/** Depth multiplier values to test the vectorised quantized paths, including a block of 8 multipliers with left-overs */
+const auto depth_multiplier_values_quantized_tiled = framework::dataset::make("depth_multiplier", { 1U, 5U, 9U });
+
 /** Data type values to test - All */
 const auto data_type_values = framework::dataset::make("data_type", { DataType::F32 });
 
@@ -106,7 +125,7 @@ TEST_SUITE(DepthwiseConvolutionLayerNative)
 TEST_CASE(ValidateNoPadding, framework::DatasetMode::ALL)
 {
     // this test case will ensure that the kernel is not adding implicit padding
-    constexpr uint32_t vector_size = 8; // Asummed vector size of the current native kernel
+    constexpr uint32_t vector_size = 16; // Asummed vector size of the current native kernel
     constexpr auto     depth = vector_size * 2 + 1; // mis-aligned depth to force padding if exists.
     constexpr auto     data_layout = DataLayout::NHWC;
     constexpr auto     data_type = DataType::F32;
@@ -152,6 +171,23 @@ FIXTURE_DATA_TEST_CASE(RunSmall, NEDepthwiseConvolutionLayerNativeFixture<float>
     validate(Accessor(_target), _reference, rel_tolerance_f32, 0.f, abs_tolerance_f32);
 }
 
+FIXTURE_DATA_TEST_CASE(RunSmallTiled, NEDepthwiseConvolutionLayerNativeFixture<float>, framework::DatasetMode::ALL,
+                combine(combine(combine(combine(combine(combine(combine(combine(combine(combine(framework::dataset::make("width", { 23U }),
+                                                                                                framework::dataset::make("height", { 21U })),
+                                                                                                channel_values_tiled),
+                                                                                                framework::dataset::make("batch", { 1U })),
+                                                                                                kernel_sz_values_tiled),
+                                                                                                depth_multiplier_values_tiled),
+                                                                                                dilation_values),
+                                                                                                stride_values),
+                                                                                                padding_valid_values),
+                                                                                                data_type_values),
+                                                                                                data_layout_values))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_f32, 0.f, abs_tolerance_f32);
+}
+
 FIXTURE_DATA_TEST_CASE(RunLarge, NEDepthwiseConvolutionLayerNativeFixture<float>, framework::DatasetMode::NIGHTLY,
                 combine(combine(combine(combine(combine(combine(combine(combine(combine(combine(width_values_nightly,
                                                                                                 height_values_nightly),
@@ -171,6 +207,48 @@ FIXTURE_DATA_TEST_CASE(RunLarge, NEDepthwiseConvolutionLayerNativeFixture<float>
 
 TEST_SUITE_END() // FP32
 TEST_SUITE_END() // Float
+
+TEST_SUITE(Quantized)
+TEST_SUITE(QASYMM8)
+FIXTURE_DATA_TEST_CASE(RunSmallTiled, NEDepthwiseConvolutionLayerNativeQuantizedFixture<uint8_t>, framework::DatasetMode::ALL,
+                combine(combine(combine(combine(combine(combine(combine(combine(combine(combine(combine(framework::dataset::make("width", { 23U }),
+                                                                                                        framework::dataset::make("height", { 21U })),
+                                                                                                        channel_values_tiled),
+                                                                                                        framework::dataset::make("batch", { 1U })),
+                                                                                                        kernel_sz_values_tiled),
+                                                                                                        depth_multiplier_values_quantized_tiled),
+                                                                                                        dilation_values),
+                                                                                                        stride_values),
+                                                                                                        padding_valid_values),
+                                                                                                        framework::dataset::make("data_type", { DataType::QASYMM8 })),
+                                                                                                        framework::dataset::make("weights_data_type", { DataType::QASYMM8 })),
+                                                                                                        data_layout_values))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_qasymm8);
+}
+TEST_SUITE_END() // QASYMM8
+
+TEST_SUITE(QSYMM8_PER_CHANNEL)
+FIXTURE_DATA_TEST_CASE(RunSmallTiled, NEDepthwiseConvolutionLayerNativeQuantizedPerChannelFixture<uint8_t>, framework::DatasetMode::ALL,
+                combine(combine(combine(combine(combine(combine(combine(combine(combine(combine(combine(framework::dataset::make("width", { 23U }),
+                                                                                                        framework::dataset::make("height", { 21U })),
+                                                                                                        channel_values_tiled),
+                                                                                                        framework::dataset::make("batch", { 1U })),
+                                                                                                        kernel_sz_values_tiled),
+                                                                                                        depth_multiplier_values_quantized_tiled),
+                                                                                                        dilation_values),
+                                                                                                        stride_values),
+                                                                                                        padding_valid_values),
+                                                                                                        framework::dataset::make("data_type", { DataType::QASYMM8 })),
+                                                                                                        framework::dataset::make("weights_data_type", { DataType::QSYMM8_PER_CHANNEL })),
+                                                                                                        data_layout_values))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_qasymm8);
+}
+TEST_SUITE_END() // QSYMM8_PER_CHANNEL
+TEST_SUITE_END() // Quantized
 TEST_SUITE_END() // DepthwiseConvolutionLayerNative
 TEST_SUITE_END() // NEON
 } // namespace validation
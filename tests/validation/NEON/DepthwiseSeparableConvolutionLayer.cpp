@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/functions/NEDepthwiseSeparableConvolutionLayer.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/datasets/DepthwiseConvolutionLayerDataset.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/validation/Validation.h"
+#include "tests/validation/fixtures/DepthwiseSeparableConvolutionLayerFixture.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+constexpr RelativeTolerance<float> tolerance_f32(0.01f); /**< Tolerance value for comparing reference's output against implementation's output for DataType::F32 */
+constexpr float                    tolerance_num = 0.02f; /**< Tolerance number */
+constexpr AbsoluteTolerance<uint8_t> tolerance_qasymm8(1); /**< Tolerance value for comparing reference's output against implementation's output for DataType::QASYMM8 */
+
+const auto depth_multipliers   = framework::dataset::make("DepthMultiplier", { 1, 2 });
+const auto num_output_channels = framework::dataset::make("OutputChannels", { 4, 17 });
+
+const auto ActivationFunctionsDataset = framework::dataset::make("ActivationInfo",
+{
+    ActivationLayerInfo(),
+    ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU)
+});
+
+/** Shape whose output is much taller than the rows fitting in the L2 caches, so that it is processed in several blocks */
+const auto BlockedDepthwiseSeparableConvolutionLayerDataset = combine(combine(combine(combine(combine(framework::dataset::make("InputShape", TensorShape(64U, 512U, 64U)),
+                                                                                                      framework::dataset::make("KernelSize", Size2D(3U, 3U))),
+                                                                                              framework::dataset::make("PadStrideInfo", PadStrideInfo(1, 1, 1, 1))),
+                                                                                      framework::dataset::make("Dilation", Size2D(1U, 1U))),
+                                                                              framework::dataset::make("DepthMultiplier", 1)),
+                                                                      framework::dataset::make("OutputChannels", 64));
+
+const auto QuantizationInfoDataset = combine(combine(combine(framework::dataset::make("InputQuantizationInfo", QuantizationInfo(0.5f, 10)),
+                                                             framework::dataset::make("WeightsQuantizationInfo", QuantizationInfo(0.1f, 5))),
+                                                     framework::dataset::make("DepthwiseOutputQuantizationInfo", QuantizationInfo(0.05f, 128))),
+                                             framework::dataset::make("OutputQuantizationInfo", QuantizationInfo(0.1f, 128)));
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(DepthwiseSeparableConvolutionLayer)
+
+// *INDENT-OFF*
+// clang-format off
+DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(zip(zip(zip(
+               framework::dataset::make("InputInfo", { TensorInfo(TensorShape(8U, 16U, 16U), 1, DataType::F32, DataLayout::NCHW), // Unsupported data layout
+                                                       TensorInfo(TensorShape(8U, 16U, 16U), 1, DataType::F32, DataLayout::NHWC), // Pointwise convolution is not 1x1
+                                                       TensorInfo(TensorShape(8U, 16U, 16U), 1, DataType::F32, DataLayout::NHWC), // Mismatching pointwise input channels
+                                                       TensorInfo(TensorShape(8U, 16U, 16U), 1, DataType::F32, DataLayout::NHWC),
+                                                     }),
+               framework::dataset::make("DepthwiseWeightsInfo", { TensorInfo(TensorShape(8U, 3U, 3U), 1, DataType::F32, DataLayout::NCHW),
+                                                                  TensorInfo(TensorShape(8U, 3U, 3U), 1, DataType::F32, DataLayout::NHWC),
+                                                                  TensorInfo(TensorShape(8U, 3U, 3U), 1, DataType::F32, DataLayout::NHWC),
+                                                                  TensorInfo(TensorShape(8U, 3U, 3U), 1, DataType::F32, DataLayout::NHWC),
+                                                                })),
+               framework::dataset::make("PointwiseWeightsInfo", { TensorInfo(TensorShape(8U, 1U, 1U, 12U), 1, DataType::F32, DataLayout::NCHW),
+                                                                  TensorInfo(TensorShape(8U, 3U, 3U, 12U), 1, DataType::F32, DataLayout::NHWC),
+                                                                  TensorInfo(TensorShape(6U, 1U, 1U, 12U), 1, DataType::F32, DataLayout::NHWC),
+                                                                  TensorInfo(TensorShape(8U, 1U, 1U, 12U), 1, DataType::F32, DataLayout::NHWC),
+                                                                })),
+               framework::dataset::make("OutputInfo", { TensorInfo(TensorShape(12U, 14U, 14U), 1, DataType::F32, DataLayout::NCHW),
+                                                        TensorInfo(TensorShape(12U, 14U, 14U), 1, DataType::F32, DataLayout::NHWC),
+                                                        TensorInfo(TensorShape(12U, 14U, 14U), 1, DataType::F32, DataLayout::NHWC),
+                                                        TensorInfo(TensorShape(12U, 14U, 14U), 1, DataType::F32, DataLayout::NHWC),
+                                                      })),
+               framework::dataset::make("Expected", { false, false, false, true })),
+               input_info, depthwise_weights_info, pointwise_weights_info, output_info, expected)
+{
+    bool is_valid = bool(NEDepthwiseSeparableConvolutionLayer::validate(&input_info.clone()->set_is_resizable(false), &depthwise_weights_info.clone()->set_is_resizable(false), nullptr,
+                                                                        &pointwise_weights_info.clone()->set_is_resizable(false), nullptr, &output_info.clone()->set_is_resizable(false),
+                                                                        PadStrideInfo(1, 1, 0, 0)));
+    ARM_COMPUTE_EXPECT(is_valid == expected, framework::LogLevel::ERRORS);
+}
+// clang-format on
+// *INDENT-ON*
+
+template <typename T>
+using NEDepthwiseSeparableConvolutionLayerFixture = DepthwiseSeparableConvolutionLayerValidationFixture<Tensor, Accessor, NEDepthwiseSeparableConvolutionLayer, T>;
+template <typename T>
+using NEDepthwiseSeparableConvolutionLayerQuantizedFixture = DepthwiseSeparableConvolutionLayerValidationQuantizedFixture<Tensor, Accessor, NEDepthwiseSeparableConvolutionLayer, T>;
+
+TEST_SUITE(Float)
+TEST_SUITE(FP32)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEDepthwiseSeparableConvolutionLayerFixture<float>, framework::DatasetMode::PRECOMMIT,
+                       combine(combine(combine(combine(datasets::SmallDepthwiseConvolutionLayerDataset(), depth_multipliers), num_output_channels),
+                                       framework::dataset::make("DataType", DataType::F32)),
+                               ActivationFunctionsDataset))
+{
+    validate(Accessor(_target), _reference, tolerance_f32, tolerance_num);
+}
+FIXTURE_DATA_TEST_CASE(RunLarge, NEDepthwiseSeparableConvolutionLayerFixture<float>, framework::DatasetMode::NIGHTLY,
+                       combine(combine(combine(combine(datasets::LargeDepthwiseConvolutionLayerDataset(), framework::dataset::make("DepthMultiplier", 1)),
+                                               framework::dataset::make("OutputChannels", 32)),
+                                       framework::dataset::make("DataType", DataType::F32)),
+                               ActivationFunctionsDataset))
+{
+    validate(Accessor(_target), _reference, tolerance_f32, tolerance_num);
+}
+FIXTURE_DATA_TEST_CASE(RunBlocked, NEDepthwiseSeparableConvolutionLayerFixture<float>, framework::DatasetMode::NIGHTLY,
+                       combine(combine(BlockedDepthwiseSeparableConvolutionLayerDataset, framework::dataset::make("DataType", DataType::F32)), ActivationFunctionsDataset))
+{
+    validate(Accessor(_target), _reference, tolerance_f32, tolerance_num);
+}
+TEST_SUITE_END() // FP32
+TEST_SUITE_END() // Float
+
+TEST_SUITE(Quantized)
+TEST_SUITE(QASYMM8)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEDepthwiseSeparableConvolutionLayerQuantizedFixture<uint8_t>, framework::DatasetMode::PRECOMMIT,
+                       combine(combine(combine(combine(combine(datasets::SmallDepthwiseConvolutionLayerDataset(), depth_multipliers), num_output_channels),
+                                               framework::dataset::make("DataType", DataType::QASYMM8)),
+                                       QuantizationInfoDataset),
+                               ActivationFunctionsDataset))
+{
+    validate(Accessor(_target), _reference, tolerance_qasymm8, tolerance_num);
+}
+FIXTURE_DATA_TEST_CASE(RunBlocked, NEDepthwiseSeparableConvolutionLayerQuantizedFixture<uint8_t>, framework::DatasetMode::NIGHTLY,
+                       combine(combine(combine(BlockedDepthwiseSeparableConvolutionLayerDataset, framework::dataset::make("DataType", DataType::QASYMM8)), QuantizationInfoDataset),
+                               ActivationFunctionsDataset))
+{
+    validate(Accessor(_target), _reference, tolerance_qasymm8, tolerance_num);
+}
+TEST_SUITE_END() // QASYMM8
+TEST_SUITE_END() // Quantized
+
+TEST_SUITE_END() // DepthwiseSeparableConvolutionLayer
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
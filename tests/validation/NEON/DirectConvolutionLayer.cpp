@@ -93,6 +93,15 @@ const auto data9x9 = combine(datasets::SmallDirectConvolutionShapes(),
                                                      combine(framework::dataset::make("PadY", { 0, 3 }),
                                                              framework::dataset::make("KernelSize", 9))))));
 
+/** Direct convolution data set for NHWC, which supports any kernel size */
+const auto data_nhwc = combine(datasets::SmallDirectConvolutionShapes(),
+                               combine(framework::dataset::make("StrideX", { 1, 2 }),
+                                       combine(framework::dataset::make("StrideY", { 1, 3 }),
+                                               combine(framework::dataset::make("PadX", { 0, 3 }),
+                                                       combine(framework::dataset::make("PadY", { 1 }),
+                                                               combine(framework::dataset::make("KernelSize", { 1, 7 }),
+                                                                       framework::dataset::make("NumKernels", { 3, 32 })))))));
+
 const auto data_f32_nightly = combine(data_f32, framework::dataset::make("NumKernels", { 1, 4 }));
 const auto data_f16_nightly = combine(data_f16, framework::dataset::make("NumKernels", { 1, 4 }));
 
@@ -242,7 +251,15 @@ TEST_SUITE(FP16)
 FIXTURE_DATA_TEST_CASE(RunSmall, NEDirectConvolutionLayerFixture<half>, framework::DatasetMode::PRECOMMIT, combine(combine(combine(data_precommit, framework::dataset::make("DataType",
                                                                                                                    DataType::F16)),
                                                                                                                    ActivationFunctionsDataset),
-                                                                                                                   framework::dataset::make("DataLayout", DataLayout::NCHW)))
+                                                                                                                   framework::dataset::make("DataLayout", { DataLayout::NCHW, DataLayout::NHWC })))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_f16, tolerance_num, abs_tolerance_f16);
+}
+FIXTURE_DATA_TEST_CASE(RunSmallNHWC, NEDirectConvolutionLayerFixture<half>, framework::DatasetMode::PRECOMMIT, combine(combine(combine(data_nhwc, framework::dataset::make("DataType",
+                                                                                                                       DataType::F16)),
+                                                                                                                       framework::dataset::make("ActivationInfo", { ActivationLayerInfo() })),
+                                                                                                                       framework::dataset::make("DataLayout", { DataLayout::NHWC })))
 {
     // Validate output
     validate(Accessor(_target), _reference, rel_tolerance_f16, tolerance_num, abs_tolerance_f16);
@@ -274,6 +291,14 @@ FIXTURE_DATA_TEST_CASE(RunSmall9x9, NEDirectConvolutionLayerFixture<float>, fram
     // Validate output
     validate(Accessor(_target), _reference, tolerance_fp32);
 }
+FIXTURE_DATA_TEST_CASE(RunSmallNHWC, NEDirectConvolutionLayerFixture<float>, framework::DatasetMode::PRECOMMIT, combine(combine(combine(data_nhwc, framework::dataset::make("DataType",
+                                                                                                                        DataType::F32)),
+                                                                                                                        ActivationFunctionsDataset),
+                                                                                                                        framework::dataset::make("DataLayout", { DataLayout::NHWC })))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_fp32);
+}
 FIXTURE_DATA_TEST_CASE(RunLarge, NEDirectConvolutionLayerFixture<float>, framework::DatasetMode::NIGHTLY, combine(combine(combine(data_f32_nightly, framework::dataset::make("DataType",
                                                                                                                   DataType::F32)),
                                                                                                                   ActivationFunctionsDataset),
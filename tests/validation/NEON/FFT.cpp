@@ -49,16 +49,33 @@ const auto shapes_1d  = framework::dataset::make("TensorShape", { TensorShape(2U
                                                                   TensorShape(9U, 2U, 3U), TensorShape(25U, 2U, 3U),
                                                                   TensorShape(49U, 2U, 3U), TensorShape(64U, 2U, 3U),
                                                                   TensorShape(16U, 2U, 3U), TensorShape(32U, 2U, 3U),
-                                                                  TensorShape(96U, 2U, 2U)
+                                                                  TensorShape(96U, 2U, 2U), TensorShape(11U, 2U, 3U),
+                                                                  TensorShape(13U, 2U, 3U), TensorShape(143U, 2U, 2U),
+                                                                  TensorShape(17U, 2U, 3U), TensorShape(46U, 2U, 2U)
                                                                 });
 
 const auto shapes_2d = framework::dataset::make("TensorShape", { TensorShape(2U, 2U, 3U), TensorShape(3U, 6U, 3U),
                                                                  TensorShape(4U, 5U, 3U), TensorShape(5U, 7U, 3U),
                                                                  TensorShape(7U, 25U, 3U), TensorShape(8U, 2U, 3U),
                                                                  TensorShape(9U, 16U, 3U), TensorShape(25U, 32U, 3U),
-                                                                 TensorShape(192U, 128U, 2U)
+                                                                 TensorShape(192U, 128U, 2U), TensorShape(11U, 13U, 3U),
+                                                                 TensorShape(17U, 22U, 3U)
                                                                });
 
+const auto shapes_real_1d = framework::dataset::make("TensorShape", { TensorShape(4U, 2U, 3U), TensorShape(5U, 2U, 3U),
+                                                                      TensorShape(8U, 2U, 3U), TensorShape(9U, 2U, 3U),
+                                                                      TensorShape(15U, 2U, 3U), TensorShape(16U, 2U, 3U),
+                                                                      TensorShape(21U, 2U, 3U), TensorShape(25U, 2U, 3U),
+                                                                      TensorShape(32U, 2U, 3U), TensorShape(49U, 2U, 3U),
+                                                                      TensorShape(96U, 2U, 2U), TensorShape(105U, 2U, 2U)
+                                                                    });
+
+const auto shapes_real_2d = framework::dataset::make("TensorShape", { TensorShape(4U, 5U, 3U), TensorShape(5U, 7U, 3U),
+                                                                      TensorShape(8U, 2U, 3U), TensorShape(9U, 16U, 3U),
+                                                                      TensorShape(15U, 13U, 3U), TensorShape(21U, 6U, 3U),
+                                                                      TensorShape(32U, 25U, 3U), TensorShape(49U, 11U, 3U)
+                                                                    });
+
 const auto ActivationFunctionsSmallDataset = framework::dataset::make("ActivationInfo",
 {
     ActivationLayerInfo(),
@@ -79,18 +96,20 @@ DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(zip(zip(
                                                 TensorInfo(TensorShape(32U, 13U, 2U), 2, DataType::F32), // Mismatching shapes
                                                 TensorInfo(TensorShape(32U, 13U, 2U), 3, DataType::F32), // Invalid channels
                                                 TensorInfo(TensorShape(32U, 13U, 2U), 2, DataType::F32), // Unsupported axis
-                                                TensorInfo(TensorShape(11U, 13U, 2U), 2, DataType::F32), // Undecomposable FFT
+                                                TensorInfo(TensorShape(17U, 13U, 2U), 1, DataType::F32), // Real input of undecomposable FFT
                                                 TensorInfo(TensorShape(25U, 13U, 2U), 2, DataType::F32),
+                                                TensorInfo(TensorShape(17U, 13U, 2U), 2, DataType::F32), // Undecomposable FFT
         }),
         framework::dataset::make("OutputInfo",{ TensorInfo(TensorShape(32U, 13U, 2U), 2, DataType::F16),
                                                 TensorInfo(TensorShape(16U, 13U, 2U), 2, DataType::F32),
                                                 TensorInfo(TensorShape(32U, 13U, 2U), 2, DataType::F32),
                                                 TensorInfo(TensorShape(32U, 13U, 2U), 2, DataType::F32),
-                                                TensorInfo(TensorShape(11U, 13U, 2U), 2, DataType::F32),
+                                                TensorInfo(TensorShape(17U, 13U, 2U), 2, DataType::F32),
                                                 TensorInfo(TensorShape(25U, 13U, 2U), 2, DataType::F32),
+                                                TensorInfo(TensorShape(17U, 13U, 2U), 2, DataType::F32),
         })),
-        framework::dataset::make("Axis", { 0, 0, 0, 2, 0, 0 })),
-        framework::dataset::make("Expected", { false, false, false, false, false, true })),
+        framework::dataset::make("Axis", { 0, 0, 0, 2, 0, 0, 0 })),
+        framework::dataset::make("Expected", { false, false, false, false, false, true, true })),
         input_info, output_info, axis, expected)
 {
     FFT1DInfo desc;
@@ -101,9 +120,50 @@ DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(zip(zip(
 // clang-format on
 // *INDENT-ON*
 
+// *INDENT-OFF*
+// clang-format off
+DATA_TEST_CASE(ValidateReal, framework::DatasetMode::ALL, zip(zip(zip(zip(
+        framework::dataset::make("InputInfo", { TensorInfo(TensorShape(32U, 13U, 2U), 2, DataType::F32), // Complex input for a forward real FFT
+                                                TensorInfo(TensorShape(31U, 13U, 2U), 1, DataType::F32), // Undecomposable odd length
+                                                TensorInfo(TensorShape(32U, 13U, 2U), 1, DataType::F32), // Unsupported axis
+                                                TensorInfo(TensorShape(34U, 13U, 2U), 1, DataType::F32), // Undecomposable half length
+                                                TensorInfo(TensorShape(32U, 13U, 2U), 1, DataType::F32), // Mismatching number of bins
+                                                TensorInfo(TensorShape(32U, 13U, 2U), 1, DataType::F32),
+                                                TensorInfo(TensorShape(17U, 13U, 2U), 2, DataType::F32),
+                                                TensorInfo(TensorShape(21U, 13U, 2U), 1, DataType::F32),
+                                                TensorInfo(TensorShape(11U, 13U, 2U), 2, DataType::F32),
+        }),
+        framework::dataset::make("OutputInfo",{ TensorInfo(TensorShape(17U, 13U, 2U), 2, DataType::F32),
+                                                TensorInfo(TensorShape(16U, 13U, 2U), 2, DataType::F32),
+                                                TensorInfo(TensorShape(32U, 7U, 2U), 2, DataType::F32),
+                                                TensorInfo(TensorShape(18U, 13U, 2U), 2, DataType::F32),
+                                                TensorInfo(TensorShape(32U, 13U, 2U), 2, DataType::F32),
+                                                TensorInfo(TensorShape(17U, 13U, 2U), 2, DataType::F32),
+                                                TensorInfo(TensorShape(32U, 13U, 2U), 1, DataType::F32),
+                                                TensorInfo(TensorShape(11U, 13U, 2U), 2, DataType::F32),
+                                                TensorInfo(TensorShape(21U, 13U, 2U), 1, DataType::F32),
+        })),
+        framework::dataset::make("Axis", { 0, 0, 1, 0, 0, 0, 0, 0, 0 })),
+        framework::dataset::make("Inverse", { false, false, false, false, false, false, true, false, true })),
+        framework::dataset::make("Expected", { false, false, false, false, false, true, true, true, true })),
+        input_info, output_info, axis, inverse, expected)
+{
+    FFT1DInfo desc;
+    desc.axis      = axis;
+    desc.direction = inverse ? FFTDirection::Inverse : FFTDirection::Forward;
+    desc.is_real   = true;
+    const Status s = NEFFT1D::validate(&input_info.clone()->set_is_resizable(false), &output_info.clone()->set_is_resizable(false), desc);
+    ARM_COMPUTE_EXPECT(bool(s) == expected, framework::LogLevel::ERRORS);
+}
+// clang-format on
+// *INDENT-ON*
+
 template <typename T>
 using NEFFT1DFixture = FFTValidationFixture<Tensor, Accessor, NEFFT1D, FFT1DInfo, T>;
 
+template <typename T>
+using NEFFT1DRealFixture = FFTRealValidationFixture<Tensor, Accessor, NEFFT1D, FFT1DInfo, T>;
+
 TEST_SUITE(Float)
 TEST_SUITE(FP32)
 FIXTURE_DATA_TEST_CASE(RunSmall, NEFFT1DFixture<float>, framework::DatasetMode::ALL, combine(shapes_1d, framework::dataset::make("DataType", DataType::F32)))
@@ -111,6 +171,12 @@ FIXTURE_DATA_TEST_CASE(RunSmall, NEFFT1DFixture<float>, framework::DatasetMode::
     // Validate output
     validate(Accessor(_target), _reference, tolerance_f32, tolerance_num);
 }
+FIXTURE_DATA_TEST_CASE(RunReal, NEFFT1DRealFixture<float>, framework::DatasetMode::ALL, combine(combine(shapes_real_1d, framework::dataset::make("DataType", DataType::F32)),
+                                                                                                framework::dataset::make("Inverse", { false, true })))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f32, tolerance_num);
+}
 TEST_SUITE_END() // FP32
 TEST_SUITE_END() // Float
 TEST_SUITE_END() // FFT1D
@@ -122,13 +188,13 @@ DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(zip(
         framework::dataset::make("InputInfo", { TensorInfo(TensorShape(32U, 25U, 2U), 2, DataType::F32), // Mismatching data types
                                                 TensorInfo(TensorShape(32U, 25U, 2U), 2, DataType::F32), // Mismatching shapes
                                                 TensorInfo(TensorShape(32U, 25U, 2U), 3, DataType::F32), // Invalid channels
-                                                TensorInfo(TensorShape(32U, 13U, 2U), 2, DataType::F32), // Undecomposable FFT
+                                                TensorInfo(TensorShape(17U, 25U, 2U), 1, DataType::F32), // Real input of undecomposable FFT
                                                 TensorInfo(TensorShape(32U, 25U, 2U), 2, DataType::F32),
         }),
         framework::dataset::make("OutputInfo",{ TensorInfo(TensorShape(32U, 25U, 2U), 2, DataType::F16),
                                                 TensorInfo(TensorShape(16U, 25U, 2U), 2, DataType::F32),
                                                 TensorInfo(TensorShape(32U, 25U, 2U), 1, DataType::F32),
-                                                TensorInfo(TensorShape(32U, 13U, 2U), 2, DataType::F32),
+                                                TensorInfo(TensorShape(17U, 25U, 2U), 2, DataType::F32),
                                                 TensorInfo(TensorShape(32U, 25U, 2U), 2, DataType::F32),
         })),
         framework::dataset::make("Expected", { false, false, false, false, true })),
@@ -143,6 +209,9 @@ DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(zip(
 template <typename T>
 using NEFFT2DFixture = FFTValidationFixture<Tensor, Accessor, NEFFT2D, FFT2DInfo, T>;
 
+template <typename T>
+using NEFFT2DRealFixture = FFTRealValidationFixture<Tensor, Accessor, NEFFT2D, FFT2DInfo, T>;
+
 TEST_SUITE(Float)
 TEST_SUITE(FP32)
 FIXTURE_DATA_TEST_CASE(RunSmall, NEFFT2DFixture<float>, framework::DatasetMode::ALL, combine(shapes_2d, framework::dataset::make("DataType", DataType::F32)))
@@ -150,6 +219,12 @@ FIXTURE_DATA_TEST_CASE(RunSmall, NEFFT2DFixture<float>, framework::DatasetMode::
     // Validate output
     validate(Accessor(_target), _reference, tolerance_f32, tolerance_num);
 }
+FIXTURE_DATA_TEST_CASE(RunReal, NEFFT2DRealFixture<float>, framework::DatasetMode::ALL, combine(combine(shapes_real_2d, framework::dataset::make("DataType", DataType::F32)),
+                                                                                                framework::dataset::make("Inverse", { false, true })))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f32, tolerance_num);
+}
 TEST_SUITE_END() // FP32
 TEST_SUITE_END() // Float
 TEST_SUITE_END() // FFT2D
@@ -45,6 +45,11 @@ namespace
 /** Tolerance for float operations */
 constexpr RelativeTolerance<float> rel_tolerance_f32(0.01f);  /**< Relative tolerance value for comparing reference's output against implementation's output for DataType::F32 */
 constexpr AbsoluteTolerance<float> abs_tolerance_f32(0.001f); /**< Absolute tolerance value for comparing reference's output against implementation's output for DataType::F32 */
+/** Tolerance for F32 operations computed with dynamic quantization */
+constexpr RelativeTolerance<float> rel_tolerance_dynamic_f32(0.05f);      /**< Relative tolerance value for comparing reference's output against implementation's output for DataType::F32 with dynamic quantization */
+constexpr AbsoluteTolerance<float> abs_tolerance_dynamic_f32(0.1f);       /**< Absolute tolerance value for comparing reference's output against implementation's output for DataType::F32 with dynamic quantization */
+constexpr float                    tolerance_num_dynamic_f32 = 0.05f;     /**< Tolerance number for DataType::F32 with dynamic quantization */
+constexpr AbsoluteTolerance<float> abs_tolerance_exact_dynamic_f32(0.5f); /**< Absolute tolerance value for DataType::F32 with dynamic quantization of exactly quantized integer values */
 #ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
 const AbsoluteTolerance<float>            abs_tolerance_f16(0.3f);                   /**< Absolute tolerance value for comparing reference's output against implementation's output for DataType::F16 */
 const RelativeTolerance<half_float::half> rel_tolerance_f16(half_float::half(0.2f)); /**< Relative tolerance value for comparing reference's output against implementation's output for DataType::F16 */
@@ -199,11 +204,86 @@ FIXTURE_DATA_TEST_CASE(RunLarge, NEFullyConnectedLayerFixture<float>, framework:
     // Validate output
     validate(Accessor(_target), _reference, rel_tolerance_f32, 0, abs_tolerance_f32);
 }
+
+template <typename T>
+using NEFullyConnectedLayerDynamicQuantizationFixture = FullyConnectedLayerValidationDynamicQuantizationFixture<Tensor, Accessor, NEFullyConnectedLayer, T>;
+
+TEST_SUITE(DynamicQuantization)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEFullyConnectedLayerDynamicQuantizationFixture<float>, framework::DatasetMode::PRECOMMIT, combine(combine(combine(combine(datasets::SmallFullyConnectedLayerDataset(),
+                       FullyConnectedParameters),
+                       framework::dataset::make("DataType", DataType::F32)),
+                       EmptyActivationFunctionDataset),
+                       framework::dataset::make("ExactlyQuantizedValues", false)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_dynamic_f32, tolerance_num_dynamic_f32, abs_tolerance_dynamic_f32);
+}
+FIXTURE_DATA_TEST_CASE(RunWithActivation, NEFullyConnectedLayerDynamicQuantizationFixture<float>, framework::DatasetMode::PRECOMMIT, combine(combine(combine(
+                           combine(datasets::FullyConnectedLayerWithActivationDataset(),
+                                   FullyConnectedParameters),
+                           framework::dataset::make("DataType", DataType::F32)),
+                       ActivationFunctionsDataset),
+                       framework::dataset::make("ExactlyQuantizedValues", false)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_dynamic_f32, tolerance_num_dynamic_f32, abs_tolerance_dynamic_f32);
+}
+FIXTURE_DATA_TEST_CASE(RunLargeK, NEFullyConnectedLayerDynamicQuantizationFixture<float>, framework::DatasetMode::PRECOMMIT, combine(combine(combine(combine(combine(combine(combine(
+                           framework::dataset::make("InputShape", TensorShape(4096U, 3U)),
+                           framework::dataset::make("WeightsShape", TensorShape(4096U, 67U))),
+                           framework::dataset::make("BiasShape", TensorShape(67U))),
+                           framework::dataset::make("OutputShape", TensorShape(67U, 3U))),
+                           FullyConnectedParameters),
+                           framework::dataset::make("DataType", DataType::F32)),
+                       EmptyActivationFunctionDataset),
+                       framework::dataset::make("ExactlyQuantizedValues", true)))
+{
+    // The quantization is exact and the accumulators exceed the float precision: only the final conversion may round
+    validate(Accessor(_target), _reference, abs_tolerance_exact_dynamic_f32);
+}
+TEST_SUITE_END() // DynamicQuantization
+
+template <typename T>
+using NEFullyConnectedLayerSparseWeightsFixture = FullyConnectedLayerValidationFixture<Tensor, Accessor, NEFullyConnectedLayer, T, true>;
+template <typename T>
+using NEFullyConnectedLayerDynamicQuantizationSparseWeightsFixture = FullyConnectedLayerValidationDynamicQuantizationFixture<Tensor, Accessor, NEFullyConnectedLayer, T, true>;
+
+TEST_SUITE(SparseWeights)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEFullyConnectedLayerSparseWeightsFixture<float>, framework::DatasetMode::PRECOMMIT, combine(combine(combine(datasets::SmallFullyConnectedLayerDataset(),
+                       FullyConnectedParameters),
+                       framework::dataset::make("DataType", DataType::F32)),
+                       EmptyActivationFunctionDataset))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_f32, 0, abs_tolerance_f32);
+}
+FIXTURE_DATA_TEST_CASE(RunWithActivation, NEFullyConnectedLayerSparseWeightsFixture<float>, framework::DatasetMode::PRECOMMIT, combine(combine(
+                           combine(datasets::FullyConnectedLayerWithActivationDataset(),
+                                   FullyConnectedParameters),
+                           framework::dataset::make("DataType", DataType::F32)),
+                       ActivationFunctionsDataset))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_f32, 0, abs_tolerance_f32);
+}
+FIXTURE_DATA_TEST_CASE(RunDynamicQuantization, NEFullyConnectedLayerDynamicQuantizationSparseWeightsFixture<float>, framework::DatasetMode::PRECOMMIT,
+                       combine(combine(combine(combine(datasets::SmallFullyConnectedLayerDataset(),
+                                                       FullyConnectedParameters),
+                                               framework::dataset::make("DataType", DataType::F32)),
+                                       EmptyActivationFunctionDataset),
+                               framework::dataset::make("ExactlyQuantizedValues", false)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_dynamic_f32, tolerance_num_dynamic_f32, abs_tolerance_dynamic_f32);
+}
+TEST_SUITE_END() // SparseWeights
 TEST_SUITE_END()
 TEST_SUITE_END()
 
 template <typename T>
 using NEFullyConnectedLayerQuantizedFixture = FullyConnectedLayerValidationQuantizedFixture<Tensor, Accessor, NEFullyConnectedLayer, T>;
+template <typename T>
+using NEFullyConnectedLayerQuantizedSparseWeightsFixture = FullyConnectedLayerValidationQuantizedFixture<Tensor, Accessor, NEFullyConnectedLayer, T, true>;
 
 TEST_SUITE(Quantized)
 TEST_SUITE(QASYMM8)
@@ -239,6 +319,29 @@ FIXTURE_DATA_TEST_CASE(RunLarge, NEFullyConnectedLayerQuantizedFixture<uint8_t>,
     // Validate output
     validate(Accessor(_target), _reference, tolerance_qasymm8);
 }
+
+TEST_SUITE(SparseWeights)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEFullyConnectedLayerQuantizedSparseWeightsFixture<uint8_t>, framework::DatasetMode::PRECOMMIT, combine(combine(combine(
+                           combine(datasets::SmallFullyConnectedLayerDataset(),
+                                   FullyConnectedParameters),
+                           framework::dataset::make("DataType", DataType::QASYMM8)),
+                       QuantizationData),
+                       EmptyActivationFunctionDataset))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_qasymm8);
+}
+FIXTURE_DATA_TEST_CASE(RunWithActivation, NEFullyConnectedLayerQuantizedSparseWeightsFixture<uint8_t>, framework::DatasetMode::PRECOMMIT, combine(combine(combine(
+                           combine(datasets::FullyConnectedLayerWithActivationDataset(),
+                                   FullyConnectedParameters),
+                           framework::dataset::make("DataType", DataType::QASYMM8)),
+                       QuantizationData),
+                       ActivationFunctionsQuantizedDataset))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_qasymm8);
+}
+TEST_SUITE_END() // SparseWeights
 TEST_SUITE_END()
 TEST_SUITE(QASYMM8_SIGNED)
 FIXTURE_DATA_TEST_CASE(RunSmall, NEFullyConnectedLayerQuantizedFixture<int8_t>, framework::DatasetMode::PRECOMMIT, combine(combine(combine(
@@ -56,6 +56,10 @@ RelativeTolerance<half_float::half> rel_tolerance_f16(half(0.2)); /**< Relative
 const AbsoluteTolerance<float>      abs_tolerance_f16(0.2f);      /**< Absolute tolerance value for comparing reference's output against implementation's output for FP16 data types */
 constexpr float                     tolerance_num = 0.07f;        /**< Tolerance number for FP16 data types */
 #endif                                                            /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
+#ifdef V8P6_BF
+const RelativeTolerance<float> rel_tolerance_bf16(0.02f);  /**< Relative tolerance value for FP32 data types computed with bfloat16 fast math */
+constexpr float                abs_tolerance_bf16 = 0.02f; /**< Absolute tolerance value for FP32 data types computed with bfloat16 fast math */
+#endif                                                      /* V8P6_BF */
 /** CNN data types */
 const auto CNNDataTypes = framework::dataset::make("DataType",
 {
@@ -196,6 +200,9 @@ using NEGEMMFixture = GEMMValidationFixture<Tensor, Accessor, NEGEMM, T>;
 template <typename T>
 using NEGEMMFixtureDisabledC = GEMMValidationFixture<Tensor, Accessor, NEGEMM, T, true>;
 
+template <typename T>
+using NEGEMMFixtureFastMath = GEMMValidationFixture<Tensor, Accessor, NEGEMM, T, false, false, false, true>;
+
 TEST_SUITE(Float)
 DATA_TEST_CASE(ValidateZeroPadding, framework::DatasetMode::ALL, zip(framework::dataset::make("In0", { TensorShape(21U, 13U),
                                                                                                        TensorShape(31U, 1U),
@@ -234,6 +241,13 @@ FIXTURE_DATA_TEST_CASE(RunLarge, NEGEMMFixture<half>, framework::DatasetMode::NI
     // Validate output
     validate(Accessor(_target), _reference, rel_tolerance_f16, tolerance_num, abs_tolerance_f16);
 }
+FIXTURE_DATA_TEST_CASE(RunSmallM, NEGEMMFixture<half>, framework::DatasetMode::PRECOMMIT, combine(combine(datasets::SmallMGEMMDataset(),
+                                                                                                          framework::dataset::make("ReshapeWeights", { true, false })),
+                                                                                                  framework::dataset::make("DataType", DataType::F16)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_f16, tolerance_num, abs_tolerance_f16);
+}
 TEST_SUITE_END()
 #endif /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
 
@@ -254,6 +268,24 @@ FIXTURE_DATA_TEST_CASE(RunLarge, NEGEMMFixture<float>, framework::DatasetMode::N
     // Validate output
     validate(Accessor(_target), _reference, tolerance_f);
 }
+FIXTURE_DATA_TEST_CASE(RunSmallM, NEGEMMFixture<float>, framework::DatasetMode::PRECOMMIT, combine(combine(datasets::SmallMGEMMDataset(),
+                                                                                                           framework::dataset::make("ReshapeWeights", { true, false })),
+                                                                                                   framework::dataset::make("DataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f);
+}
+#ifdef V8P6_BF
+TEST_SUITE(FastMath)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEGEMMFixtureFastMath<float>, framework::DatasetMode::PRECOMMIT, combine(combine(datasets::SmallGEMMDataset(),
+                                                                                                                  framework::dataset::make("ReshapeWeights", { true, false })),
+                                                                                                          framework::dataset::make("DataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_bf16, 0.f, abs_tolerance_bf16);
+}
+TEST_SUITE_END() // FastMath
+#endif /* V8P6_BF */
 TEST_SUITE(DisabledC)
 FIXTURE_DATA_TEST_CASE(RunSmall, NEGEMMFixtureDisabledC<float>, framework::DatasetMode::PRECOMMIT, combine(combine(datasets::SmallGEMMDataset(),
                                                                                                                    framework::dataset::make("ReshapeWeights", { true, false })),
@@ -38,6 +38,7 @@
 #include "tests/validation/reference/Permute.h"
 #include "tests/validation/reference/Utils.h"
 
+#include <cstring>
 #include <random>
 
 namespace arm_compute
@@ -58,7 +59,7 @@ void configure_conv_function(ConvolutionFunction &func,
 }
 } // namespace detail
 
-template <typename TensorType, typename AccessorType, typename FunctionType, typename T, typename TW>
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T, typename TW, bool sparse_weights = false>
 class ConvolutionValidationGenericFixture : public framework::Fixture
 {
 public:
@@ -153,6 +154,26 @@ protected:
         }
     }
 
+    template <typename U>
+    void fill_weights(U &&tensor, int i)
+    {
+        fill(tensor, i);
+
+        if(sparse_weights)
+        {
+            // Zero half of the input channels of each group of 16 kernels, which zeroes whole 1x16 blocks of the reshaped weights matrix
+            const size_t idx_channel = get_data_layout_dimension_index(tensor.data_layout(), DataLayoutDimension::CHANNEL);
+            for(int idx = 0; idx < tensor.num_elements(); ++idx)
+            {
+                const Coordinates coord = index2coord(tensor.shape(), idx);
+                if(((coord[idx_channel] * 7 + (coord[3] / 16) * 3) % 4) < 2)
+                {
+                    std::memset(tensor(coord), 0, tensor.element_size());
+                }
+            }
+        }
+    }
+
     TensorType compute_target(TensorShape input_shape, TensorShape weights_shape, const TensorShape &bias_shape, TensorShape output_shape, const PadStrideInfo &info,
                               bool reshape_weights, const Size2D &dilation, const ActivationLayerInfo act_info)
     {
@@ -170,7 +191,7 @@ protected:
         const int idx_width  = get_data_layout_dimension_index(_data_layout, DataLayoutDimension::WIDTH);
         const int idx_height = get_data_layout_dimension_index(_data_layout, DataLayoutDimension::HEIGHT);
 
-        WeightsInfo weights_info(!reshape_weights, weights_shape[idx_width], weights_shape[idx_height], weights_shape[3]);
+        WeightsInfo weights_info(!reshape_weights, weights_shape[idx_width], weights_shape[idx_height], weights_shape[3], false, sparse_weights);
         TensorShape reshaped_weights_shape(weights_shape);
 
         // Create tensors
@@ -201,7 +222,7 @@ protected:
 
         // Fill tensors
         fill(AccessorType(src), 0);
-        fill(AccessorType(weights), 1);
+        fill_weights(AccessorType(weights), 1);
         fill(AccessorType(bias), 2);
 
         // Compute NEConvolutionLayer function
@@ -228,7 +249,7 @@ protected:
         SimpleTensor<TBias> bias{ bias_shape, bias_dt, 1, _quantization_info };
 
         fill(src, 0);
-        fill(weights, 1);
+        fill_weights(weights, 1);
         fill(bias, 2);
 
         // Fill with bfloat16 to perform the conversion and reduce the mismatches in the output
@@ -256,30 +277,30 @@ protected:
     bool             _is_bfloat16  = false;
 };
 
-template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
-class ConvolutionValidationFixture : public ConvolutionValidationGenericFixture<TensorType, AccessorType, FunctionType, T, T>
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T, bool sparse_weights = false>
+class ConvolutionValidationFixture : public ConvolutionValidationGenericFixture<TensorType, AccessorType, FunctionType, T, T, sparse_weights>
 {
 public:
     template <typename...>
     void setup(TensorShape input_shape, TensorShape weights_shape, TensorShape bias_shape, TensorShape output_shape, PadStrideInfo info, Size2D dilation, bool reshape_weights, DataType data_type,
                DataLayout data_layout, ActivationLayerInfo act_info)
     {
-        ConvolutionValidationGenericFixture<TensorType, AccessorType, FunctionType, T, T>::setup(input_shape, weights_shape, bias_shape, output_shape, info, dilation, reshape_weights,
-                                                                                                 data_type, data_type, data_layout,
-                                                                                                 QuantizationInfo(), QuantizationInfo(), act_info);
+        ConvolutionValidationGenericFixture<TensorType, AccessorType, FunctionType, T, T, sparse_weights>::setup(input_shape, weights_shape, bias_shape, output_shape, info, dilation, reshape_weights,
+                                                                                                                 data_type, data_type, data_layout,
+                                                                                                                 QuantizationInfo(), QuantizationInfo(), act_info);
     }
 };
 
-template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
-class ConvolutionValidationQuantizedFixture : public ConvolutionValidationGenericFixture<TensorType, AccessorType, FunctionType, T, T>
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T, bool sparse_weights = false>
+class ConvolutionValidationQuantizedFixture : public ConvolutionValidationGenericFixture<TensorType, AccessorType, FunctionType, T, T, sparse_weights>
 {
 public:
     template <typename...>
     void setup(TensorShape input_shape, TensorShape weights_shape, TensorShape bias_shape, TensorShape output_shape, PadStrideInfo info, Size2D dilation, bool reshape_weights, DataType data_type,
                DataLayout data_layout, QuantizationInfo quantization_info, ActivationLayerInfo act_info)
     {
-        ConvolutionValidationGenericFixture<TensorType, AccessorType, FunctionType, T, T>::setup(input_shape, weights_shape, bias_shape, output_shape, info, dilation, reshape_weights,
-                                                                                                 data_type, data_type, data_layout, quantization_info, quantization_info, act_info);
+        ConvolutionValidationGenericFixture<TensorType, AccessorType, FunctionType, T, T, sparse_weights>::setup(input_shape, weights_shape, bias_shape, output_shape, info, dilation, reshape_weights,
+                                                                                                                 data_type, data_type, data_layout, quantization_info, quantization_info, act_info);
     }
 };
 
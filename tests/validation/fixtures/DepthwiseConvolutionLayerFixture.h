@@ -309,6 +309,120 @@ protected:
     SimpleTensor<T> _reference{};
 };
 
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T, typename TW>
+class DepthwiseConvolutionLayerNativeQuantizedValidationFixture : public DepthwiseConvolutionLayerValidationGenericFixture<TensorType, AccessorType, FunctionType, T, TW>
+{
+public:
+    template <typename...>
+    void setup(size_t width, size_t height, size_t channel, size_t batch, Size2D kernel_size, size_t depth_multiplier, Size2D dilation, Size2D stride, bool padding_valid, DataType data_type,
+               DataType weights_data_type, DataLayout data_layout)
+    {
+        const TensorShape src_shape(width, height, channel, batch);
+        const TensorShape weights_shape(kernel_size.width, kernel_size.height, channel * depth_multiplier);
+        const TensorShape biases_shape(weights_shape.z());
+
+        PadStrideInfo conv_info;
+        if(padding_valid)
+        {
+            conv_info = PadStrideInfo();
+        }
+        else
+        {
+            conv_info = calculate_same_pad(src_shape, weights_shape, PadStrideInfo(stride.width, stride.height), DataLayout::NCHW, dilation);
+        }
+
+        const QuantizationInfo input_quantization_info(0.5f, 10);
+        const QuantizationInfo output_quantization_info(4.f, 128);
+        QuantizationInfo       weights_quantization_info(0.25f, 3);
+
+        if(is_data_type_quantized_per_channel(weights_data_type))
+        {
+            std::vector<float>               weights_scales{};
+            std::mt19937                     gen(library->seed());
+            std::uniform_real_distribution<> dis(0.01f, output_quantization_info.uniform().scale / input_quantization_info.uniform().scale);
+            for(size_t i = 0; i < weights_shape.z(); ++i)
+            {
+                weights_scales.push_back(dis(gen));
+            }
+            weights_quantization_info = QuantizationInfo(weights_scales);
+        }
+
+        _target = compute_target(src_shape, weights_shape, biases_shape, conv_info, dilation, depth_multiplier, data_type, weights_data_type,
+                                 input_quantization_info, weights_quantization_info, output_quantization_info, data_layout);
+        _reference = compute_reference(src_shape, weights_shape, biases_shape, conv_info, dilation, depth_multiplier, data_type, weights_data_type,
+                                       input_quantization_info, weights_quantization_info, output_quantization_info);
+    }
+
+protected:
+    TensorType compute_target(TensorShape input_shape, TensorShape weights_shape, TensorShape biases_shape, PadStrideInfo &conv_info, Size2D dilation,
+                              unsigned int depth_multiplier, const DataType data_type, const DataType weights_data_type,
+                              const QuantizationInfo &input_quantization_info, const QuantizationInfo &weights_quantization_info, const QuantizationInfo &output_quantization_info,
+                              const DataLayout data_layout)
+    {
+        if(data_layout == DataLayout::NHWC)
+        {
+            permute(input_shape, PermutationVector(2U, 0U, 1U));
+            permute(weights_shape, PermutationVector(2U, 0U, 1U));
+        }
+
+        // Create tensors
+        TensorType src     = create_tensor<TensorType>(input_shape, data_type, 1, input_quantization_info, data_layout);
+        TensorType weights = create_tensor<TensorType>(weights_shape, weights_data_type, 1, weights_quantization_info, data_layout);
+        TensorType biases  = create_tensor<TensorType>(biases_shape, DataType::S32, 1, input_quantization_info, data_layout);
+        TensorType dst     = create_tensor<TensorType>(TensorShape(), data_type, 1, output_quantization_info, data_layout);
+
+        // Create Depthwise Convolution configure function
+        FunctionType dwc;
+        dwc.configure(&src, &weights, &biases, &dst, conv_info, depth_multiplier, dilation);
+
+        ARM_COMPUTE_EXPECT(src.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(weights.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(biases.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(dst.info()->is_resizable(), framework::LogLevel::ERRORS);
+
+        // Allocate tensors
+        src.allocator()->allocate();
+        weights.allocator()->allocate();
+        biases.allocator()->allocate();
+        dst.allocator()->allocate();
+
+        ARM_COMPUTE_EXPECT(!src.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(!weights.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(!biases.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(!dst.info()->is_resizable(), framework::LogLevel::ERRORS);
+
+        // Fill tensors
+        this->fill(AccessorType(src), 0);
+        this->fill(AccessorType(weights), 1);
+        this->fill(AccessorType(biases), 2);
+
+        // Compute function
+        dwc.run();
+
+        return dst;
+    }
+
+    SimpleTensor<T> compute_reference(const TensorShape &input_shape, const TensorShape &weights_shape, const TensorShape &biases_shape, const PadStrideInfo &conv_info,
+                                      const Size2D &dilation, unsigned int depth_multiplier, const DataType data_type, const DataType weights_data_type,
+                                      const QuantizationInfo &input_quantization_info, const QuantizationInfo &weights_quantization_info, const QuantizationInfo &output_quantization_info)
+    {
+        SimpleTensor<T>       src{ input_shape, data_type, 1, input_quantization_info };
+        SimpleTensor<TW>      weights{ weights_shape, weights_data_type, 1, weights_quantization_info };
+        SimpleTensor<int32_t> biases{ biases_shape, DataType::S32, 1, input_quantization_info };
+
+        this->fill(src, 0);
+        this->fill(weights, 1);
+        this->fill(biases, 2);
+
+        const TensorShape dst_shape = compute_depthwise_convolution_shape(TensorInfo(input_shape, 1, data_type), TensorInfo(weights_shape, 1, weights_data_type), conv_info,
+                                                                          depth_multiplier, dilation);
+        return reference::depthwise_convolution(src, weights, biases, dst_shape, conv_info, depth_multiplier, dilation, output_quantization_info);
+    }
+
+    TensorType      _target{};
+    SimpleTensor<T> _reference{};
+};
+
 template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
 class DepthwiseConvolutionLayerNativeConfigurableValidationFixture : public DepthwiseConvolutionLayerValidationGenericFixture<TensorType, AccessorType, FunctionType, T, T>
 {
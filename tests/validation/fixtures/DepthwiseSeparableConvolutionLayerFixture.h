@@ -0,0 +1,239 @@
+/*
+ * Copyright (c) 2020 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_TEST_DEPTHWISE_SEPARABLE_CONVOLUTION_FIXTURE
+#define ARM_COMPUTE_TEST_DEPTHWISE_SEPARABLE_CONVOLUTION_FIXTURE
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/utils/misc/ShapeCalculator.h"
+#include "tests/AssetsLibrary.h"
+#include "tests/Globals.h"
+#include "tests/IAccessor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Fixture.h"
+#include "tests/validation/Helpers.h"
+#include "tests/validation/reference/ActivationLayer.h"
+#include "tests/validation/reference/ConvolutionLayer.h"
+#include "tests/validation/reference/DepthwiseConvolutionLayer.h"
+
+#include <random>
+#include <type_traits>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+using namespace arm_compute::misc::shape_calculator;
+
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class DepthwiseSeparableConvolutionLayerValidationGenericFixture : public framework::Fixture
+{
+public:
+    template <typename...>
+    void setup(TensorShape in_shape, Size2D kernel_size, PadStrideInfo pad_stride_info, Size2D dilation, unsigned int depth_multiplier, unsigned int num_output_channels,
+               DataType data_type, QuantizationInfo input_qinfo, QuantizationInfo weights_qinfo, QuantizationInfo depthwise_output_qinfo, QuantizationInfo output_qinfo,
+               ActivationLayerInfo act_info)
+    {
+        _data_type              = data_type;
+        _bias_data_type         = is_data_type_quantized(data_type) ? DataType::S32 : data_type;
+        _input_qinfo            = input_qinfo;
+        _weights_qinfo          = weights_qinfo;
+        _depthwise_output_qinfo = depthwise_output_qinfo;
+        _output_qinfo           = output_qinfo;
+
+        TensorShape depthwise_weights_shape(kernel_size.width, kernel_size.height);
+
+        const TensorInfo in_info(in_shape, 1, data_type);
+        const TensorInfo we_info(depthwise_weights_shape, 1, data_type);
+        TensorShape      depthwise_out_shape = compute_depthwise_convolution_shape(in_info, we_info, pad_stride_info, depth_multiplier, dilation);
+
+        depthwise_weights_shape.set(2, depthwise_out_shape.z());
+        const TensorShape depthwise_biases_shape(depthwise_weights_shape[2]);
+        const TensorShape pointwise_weights_shape(1U, 1U, depthwise_out_shape.z(), num_output_channels);
+        const TensorShape pointwise_biases_shape(num_output_channels);
+
+        TensorShape out_shape = depthwise_out_shape;
+        out_shape.set(2, num_output_channels);
+
+        _target = compute_target(in_shape, depthwise_weights_shape, depthwise_biases_shape, pointwise_weights_shape, pointwise_biases_shape, out_shape, pad_stride_info, dilation,
+                                 depth_multiplier, act_info);
+        _reference = compute_reference(in_shape, depthwise_weights_shape, depthwise_biases_shape, pointwise_weights_shape, pointwise_biases_shape, depthwise_out_shape, out_shape,
+                                       pad_stride_info, dilation, depth_multiplier, act_info);
+    }
+
+protected:
+    template <typename U>
+    void fill(U &&tensor, int i)
+    {
+        switch(tensor.data_type())
+        {
+            case DataType::QASYMM8:
+            {
+                std::uniform_int_distribution<uint8_t> distribution(0, 10);
+                library->fill(tensor, distribution, i);
+                break;
+            }
+            case DataType::S32:
+            {
+                std::uniform_int_distribution<int32_t> distribution(-100, 100);
+                library->fill(tensor, distribution, i);
+                break;
+            }
+            default:
+            {
+                std::uniform_real_distribution<> distribution(-1.0f, 1.0f);
+                library->fill(tensor, distribution, i);
+                break;
+            }
+        }
+    }
+
+    TensorType compute_target(TensorShape input_shape, TensorShape depthwise_weights_shape, const TensorShape &depthwise_biases_shape, TensorShape pointwise_weights_shape,
+                              const TensorShape &pointwise_biases_shape, TensorShape output_shape, const PadStrideInfo &pad_stride_info, const Size2D &dilation,
+                              unsigned int depth_multiplier, const ActivationLayerInfo &act_info)
+    {
+        // The function only supports NHWC
+        permute(input_shape, PermutationVector(2U, 0U, 1U));
+        permute(depthwise_weights_shape, PermutationVector(2U, 0U, 1U));
+        permute(pointwise_weights_shape, PermutationVector(2U, 0U, 1U));
+        permute(output_shape, PermutationVector(2U, 0U, 1U));
+
+        // Create tensors
+        TensorType src               = create_tensor<TensorType>(input_shape, _data_type, 1, _input_qinfo, DataLayout::NHWC);
+        TensorType depthwise_weights = create_tensor<TensorType>(depthwise_weights_shape, _data_type, 1, _weights_qinfo, DataLayout::NHWC);
+        TensorType depthwise_biases  = create_tensor<TensorType>(depthwise_biases_shape, _bias_data_type, 1, QuantizationInfo(), DataLayout::NHWC);
+        TensorType pointwise_weights = create_tensor<TensorType>(pointwise_weights_shape, _data_type, 1, _weights_qinfo, DataLayout::NHWC);
+        TensorType pointwise_biases  = create_tensor<TensorType>(pointwise_biases_shape, _bias_data_type, 1, QuantizationInfo(), DataLayout::NHWC);
+        TensorType dst               = create_tensor<TensorType>(output_shape, _data_type, 1, _output_qinfo, DataLayout::NHWC);
+
+        // Create and configure function
+        FunctionType dsc;
+        dsc.configure(&src, &depthwise_weights, &depthwise_biases, &pointwise_weights, &pointwise_biases, &dst, pad_stride_info, _depthwise_output_qinfo, depth_multiplier, act_info, act_info,
+                      dilation);
+
+        ARM_COMPUTE_EXPECT(src.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(depthwise_weights.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(pointwise_weights.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(dst.info()->is_resizable(), framework::LogLevel::ERRORS);
+
+        // Allocate tensors
+        src.allocator()->allocate();
+        depthwise_weights.allocator()->allocate();
+        depthwise_biases.allocator()->allocate();
+        pointwise_weights.allocator()->allocate();
+        pointwise_biases.allocator()->allocate();
+        dst.allocator()->allocate();
+
+        ARM_COMPUTE_EXPECT(!src.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(!depthwise_weights.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(!pointwise_weights.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(!dst.info()->is_resizable(), framework::LogLevel::ERRORS);
+
+        // Fill tensors
+        fill(AccessorType(src), 0);
+        fill(AccessorType(depthwise_weights), 1);
+        fill(AccessorType(depthwise_biases), 2);
+        fill(AccessorType(pointwise_weights), 3);
+        fill(AccessorType(pointwise_biases), 4);
+
+        // Compute function
+        dsc.run();
+
+        return dst;
+    }
+
+    SimpleTensor<T> compute_reference(const TensorShape &in_shape, const TensorShape &depthwise_weights_shape, const TensorShape &depthwise_biases_shape,
+                                      const TensorShape &pointwise_weights_shape, const TensorShape &pointwise_biases_shape, const TensorShape &depthwise_out_shape,
+                                      const TensorShape &out_shape, const PadStrideInfo &pad_stride_info, const Size2D &dilation, unsigned int depth_multiplier,
+                                      const ActivationLayerInfo &act_info)
+    {
+        using TBias = typename std::conditional<std::is_same<T, uint8_t>::value, int32_t, T>::type;
+
+        SimpleTensor<T>     src{ in_shape, _data_type, 1, _input_qinfo };
+        SimpleTensor<T>     depthwise_weights{ depthwise_weights_shape, _data_type, 1, _weights_qinfo };
+        SimpleTensor<TBias> depthwise_biases{ depthwise_biases_shape, _bias_data_type };
+        SimpleTensor<T>     pointwise_weights{ pointwise_weights_shape, _data_type, 1, _weights_qinfo };
+        SimpleTensor<TBias> pointwise_biases{ pointwise_biases_shape, _bias_data_type };
+
+        fill(src, 0);
+        fill(depthwise_weights, 1);
+        fill(depthwise_biases, 2);
+        fill(pointwise_weights, 3);
+        fill(pointwise_biases, 4);
+
+        SimpleTensor<T> depth_out = reference::depthwise_convolution(src, depthwise_weights, depthwise_biases, depthwise_out_shape, pad_stride_info, depth_multiplier, dilation,
+                                                                     _depthwise_output_qinfo);
+        if(act_info.enabled())
+        {
+            depth_out = reference::activation_layer<T>(depth_out, act_info);
+        }
+
+        SimpleTensor<T> out = reference::convolution_layer<T>(depth_out, pointwise_weights, pointwise_biases, out_shape, PadStrideInfo(1, 1, 0, 0), Size2D(1U, 1U), 1, _output_qinfo);
+        return (act_info.enabled()) ? reference::activation_layer<T>(out, act_info) : out;
+    }
+
+    TensorType       _target{};
+    SimpleTensor<T>  _reference{};
+    DataType         _data_type{};
+    DataType         _bias_data_type{};
+    QuantizationInfo _input_qinfo{};
+    QuantizationInfo _weights_qinfo{};
+    QuantizationInfo _depthwise_output_qinfo{};
+    QuantizationInfo _output_qinfo{};
+};
+
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class DepthwiseSeparableConvolutionLayerValidationFixture : public DepthwiseSeparableConvolutionLayerValidationGenericFixture<TensorType, AccessorType, FunctionType, T>
+{
+public:
+    template <typename...>
+    void setup(TensorShape in_shape, Size2D kernel_size, PadStrideInfo pad_stride_info, Size2D dilation, unsigned int depth_multiplier, unsigned int num_output_channels,
+               DataType data_type, ActivationLayerInfo act_info)
+    {
+        DepthwiseSeparableConvolutionLayerValidationGenericFixture<TensorType, AccessorType, FunctionType, T>::setup(in_shape, kernel_size, pad_stride_info, dilation, depth_multiplier,
+                                                                                                                     num_output_channels, data_type, QuantizationInfo(), QuantizationInfo(),
+                                                                                                                     QuantizationInfo(), QuantizationInfo(), act_info);
+    }
+};
+
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class DepthwiseSeparableConvolutionLayerValidationQuantizedFixture : public DepthwiseSeparableConvolutionLayerValidationGenericFixture<TensorType, AccessorType, FunctionType, T>
+{
+public:
+    template <typename...>
+    void setup(TensorShape in_shape, Size2D kernel_size, PadStrideInfo pad_stride_info, Size2D dilation, unsigned int depth_multiplier, unsigned int num_output_channels,
+               DataType data_type, QuantizationInfo input_qinfo, QuantizationInfo weights_qinfo, QuantizationInfo depthwise_output_qinfo, QuantizationInfo output_qinfo,
+               ActivationLayerInfo act_info)
+    {
+        DepthwiseSeparableConvolutionLayerValidationGenericFixture<TensorType, AccessorType, FunctionType, T>::setup(in_shape, kernel_size, pad_stride_info, dilation, depth_multiplier,
+                                                                                                                     num_output_channels, data_type, input_qinfo, weights_qinfo,
+                                                                                                                     depthwise_output_qinfo, output_qinfo, act_info);
+    }
+};
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_TEST_DEPTHWISE_SEPARABLE_CONVOLUTION_FIXTURE */
@@ -113,6 +113,87 @@ protected:
     SimpleTensor<T> _reference{};
 };
 
+template <typename TensorType, typename AccessorType, typename FunctionType, typename InfoType, typename T>
+class FFTRealValidationFixture : public framework::Fixture
+{
+public:
+    template <typename...>
+    void setup(TensorShape shape, DataType data_type, bool inverse)
+    {
+        // Non-redundant bins of the spectrum of the real signal
+        TensorShape spectrum_shape = shape;
+        spectrum_shape.set(0, shape[0] / 2 + 1);
+
+        const TensorShape &src_shape = inverse ? spectrum_shape : shape;
+        const TensorShape &dst_shape = inverse ? shape : spectrum_shape;
+
+        _target    = compute_target(src_shape, dst_shape, data_type, inverse);
+        _reference = compute_reference(src_shape, data_type, inverse, (shape[0] % 2) != 0);
+        ARM_COMPUTE_ERROR_ON_MISMATCHING_DIMENSIONS(_target.info()->tensor_shape(), _reference.shape());
+    }
+
+protected:
+    template <typename U>
+    void fill(U &&tensor)
+    {
+        std::uniform_real_distribution<float> distribution(-5.f, 5.f);
+        library->fill(tensor, distribution, 0);
+    }
+
+    TensorType compute_target(const TensorShape &src_shape, const TensorShape &dst_shape, DataType data_type, bool inverse)
+    {
+        // Create tensors
+        TensorType src = create_tensor<TensorType>(src_shape, data_type, inverse ? 2 : 1);
+        TensorType dst = create_tensor<TensorType>(dst_shape, data_type, inverse ? 1 : 2);
+
+        // Create and configure function
+        InfoType config;
+        config.direction = inverse ? FFTDirection::Inverse : FFTDirection::Forward;
+        config.is_real   = true;
+
+        FunctionType fft;
+        fft.configure(&src, &dst, config);
+
+        ARM_COMPUTE_EXPECT(src.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(dst.info()->is_resizable(), framework::LogLevel::ERRORS);
+
+        // Allocate tensors
+        src.allocator()->allocate();
+        dst.allocator()->allocate();
+
+        ARM_COMPUTE_EXPECT(!src.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(!dst.info()->is_resizable(), framework::LogLevel::ERRORS);
+
+        // Fill tensors
+        fill(AccessorType(src));
+
+        // Compute function
+        fft.run();
+
+        return dst;
+    }
+
+    SimpleTensor<T> compute_reference(const TensorShape &src_shape, DataType data_type, bool inverse, bool is_odd)
+    {
+        // Create reference
+        SimpleTensor<T> src{ src_shape, data_type, inverse ? 2 : 1 };
+
+        // Fill reference
+        fill(src);
+        if(std::is_same<InfoType, FFT1DInfo>::value)
+        {
+            return inverse ? reference::ridft_1d(src, is_odd) : reference::rdft_1d(src);
+        }
+        else
+        {
+            return inverse ? reference::ridft_2d(src, is_odd) : reference::rdft_2d(src);
+        }
+    }
+
+    TensorType      _target{};
+    SimpleTensor<T> _reference{};
+};
+
 template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
 class FFTConvolutionValidationGenericFixture : public framework::Fixture
 {
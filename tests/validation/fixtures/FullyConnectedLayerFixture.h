@@ -38,6 +38,7 @@
 #include "tests/validation/reference/FullyConnectedLayer.h"
 #include "tests/validation/reference/Utils.h"
 
+#include <cstring>
 #include <random>
 
 namespace arm_compute
@@ -46,7 +47,7 @@ namespace test
 {
 namespace validation
 {
-template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T, bool sparse_weights = false>
 class FullyConnectedLayerValidationGenericFixture : public framework::Fixture
 {
 public:
@@ -89,6 +90,17 @@ protected:
             std::uniform_int_distribution<int32_t> distribution(-50, 50);
             library->fill(tensor, distribution, i);
         }
+        else if(is_data_type_float(_data_type) && _exactly_quantized_values && i < 2)
+        {
+            // Integer values that the dynamic quantization represents exactly: the input spans [0, 255] with mostly small values and every output channel
+            // of the weights reaches 127, so that both scales are 1 and the input offset contribution is much larger than the result
+            std::uniform_int_distribution<int32_t> distribution(0, (i == 0) ? 3 : 127);
+            library->fill(tensor, distribution, i);
+            if(i == 0)
+            {
+                *reinterpret_cast<T *>(tensor(Coordinates())) = static_cast<T>(255);
+            }
+        }
         else if(is_data_type_float(_data_type))
         {
             std::uniform_real_distribution<> distribution(-1.0f, 1.0f);
@@ -100,6 +112,25 @@ protected:
         }
     }
 
+    template <typename U>
+    void fill_weights(U &&tensor, int i)
+    {
+        fill(tensor, i);
+
+        if(sparse_weights)
+        {
+            // Zero half of the 1x16 blocks (one input, 16 consecutive outputs) of the [input, output] weights matrix
+            for(int idx = 0; idx < tensor.num_elements(); ++idx)
+            {
+                const Coordinates coord = index2coord(tensor.shape(), idx);
+                if(((coord.x() * 7 + (coord.y() / 16) * 3) % 4) < 2)
+                {
+                    std::memset(tensor(coord), 0, tensor.element_size());
+                }
+            }
+        }
+    }
+
     TensorType compute_target(const TensorShape &input_shape, const TensorShape &weights_shape, const TensorShape &bias_shape, const TensorShape &output_shape, bool transpose_weights,
                               bool reshape_weights)
     {
@@ -130,9 +161,11 @@ protected:
 
         // Create Fully Connected layer info
         FullyConnectedLayerInfo fc_info;
-        fc_info.transpose_weights    = transpose_weights;
-        fc_info.are_weights_reshaped = !reshape_weights;
-        fc_info.activation_info      = _activation_info;
+        fc_info.transpose_weights           = transpose_weights;
+        fc_info.are_weights_reshaped        = !reshape_weights;
+        fc_info.activation_info             = _activation_info;
+        fc_info.enable_dynamic_quantization = _enable_dynamic_quantization;
+        fc_info.sparse_weights              = sparse_weights;
 
         // Create and configure function.
         FunctionType fc;
@@ -164,7 +197,7 @@ protected:
             RawTensor   tmp(tmp_shape, _data_type, 1);
 
             // Fill with original shape
-            fill(tmp, 1);
+            fill_weights(tmp, 1);
 
             // Transpose elementwise
             tmp = transpose(tmp);
@@ -181,7 +214,7 @@ protected:
         }
         else
         {
-            fill(AccessorType(weights), 1);
+            fill_weights(AccessorType(weights), 1);
         }
 
         // Compute NEFullyConnectedLayer function
@@ -199,7 +232,7 @@ protected:
 
         // Fill reference
         fill(src, 0);
-        fill(weights, 1);
+        fill_weights(weights, 1);
         fill(bias, 2);
 
         return reference::activation_layer(reference::fully_connected_layer<T>(src, weights, bias, output_shape), _activation_info, _quantization_info);
@@ -211,35 +244,54 @@ protected:
     DataType            _bias_data_type{};
     QuantizationInfo    _quantization_info{};
     ActivationLayerInfo _activation_info{};
+    bool                _enable_dynamic_quantization{ false };
+    bool                _exactly_quantized_values{ false };
 };
 
-template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
-class FullyConnectedLayerValidationFixture : public FullyConnectedLayerValidationGenericFixture<TensorType, AccessorType, FunctionType, T>
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T, bool sparse_weights = false>
+class FullyConnectedLayerValidationFixture : public FullyConnectedLayerValidationGenericFixture<TensorType, AccessorType, FunctionType, T, sparse_weights>
 {
 public:
     template <typename...>
     void setup(TensorShape input_shape, TensorShape weights_shape, TensorShape bias_shape, TensorShape output_shape, bool transpose_weights, bool reshape_weights, DataType data_type,
                ActivationLayerInfo activation_info)
     {
-        FullyConnectedLayerValidationGenericFixture<TensorType, AccessorType, FunctionType, T>::setup(input_shape, weights_shape, bias_shape, output_shape, transpose_weights,
-                                                                                                      reshape_weights, data_type,
-                                                                                                      QuantizationInfo(), activation_info);
+        FullyConnectedLayerValidationGenericFixture<TensorType, AccessorType, FunctionType, T, sparse_weights>::setup(input_shape, weights_shape, bias_shape, output_shape, transpose_weights,
+                                                                                                                      reshape_weights, data_type,
+                                                                                                                      QuantizationInfo(), activation_info);
     }
 };
 
-template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
-class FullyConnectedLayerValidationQuantizedFixture : public FullyConnectedLayerValidationGenericFixture<TensorType, AccessorType, FunctionType, T>
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T, bool sparse_weights = false>
+class FullyConnectedLayerValidationQuantizedFixture : public FullyConnectedLayerValidationGenericFixture<TensorType, AccessorType, FunctionType, T, sparse_weights>
 {
 public:
     template <typename...>
     void setup(TensorShape input_shape, TensorShape weights_shape, TensorShape bias_shape, TensorShape output_shape, bool transpose_weights, bool reshape_weights, DataType data_type,
                QuantizationInfo quantization_info, ActivationLayerInfo activation_info)
     {
-        FullyConnectedLayerValidationGenericFixture<TensorType, AccessorType, FunctionType, T>::setup(input_shape, weights_shape, bias_shape, output_shape, transpose_weights,
-                                                                                                      reshape_weights, data_type,
-                                                                                                      quantization_info, activation_info);
+        FullyConnectedLayerValidationGenericFixture<TensorType, AccessorType, FunctionType, T, sparse_weights>::setup(input_shape, weights_shape, bias_shape, output_shape, transpose_weights,
+                                                                                                                      reshape_weights, data_type,
+                                                                                                                      quantization_info, activation_info);
     }
 };
+
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T, bool sparse_weights = false>
+class FullyConnectedLayerValidationDynamicQuantizationFixture : public FullyConnectedLayerValidationGenericFixture<TensorType, AccessorType, FunctionType, T, sparse_weights>
+{
+public:
+    template <typename...>
+    void setup(TensorShape input_shape, TensorShape weights_shape, TensorShape bias_shape, TensorShape output_shape, bool transpose_weights, bool reshape_weights, DataType data_type,
+               ActivationLayerInfo activation_info, bool exactly_quantized_values)
+    {
+        this->_enable_dynamic_quantization = true;
+        this->_exactly_quantized_values    = exactly_quantized_values;
+        FullyConnectedLayerValidationGenericFixture<TensorType, AccessorType, FunctionType, T, sparse_weights>::setup(input_shape, weights_shape, bias_shape, output_shape, transpose_weights,
+                                                                                                                      reshape_weights, data_type,
+                                                                                                                      QuantizationInfo(), activation_info);
+    }
+};
+
 } // namespace validation
 } // namespace test
 } // namespace arm_compute
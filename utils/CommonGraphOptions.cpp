@@ -85,8 +85,12 @@ namespace utils
     os << "Data layout : " << common_params.data_layout << std::endl;
     os << "Tuner enabled? : " << (common_params.enable_tuner ? true_str : false_str) << std::endl;
     os << "Cache enabled? : " << (common_params.enable_cl_cache ? true_str : false_str) << std::endl;
+    os << "Convolution method tuner enabled? : " << (common_params.enable_conv_method_tuner ? true_str : false_str) << std::endl;
+    os << "Pipelined? : " << (common_params.pipelined ? true_str : false_str) << std::endl;
+    os << "Pipeline stages : " << common_params.pipeline_stages << std::endl;
     os << "Tuner mode : " << common_params.tuner_mode << std::endl;
     os << "Tuner file : " << common_params.tuner_file << std::endl;
+    os << "Plan file : " << common_params.plan_file << std::endl;
     os << "Fast math enabled? : " << (common_params.fast_math_hint == FastMathHint::Enabled ? true_str : false_str) << std::endl;
     if(!common_params.data_path.empty())
     {
@@ -121,6 +125,9 @@ CommonGraphOptions::CommonGraphOptions(CommandLineParser &parser)
       data_layout(),
       enable_tuner(parser.add_option<ToggleOption>("enable-tuner")),
       enable_cl_cache(parser.add_option<ToggleOption>("enable-cl-cache")),
+      enable_conv_method_tuner(parser.add_option<ToggleOption>("enable-conv-method-tuner")),
+      pipelined(parser.add_option<ToggleOption>("pipelined")),
+      pipeline_stages(parser.add_option<SimpleOption<unsigned int>>("pipeline-stages", 1)),
       tuner_mode(),
       fast_math_hint(parser.add_option<ToggleOption>("fast-math")),
       data_path(parser.add_option<SimpleOption<std::string>>("data")),
@@ -129,7 +136,8 @@ CommonGraphOptions::CommonGraphOptions(CommandLineParser &parser)
       validation_file(parser.add_option<SimpleOption<std::string>>("validation-file")),
       validation_path(parser.add_option<SimpleOption<std::string>>("validation-path")),
       validation_range(parser.add_option<SimpleOption<std::string>>("validation-range")),
-      tuner_file(parser.add_option<SimpleOption<std::string>>("tuner-file"))
+      tuner_file(parser.add_option<SimpleOption<std::string>>("tuner-file")),
+      plan_file(parser.add_option<SimpleOption<std::string>>("plan-file"))
 {
     std::set<arm_compute::graph::Target> supported_targets
     {
@@ -170,6 +178,9 @@ CommonGraphOptions::CommonGraphOptions(CommandLineParser &parser)
     data_layout->set_help("Data layout to use");
     enable_tuner->set_help("Enable OpenCL dynamic tuner");
     enable_cl_cache->set_help("Enable OpenCL program caches");
+    enable_conv_method_tuner->set_help("Measure the NEON convolution methods and keep the fastest one");
+    pipelined->set_help("Overlap the input and output accessors with the execution of the graph");
+    pipeline_stages->set_help("Number of stages the graph is cut into, each processing a different frame on its own threads");
     tuner_mode->set_help(
         "Configures the time taken by the tuner to tune. "
         "Exhaustive: slowest but produces the most performant LWS configuration. "
@@ -183,6 +194,7 @@ CommonGraphOptions::CommonGraphOptions(CommandLineParser &parser)
     validation_path->set_help("Path to the validation data");
     validation_range->set_help("Range of the images to validate for (Format : start,end)");
     tuner_file->set_help("File to load/save CLTuner values");
+    plan_file->set_help("File to load/save the execution plan of the graph");
 }
 
 CommonGraphParams consume_common_graph_parameters(CommonGraphOptions &options)
@@ -199,18 +211,22 @@ CommonGraphParams consume_common_graph_parameters(CommonGraphOptions &options)
     {
         common_params.data_layout = options.data_layout->value();
     }
-    common_params.enable_tuner           = options.enable_tuner->is_set() ? options.enable_tuner->value() : false;
-    common_params.enable_cl_cache        = common_params.target == arm_compute::graph::Target::CL ? (options.enable_cl_cache->is_set() ? options.enable_cl_cache->value() : true) : false;
-    common_params.tuner_mode             = options.tuner_mode->value();
-    common_params.fast_math_hint         = options.fast_math_hint->is_set() ? fast_math_hint_value : FastMathHint::Disabled;
-    common_params.data_path              = options.data_path->value();
-    common_params.image                  = options.image->value();
-    common_params.labels                 = options.labels->value();
-    common_params.validation_file        = options.validation_file->value();
-    common_params.validation_path        = options.validation_path->value();
-    common_params.validation_range_start = validation_range.first;
-    common_params.validation_range_end   = validation_range.second;
-    common_params.tuner_file             = options.tuner_file->value();
+    common_params.enable_tuner             = options.enable_tuner->is_set() ? options.enable_tuner->value() : false;
+    common_params.enable_cl_cache          = common_params.target == arm_compute::graph::Target::CL ? (options.enable_cl_cache->is_set() ? options.enable_cl_cache->value() : true) : false;
+    common_params.enable_conv_method_tuner = options.enable_conv_method_tuner->is_set() ? options.enable_conv_method_tuner->value() : false;
+    common_params.pipelined                = options.pipelined->is_set() ? options.pipelined->value() : false;
+    common_params.pipeline_stages          = options.pipeline_stages->value();
+    common_params.tuner_mode               = options.tuner_mode->value();
+    common_params.fast_math_hint           = options.fast_math_hint->is_set() ? fast_math_hint_value : FastMathHint::Disabled;
+    common_params.data_path                = options.data_path->value();
+    common_params.image                    = options.image->value();
+    common_params.labels                   = options.labels->value();
+    common_params.validation_file          = options.validation_file->value();
+    common_params.validation_path          = options.validation_path->value();
+    common_params.validation_range_start   = validation_range.first;
+    common_params.validation_range_end     = validation_range.second;
+    common_params.tuner_file               = options.tuner_file->value();
+    common_params.plan_file                = options.plan_file->value();
 
     return common_params;
 }
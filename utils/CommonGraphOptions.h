@@ -100,6 +100,9 @@ struct CommonGraphParams
     arm_compute::DataLayout          data_layout{ DataLayout::NHWC };
     bool                             enable_tuner{ false };
     bool                             enable_cl_cache{ false };
+    bool                             enable_conv_method_tuner{ false };
+    bool                             pipelined{ false };
+    unsigned int                     pipeline_stages{ 1 };
     arm_compute::CLTunerMode         tuner_mode{ CLTunerMode::NORMAL };
     arm_compute::graph::FastMathHint fast_math_hint{ arm_compute::graph::FastMathHint::Disabled };
     std::string                      data_path{};
@@ -108,6 +111,7 @@ struct CommonGraphParams
     std::string                      validation_file{};
     std::string                      validation_path{};
     std::string                      tuner_file{};
+    std::string                      plan_file{};
     unsigned int                     validation_range_start{ 0 };
     unsigned int                     validation_range_end{ std::numeric_limits<unsigned int>::max() };
 };
@@ -149,22 +153,26 @@ public:
     /** Default destructor */
     ~CommonGraphOptions() = default;
 
-    ToggleOption                           *help;             /**< Show help option */
-    SimpleOption<int>                      *threads;          /**< Number of threads option */
-    EnumOption<arm_compute::graph::Target> *target;           /**< Graph execution target */
-    EnumOption<arm_compute::DataType>      *data_type;        /**< Graph data type */
-    EnumOption<arm_compute::DataLayout>    *data_layout;      /**< Graph data layout */
-    ToggleOption                           *enable_tuner;     /**< Enable tuner */
-    ToggleOption                           *enable_cl_cache;  /**< Enable opencl kernels cache */
-    SimpleOption<arm_compute::CLTunerMode> *tuner_mode;       /**< Tuner mode */
-    ToggleOption                           *fast_math_hint;   /**< Fast math hint */
-    SimpleOption<std::string>              *data_path;        /**< Trainable parameters path */
-    SimpleOption<std::string>              *image;            /**< Image */
-    SimpleOption<std::string>              *labels;           /**< Labels */
-    SimpleOption<std::string>              *validation_file;  /**< Validation file */
-    SimpleOption<std::string>              *validation_path;  /**< Validation data path */
-    SimpleOption<std::string>              *validation_range; /**< Validation range */
-    SimpleOption<std::string>              *tuner_file;       /**< File to load/store the tuner's values from */
+    ToggleOption                           *help;                     /**< Show help option */
+    SimpleOption<int>                      *threads;                  /**< Number of threads option */
+    EnumOption<arm_compute::graph::Target> *target;                   /**< Graph execution target */
+    EnumOption<arm_compute::DataType>      *data_type;                /**< Graph data type */
+    EnumOption<arm_compute::DataLayout>    *data_layout;              /**< Graph data layout */
+    ToggleOption                           *enable_tuner;             /**< Enable tuner */
+    ToggleOption                           *enable_cl_cache;          /**< Enable opencl kernels cache */
+    ToggleOption                           *enable_conv_method_tuner; /**< Enable the NEON convolution method tuner */
+    ToggleOption                           *pipelined;                /**< Pipelined streaming execution */
+    SimpleOption<unsigned int>             *pipeline_stages;          /**< Number of pipeline stages */
+    SimpleOption<arm_compute::CLTunerMode> *tuner_mode;               /**< Tuner mode */
+    ToggleOption                           *fast_math_hint;           /**< Fast math hint */
+    SimpleOption<std::string>              *data_path;                /**< Trainable parameters path */
+    SimpleOption<std::string>              *image;                    /**< Image */
+    SimpleOption<std::string>              *labels;                   /**< Labels */
+    SimpleOption<std::string>              *validation_file;          /**< Validation file */
+    SimpleOption<std::string>              *validation_path;          /**< Validation data path */
+    SimpleOption<std::string>              *validation_range;         /**< Validation range */
+    SimpleOption<std::string>              *tuner_file;               /**< File to load/store the tuner's values from */
+    SimpleOption<std::string>              *plan_file;                /**< File to load/store the execution plan from */
 };
 
 /** Consumes the common graph options and creates a structure containing any information
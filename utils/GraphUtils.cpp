@@ -36,6 +36,8 @@
 #include "utils/Utils.h"
 
 #include <inttypes.h>
+#include <algorithm>
+#include <cstring>
 #include <iomanip>
 #include <limits>
 
@@ -60,6 +62,36 @@ std::pair<arm_compute::TensorShape, arm_compute::PermutationVector> compute_perm
 
     return std::make_pair(permuted_shape, perm);
 }
+
+/** Calls a function on each row of the valid region of a tensor, along with the batch it belongs to and its offset in bytes in the batch
+ *
+ * The batches are the outermost dimension of the valid region.
+ */
+template <typename F>
+void copy_batches(arm_compute::ITensor &tensor, size_t num_batches, F &&copy_row)
+{
+    const arm_compute::ValidRegion valid_region = tensor.info()->valid_region();
+    const size_t                   row_size     = valid_region.shape[0] * tensor.info()->element_size();
+    const size_t                   total_size   = valid_region.shape.total_size() * tensor.info()->element_size();
+    const size_t                   batch_bytes  = total_size / std::max<size_t>(num_batches, 1);
+    ARM_COMPUTE_EXIT_ON_MSG(num_batches == 0 || batch_bytes * num_batches != total_size || batch_bytes % row_size != 0, "A buffer has to be given for each batch of the tensor!");
+
+    arm_compute::Window window;
+    for(size_t d = 0; d < valid_region.shape.num_dimensions(); ++d)
+    {
+        window.set(d, arm_compute::Window::Dimension(valid_region.start(d), valid_region.end(d)));
+    }
+    window.set(arm_compute::Window::DimX, arm_compute::Window::Dimension(valid_region.start(0), valid_region.start(0) + 1));
+    arm_compute::Iterator it(&tensor, window);
+
+    size_t offset = 0;
+    arm_compute::execute_window_loop(window, [&](const arm_compute::Coordinates &)
+    {
+        copy_row(it.ptr(), offset / batch_bytes, offset % batch_bytes, row_size);
+        offset += row_size;
+    },
+    it);
+}
 } // namespace
 
 TFPreproccessor::TFPreproccessor(float min_range, float max_range)
@@ -782,3 +814,41 @@ bool NumPyBinLoader::access_tensor(ITensor &tensor)
     _already_loaded = !_already_loaded;
     return _already_loaded;
 }
+
+BatchBufferInputAccessor::BatchBufferInputAccessor(std::shared_ptr<const std::vector<const void *>> buffers)
+    : _buffers(std::move(buffers))
+{
+}
+
+bool BatchBufferInputAccessor::access_tensor(ITensor &tensor)
+{
+    ARM_COMPUTE_EXIT_ON_MSG(_buffers == nullptr, "No vector of buffers!");
+    if(_buffers->empty())
+    {
+        return false;
+    }
+
+    const std::vector<const void *> &buffers = *_buffers;
+    copy_batches(tensor, buffers.size(), [&](uint8_t *row, size_t batch, size_t offset, size_t row_size)
+    {
+        std::memcpy(row, static_cast<const uint8_t *>(buffers[batch]) + offset, row_size);
+    });
+    return true;
+}
+
+BatchBufferOutputAccessor::BatchBufferOutputAccessor(std::shared_ptr<const std::vector<void *>> buffers)
+    : _buffers(std::move(buffers))
+{
+}
+
+bool BatchBufferOutputAccessor::access_tensor(ITensor &tensor)
+{
+    ARM_COMPUTE_EXIT_ON_MSG(_buffers == nullptr, "No vector of buffers!");
+
+    const std::vector<void *> &buffers = *_buffers;
+    copy_batches(tensor, buffers.size(), [&](uint8_t *row, size_t batch, size_t offset, size_t row_size)
+    {
+        std::memcpy(static_cast<uint8_t *>(buffers[batch]) + offset, row, row_size);
+    });
+    return false;
+}
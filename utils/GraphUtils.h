@@ -35,6 +35,7 @@
 #include "utils/CommonGraphOptions.h"
 
 #include <array>
+#include <memory>
 #include <random>
 #include <string>
 #include <vector>
@@ -449,6 +450,54 @@ private:
     const DataLayout  _file_layout;
 };
 
+/** Input accessor copying a buffer into each batch of the tensor
+ *
+ * @note The buffers have to be set before each execution, one for each batch of the valid region of the tensor. No buffer stops the execution.
+ */
+class BatchBufferInputAccessor final : public graph::ITensorAccessor
+{
+public:
+    /** Constructor
+     *
+     * @note The vector of buffers is shared with the caller and read at each execution, so it can be refilled between executions.
+     *
+     * @param[in] buffers Buffers holding a batch each, in the logical order of the elements
+     */
+    BatchBufferInputAccessor(std::shared_ptr<const std::vector<const void *>> buffers);
+    /** Allows instances to move constructed */
+    BatchBufferInputAccessor(BatchBufferInputAccessor &&) = default;
+
+    // Inherited methods overriden:
+    bool access_tensor(ITensor &tensor) override;
+
+private:
+    std::shared_ptr<const std::vector<const void *>> _buffers;
+};
+
+/** Output accessor copying each batch of the tensor to a buffer
+ *
+ * @note The execution stops after each batch, so that a new batch can be submitted to the next one.
+ */
+class BatchBufferOutputAccessor final : public graph::ITensorAccessor
+{
+public:
+    /** Constructor
+     *
+     * @note The vector of buffers is shared with the caller and read at each execution, so it can be refilled between executions.
+     *
+     * @param[in] buffers Buffers receiving a batch each of the valid region of the tensor, in the logical order of the elements
+     */
+    BatchBufferOutputAccessor(std::shared_ptr<const std::vector<void *>> buffers);
+    /** Allows instances to move constructed */
+    BatchBufferOutputAccessor(BatchBufferOutputAccessor &&) = default;
+
+    // Inherited methods overriden:
+    bool access_tensor(ITensor &tensor) override;
+
+private:
+    std::shared_ptr<const std::vector<void *>> _buffers;
+};
+
 /** Generates appropriate random accessor
  *
  * @param[in] lower Lower random values bound